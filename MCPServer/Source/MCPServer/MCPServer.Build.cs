@@ -12,6 +12,7 @@ public class MCPServer : ModuleRules
 		{
 			"Core",
 			"CoreUObject",
+			"DeveloperSettings",
 			"Engine",
 			"HTTPServer",
 			"Json",
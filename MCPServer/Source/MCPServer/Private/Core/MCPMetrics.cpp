@@ -0,0 +1,248 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/MCPMetrics.h"
+#include "HAL/PlatformTime.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/ScopeLock.h"
+
+void FMCPHistogram::Record(uint64 Value)
+{
+	const int32 Index = GetBucketIndex(Value);
+	if (Index >= Buckets.Num())
+	{
+		Buckets.SetNumZeroed(Index + 1);
+	}
+	Buckets[Index]++;
+	Count++;
+	Sum += Value;
+	Max = FMath::Max(Max, Value);
+}
+
+uint64 FMCPHistogram::GetPercentile(double Quantile) const
+{
+	if (Count == 0)
+	{
+		return 0;
+	}
+
+	const int64 Target = FMath::Clamp<int64>(FMath::CeilToInt64(Quantile * Count), 1, Count);
+	int64 Seen = 0;
+	for (int32 Index = 0; Index < Buckets.Num(); ++Index)
+	{
+		Seen += Buckets[Index];
+		if (Seen == Count)
+		{
+			// The highest bucket is represented by the exact maximum
+			return Max;
+		}
+		if (Seen >= Target)
+		{
+			return FMath::Min(GetBucketValue(Index), Max);
+		}
+	}
+	return Max;
+}
+
+double FMCPHistogram::GetMean() const
+{
+	return Count > 0 ? static_cast<double>(Sum) / Count : 0.0;
+}
+
+int32 FMCPHistogram::GetBucketIndex(uint64 Value)
+{
+	if (Value < LinearCount)
+	{
+		return static_cast<int32>(Value);
+	}
+
+	// Keep the top LinearBits - 1 bits below the leading one
+	const int32 Shift = static_cast<int32>(FMath::FloorLog2_64(Value)) - (LinearBits - 1);
+	const int32 SubBucket = static_cast<int32>(Value >> Shift) - SubBucketCount;
+	return LinearCount + (Shift - 1) * SubBucketCount + SubBucket;
+}
+
+uint64 FMCPHistogram::GetBucketValue(int32 Index)
+{
+	if (Index < LinearCount)
+	{
+		return static_cast<uint64>(Index);
+	}
+
+	const int32 Offset = Index - LinearCount;
+	const int32 Shift = Offset / SubBucketCount + 1;
+	const uint64 Lower = static_cast<uint64>(Offset % SubBucketCount + SubBucketCount) << Shift;
+	return Lower + ((uint64(1) << Shift) >> 1);
+}
+
+namespace MCPMetricsPrivate
+{
+	uint64 ToMicros(double Seconds)
+	{
+		return static_cast<uint64>(FMath::Max(0.0, Seconds) * 1000000.0);
+	}
+
+	FString EscapeLabelValue(const FString& Value)
+	{
+		return Value.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\"")).Replace(TEXT("\n"), TEXT("\\n"));
+	}
+
+	void AppendCounter(
+		FString& Out,
+		const TCHAR* Name,
+		const TCHAR* Help,
+		const TCHAR* Label,
+		const TMap<FString, FMCPMetricSeries>& Series,
+		int64 FMCPMetricSeries::* Counter)
+	{
+		Out += FString::Printf(TEXT("# HELP %s %s\n# TYPE %s counter\n"), Name, Help, Name);
+		for (const auto& Pair : Series)
+		{
+			Out += FString::Printf(TEXT("%s{%s=\"%s\"} %lld\n"), Name, Label, *EscapeLabelValue(Pair.Key), Pair.Value.*Counter);
+		}
+	}
+
+	/** Histograms are exported as summaries with precomputed quantiles; Scale converts recorded units to the exported ones */
+	void AppendSummary(
+		FString& Out,
+		const TCHAR* Name,
+		const TCHAR* Help,
+		const TCHAR* Label,
+		const TMap<FString, FMCPMetricSeries>& Series,
+		FMCPHistogram FMCPMetricSeries::* Histogram,
+		double Scale)
+	{
+		static const TCHAR* QuantileNames[] = { TEXT("0.5"), TEXT("0.95"), TEXT("0.99") };
+		static const double Quantiles[] = { 0.5, 0.95, 0.99 };
+
+		Out += FString::Printf(TEXT("# HELP %s %s\n# TYPE %s summary\n"), Name, Help, Name);
+		for (const auto& Pair : Series)
+		{
+			const FMCPHistogram& Values = Pair.Value.*Histogram;
+			if (Values.GetCount() == 0)
+			{
+				continue;
+			}
+
+			const FString LabelValue = EscapeLabelValue(Pair.Key);
+			for (int32 QuantileIndex = 0; QuantileIndex < UE_ARRAY_COUNT(Quantiles); ++QuantileIndex)
+			{
+				Out += FString::Printf(TEXT("%s{%s=\"%s\",quantile=\"%s\"} %.9g\n"), Name, Label, *LabelValue,
+					QuantileNames[QuantileIndex], Values.GetPercentile(Quantiles[QuantileIndex]) * Scale);
+			}
+			Out += FString::Printf(TEXT("%s_sum{%s=\"%s\"} %.9g\n"), Name, Label, *LabelValue, Values.GetSum() * Scale);
+			Out += FString::Printf(TEXT("%s_count{%s=\"%s\"} %lld\n"), Name, Label, *LabelValue, Values.GetCount());
+		}
+	}
+}
+
+FMCPMetrics::FMCPMetrics()
+	: CollectingSince(FPlatformTime::Seconds())
+{
+}
+
+void FMCPMetrics::RecordToolCall(const FString& ToolName, double ExecuteSeconds, double QueueWaitSeconds, bool bError)
+{
+	using namespace MCPMetricsPrivate;
+
+	FScopeLock Lock(&MetricsLock);
+	FMCPMetricSeries& Series = ToolSeries.FindOrAdd(ToolName);
+	Series.Calls++;
+	Series.Errors += bError ? 1 : 0;
+	Series.LatencyMicros.Record(ToMicros(ExecuteSeconds));
+
+	if (QueueWaitSeconds >= 0.0)
+	{
+		Series.QueueWaitMicros.Record(ToMicros(QueueWaitSeconds));
+		MethodSeries.FindOrAdd(TEXT("tools/call")).QueueWaitMicros.Record(ToMicros(QueueWaitSeconds));
+	}
+}
+
+void FMCPMetrics::RecordToolBytes(const FString& ToolName, int64 RequestBytes, int64 ResponseBytes)
+{
+	FScopeLock Lock(&MetricsLock);
+	FMCPMetricSeries& Series = ToolSeries.FindOrAdd(ToolName);
+	Series.RequestBytes.Record(static_cast<uint64>(FMath::Max<int64>(0, RequestBytes)));
+	Series.ResponseBytes.Record(static_cast<uint64>(FMath::Max<int64>(0, ResponseBytes)));
+}
+
+void FMCPMetrics::RecordMethodCall(const FString& Method, double LatencySeconds, bool bError, int64 RequestBytes, int64 ResponseBytes)
+{
+	FScopeLock Lock(&MetricsLock);
+	FMCPMetricSeries& Series = MethodSeries.FindOrAdd(Method);
+	Series.Calls++;
+	Series.Errors += bError ? 1 : 0;
+	Series.LatencyMicros.Record(MCPMetricsPrivate::ToMicros(LatencySeconds));
+
+	if (RequestBytes >= 0)
+	{
+		Series.RequestBytes.Record(static_cast<uint64>(RequestBytes));
+	}
+	if (ResponseBytes >= 0)
+	{
+		Series.ResponseBytes.Record(static_cast<uint64>(ResponseBytes));
+	}
+}
+
+TMap<FString, FMCPMetricSeries> FMCPMetrics::GetToolSeries() const
+{
+	FScopeLock Lock(&MetricsLock);
+	return ToolSeries;
+}
+
+TMap<FString, FMCPMetricSeries> FMCPMetrics::GetMethodSeries() const
+{
+	FScopeLock Lock(&MetricsLock);
+	return MethodSeries;
+}
+
+double FMCPMetrics::GetCollectionSeconds() const
+{
+	FScopeLock Lock(&MetricsLock);
+	return FPlatformTime::Seconds() - CollectingSince;
+}
+
+void FMCPMetrics::Reset()
+{
+	FScopeLock Lock(&MetricsLock);
+	ToolSeries.Empty();
+	MethodSeries.Empty();
+	CollectingSince = FPlatformTime::Seconds();
+}
+
+FString FMCPMetrics::ExportPrometheus() const
+{
+	using namespace MCPMetricsPrivate;
+
+	// Copy under the lock, format outside it
+	TMap<FString, FMCPMetricSeries> Tools;
+	TMap<FString, FMCPMetricSeries> Methods;
+	{
+		FScopeLock Lock(&MetricsLock);
+		Tools = ToolSeries;
+		Methods = MethodSeries;
+	}
+	Tools.KeySort(TLess<FString>());
+	Methods.KeySort(TLess<FString>());
+
+	FString Out;
+	AppendCounter(Out, TEXT("mcp_method_calls_total"), TEXT("JSON-RPC messages answered."), TEXT("method"), Methods, &FMCPMetricSeries::Calls);
+	AppendCounter(Out, TEXT("mcp_method_errors_total"), TEXT("JSON-RPC messages answered with an error."), TEXT("method"), Methods, &FMCPMetricSeries::Errors);
+	AppendSummary(Out, TEXT("mcp_method_duration_seconds"), TEXT("Time from request body to response."), TEXT("method"), Methods, &FMCPMetricSeries::LatencyMicros, 1e-6);
+	AppendSummary(Out, TEXT("mcp_method_queue_wait_seconds"), TEXT("Time calls waited in the tool call queue."), TEXT("method"), Methods, &FMCPMetricSeries::QueueWaitMicros, 1e-6);
+	AppendSummary(Out, TEXT("mcp_method_request_bytes"), TEXT("Request body size."), TEXT("method"), Methods, &FMCPMetricSeries::RequestBytes, 1.0);
+	AppendSummary(Out, TEXT("mcp_method_response_bytes"), TEXT("Uncompressed response body size."), TEXT("method"), Methods, &FMCPMetricSeries::ResponseBytes, 1.0);
+
+	AppendCounter(Out, TEXT("mcp_tool_calls_total"), TEXT("Tool executions."), TEXT("tool"), Tools, &FMCPMetricSeries::Calls);
+	AppendCounter(Out, TEXT("mcp_tool_errors_total"), TEXT("Tool executions that returned an error."), TEXT("tool"), Tools, &FMCPMetricSeries::Errors);
+	AppendSummary(Out, TEXT("mcp_tool_duration_seconds"), TEXT("Tool execution time."), TEXT("tool"), Tools, &FMCPMetricSeries::LatencyMicros, 1e-6);
+	AppendSummary(Out, TEXT("mcp_tool_queue_wait_seconds"), TEXT("Time calls waited in the tool call queue."), TEXT("tool"), Tools, &FMCPMetricSeries::QueueWaitMicros, 1e-6);
+	AppendSummary(Out, TEXT("mcp_tool_request_bytes"), TEXT("tools/call request body size."), TEXT("tool"), Tools, &FMCPMetricSeries::RequestBytes, 1.0);
+	AppendSummary(Out, TEXT("mcp_tool_response_bytes"), TEXT("Uncompressed tools/call response body size."), TEXT("tool"), Tools, &FMCPMetricSeries::ResponseBytes, 1.0);
+	return Out;
+}
+
+bool FMCPMetrics::IsToolError(const TSharedPtr<FJsonObject>& ToolResult)
+{
+	bool bIsError = false;
+	return !ToolResult.IsValid() || (ToolResult->TryGetBoolField(TEXT("isError"), bIsError) && bIsError);
+}
@@ -1,8 +1,12 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Core/MCPServerModule.h"
+#include "Core/MCPServerSettings.h"
+#include "Core/MCPMetrics.h"
 #include "Tools/MCPToolRegistry.h"
+#include "Tools/MCPToolCallQueue.h"
 #include "Protocol/MCPSessionManager.h"
+#include "Protocol/MCPRateLimiter.h"
 #include "Protocol/MCPJsonRpc.h"
 #include "Protocol/MCPHttpServer.h"
 
@@ -12,21 +16,28 @@
 #include "Tools/Impl/BatchSetActorPropertiesImplTool.h"
 #include "Tools/Impl/BatchSetMaterialExpressionPropertiesImplTool.h"
 #include "Tools/Impl/BatchConnectMaterialExpressionsImplTool.h"
+#include "Tools/Impl/RunPipelineImplTool.h"
 #include "Tools/Impl/HelloWorldImplTool.h"
 #include "Tools/Impl/SpawnActorImplTool.h"
+#include "Tools/Impl/SpawnActorsBatchImplTool.h"
 #include "Tools/Impl/DeleteActorImplTool.h"
 #include "Tools/Impl/DuplicateActorImplTool.h"
 #include "Tools/Impl/GetActorsInLevelImplTool.h"
+#include "Tools/Impl/QueryActorsSpatialImplTool.h"
+#include "Tools/Impl/GetLevelChangesImplTool.h"
 #include "Tools/Impl/SelectActorImplTool.h"
 #include "Tools/Impl/DeselectAllImplTool.h"
 #include "Tools/Impl/GetActorTransformImplTool.h"
 #include "Tools/Impl/SetActorTransformImplTool.h"
 #include "Tools/Impl/GetActorPropertyImplTool.h"
+#include "Tools/Impl/GetActorPropertiesBulkImplTool.h"
 #include "Tools/Impl/SetActorPropertyImplTool.h"
 #include "Tools/Impl/ConvertActorImplTool.h"
 #include "Tools/Impl/MoveActorsToLevelImplTool.h"
 #include "Tools/Impl/GroupActorsImplTool.h"
 #include "Tools/Impl/SetActorFolderImplTool.h"
+#include "Tools/Impl/MergeToInstancesImplTool.h"
+#include "Tools/Impl/ExplodeInstancesImplTool.h"
 #include "Tools/Impl/NewLevelImplTool.h"
 #include "Tools/Impl/NewLevelFromTemplateImplTool.h"
 #include "Tools/Impl/LoadLevelImplTool.h"
@@ -53,6 +64,9 @@
 #include "Tools/Impl/SetAssetPropertyImplTool.h"
 #include "Tools/Impl/GetAssetPropertyImplTool.h"
 #include "Tools/Impl/FindReferencersOfClassImplTool.h"
+#include "Tools/Impl/GetAssetCacheStatsImplTool.h"
+#include "Tools/Impl/GetQueueStatsImplTool.h"
+#include "Tools/Impl/GetServerStatsImplTool.h"
 #include "Tools/Impl/GetViewportCameraImplTool.h"
 #include "Tools/Impl/SetViewportCameraImplTool.h"
 #include "Tools/Impl/SetGameViewImplTool.h"
@@ -208,6 +222,8 @@
 #include "Tools/Impl/ImportWidgetsImplTool.h"
 
 // Modules
+#include "Modules/Impl/AssetCacheImplModule.h"
+#include "Modules/Impl/EditorBatchImplModule.h"
 #include "Modules/Impl/ActorImplModule.h"
 #include "Modules/Impl/LevelImplModule.h"
 #include "Modules/Impl/AssetImplModule.h"
@@ -242,17 +258,19 @@ FMCPServerModule& FMCPServerModule::Get()
 void FMCPServerModule::StartupModule()
 {
 	// Create layers bottom-up: Modules -> Tools -> Protocol -> HTTP
-	ActorModule = MakeUnique<FActorImplModule>();
+	AssetCacheModule = MakeUnique<FAssetCacheImplModule>();
+	EditorBatchModule = MakeUnique<FEditorBatchImplModule>();
+	ActorModule = MakeUnique<FActorImplModule>(*EditorBatchModule);
 	LevelModule = MakeUnique<FLevelImplModule>();
 	AssetModule = MakeUnique<FAssetImplModule>();
 	ViewportModule = MakeUnique<FViewportImplModule>(*ActorModule);
-	BlueprintModule = MakeUnique<FBlueprintImplModule>(*ActorModule);
-	MaterialModule = MakeUnique<FMaterialImplModule>();
-	StaticMeshModule = MakeUnique<FStaticMeshImplModule>();
-	SkeletalMeshModule = MakeUnique<FSkeletalMeshImplModule>();
+	BlueprintModule = MakeUnique<FBlueprintImplModule>(*ActorModule, *AssetCacheModule, *EditorBatchModule);
+	MaterialModule = MakeUnique<FMaterialImplModule>(*AssetCacheModule, *EditorBatchModule);
+	StaticMeshModule = MakeUnique<FStaticMeshImplModule>(*AssetCacheModule);
+	SkeletalMeshModule = MakeUnique<FSkeletalMeshImplModule>(*AssetCacheModule);
 	SequencerModule = MakeUnique<FSequencerToolImplModule>();
 	LandscapeModule = MakeUnique<FLandscapeToolImplModule>();
-	FoliageModule = MakeUnique<FFoliageImplModule>();
+	FoliageModule = MakeUnique<FFoliageImplModule>(*AssetCacheModule);
 	NavigationModule = MakeUnique<FNavigationImplModule>();
 	PhysicsModule = MakeUnique<FPhysicsImplModule>(*ActorModule);
 	BuildModule = MakeUnique<FBuildImplModule>();
@@ -262,14 +280,33 @@ void FMCPServerModule::StartupModule()
 	UIModule = MakeUnique<FUIImplModule>();
 	WorldPartitionModule = MakeUnique<FWorldPartitionImplModule>();
 	PIEModule = MakeUnique<FPIEImplModule>();
-	UMGModule = MakeUnique<FUMGImplModule>();
+	UMGModule = MakeUnique<FUMGImplModule>(*AssetCacheModule);
+
+	const UMCPServerSettings* Settings = GetDefault<UMCPServerSettings>();
+
+	FMCPRateLimits RateLimits;
+	const FMCPToolLaneSettings* LaneSettings[] = { &Settings->InteractiveLane, &Settings->BulkLane, &Settings->BuildLane };
+	static_assert(UE_ARRAY_COUNT(LaneSettings) == static_cast<int32>(EMCPToolPriority::Num), "One settings entry per tool lane");
+	for (int32 LaneIndex = 0; LaneIndex < UE_ARRAY_COUNT(LaneSettings); ++LaneIndex)
+	{
+		RateLimits.Lanes[LaneIndex].CallsPerSecond = LaneSettings[LaneIndex]->CallsPerSecond;
+		RateLimits.Lanes[LaneIndex].Burst = LaneSettings[LaneIndex]->Burst;
+		RateLimits.Lanes[LaneIndex].MaxQueuedCalls = LaneSettings[LaneIndex]->MaxQueuedCalls;
+	}
+	RateLimiter = MakeUnique<FMCPRateLimiter>(RateLimits);
+	Metrics = MakeUnique<FMCPMetrics>();
 
 	ToolRegistry = MakeUnique<FMCPToolRegistry>();
+	ToolCallQueue = MakeUnique<FMCPToolCallQueue>(*ToolRegistry, Metrics.Get());
 	RegisterBuiltinTools();
+	ToolCallQueue->Start();
 
-	SessionManager = MakeUnique<FMCPSessionManager>();
-	JsonRpc = MakeUnique<FMCPJsonRpc>(*ToolRegistry, *SessionManager);
-	HttpServer = MakeUnique<FMCPHttpServer>(*JsonRpc, *SessionManager);
+	FMCPSessionLimits SessionLimits;
+	SessionLimits.IdleTimeoutSeconds = Settings->SessionIdleTimeoutSeconds;
+	SessionLimits.MaxSessions = Settings->MaxSessions;
+	SessionManager = MakeUnique<FMCPSessionManager>(SessionLimits);
+	JsonRpc = MakeUnique<FMCPJsonRpc>(*ToolRegistry, *SessionManager, ToolCallQueue.Get(), RateLimiter.Get(), Metrics.Get());
+	HttpServer = MakeUnique<FMCPHttpServer>(*JsonRpc, *SessionManager, Metrics.Get());
 
 	HttpServer->Start(ServerPort);
 
@@ -283,9 +320,17 @@ void FMCPServerModule::ShutdownModule()
 		HttpServer->Stop();
 	}
 
+	if (ToolCallQueue.IsValid())
+	{
+		ToolCallQueue->Stop();
+	}
+
 	HttpServer.Reset();
 	JsonRpc.Reset();
 	SessionManager.Reset();
+	ToolCallQueue.Reset();
+	RateLimiter.Reset();
+	Metrics.Reset();
 	ToolRegistry.Reset();
 	UMGModule.Reset();
 	PIEModule.Reset();
@@ -308,6 +353,8 @@ void FMCPServerModule::ShutdownModule()
 	AssetModule.Reset();
 	LevelModule.Reset();
 	ActorModule.Reset();
+	EditorBatchModule.Reset();
+	AssetCacheModule.Reset();
 
 	UE_LOG(LogMCPServer, Log, TEXT("MCP Server plugin shut down"));
 }
@@ -321,19 +368,25 @@ void FMCPServerModule::RegisterBuiltinTools()
 {
 	ToolRegistry->RegisterTool(MakeShared<FHelloWorldImplTool>());
 	ToolRegistry->RegisterTool(MakeShared<FSpawnActorImplTool>(*ActorModule));
+	ToolRegistry->RegisterTool(MakeShared<FSpawnActorsBatchImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FDeleteActorImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FDuplicateActorImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FGetActorsInLevelImplTool>(*ActorModule));
+	ToolRegistry->RegisterTool(MakeShared<FQueryActorsSpatialImplTool>(*ActorModule));
+	ToolRegistry->RegisterTool(MakeShared<FGetLevelChangesImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FSelectActorImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FDeselectAllImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FGetActorTransformImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FSetActorTransformImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FGetActorPropertyImplTool>(*ActorModule));
+	ToolRegistry->RegisterTool(MakeShared<FGetActorPropertiesBulkImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FSetActorPropertyImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FConvertActorImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FMoveActorsToLevelImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FGroupActorsImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FSetActorFolderImplTool>(*ActorModule));
+	ToolRegistry->RegisterTool(MakeShared<FMergeToInstancesImplTool>(*ActorModule));
+	ToolRegistry->RegisterTool(MakeShared<FExplodeInstancesImplTool>(*ActorModule));
 
 	// Level management tools
 	ToolRegistry->RegisterTool(MakeShared<FNewLevelImplTool>(*LevelModule));
@@ -364,6 +417,9 @@ void FMCPServerModule::RegisterBuiltinTools()
 	ToolRegistry->RegisterTool(MakeShared<FSetAssetPropertyImplTool>(*AssetModule));
 	ToolRegistry->RegisterTool(MakeShared<FGetAssetPropertyImplTool>(*AssetModule));
 	ToolRegistry->RegisterTool(MakeShared<FFindReferencersOfClassImplTool>(*AssetModule));
+	ToolRegistry->RegisterTool(MakeShared<FGetAssetCacheStatsImplTool>(*AssetCacheModule));
+	ToolRegistry->RegisterTool(MakeShared<FGetQueueStatsImplTool>(*ToolCallQueue, *RateLimiter));
+	ToolRegistry->RegisterTool(MakeShared<FGetServerStatsImplTool>(*Metrics));
 
 	// Viewport and camera tools
 	ToolRegistry->RegisterTool(MakeShared<FGetViewportCameraImplTool>(*ViewportModule));
@@ -566,6 +622,9 @@ void FMCPServerModule::RegisterBuiltinTools()
 	ToolRegistry->RegisterTool(MakeShared<FBatchSetActorPropertiesImplTool>(*ActorModule));
 	ToolRegistry->RegisterTool(MakeShared<FBatchSetMaterialExpressionPropertiesImplTool>(*MaterialModule));
 	ToolRegistry->RegisterTool(MakeShared<FBatchConnectMaterialExpressionsImplTool>(*MaterialModule));
+
+	// Pipeline tool (dispatches to the other registered tools)
+	ToolRegistry->RegisterTool(MakeShared<FRunPipelineImplTool>(*ToolRegistry));
 }
 
 #undef LOCTEXT_NAMESPACE
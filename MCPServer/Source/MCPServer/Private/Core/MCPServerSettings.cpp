@@ -0,0 +1,23 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/MCPServerSettings.h"
+
+UMCPServerSettings::UMCPServerSettings()
+{
+	InteractiveLane.CallsPerSecond = 20.0f;
+	InteractiveLane.Burst = 40.0f;
+	InteractiveLane.MaxQueuedCalls = 256;
+
+	BulkLane.CallsPerSecond = 2.0f;
+	BulkLane.Burst = 8.0f;
+	BulkLane.MaxQueuedCalls = 32;
+
+	BuildLane.CallsPerSecond = 0.1f;
+	BuildLane.Burst = 2.0f;
+	BuildLane.MaxQueuedCalls = 2;
+}
+
+FName UMCPServerSettings::GetCategoryName() const
+{
+	return TEXT("Plugins");
+}
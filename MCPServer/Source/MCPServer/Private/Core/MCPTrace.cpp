@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/MCPTrace.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryWriter.h"
+
+UE_TRACE_CHANNEL_DEFINE(MCPChannel)
+
+UE_TRACE_EVENT_BEGIN(MCP, ScopeMetadata)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+	UE_TRACE_EVENT_FIELD(int64, ArgumentBytes)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Scope)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, SessionId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ToolName)
+UE_TRACE_EVENT_END()
+
+namespace MCPTracePrivate
+{
+	thread_local FString CurrentSessionId;
+}
+
+bool MCPTrace::IsEnabled()
+{
+	return UE_TRACE_CHANNELEXPR_IS_ENABLED(MCPChannel);
+}
+
+const FString& MCPTrace::GetSessionId()
+{
+	return MCPTracePrivate::CurrentSessionId;
+}
+
+void MCPTrace::TraceScopeMetadata(const TCHAR* ScopeName, const FString& ToolName, int64 ArgumentBytes)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	const FString& SessionId = MCPTracePrivate::CurrentSessionId;
+	UE_TRACE_LOG(MCP, ScopeMetadata, MCPChannel)
+		<< ScopeMetadata.Cycle(FPlatformTime::Cycles64())
+		<< ScopeMetadata.ThreadId(FPlatformTLS::GetCurrentThreadId())
+		<< ScopeMetadata.ArgumentBytes(ArgumentBytes)
+		<< ScopeMetadata.Scope(ScopeName, FCString::Strlen(ScopeName))
+		<< ScopeMetadata.SessionId(*SessionId, SessionId.Len())
+		<< ScopeMetadata.ToolName(*ToolName, ToolName.Len());
+}
+
+void MCPTrace::TraceScopeMetadata(const TCHAR* ScopeName, const FString& ToolName, const TSharedPtr<FJsonObject>& Arguments)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	int64 ArgumentBytes = 0;
+	if (Arguments.IsValid())
+	{
+		TArray<uint8> Utf8;
+		FMemoryWriter Archive(Utf8);
+		TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> Writer =
+			TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Archive);
+		FJsonSerializer::Serialize(Arguments.ToSharedRef(), Writer);
+		ArgumentBytes = Utf8.Num();
+	}
+	TraceScopeMetadata(ScopeName, ToolName, ArgumentBytes);
+}
+
+FMCPTraceSessionScope::FMCPTraceSessionScope(const FString& SessionId)
+{
+	// Nothing reads the session while the channel is off, so skip the string copies
+	if (MCPTrace::IsEnabled())
+	{
+		bActive = true;
+		PreviousSessionId = MoveTemp(MCPTracePrivate::CurrentSessionId);
+		MCPTracePrivate::CurrentSessionId = SessionId;
+	}
+}
+
+FMCPTraceSessionScope::~FMCPTraceSessionScope()
+{
+	if (bActive)
+	{
+		MCPTracePrivate::CurrentSessionId = MoveTemp(PreviousSessionId);
+	}
+}
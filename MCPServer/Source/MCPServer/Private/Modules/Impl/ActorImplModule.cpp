@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/ActorImplModule.h"
+#include "Core/MCPTrace.h"
+#include "Modules/Interfaces/IEditorBatchModule.h"
 #include "Editor.h"
 #include "Subsystems/EditorActorSubsystem.h"
 #include "Engine/World.h"
@@ -11,32 +13,369 @@
 #include "Engine/LevelStreaming.h"
 #include "ActorGroupingUtils.h"
 #include "Editor/GroupActor.h"
+#include "Engine/Engine.h"
+#include "Misc/CoreDelegates.h"
+#include "ConvexVolume.h"
+#include "Misc/TransactionObjectEvent.h"
+#include "Algo/BinarySearch.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
+#include "Selection.h"
+
+namespace ActorImplHelpers
+{
+	/** Starting half-size of the box searched by nearest-neighbour queries */
+	static constexpr double NearestInitialRadius = 1000.0;
+
+	/** Factor the nearest-neighbour search box grows by when it holds too few actors */
+	static constexpr double NearestGrowthFactor = 4.0;
+
+	/** Journal length at which the oldest half of the change history is dropped */
+	static constexpr int32 MaxJournalLength = 200000;
+
+	static bool ParseChangeToken(const FString& Token, FGuid& OutJournalId, uint64& OutSequence)
+	{
+		FString IdPart;
+		FString SequencePart;
+		if (!Token.Split(TEXT(":"), &IdPart, &SequencePart) || SequencePart.IsEmpty() || !SequencePart.IsNumeric())
+		{
+			return false;
+		}
+		OutSequence = FCString::Strtoui64(*SequencePart, nullptr, 10);
+		return FGuid::Parse(IdPart, OutJournalId);
+	}
+
+	static double DistanceToBounds(const FBoxCenterAndExtent& Bounds, const FVector& Point)
+	{
+		return FMath::Sqrt(Bounds.GetBox().ComputeSquaredDistanceToPoint(Point));
+	}
+
+	/** Build a view frustum from outward-facing planes, as FConvexVolume::IntersectBox expects */
+	static FConvexVolume MakeFrustum(const FActorSpatialQuery& Query)
+	{
+		const FRotationMatrix Axes(Query.Rotation);
+		const FVector Forward = Axes.GetScaledAxis(EAxis::X);
+		const FVector Right = Axes.GetScaledAxis(EAxis::Y);
+		const FVector Up = Axes.GetScaledAxis(EAxis::Z);
+
+		const double HalfHorizontal = FMath::DegreesToRadians(Query.FieldOfView * 0.5);
+		const double HalfVertical = FMath::Atan(FMath::Tan(HalfHorizontal) / Query.AspectRatio);
+		const double CosH = FMath::Cos(HalfHorizontal);
+		const double SinH = FMath::Sin(HalfHorizontal);
+		const double CosV = FMath::Cos(HalfVertical);
+		const double SinV = FMath::Sin(HalfVertical);
+
+		TArray<FPlane> Planes;
+		Planes.Add(FPlane(Query.Origin, Right * CosH - Forward * SinH));
+		Planes.Add(FPlane(Query.Origin, -Right * CosH - Forward * SinH));
+		Planes.Add(FPlane(Query.Origin, Up * CosV - Forward * SinV));
+		Planes.Add(FPlane(Query.Origin, -Up * CosV - Forward * SinV));
+		Planes.Add(FPlane(Query.Origin + Forward * Query.NearDistance, -Forward));
+		Planes.Add(FPlane(Query.Origin + Forward * Query.FarDistance, Forward));
+		return FConvexVolume(Planes);
+	}
+
+	/** One hop of a property path; object references are followed into the referenced object */
+	struct FPropertyPathStep
+	{
+		FProperty* Property = nullptr;
+		FObjectPropertyBase* ObjectProperty = nullptr;
+	};
+
+	/**
+	 * Resolve a property path against a class. Object hops resolve against the declared class of the reference.
+	 * Returns an empty chain if any segment is not found.
+	 */
+	static TArray<FPropertyPathStep> ResolvePropertyPath(UStruct* Struct, const TArray<FString>& Segments)
+	{
+		TArray<FPropertyPathStep> Chain;
+		for (const FString& Segment : Segments)
+		{
+			const FName PropertyName(*Segment, FNAME_Find);
+			FProperty* Property = Struct && !PropertyName.IsNone() ? FindFProperty<FProperty>(Struct, PropertyName) : nullptr;
+			if (!Property)
+			{
+				return TArray<FPropertyPathStep>();
+			}
+
+			FPropertyPathStep& Step = Chain.AddDefaulted_GetRef();
+			Step.Property = Property;
+			Struct = nullptr;
+			if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				Struct = StructProperty->Struct;
+			}
+			else if (FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+			{
+				Step.ObjectProperty = ObjectProperty;
+				Struct = ObjectProperty->PropertyClass;
+			}
+		}
+		return Chain;
+	}
+
+	/** Export the value at the end of a resolved chain. Returns false if a reference along the way is null. */
+	static bool ExportPropertyPath(const TArray<FPropertyPathStep>& Chain, UObject* Object, FString& OutValue)
+	{
+		UObject* Owner = Object;
+		const void* Container = Object;
+		for (int32 StepIndex = 0; StepIndex < Chain.Num(); ++StepIndex)
+		{
+			const FPropertyPathStep& Step = Chain[StepIndex];
+			const void* ValuePtr = Step.Property->ContainerPtrToValuePtr<void>(Container);
+			if (StepIndex == Chain.Num() - 1)
+			{
+				Step.Property->ExportTextItem_Direct(OutValue, ValuePtr, nullptr, Owner, PPF_None);
+				return true;
+			}
+
+			if (Step.ObjectProperty)
+			{
+				UObject* Referenced = Step.ObjectProperty->GetObjectPropertyValue(ValuePtr);
+				if (!Referenced)
+				{
+					return false;
+				}
+				Owner = Referenced;
+				Container = Referenced;
+			}
+			else
+			{
+				Container = ValuePtr;
+			}
+		}
+		return false;
+	}
+
+	/** Static mesh actors share one instanced component only if all of these match */
+	struct FInstanceMergeKey
+	{
+		ULevel* Level = nullptr;
+		FName FolderPath;
+		UStaticMesh* Mesh = nullptr;
+		TArray<UMaterialInterface*> Materials;
+		EComponentMobility::Type Mobility = EComponentMobility::Static;
+		FName CollisionProfile;
+		ECollisionEnabled::Type CollisionEnabled = ECollisionEnabled::NoCollision;
+		bool bCastShadow = true;
+
+		bool operator==(const FInstanceMergeKey& Other) const
+		{
+			return Level == Other.Level && FolderPath == Other.FolderPath && Mesh == Other.Mesh
+				&& Materials == Other.Materials && Mobility == Other.Mobility && CollisionProfile == Other.CollisionProfile
+				&& CollisionEnabled == Other.CollisionEnabled && bCastShadow == Other.bCastShadow;
+		}
+
+		friend uint32 GetTypeHash(const FInstanceMergeKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.Level), GetTypeHash(Key.FolderPath));
+			Hash = HashCombine(Hash, GetTypeHash(Key.Mesh));
+			for (const UMaterialInterface* Material : Key.Materials)
+			{
+				Hash = HashCombine(Hash, GetTypeHash(Material));
+			}
+			return Hash;
+		}
+	};
+
+	static FInstanceMergeKey MakeInstanceMergeKey(const AStaticMeshActor* Actor)
+	{
+		const UStaticMeshComponent* Component = Actor->GetStaticMeshComponent();
+
+		FInstanceMergeKey Key;
+		Key.Level = Actor->GetLevel();
+		Key.FolderPath = Actor->GetFolderPath();
+		Key.Mesh = Component->GetStaticMesh();
+		for (UMaterialInterface* Material : Component->OverrideMaterials)
+		{
+			Key.Materials.Add(Material);
+		}
+		// Trailing empty slots mean the same as no override
+		while (!Key.Materials.IsEmpty() && !Key.Materials.Last())
+		{
+			Key.Materials.Pop();
+		}
+		Key.Mobility = Component->Mobility;
+		Key.CollisionProfile = Component->GetCollisionProfileName();
+		Key.CollisionEnabled = Component->GetCollisionEnabled();
+		Key.bCastShadow = Component->CastShadow;
+		return Key;
+	}
+
+	/** Why an actor cannot become an instance, or empty if it can */
+	static FString GetMergeBlocker(const AActor* Actor)
+	{
+		// Subclasses may carry logic or data an instance cannot keep
+		if (Actor->GetClass() != AStaticMeshActor::StaticClass())
+		{
+			return TEXT("Not a StaticMeshActor");
+		}
+		const UStaticMeshComponent* Component = CastChecked<AStaticMeshActor>(Actor)->GetStaticMeshComponent();
+		if (!Component || !Component->GetStaticMesh())
+		{
+			return TEXT("Has no static mesh");
+		}
+		if (Actor->GetComponents().Num() > 1)
+		{
+			return TEXT("Has components besides its static mesh");
+		}
+		if (Actor->GetAttachParentActor())
+		{
+			return TEXT("Is attached to another actor");
+		}
+		TArray<AActor*> AttachedActors;
+		Actor->GetAttachedActors(AttachedActors);
+		if (!AttachedActors.IsEmpty())
+		{
+			return TEXT("Has attached actors");
+		}
+		return FString();
+	}
+
+	/** Why an actor cannot be exploded, or empty if it can; fills the instanced components to explode */
+	static FString GetExplodeBlocker(const AActor* Actor, TArray<UInstancedStaticMeshComponent*>& OutComponents)
+	{
+		// Only the plain actors MergeToInstances creates; other classes own their instances (foliage, PCG, Blueprints)
+		if (Actor->GetClass() != AActor::StaticClass())
+		{
+			return TEXT("Not a plain actor holding instanced static meshes");
+		}
+		Actor->GetComponents(OutComponents);
+		if (OutComponents.IsEmpty())
+		{
+			return TEXT("Has no instanced static mesh components");
+		}
+		for (const UActorComponent* Component : Actor->GetComponents())
+		{
+			if (Component->IsA<UPrimitiveComponent>() && !Component->IsA<UInstancedStaticMeshComponent>())
+			{
+				return TEXT("Has primitive components besides instanced static meshes");
+			}
+		}
+		for (const UInstancedStaticMeshComponent* Component : OutComponents)
+		{
+			if (!Component->GetStaticMesh())
+			{
+				return TEXT("Has an instanced component without a static mesh");
+			}
+		}
+		TArray<AActor*> AttachedActors;
+		Actor->GetAttachedActors(AttachedActors);
+		if (!AttachedActors.IsEmpty())
+		{
+			return TEXT("Has attached actors");
+		}
+		return FString();
+	}
+
+	/** Copy the settings an instanced component shares across its instances onto a component of another class */
+	static void CopyMeshComponentSettings(const UStaticMeshComponent* Source, const TArray<UMaterialInterface*>& Materials, UStaticMeshComponent* Target)
+	{
+		Target->SetMobility(Source->Mobility);
+		Target->SetStaticMesh(Source->GetStaticMesh());
+		for (int32 MaterialIndex = 0; MaterialIndex < Materials.Num(); ++MaterialIndex)
+		{
+			if (Materials[MaterialIndex])
+			{
+				Target->SetMaterial(MaterialIndex, Materials[MaterialIndex]);
+			}
+		}
+		Target->BodyInstance.CopyBodyInstancePropertiesFrom(&Source->BodyInstance);
+		Target->SetCastShadow(Source->CastShadow);
+	}
+
+	/** Draw calls of one unculled mesh or instanced component: one per LOD0 section */
+	static int32 GetMeshDrawCalls(const UStaticMesh* Mesh)
+	{
+		return FMath::Max(1, Mesh->GetNumSections(0));
+	}
+
+	/** Size of the actor and component objects, the part of an actor that instancing removes */
+	static int64 GetActorObjectBytes(const AActor* Actor)
+	{
+		int64 Bytes = Actor->GetClass()->GetStructureSize();
+		for (const UActorComponent* Component : Actor->GetComponents())
+		{
+			Bytes += Component->GetClass()->GetStructureSize();
+		}
+		return Bytes;
+	}
+
+	/** Level notifications after actors were added or removed, run once per batch */
+	static void FinishLevelActorListChange(UObject* Object)
+	{
+		CastChecked<ULevel>(Object)->MarkPackageDirty();
+		ULevel::LevelDirtiedEvent.Broadcast();
+		if (GEngine)
+		{
+			GEngine->BroadcastLevelActorListChanged();
+		}
+		if (GEditor)
+		{
+			GEditor->RedrawLevelEditingViewports();
+		}
+	}
+}
+
+FActorImplModule::FActorImplModule(IEditorBatchModule& InEditorBatch)
+	: EditorBatch(InEditorBatch)
+	, ActorOctree(FVector::ZeroVector, HALF_WORLD_MAX)
+{
+	if (GEngine)
+	{
+		LevelActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FActorImplModule::HandleLevelActorAdded);
+		LevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FActorImplModule::HandleLevelActorDeleted);
+		ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FActorImplModule::HandleActorMoved);
+		ActorFolderChangedHandle = GEngine->OnLevelActorFolderChanged().AddRaw(this, &FActorImplModule::HandleActorFolderChanged);
+	}
+	ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FActorImplModule::HandleActorLabelChanged);
+	MapChangeHandle = FEditorDelegates::MapChange.AddRaw(this, &FActorImplModule::HandleMapChange);
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FActorImplModule::HandleLevelListChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FActorImplModule::HandleLevelListChanged);
+	PostUndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FActorImplModule::HandlePostUndoRedo);
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FActorImplModule::HandleObjectPropertyChanged);
+	ObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddRaw(this, &FActorImplModule::HandleObjectTransacted);
+	LoadedActorAddedHandle = ULevel::OnLoadedActorAddedToLevelEvent.AddRaw(this, &FActorImplModule::HandleLoadedActorAdded);
+	LoadedActorRemovedHandle = ULevel::OnLoadedActorRemovedFromLevelEvent.AddRaw(this, &FActorImplModule::HandleLoadedActorRemoved);
+	ResetChangeJournal();
+}
+
+FActorImplModule::~FActorImplModule()
+{
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(LevelActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(LevelActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+		GEngine->OnLevelActorFolderChanged().Remove(ActorFolderChangedHandle);
+	}
+	FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+	FEditorDelegates::MapChange.Remove(MapChangeHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	FEditorDelegates::PostUndoRedo.Remove(PostUndoRedoHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	FCoreUObjectDelegates::OnObjectTransacted.Remove(ObjectTransactedHandle);
+	ULevel::OnLoadedActorAddedToLevelEvent.Remove(LoadedActorAddedHandle);
+	ULevel::OnLoadedActorRemovedFromLevelEvent.Remove(LoadedActorRemovedHandle);
+}
 
 FActorSpawnResult FActorImplModule::SpawnActor(
 	const FString& ActorClassPath,
 	const FVector& Location,
 	const FRotator& Rotation)
 {
-	FActorSpawnResult Result;
+	MCP_TRACE_SCOPE("FActorImplModule::SpawnActor");
 
-	// Find the class by path
-	UClass* ActorClass = FindObject<UClass>(nullptr, *ActorClassPath);
-	if (!ActorClass)
-	{
-		ActorClass = LoadClass<AActor>(nullptr, *ActorClassPath);
-	}
+	FActorSpawnResult Result;
 
+	UClass* ActorClass = ResolveActorClass(ActorClassPath, Result.ErrorMessage);
 	if (!ActorClass)
 	{
 		Result.bSuccess = false;
-		Result.ErrorMessage = FString::Printf(TEXT("Class not found: %s"), *ActorClassPath);
-		return Result;
-	}
-
-	if (!ActorClass->IsChildOf(AActor::StaticClass()))
-	{
-		Result.bSuccess = false;
-		Result.ErrorMessage = FString::Printf(TEXT("Class is not an Actor: %s"), *ActorClassPath);
 		return Result;
 	}
 
@@ -66,8 +405,105 @@ FActorSpawnResult FActorImplModule::SpawnActor(
 	return Result;
 }
 
+FActorSpawnBatchResult FActorImplModule::SpawnActorsBatch(const FActorSpawnBatchRequest& Request)
+{
+	MCP_TRACE_SCOPE("FActorImplModule::SpawnActorsBatch");
+
+	FActorSpawnBatchResult Result;
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	ULevel* Level = World ? World->GetCurrentLevel() : nullptr;
+	if (!Level)
+	{
+		Result.bSuccess = false;
+		Result.ErrorMessage = TEXT("No editor world available");
+		return Result;
+	}
+
+	// Each class is resolved once, however many items use it
+	TArray<UClass*> Classes;
+	TArray<FString> ClassErrors;
+	Classes.Reserve(Request.ClassPaths.Num());
+	ClassErrors.SetNum(Request.ClassPaths.Num());
+	for (int32 ClassIndex = 0; ClassIndex < Request.ClassPaths.Num(); ++ClassIndex)
+	{
+		Classes.Add(ResolveActorClass(Request.ClassPaths[ClassIndex], ClassErrors[ClassIndex]));
+	}
+
+	Result.ActorNames.SetNum(Request.Items.Num());
+
+	EditorBatch.BeginBatch(TEXT("Spawn Actors Batch"));
+	Level->Modify();
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.OverrideLevel = Level;
+	SpawnParams.ObjectFlags = RF_Transactional;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.bDeferConstruction = true;
+
+	// Create every actor first, then run construction scripts in a second pass
+	TArray<TPair<int32, AActor*>> SpawnedActors;
+	SpawnedActors.Reserve(Request.Items.Num());
+	for (int32 Index = 0; Index < Request.Items.Num(); ++Index)
+	{
+		const FActorSpawnBatchItem& Item = Request.Items[Index];
+		if (!Classes.IsValidIndex(Item.ClassIndex))
+		{
+			Result.Errors.Add({ Index, FString::Printf(TEXT("Invalid class index: %d"), Item.ClassIndex) });
+			continue;
+		}
+
+		UClass* ActorClass = Classes[Item.ClassIndex];
+		if (!ActorClass)
+		{
+			Result.Errors.Add({ Index, ClassErrors[Item.ClassIndex] });
+			continue;
+		}
+
+		AActor* Actor = World->SpawnActor(ActorClass, &Item.Transform, SpawnParams);
+		if (!Actor)
+		{
+			Result.Errors.Add({ Index, FString::Printf(TEXT("Failed to spawn actor of class: %s"), *Request.ClassPaths[Item.ClassIndex]) });
+			continue;
+		}
+
+		SpawnedActors.Emplace(Index, Actor);
+	}
+
+	const FName FolderPath(*Request.FolderPath);
+	for (const TPair<int32, AActor*>& Spawned : SpawnedActors)
+	{
+		AActor* Actor = Spawned.Value;
+		Actor->FinishSpawning(Request.Items[Spawned.Key].Transform);
+
+		if (!Request.LabelPrefix.IsEmpty())
+		{
+			Actor->SetActorLabel(FString::Printf(TEXT("%s_%d"), *Request.LabelPrefix, Spawned.Key), false);
+		}
+		if (!Request.FolderPath.IsEmpty())
+		{
+			Actor->SetFolderPath(FolderPath);
+		}
+		Actor->MarkPackageDirty();
+
+		// Construction scripts may have added the root component after the actor was first indexed
+		HandleActorMoved(Actor);
+
+		Result.ActorNames[Spawned.Key] = Actor->GetName();
+		++Result.SpawnedCount;
+	}
+
+	EditorBatch.RunOrDefer(Level, TEXT("LevelActorListChanged"), &ActorImplHelpers::FinishLevelActorListChange);
+	EditorBatch.EndBatch();
+
+	Result.bSuccess = true;
+	return Result;
+}
+
 FActorDeleteResult FActorImplModule::DeleteActor(const FString& ActorIdentifier)
 {
+	MCP_TRACE_SCOPE("FActorImplModule::DeleteActor");
+
 	FActorDeleteResult Result;
 
 	AActor* FoundActor = FindActorByIdentifier(ActorIdentifier);
@@ -108,6 +544,8 @@ FActorDuplicateResult FActorImplModule::DuplicateActor(
 	const FString& ActorIdentifier,
 	const FVector& Offset)
 {
+	MCP_TRACE_SCOPE("FActorImplModule::DuplicateActor");
+
 	FActorDuplicateResult Result;
 
 	AActor* SourceActor = FindActorByIdentifier(ActorIdentifier);
@@ -143,8 +581,10 @@ FActorDuplicateResult FActorImplModule::DuplicateActor(
 	return Result;
 }
 
-FGetActorsResult FActorImplModule::GetActorsInLevel(const FString& ClassFilter)
+FGetActorsResult FActorImplModule::GetActorsInLevel(const FActorQuery& Query)
 {
+	MCP_TRACE_SCOPE("FActorImplModule::GetActorsInLevel");
+
 	FGetActorsResult Result;
 
 	UEditorActorSubsystem* EditorActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
@@ -155,19 +595,42 @@ FGetActorsResult FActorImplModule::GetActorsInLevel(const FString& ClassFilter)
 		return Result;
 	}
 
-	TArray<AActor*> AllActors = EditorActorSubsystem->GetAllLevelActors();
-
 	UClass* FilterClass = nullptr;
-	if (!ClassFilter.IsEmpty())
+	if (!Query.ClassFilter.IsEmpty())
 	{
-		FilterClass = FindObject<UClass>(nullptr, *ClassFilter);
+		FilterClass = FindObject<UClass>(nullptr, *Query.ClassFilter);
 		if (!FilterClass)
 		{
-			FilterClass = LoadClass<AActor>(nullptr, *ClassFilter);
+			FilterClass = LoadClass<AActor>(nullptr, *Query.ClassFilter);
 		}
 	}
 
-	for (AActor* Actor : AllActors)
+	const FName FolderName(*Query.FolderFilter);
+	const FString FolderPrefix = Query.FolderFilter + TEXT("/");
+	const bool bFilterBounds = Query.Bounds.IsValid != 0;
+	const int32 Offset = FMath::Max(0, Query.Offset);
+	int32 MatchIndex = 0;
+
+	// With bounds, only the octree nodes overlapping the box are visited and actors are listed in octree order
+	TArray<AActor*> Candidates;
+	if (bFilterBounds)
+	{
+		EnsureActorIndex();
+		ActorOctree.FindElementsWithBoundsTest(FBoxCenterAndExtent(Query.Bounds), [&Candidates](const FActorOctreeElement& Element)
+		{
+			AActor* Actor = Element.Actor.Get();
+			if (IsValid(Actor))
+			{
+				Candidates.Add(Actor);
+			}
+		});
+	}
+	else
+	{
+		Candidates = EditorActorSubsystem->GetAllLevelActors();
+	}
+
+	for (AActor* Actor : Candidates)
 	{
 		if (!Actor) continue;
 
@@ -176,56 +639,275 @@ FGetActorsResult FActorImplModule::GetActorsInLevel(const FString& ClassFilter)
 			continue;
 		}
 
-		FActorInfo Info;
-		Info.ActorName = Actor->GetName();
-		Info.ActorLabel = Actor->GetActorLabel();
-		Info.ActorClass = Actor->GetClass()->GetPathName();
-		Info.Location = Actor->GetActorLocation();
-		Info.Rotation = Actor->GetActorRotation();
-		Info.FolderPath = Actor->GetFolderPath().ToString();
-		Result.Actors.Add(Info);
+		if (!Query.FolderFilter.IsEmpty())
+		{
+			const FName ActorFolder = Actor->GetFolderPath();
+			if (ActorFolder != FolderName && !ActorFolder.ToString().StartsWith(FolderPrefix))
+			{
+				continue;
+			}
+		}
+
+		// Matches before the requested page are only counted
+		if (MatchIndex++ < Offset)
+		{
+			continue;
+		}
+
+		if (Query.Limit != INDEX_NONE && Result.Actors.Num() >= Query.Limit)
+		{
+			Result.bHasMore = true;
+			Result.NextOffset = Offset + Result.Actors.Num();
+			break;
+		}
+
+		FActorInfo& Info = Result.Actors.AddDefaulted_GetRef();
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Name))
+		{
+			Info.ActorName = Actor->GetName();
+		}
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Label))
+		{
+			Info.ActorLabel = Actor->GetActorLabel();
+		}
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Class))
+		{
+			Info.ActorClass = Actor->GetClass()->GetPathName();
+		}
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Location))
+		{
+			Info.Location = Actor->GetActorLocation();
+		}
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Rotation))
+		{
+			Info.Rotation = Actor->GetActorRotation();
+		}
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Folder))
+		{
+			Info.FolderPath = Actor->GetFolderPath().ToString();
+		}
 	}
 
 	Result.bSuccess = true;
 	return Result;
 }
 
-FActorSelectionResult FActorImplModule::SelectActors(const TArray<FString>& ActorIdentifiers, bool bAddToSelection)
+FActorSpatialQueryResult FActorImplModule::QueryActorsSpatial(const FActorSpatialQuery& Query)
 {
-	FActorSelectionResult Result;
+	MCP_TRACE_SCOPE("FActorImplModule::QueryActorsSpatial");
 
-	UEditorActorSubsystem* EditorActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-	if (!EditorActorSubsystem)
-	{
-		Result.bSuccess = false;
-		Result.ErrorMessage = TEXT("UEditorActorSubsystem is not available");
-		return Result;
-	}
+	using namespace ActorImplHelpers;
 
-	if (!bAddToSelection)
+	FActorSpatialQueryResult Result;
+
+	switch (Query.Shape)
 	{
-		GEditor->SelectNone(true, true, false);
+	case EActorSpatialShape::Box:
+		if (!Query.Box.IsValid)
+		{
+			Result.bSuccess = false;
+			Result.ErrorMessage = TEXT("Box query needs a valid min and max");
+			return Result;
+		}
+		break;
+	case EActorSpatialShape::Sphere:
+		if (Query.Radius <= 0.0)
+		{
+			Result.bSuccess = false;
+			Result.ErrorMessage = TEXT("Sphere query needs a positive radius");
+			return Result;
+		}
+		break;
+	case EActorSpatialShape::Frustum:
+		if (Query.FieldOfView <= 0.0 || Query.FieldOfView >= 180.0 || Query.AspectRatio <= 0.0)
+		{
+			Result.bSuccess = false;
+			Result.ErrorMessage = TEXT("Frustum query needs a field of view between 0 and 180 degrees and a positive aspect ratio");
+			return Result;
+		}
+		if (Query.NearDistance < 0.0 || Query.FarDistance <= Query.NearDistance)
+		{
+			Result.bSuccess = false;
+			Result.ErrorMessage = TEXT("Frustum query needs 0 <= near < far");
+			return Result;
+		}
+		break;
+	case EActorSpatialShape::Nearest:
+		if (Query.Count < 1)
+		{
+			Result.bSuccess = false;
+			Result.ErrorMessage = TEXT("Nearest query needs a count of at least 1");
+			return Result;
+		}
+		break;
 	}
 
-	int32 SelectedCount = 0;
-	for (const FString& Identifier : ActorIdentifiers)
+	UClass* FilterClass = nullptr;
+	if (!Query.ClassFilter.IsEmpty())
 	{
-		AActor* Actor = FindActorByIdentifier(Identifier);
-		if (Actor)
+		FilterClass = FindObject<UClass>(nullptr, *Query.ClassFilter);
+		if (!FilterClass)
 		{
-			GEditor->SelectActor(Actor, true, true, false);
-			SelectedCount++;
+			FilterClass = LoadClass<AActor>(nullptr, *Query.ClassFilter);
+		}
+		if (!FilterClass)
+		{
+			Result.bSuccess = false;
+			Result.ErrorMessage = FString::Printf(TEXT("Class not found: %s"), *Query.ClassFilter);
+			return Result;
 		}
 	}
 
-	Result.bSuccess = true;
-	Result.AffectedCount = SelectedCount;
-	return Result;
-}
-
-FActorSelectionResult FActorImplModule::DeselectAll()
-{
-	FActorSelectionResult Result;
+	EnsureActorIndex();
+	if (!IndexedWorld.IsValid())
+	{
+		Result.bSuccess = false;
+		Result.ErrorMessage = TEXT("No editor world available");
+		return Result;
+	}
+
+	const FVector DistanceOrigin = Query.Shape == EActorSpatialShape::Frustum ? Query.Origin
+		: Query.Shape == EActorSpatialShape::Box ? Query.Box.GetCenter()
+		: Query.Center;
+
+	TArray<TPair<AActor*, double>> Matches;
+	auto AddMatch = [&Matches, FilterClass, &DistanceOrigin](const FActorOctreeElement& Element)
+	{
+		AActor* Actor = Element.Actor.Get();
+		if (!IsValid(Actor) || (FilterClass && !Actor->GetClass()->IsChildOf(FilterClass)))
+		{
+			return;
+		}
+		Matches.Emplace(Actor, DistanceToBounds(Element.Bounds, DistanceOrigin));
+	};
+
+	switch (Query.Shape)
+	{
+	case EActorSpatialShape::Box:
+		ActorOctree.FindElementsWithBoundsTest(FBoxCenterAndExtent(Query.Box), AddMatch);
+		break;
+
+	case EActorSpatialShape::Sphere:
+	{
+		const double RadiusSquared = FMath::Square(Query.Radius);
+		ActorOctree.FindElementsWithBoundsTest(FBoxCenterAndExtent(Query.Center, FVector(Query.Radius)),
+			[&AddMatch, &Query, RadiusSquared](const FActorOctreeElement& Element)
+			{
+				if (FMath::SphereAABBIntersection(Query.Center, RadiusSquared, Element.Bounds.GetBox()))
+				{
+					AddMatch(Element);
+				}
+			});
+		break;
+	}
+
+	case EActorSpatialShape::Frustum:
+	{
+		const FConvexVolume Frustum = MakeFrustum(Query);
+		ActorOctree.FindElementsWithPredicate(
+			[&Frustum](FActorOctree::FNodeIndex ParentIndex, FActorOctree::FNodeIndex NodeIndex, const FBoxCenterAndExtent& NodeBounds)
+			{
+				return Frustum.IntersectBox(FVector(NodeBounds.Center), FVector(NodeBounds.Extent));
+			},
+			[&AddMatch, &Frustum](FActorOctree::FNodeIndex ParentIndex, const FActorOctreeElement& Element)
+			{
+				if (Frustum.IntersectBox(FVector(Element.Bounds.Center), FVector(Element.Bounds.Extent)))
+				{
+					AddMatch(Element);
+				}
+			});
+		break;
+	}
+
+	case EActorSpatialShape::Nearest:
+	{
+		// Grow the search box until it holds enough actors within its own radius; anything outside
+		// the box is farther away than everything inside that radius.
+		const double MaxRadius = Query.MaxDistance > 0.0 ? Query.MaxDistance : HALF_WORLD_MAX;
+		double Radius = FMath::Min(NearestInitialRadius, MaxRadius);
+		for (;;)
+		{
+			Matches.Reset();
+			ActorOctree.FindElementsWithBoundsTest(FBoxCenterAndExtent(Query.Center, FVector(Radius)), AddMatch);
+			Matches.RemoveAllSwap([Radius](const TPair<AActor*, double>& Match) { return Match.Value > Radius; });
+			if (Matches.Num() >= Query.Count || Radius >= MaxRadius)
+			{
+				break;
+			}
+			Radius = FMath::Min(Radius * NearestGrowthFactor, MaxRadius);
+		}
+		break;
+	}
+	}
+
+	Matches.Sort([](const TPair<AActor*, double>& A, const TPair<AActor*, double>& B) { return A.Value < B.Value; });
+	if (Query.Shape == EActorSpatialShape::Nearest && Matches.Num() > Query.Count)
+	{
+		Matches.SetNum(Query.Count);
+	}
+
+	Result.TotalMatches = Matches.Num();
+	if (Query.Limit != INDEX_NONE && Matches.Num() > Query.Limit)
+	{
+		Matches.SetNum(FMath::Max(0, Query.Limit));
+		Result.bTruncated = true;
+	}
+
+	Result.Actors.Reserve(Matches.Num());
+	for (const TPair<AActor*, double>& Match : Matches)
+	{
+		FActorSpatialMatch& Info = Result.Actors.AddDefaulted_GetRef();
+		Info.ActorName = Match.Key->GetName();
+		Info.ActorLabel = Match.Key->GetActorLabel();
+		Info.ActorClass = Match.Key->GetClass()->GetPathName();
+		Info.Location = Match.Key->GetActorLocation();
+		Info.Distance = Match.Value;
+	}
+
+	Result.bSuccess = true;
+	return Result;
+}
+
+FActorSelectionResult FActorImplModule::SelectActors(const TArray<FString>& ActorIdentifiers, bool bAddToSelection)
+{
+	MCP_TRACE_SCOPE("FActorImplModule::SelectActors");
+
+	FActorSelectionResult Result;
+
+	UEditorActorSubsystem* EditorActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
+	if (!EditorActorSubsystem)
+	{
+		Result.bSuccess = false;
+		Result.ErrorMessage = TEXT("UEditorActorSubsystem is not available");
+		return Result;
+	}
+
+	if (!bAddToSelection)
+	{
+		GEditor->SelectNone(true, true, false);
+	}
+
+	int32 SelectedCount = 0;
+	for (const FString& Identifier : ActorIdentifiers)
+	{
+		AActor* Actor = FindActorByIdentifier(Identifier);
+		if (Actor)
+		{
+			GEditor->SelectActor(Actor, true, true, false);
+			SelectedCount++;
+		}
+	}
+
+	Result.bSuccess = true;
+	Result.AffectedCount = SelectedCount;
+	return Result;
+}
+
+FActorSelectionResult FActorImplModule::DeselectAll()
+{
+	MCP_TRACE_SCOPE("FActorImplModule::DeselectAll");
+
+	FActorSelectionResult Result;
 
 	GEditor->SelectNone(true, true, false);
 
@@ -236,6 +918,8 @@ FActorSelectionResult FActorImplModule::DeselectAll()
 
 FActorTransformResult FActorImplModule::GetActorTransform(const FString& ActorIdentifier)
 {
+	MCP_TRACE_SCOPE("FActorImplModule::GetActorTransform");
+
 	FActorTransformResult Result;
 
 	AActor* Actor = FindActorByIdentifier(ActorIdentifier);
@@ -260,6 +944,8 @@ FActorSetTransformResult FActorImplModule::SetActorTransform(
 	const FRotator* Rotation,
 	const FVector* Scale)
 {
+	MCP_TRACE_SCOPE("FActorImplModule::SetActorTransform");
+
 	FActorSetTransformResult Result;
 
 	AActor* Actor = FindActorByIdentifier(ActorIdentifier);
@@ -270,6 +956,8 @@ FActorSetTransformResult FActorImplModule::SetActorTransform(
 		return Result;
 	}
 
+	Actor->Modify();
+
 	if (Location)
 	{
 		Actor->SetActorLocation(*Location);
@@ -283,6 +971,9 @@ FActorSetTransformResult FActorImplModule::SetActorTransform(
 		Actor->SetActorScale3D(*Scale);
 	}
 
+	// Setting the transform directly does not broadcast OnActorMoved
+	HandleActorMoved(Actor);
+
 	FTransform NewTransform = Actor->GetActorTransform();
 	Result.bSuccess = true;
 	Result.Location = NewTransform.GetLocation();
@@ -293,6 +984,8 @@ FActorSetTransformResult FActorImplModule::SetActorTransform(
 
 FActorPropertyResult FActorImplModule::GetActorProperty(const FString& ActorIdentifier, const FString& PropertyName)
 {
+	MCP_TRACE_SCOPE("FActorImplModule::GetActorProperty");
+
 	FActorPropertyResult Result;
 
 	AActor* Actor = FindActorByIdentifier(ActorIdentifier);
@@ -322,8 +1015,186 @@ FActorPropertyResult FActorImplModule::GetActorProperty(const FString& ActorIden
 	return Result;
 }
 
+FActorPropertiesBulkResult FActorImplModule::GetActorPropertiesBulk(const FActorPropertiesBulkQuery& Query)
+{
+	MCP_TRACE_SCOPE("FActorImplModule::GetActorPropertiesBulk");
+
+	using namespace ActorImplHelpers;
+
+	FActorPropertiesBulkResult Result;
+
+	if (Query.PropertyPaths.IsEmpty())
+	{
+		Result.bSuccess = false;
+		Result.ErrorMessage = TEXT("No property paths given");
+		return Result;
+	}
+
+	TArray<TArray<FString>> PathSegments;
+	PathSegments.Reserve(Query.PropertyPaths.Num());
+	for (const FString& PropertyPath : Query.PropertyPaths)
+	{
+		TArray<FString>& Segments = PathSegments.AddDefaulted_GetRef();
+		PropertyPath.ParseIntoArray(Segments, TEXT("."), false);
+		if (Segments.IsEmpty() || Segments.Contains(FString()))
+		{
+			Result.bSuccess = false;
+			Result.ErrorMessage = FString::Printf(TEXT("Invalid property path: %s"), *PropertyPath);
+			return Result;
+		}
+	}
+
+	UClass* FilterClass = nullptr;
+	if (!Query.ClassFilter.IsEmpty())
+	{
+		FilterClass = FindObject<UClass>(nullptr, *Query.ClassFilter);
+		if (!FilterClass)
+		{
+			FilterClass = LoadClass<AActor>(nullptr, *Query.ClassFilter);
+		}
+		if (!FilterClass)
+		{
+			Result.bSuccess = false;
+			Result.ErrorMessage = FString::Printf(TEXT("Class not found: %s"), *Query.ClassFilter);
+			return Result;
+		}
+	}
+
+	EnsureActorIndex();
+	UWorld* World = IndexedWorld.Get();
+	if (!World)
+	{
+		Result.bSuccess = false;
+		Result.ErrorMessage = TEXT("No editor world available");
+		return Result;
+	}
+
+	const bool bFilterBounds = Query.Bounds.IsValid != 0;
+	const FBoxCenterAndExtent QueryBounds(Query.Bounds);
+	auto PassesFilters = [this, FilterClass, bFilterBounds, &QueryBounds](AActor* Actor)
+	{
+		if (FilterClass && !Actor->GetClass()->IsChildOf(FilterClass))
+		{
+			return false;
+		}
+		if (bFilterBounds)
+		{
+			const FOctreeElementId2* ElementId = ActorOctreeIds.Find(FObjectKey(Actor));
+			return ElementId && ActorOctree.IsValidElementId(*ElementId)
+				&& Intersect(ActorOctree.GetElementById(*ElementId).Bounds, QueryBounds);
+		}
+		return true;
+	};
+
+	TArray<AActor*> Actors;
+	if (!Query.ActorIdentifiers.IsEmpty())
+	{
+		for (const FString& ActorIdentifier : Query.ActorIdentifiers)
+		{
+			AActor* Actor = FindActorByIdentifier(ActorIdentifier);
+			if (!Actor)
+			{
+				Result.MissingActors.Add(ActorIdentifier);
+			}
+			else if (PassesFilters(Actor))
+			{
+				Actors.Add(Actor);
+			}
+		}
+	}
+	else if (bFilterBounds)
+	{
+		// Only the octree nodes overlapping the box are visited
+		ActorOctree.FindElementsWithBoundsTest(QueryBounds, [&Actors, FilterClass](const FActorOctreeElement& Element)
+		{
+			AActor* Actor = Element.Actor.Get();
+			if (IsValid(Actor) && (!FilterClass || Actor->GetClass()->IsChildOf(FilterClass)))
+			{
+				Actors.Add(Actor);
+			}
+		});
+	}
+	else
+	{
+		for (ULevel* Level : World->GetLevels())
+		{
+			if (!Level)
+			{
+				continue;
+			}
+			for (AActor* Actor : Level->Actors)
+			{
+				if (IsValid(Actor) && PassesFilters(Actor))
+				{
+					Actors.Add(Actor);
+				}
+			}
+		}
+	}
+
+	const int32 Offset = FMath::Clamp(Query.Offset, 0, Actors.Num());
+	int32 Count = Actors.Num() - Offset;
+	if (Query.Limit != INDEX_NONE && Count > Query.Limit)
+	{
+		Count = FMath::Max(0, Query.Limit);
+		Result.bHasMore = true;
+		Result.NextOffset = Offset + Count;
+	}
+
+	Result.ActorNames.Reserve(Count);
+	Result.Columns.SetNum(Query.PropertyPaths.Num());
+	for (int32 ColumnIndex = 0; ColumnIndex < Result.Columns.Num(); ++ColumnIndex)
+	{
+		Result.Columns[ColumnIndex].PropertyPath = Query.PropertyPaths[ColumnIndex];
+		Result.Columns[ColumnIndex].Values.Reserve(Count);
+	}
+
+	// Paths are resolved once per class; every further actor of that class only reads values
+	TMap<UClass*, TArray<TArray<FPropertyPathStep>>> ChainsByClass;
+	FString Value;
+	for (int32 RowIndex = Offset; RowIndex < Offset + Count; ++RowIndex)
+	{
+		AActor* Actor = Actors[RowIndex];
+		Result.ActorNames.Add(Actor->GetName());
+
+		TArray<TArray<FPropertyPathStep>>* Chains = ChainsByClass.Find(Actor->GetClass());
+		if (!Chains)
+		{
+			Chains = &ChainsByClass.Add(Actor->GetClass());
+			for (const TArray<FString>& Segments : PathSegments)
+			{
+				Chains->Add(ResolvePropertyPath(Actor->GetClass(), Segments));
+			}
+		}
+
+		for (int32 ColumnIndex = 0; ColumnIndex < Result.Columns.Num(); ++ColumnIndex)
+		{
+			FActorPropertyColumn& Column = Result.Columns[ColumnIndex];
+			const TArray<FPropertyPathStep>& Chain = (*Chains)[ColumnIndex];
+			Value.Reset();
+			if (!Chain.IsEmpty() && ExportPropertyPath(Chain, Actor, Value))
+			{
+				Column.Values.Emplace(Value);
+				if (Column.PropertyType.IsEmpty())
+				{
+					Column.PropertyType = Chain.Last().Property->GetCPPType();
+				}
+			}
+			else
+			{
+				Column.Values.AddDefaulted();
+			}
+		}
+	}
+
+	Result.bSuccess = true;
+	return Result;
+}
+
 FActorSetPropertyResult FActorImplModule::SetActorProperty(const FString& ActorIdentifier, const FString& PropertyName, const FString& PropertyValue)
 {
+	MCP_TRACE_SCOPE("FActorImplModule::SetActorProperty");
+
 	FActorSetPropertyResult Result;
 
 	AActor* Actor = FindActorByIdentifier(ActorIdentifier);
@@ -354,7 +1225,10 @@ FActorSetPropertyResult FActorImplModule::SetActorProperty(const FString& ActorI
 		return Result;
 	}
 
-	Actor->PostEditChange();
+	EditorBatch.RunOrDefer(Actor, TEXT("PostEditChange"), [](UObject* Object)
+	{
+		Object->PostEditChange();
+	});
 
 	Result.bSuccess = true;
 	return Result;
@@ -362,6 +1236,8 @@ FActorSetPropertyResult FActorImplModule::SetActorProperty(const FString& ActorI
 
 FActorConvertResult FActorImplModule::ConvertActor(const FString& ActorIdentifier, const FString& NewClassPath)
 {
+	MCP_TRACE_SCOPE("FActorImplModule::ConvertActor");
+
 	FActorConvertResult Result;
 
 	AActor* Actor = FindActorByIdentifier(ActorIdentifier);
@@ -425,6 +1301,8 @@ FActorConvertResult FActorImplModule::ConvertActor(const FString& ActorIdentifie
 
 FMoveActorsToLevelResult FActorImplModule::MoveActorsToLevel(const TArray<FString>& ActorIdentifiers, const FString& LevelName)
 {
+	MCP_TRACE_SCOPE("FActorImplModule::MoveActorsToLevel");
+
 	FMoveActorsToLevelResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -506,6 +1384,8 @@ FMoveActorsToLevelResult FActorImplModule::MoveActorsToLevel(const TArray<FStrin
 
 FGroupActorsResult FActorImplModule::GroupActors(const TArray<FString>& ActorIdentifiers, const FString& GroupName)
 {
+	MCP_TRACE_SCOPE("FActorImplModule::GroupActors");
+
 	FGroupActorsResult Result;
 
 	TArray<AActor*> ActorsToGroup;
@@ -550,6 +1430,8 @@ FGroupActorsResult FActorImplModule::GroupActors(const TArray<FString>& ActorIde
 
 FSetActorFolderResult FActorImplModule::SetActorFolder(const FString& ActorIdentifier, const FString& FolderPath)
 {
+	MCP_TRACE_SCOPE("FActorImplModule::SetActorFolder");
+
 	FSetActorFolderResult Result;
 
 	AActor* Actor = FindActorByIdentifier(ActorIdentifier);
@@ -566,30 +1448,861 @@ FSetActorFolderResult FActorImplModule::SetActorFolder(const FString& ActorIdent
 	return Result;
 }
 
-AActor* FActorImplModule::FindActorByIdentifier(const FString& ActorIdentifier)
+FMergeToInstancesResult FActorImplModule::MergeToInstances(const FMergeToInstancesRequest& Request)
 {
-	UEditorActorSubsystem* EditorActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-	if (!EditorActorSubsystem)
+	MCP_TRACE_SCOPE("FActorImplModule::MergeToInstances");
+
+	using namespace ActorImplHelpers;
+
+	FMergeToInstancesResult Result;
+
+	EnsureActorIndex();
+	UWorld* World = IndexedWorld.Get();
+	if (!World)
 	{
-		return nullptr;
+		Result.bSuccess = false;
+		Result.ErrorMessage = TEXT("No editor world available");
+		return Result;
 	}
 
-	// Try GetActorReference first (supports path like "PersistentLevel.ActorName")
-	AActor* FoundActor = EditorActorSubsystem->GetActorReference(ActorIdentifier);
-	if (FoundActor)
+	const FName FolderName(*Request.FolderFilter);
+	const FString FolderPrefix = Request.FolderFilter + TEXT("/");
+	const bool bFilterBounds = Request.Bounds.IsValid != 0;
+	const FBoxCenterAndExtent QueryBounds(Request.Bounds);
+	auto PassesFilters = [this, &Request, &FolderName, &FolderPrefix, bFilterBounds, &QueryBounds](AActor* Actor)
 	{
-		return FoundActor;
+		if (!Request.FolderFilter.IsEmpty())
+		{
+			const FName ActorFolder = Actor->GetFolderPath();
+			if (ActorFolder != FolderName && !ActorFolder.ToString().StartsWith(FolderPrefix))
+			{
+				return false;
+			}
+		}
+		if (bFilterBounds)
+		{
+			const FOctreeElementId2* ElementId = ActorOctreeIds.Find(FObjectKey(Actor));
+			return ElementId && ActorOctree.IsValidElementId(*ElementId)
+				&& Intersect(ActorOctree.GetElementById(*ElementId).Bounds, QueryBounds);
+		}
+		return true;
+	};
+
+	// Named and selected actors that cannot be merged are reported; other level actors are passed over
+	TArray<AActor*> Candidates;
+	bool bReportSkipped = true;
+	if (!Request.ActorIdentifiers.IsEmpty())
+	{
+		TSet<AActor*> SeenActors;
+		for (const FString& ActorIdentifier : Request.ActorIdentifiers)
+		{
+			AActor* Actor = FindActorByIdentifier(ActorIdentifier);
+			if (!Actor)
+			{
+				Result.Skipped.Add({ ActorIdentifier, TEXT("Actor not found") });
+				continue;
+			}
+
+			bool bAlreadySeen = false;
+			SeenActors.Add(Actor, &bAlreadySeen);
+			if (!bAlreadySeen && PassesFilters(Actor))
+			{
+				Candidates.Add(Actor);
+			}
+		}
+	}
+	else if (Request.bUseSelection)
+	{
+		TArray<AActor*> SelectedActors;
+		GEditor->GetSelectedActors()->GetSelectedObjects<AActor>(SelectedActors);
+		for (AActor* Actor : SelectedActors)
+		{
+			if (IsValid(Actor) && Actor->GetWorld() == World && PassesFilters(Actor))
+			{
+				Candidates.Add(Actor);
+			}
+		}
+	}
+	else if (bFilterBounds)
+	{
+		bReportSkipped = false;
+		// Only the octree nodes overlapping the box are visited
+		ActorOctree.FindElementsWithBoundsTest(QueryBounds, [&Candidates, &PassesFilters](const FActorOctreeElement& Element)
+		{
+			AActor* Actor = Element.Actor.Get();
+			if (IsValid(Actor) && PassesFilters(Actor))
+			{
+				Candidates.Add(Actor);
+			}
+		});
+	}
+	else
+	{
+		bReportSkipped = false;
+		for (ULevel* Level : World->GetLevels())
+		{
+			if (!Level)
+			{
+				continue;
+			}
+			for (AActor* Actor : Level->Actors)
+			{
+				if (IsValid(Actor) && PassesFilters(Actor))
+				{
+					Candidates.Add(Actor);
+				}
+			}
+		}
 	}
 
-	// Search by name or label among all level actors
-	TArray<AActor*> AllActors = EditorActorSubsystem->GetAllLevelActors();
-	for (AActor* Actor : AllActors)
+	// Groups keep the order of their first actor
+	TMap<FInstanceMergeKey, int32> GroupIndices;
+	TArray<TPair<FInstanceMergeKey, TArray<AStaticMeshActor*>>> Groups;
+	for (AActor* Actor : Candidates)
 	{
-		if (Actor->GetName() == ActorIdentifier || Actor->GetActorLabel() == ActorIdentifier)
+		const FString Blocker = GetMergeBlocker(Actor);
+		if (!Blocker.IsEmpty())
+		{
+			if (bReportSkipped)
+			{
+				Result.Skipped.Add({ Actor->GetName(), Blocker });
+			}
+			continue;
+		}
+
+		AStaticMeshActor* MeshActor = CastChecked<AStaticMeshActor>(Actor);
+		FInstanceMergeKey Key = MakeInstanceMergeKey(MeshActor);
+		const int32 GroupIndex = GroupIndices.FindOrAdd(Key, Groups.Num());
+		if (GroupIndex == Groups.Num())
 		{
-			return Actor;
+			Groups.Emplace(MoveTemp(Key), TArray<AStaticMeshActor*>());
 		}
+		Groups[GroupIndex].Value.Add(MeshActor);
 	}
 
-	return nullptr;
+	UClass* ComponentClass = Request.bHierarchical
+		? UHierarchicalInstancedStaticMeshComponent::StaticClass()
+		: UInstancedStaticMeshComponent::StaticClass();
+	const int32 MinInstances = FMath::Max(1, Request.MinInstances);
+
+	EditorBatch.BeginBatch(TEXT("Merge To Instances"));
+
+	for (const TPair<FInstanceMergeKey, TArray<AStaticMeshActor*>>& Group : Groups)
+	{
+		const FInstanceMergeKey& Key = Group.Key;
+		const TArray<AStaticMeshActor*>& Actors = Group.Value;
+		if (Actors.Num() < MinInstances)
+		{
+			if (bReportSkipped)
+			{
+				for (AStaticMeshActor* Actor : Actors)
+				{
+					Result.Skipped.Add({ Actor->GetName(), TEXT("Too few actors share its mesh, materials and settings") });
+				}
+			}
+			continue;
+		}
+
+		TArray<FTransform> InstanceTransforms;
+		InstanceTransforms.Reserve(Actors.Num());
+		FVector Center = FVector::ZeroVector;
+		for (AStaticMeshActor* Actor : Actors)
+		{
+			InstanceTransforms.Add(Actor->GetStaticMeshComponent()->GetComponentTransform());
+			Center += Actor->GetActorLocation();
+		}
+		Center /= Actors.Num();
+
+		Key.Level->Modify();
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.OverrideLevel = Key.Level;
+		SpawnParams.ObjectFlags = RF_Transactional;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		AActor* InstancedActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Center), SpawnParams);
+		if (!InstancedActor)
+		{
+			for (AStaticMeshActor* Actor : Actors)
+			{
+				Result.Skipped.Add({ Actor->GetName(), TEXT("Failed to spawn the instanced actor") });
+			}
+			continue;
+		}
+
+		UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(
+			InstancedActor, ComponentClass, TEXT("InstancedStaticMesh"), RF_Transactional);
+		CopyMeshComponentSettings(Actors[0]->GetStaticMeshComponent(), Key.Materials, Component);
+		InstancedActor->SetRootComponent(Component);
+		InstancedActor->AddInstanceComponent(Component);
+		Component->SetWorldTransform(FTransform(Center));
+		Component->RegisterComponent();
+		Component->AddInstances(InstanceTransforms, false, true);
+
+		InstancedActor->SetActorLabel(FString::Printf(TEXT("%s_Instances"), *Key.Mesh->GetName()), false);
+		InstancedActor->SetFolderPath(Key.FolderPath);
+		InstancedActor->MarkPackageDirty();
+
+		const int32 DrawCalls = GetMeshDrawCalls(Key.Mesh);
+		for (AStaticMeshActor* Actor : Actors)
+		{
+			Result.Stats.DrawCallsBefore += DrawCalls;
+			Result.Stats.EstimatedBytesBefore += GetActorObjectBytes(Actor);
+			GEditor->SelectActor(Actor, false, false);
+			World->EditorDestroyActor(Actor, true);
+		}
+		Result.Stats.DrawCallsAfter += DrawCalls;
+		Result.Stats.EstimatedBytesAfter += GetActorObjectBytes(InstancedActor)
+			+ int64(Actors.Num()) * sizeof(FInstancedStaticMeshInstanceData);
+
+		// The root component was added after spawning, so the actor has no bounds in the index yet
+		HandleActorMoved(InstancedActor);
+
+		FInstanceMergeGroup& MergeGroup = Result.Groups.AddDefaulted_GetRef();
+		MergeGroup.ActorName = InstancedActor->GetName();
+		MergeGroup.ActorLabel = InstancedActor->GetActorLabel();
+		MergeGroup.StaticMeshPath = Key.Mesh->GetPathName();
+		MergeGroup.FolderPath = Key.FolderPath.ToString();
+		MergeGroup.InstanceCount = Actors.Num();
+		Result.MergedActorCount += Actors.Num();
+
+		EditorBatch.RunOrDefer(Key.Level, TEXT("LevelActorListChanged"), &FinishLevelActorListChange);
+	}
+
+	if (Result.MergedActorCount > 0)
+	{
+		GEditor->NoteSelectionChange();
+	}
+
+	EditorBatch.EndBatch();
+
+	Result.bSuccess = true;
+	return Result;
+}
+
+FExplodeInstancesResult FActorImplModule::ExplodeInstances(const TArray<FString>& ActorIdentifiers)
+{
+	MCP_TRACE_SCOPE("FActorImplModule::ExplodeInstances");
+
+	using namespace ActorImplHelpers;
+
+	FExplodeInstancesResult Result;
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World)
+	{
+		Result.bSuccess = false;
+		Result.ErrorMessage = TEXT("No editor world available");
+		return Result;
+	}
+
+	TArray<AActor*> Candidates;
+	if (!ActorIdentifiers.IsEmpty())
+	{
+		for (const FString& ActorIdentifier : ActorIdentifiers)
+		{
+			AActor* Actor = FindActorByIdentifier(ActorIdentifier);
+			if (!Actor)
+			{
+				Result.Skipped.Add({ ActorIdentifier, TEXT("Actor not found") });
+			}
+			else
+			{
+				Candidates.AddUnique(Actor);
+			}
+		}
+	}
+	else
+	{
+		GEditor->GetSelectedActors()->GetSelectedObjects<AActor>(Candidates);
+		Candidates.RemoveAll([World](const AActor* Actor)
+		{
+			return !IsValid(Actor) || Actor->GetWorld() != World;
+		});
+		if (Candidates.IsEmpty())
+		{
+			Result.bSuccess = false;
+			Result.ErrorMessage = TEXT("No actors given and none selected");
+			return Result;
+		}
+	}
+
+	EditorBatch.BeginBatch(TEXT("Explode Instances"));
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags = RF_Transactional;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.bDeferConstruction = true;
+
+	for (AActor* Actor : Candidates)
+	{
+		TArray<UInstancedStaticMeshComponent*> Components;
+		const FString Blocker = GetExplodeBlocker(Actor, Components);
+		if (!Blocker.IsEmpty())
+		{
+			Result.Skipped.Add({ Actor->GetName(), Blocker });
+			continue;
+		}
+
+		ULevel* Level = Actor->GetLevel();
+		const FName FolderPath = Actor->GetFolderPath();
+		Level->Modify();
+		SpawnParams.OverrideLevel = Level;
+
+		for (const UInstancedStaticMeshComponent* Component : Components)
+		{
+			UStaticMesh* Mesh = Component->GetStaticMesh();
+			TArray<UMaterialInterface*> Materials;
+			for (UMaterialInterface* Material : Component->OverrideMaterials)
+			{
+				Materials.Add(Material);
+			}
+
+			const int32 DrawCalls = GetMeshDrawCalls(Mesh);
+			const int32 InstanceCount = Component->GetInstanceCount();
+			Result.Stats.DrawCallsBefore += DrawCalls;
+			Result.Stats.EstimatedBytesBefore += int64(InstanceCount) * sizeof(FInstancedStaticMeshInstanceData);
+
+			for (int32 InstanceIndex = 0; InstanceIndex < InstanceCount; ++InstanceIndex)
+			{
+				FTransform InstanceTransform;
+				if (!Component->GetInstanceTransform(InstanceIndex, InstanceTransform, true))
+				{
+					continue;
+				}
+
+				AStaticMeshActor* MeshActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), InstanceTransform, SpawnParams);
+				if (!MeshActor)
+				{
+					continue;
+				}
+
+				CopyMeshComponentSettings(Component, Materials, MeshActor->GetStaticMeshComponent());
+				MeshActor->FinishSpawning(InstanceTransform);
+				MeshActor->SetActorLabel(Mesh->GetName(), false);
+				MeshActor->SetFolderPath(FolderPath);
+				MeshActor->MarkPackageDirty();
+
+				// The mesh was set after the actor was first indexed
+				HandleActorMoved(MeshActor);
+
+				Result.ActorNames.Add(MeshActor->GetName());
+				Result.Stats.DrawCallsAfter += DrawCalls;
+				Result.Stats.EstimatedBytesAfter += GetActorObjectBytes(MeshActor);
+			}
+		}
+
+		Result.Stats.EstimatedBytesBefore += GetActorObjectBytes(Actor);
+		GEditor->SelectActor(Actor, false, false);
+		World->EditorDestroyActor(Actor, true);
+		++Result.ExplodedActorCount;
+
+		EditorBatch.RunOrDefer(Level, TEXT("LevelActorListChanged"), &FinishLevelActorListChange);
+	}
+
+	if (Result.ExplodedActorCount > 0)
+	{
+		GEditor->NoteSelectionChange();
+	}
+
+	EditorBatch.EndBatch();
+
+	Result.bSuccess = true;
+	return Result;
+}
+
+UClass* FActorImplModule::ResolveActorClass(const FString& ActorClassPath, FString& OutError)
+{
+	UClass* ActorClass = FindObject<UClass>(nullptr, *ActorClassPath);
+	if (!ActorClass)
+	{
+		ActorClass = LoadClass<AActor>(nullptr, *ActorClassPath);
+	}
+
+	if (!ActorClass)
+	{
+		OutError = FString::Printf(TEXT("Class not found: %s"), *ActorClassPath);
+		return nullptr;
+	}
+
+	if (!ActorClass->IsChildOf(AActor::StaticClass()))
+	{
+		OutError = FString::Printf(TEXT("Class is not an Actor: %s"), *ActorClassPath);
+		return nullptr;
+	}
+
+	if (ActorClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+	{
+		OutError = FString::Printf(TEXT("Class cannot be spawned: %s"), *ActorClassPath);
+		return nullptr;
+	}
+
+	return ActorClass;
+}
+
+FLevelChangesResult FActorImplModule::GetLevelChanges(const FString& SinceToken)
+{
+	MCP_TRACE_SCOPE("FActorImplModule::GetLevelChanges");
+
+	FLevelChangesResult Result;
+
+	// Journaled changes belong to the editor world seen by the delegates; a new world starts a new journal
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World)
+	{
+		Result.bSuccess = false;
+		Result.ErrorMessage = TEXT("No editor world available");
+		return Result;
+	}
+
+	Result.bSuccess = true;
+	Result.Token = MakeChangeToken(JournalSequence);
+
+	FGuid TokenJournalId;
+	uint64 SinceSequence = 0;
+	if (SinceToken.IsEmpty()
+		|| !ActorImplHelpers::ParseChangeToken(SinceToken, TokenJournalId, SinceSequence)
+		|| TokenJournalId != JournalId
+		|| SinceSequence < JournalOldestSequence
+		|| SinceSequence > JournalSequence)
+	{
+		Result.bReset = true;
+		return Result;
+	}
+
+	// The log is in sequence order, so only the changes after the token are visited
+	const int32 FirstIndex = Algo::UpperBoundBy(JournalLog, SinceSequence, [](const TPair<uint64, FObjectKey>& LogEntry)
+	{
+		return LogEntry.Key;
+	});
+
+	for (int32 LogIndex = FirstIndex; LogIndex < JournalLog.Num(); ++LogIndex)
+	{
+		const FActorJournalEntry* Entry = JournalEntries.Find(JournalLog[LogIndex].Value);
+		if (!Entry || Entry->Sequence != JournalLog[LogIndex].Key)
+		{
+			continue;
+		}
+
+		const bool bAddedSinceToken = Entry->AddedSequence > SinceSequence;
+		if (Entry->bRemoved && bAddedSinceToken)
+		{
+			// Added and removed again: the caller never saw it
+			continue;
+		}
+
+		FActorChange& Change = Result.Changes.AddDefaulted_GetRef();
+		Change.Kind = Entry->bRemoved ? EActorChangeKind::Removed
+			: bAddedSinceToken ? EActorChangeKind::Added
+			: EActorChangeKind::Modified;
+		Change.ActorName = Entry->ActorName;
+		Change.ActorLabel = Entry->ActorLabel;
+		Change.ActorClass = Entry->ActorClass;
+
+		const AActor* Actor = Entry->Actor.Get();
+		if (!Entry->bRemoved && IsValid(Actor))
+		{
+			Change.ActorLabel = Actor->GetActorLabel();
+			Change.Location = Actor->GetActorLocation();
+		}
+	}
+
+	return Result;
+}
+
+AActor* FActorImplModule::FindActor(const FString& ActorIdentifier)
+{
+	MCP_TRACE_SCOPE("FActorImplModule::FindActor");
+
+	return FindActorByIdentifier(ActorIdentifier);
+}
+
+AActor* FActorImplModule::FindActorByIdentifier(const FString& ActorIdentifier)
+{
+	MCP_TRACE_SCOPE("FActorImplModule::FindActorByIdentifier");
+
+	UEditorActorSubsystem* EditorActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
+	if (!EditorActorSubsystem)
+	{
+		return nullptr;
+	}
+
+	// Try GetActorReference first (supports path like "PersistentLevel.ActorName")
+	AActor* FoundActor = EditorActorSubsystem->GetActorReference(ActorIdentifier);
+	if (FoundActor)
+	{
+		return FoundActor;
+	}
+
+	EnsureActorIndex();
+
+	// Look up by object name. FNAME_Find never adds to the name table for unknown identifiers.
+	const FName ActorName(*ActorIdentifier, FNAME_Find);
+	if (!ActorName.IsNone())
+	{
+		if (const FActorBucket* Bucket = ActorsByName.Find(ActorName))
+		{
+			for (const TWeakObjectPtr<AActor>& Entry : *Bucket)
+			{
+				AActor* Actor = Entry.Get();
+				if (IsValid(Actor) && Actor->GetFName() == ActorName)
+				{
+					return Actor;
+				}
+			}
+		}
+	}
+
+	// Look up by label
+	if (const FActorBucket* Bucket = ActorsByLabel.Find(ActorIdentifier))
+	{
+		for (const TWeakObjectPtr<AActor>& Entry : *Bucket)
+		{
+			AActor* Actor = Entry.Get();
+			if (IsValid(Actor) && Actor->GetActorLabel() == ActorIdentifier)
+			{
+				return Actor;
+			}
+		}
+	}
+
+	// The index is kept complete by the level, streaming and partition loading delegates, so a miss is final
+	return nullptr;
+}
+
+void FActorImplModule::EnsureActorIndex()
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (bActorIndexDirty || IndexedWorld.Get() != World)
+	{
+		RebuildActorIndex(World);
+	}
+}
+
+void FActorImplModule::RebuildActorIndex(UWorld* World)
+{
+	ActorsByName.Reset();
+	ActorsByLabel.Reset();
+	IndexedLabels.Reset();
+	ActorOctree.Destroy();
+	ActorOctreeIds.Reset();
+	IndexedWorld = World;
+	bActorIndexDirty = false;
+
+	if (!World)
+	{
+		return;
+	}
+
+	for (ULevel* Level : World->GetLevels())
+	{
+		if (!Level)
+		{
+			continue;
+		}
+
+		for (AActor* Actor : Level->Actors)
+		{
+			if (IsValid(Actor))
+			{
+				AddToActorIndex(Actor);
+			}
+		}
+	}
+}
+
+void FActorImplModule::AddToActorIndex(AActor* Actor)
+{
+	RemoveFromActorIndex(Actor);
+
+	const FString Label = Actor->GetActorLabel();
+	ActorsByName.FindOrAdd(Actor->GetFName()).Add(Actor);
+	ActorsByLabel.FindOrAdd(Label).Add(Actor);
+	IndexedLabels.Add(FObjectKey(Actor), Label);
+	AddToActorOctree(Actor);
+}
+
+void FActorImplModule::RemoveFromActorIndex(AActor* Actor)
+{
+	RemoveFromActorOctree(Actor);
+
+	const FObjectKey ActorKey(Actor);
+	FString OldLabel;
+	if (!IndexedLabels.RemoveAndCopyValue(ActorKey, OldLabel))
+	{
+		return;
+	}
+
+	auto RemoveFromBucket = [Actor](FActorBucket& Bucket)
+	{
+		Bucket.RemoveAllSwap([Actor](const TWeakObjectPtr<AActor>& Entry)
+		{
+			return !Entry.IsValid() || Entry.Get() == Actor;
+		});
+	};
+
+	if (FActorBucket* Bucket = ActorsByName.Find(Actor->GetFName()))
+	{
+		RemoveFromBucket(*Bucket);
+		if (Bucket->IsEmpty())
+		{
+			ActorsByName.Remove(Actor->GetFName());
+		}
+	}
+
+	if (FActorBucket* Bucket = ActorsByLabel.Find(OldLabel))
+	{
+		RemoveFromBucket(*Bucket);
+		if (Bucket->IsEmpty())
+		{
+			ActorsByLabel.Remove(OldLabel);
+		}
+	}
+}
+
+void FActorImplModule::AddToActorOctree(AActor* Actor)
+{
+	RemoveFromActorOctree(Actor);
+
+	// Actors without a root component (world settings, info actors) have no place in the world
+	if (!Actor->GetRootComponent())
+	{
+		return;
+	}
+
+	FVector Origin;
+	FVector Extent;
+	Actor->GetActorBounds(false, Origin, Extent, true);
+	FBox Bounds(Actor->GetActorLocation(), Actor->GetActorLocation());
+	if (!Extent.IsNearlyZero())
+	{
+		Bounds += FBox(Origin - Extent, Origin + Extent);
+	}
+
+	FActorOctreeElement Element;
+	Element.ActorKey = FObjectKey(Actor);
+	Element.Actor = Actor;
+	Element.Bounds = FBoxCenterAndExtent(Bounds);
+	Element.ElementIds = &ActorOctreeIds;
+	ActorOctree.AddElement(Element);
+}
+
+void FActorImplModule::RemoveFromActorOctree(AActor* Actor)
+{
+	FOctreeElementId2 ElementId;
+	if (ActorOctreeIds.RemoveAndCopyValue(FObjectKey(Actor), ElementId) && ActorOctree.IsValidElementId(ElementId))
+	{
+		ActorOctree.RemoveElement(ElementId);
+	}
+}
+
+void FActorImplModule::HandleLevelActorAdded(AActor* Actor)
+{
+	RecordActorChange(Actor, EActorChangeKind::Added);
+
+	if (!bActorIndexDirty && IsValid(Actor) && Actor->GetWorld() == IndexedWorld.Get())
+	{
+		AddToActorIndex(Actor);
+	}
+}
+
+void FActorImplModule::HandleLevelActorDeleted(AActor* Actor)
+{
+	RecordActorChange(Actor, EActorChangeKind::Removed);
+
+	if (!bActorIndexDirty && Actor)
+	{
+		RemoveFromActorIndex(Actor);
+	}
+}
+
+void FActorImplModule::HandleActorLabelChanged(AActor* Actor)
+{
+	RecordActorChange(Actor, EActorChangeKind::Modified);
+
+	if (!bActorIndexDirty && IsValid(Actor) && Actor->GetWorld() == IndexedWorld.Get())
+	{
+		AddToActorIndex(Actor);
+	}
+}
+
+void FActorImplModule::HandleMapChange(uint32 MapChangeFlags)
+{
+	bActorIndexDirty = true;
+	ResetChangeJournal();
+}
+
+void FActorImplModule::HandleLevelListChanged(ULevel* Level, UWorld* World)
+{
+	if (World == IndexedWorld.Get())
+	{
+		bActorIndexDirty = true;
+	}
+
+	// Streaming a level in or out adds and removes its actors without per-actor notifications
+	if (GEditor && World == GEditor->GetEditorWorldContext().World())
+	{
+		ResetChangeJournal();
+	}
+}
+
+void FActorImplModule::HandleLoadedActorAdded(AActor& Actor)
+{
+	// World Partition cells load actors into the persistent level without OnLevelActorAdded
+	RecordActorChange(&Actor, EActorChangeKind::Added);
+
+	if (!bActorIndexDirty && IsValid(&Actor) && Actor.GetWorld() == IndexedWorld.Get())
+	{
+		AddToActorIndex(&Actor);
+	}
+}
+
+void FActorImplModule::HandleLoadedActorRemoved(AActor& Actor)
+{
+	RecordActorChange(&Actor, EActorChangeKind::Removed);
+
+	if (!bActorIndexDirty)
+	{
+		RemoveFromActorIndex(&Actor);
+	}
+}
+
+void FActorImplModule::HandleActorMoved(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	// Attached actors move with their parent without a notification of their own
+	TArray<AActor*> MovedActors;
+	MovedActors.Add(Actor);
+	Actor->GetAttachedActors(MovedActors, false, true);
+
+	const bool bUpdateOctree = !bActorIndexDirty && Actor->GetWorld() == IndexedWorld.Get();
+	for (AActor* MovedActor : MovedActors)
+	{
+		if (IsValid(MovedActor))
+		{
+			RecordActorChange(MovedActor, EActorChangeKind::Modified);
+			if (bUpdateOctree)
+			{
+				AddToActorOctree(MovedActor);
+			}
+		}
+	}
+}
+
+void FActorImplModule::HandlePostUndoRedo()
+{
+	// Undo can move, add and remove actors without the usual notifications
+	bActorIndexDirty = true;
+}
+
+void FActorImplModule::HandleActorFolderChanged(const AActor* Actor, FName OldPath)
+{
+	RecordActorChange(Actor, EActorChangeKind::Modified);
+}
+
+void FActorImplModule::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Component edits count as a change of the owning actor
+	AActor* Actor = Cast<AActor>(Object);
+	if (!Actor && Object)
+	{
+		Actor = Object->GetTypedOuter<AActor>();
+	}
+
+	// Transform and component edits from the details panel or set_actor_property move the actor without OnActorMoved
+	if (IsValid(Actor))
+	{
+		HandleActorMoved(Actor);
+		return;
+	}
+	RecordActorChange(Actor, EActorChangeKind::Modified);
+}
+
+void FActorImplModule::HandleObjectTransacted(UObject* Object, const FTransactionObjectEvent& TransactionEvent)
+{
+	// Regular edits are journaled by the other handlers; undo and redo only show up here
+	if (TransactionEvent.GetEventType() != ETransactionObjectEventType::UndoRedo)
+	{
+		return;
+	}
+
+	const AActor* Actor = Cast<AActor>(Object);
+	if (!Actor && Object)
+	{
+		Actor = Object->GetTypedOuter<AActor>();
+	}
+
+	// Undoing a spawn leaves the actor garbage; undoing a delete brings it back
+	const bool bRemoved = Actor && (!IsValid(Actor) || !Actor->GetLevel());
+	RecordActorChange(Actor, bRemoved ? EActorChangeKind::Removed : EActorChangeKind::Modified);
+}
+
+void FActorImplModule::RecordActorChange(const AActor* Actor, EActorChangeKind Kind)
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!Actor || !World || Actor->IsTemplate() || Actor->GetWorld() != World)
+	{
+		return;
+	}
+
+	const FObjectKey ActorKey(Actor);
+	const uint64 Sequence = ++JournalSequence;
+	FActorJournalEntry& Entry = JournalEntries.FindOrAdd(ActorKey);
+	if (Kind == EActorChangeKind::Added || (Entry.bRemoved && Kind != EActorChangeKind::Removed))
+	{
+		Entry.AddedSequence = Sequence;
+	}
+	Entry.bRemoved = Kind == EActorChangeKind::Removed;
+	Entry.Sequence = Sequence;
+	Entry.Actor = Actor;
+	Entry.ActorName = Actor->GetName();
+	Entry.ActorLabel = Actor->GetActorLabel();
+	Entry.ActorClass = Actor->GetClass()->GetPathName();
+	JournalLog.Emplace(Sequence, ActorKey);
+
+	if (JournalLog.Num() > ActorImplHelpers::MaxJournalLength)
+	{
+		// Drop the oldest half; tokens from that range report a reset
+		const int32 DropCount = JournalLog.Num() / 2;
+		JournalOldestSequence = JournalLog[DropCount - 1].Key;
+		JournalLog.RemoveAt(0, DropCount);
+		for (auto It = JournalEntries.CreateIterator(); It; ++It)
+		{
+			if (It.Value().Sequence <= JournalOldestSequence)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+void FActorImplModule::ResetChangeJournal()
+{
+	JournalId = FGuid::NewGuid();
+	JournalSequence = 0;
+	JournalOldestSequence = 0;
+	JournalEntries.Reset();
+	JournalLog.Reset();
+}
+
+FString FActorImplModule::MakeChangeToken(uint64 Sequence) const
+{
+	return FString::Printf(TEXT("%s:%llu"), *JournalId.ToString(EGuidFormats::Digits), Sequence);
+}
+
+void FActorImplModule::BeginBatch(const FString& Description)
+{
+	MCP_TRACE_SCOPE("FActorImplModule::BeginBatch");
+
+	EditorBatch.BeginBatch(Description);
+}
+
+void FActorImplModule::EndBatch()
+{
+	MCP_TRACE_SCOPE("FActorImplModule::EndBatch");
+
+	EditorBatch.EndBatch();
 }
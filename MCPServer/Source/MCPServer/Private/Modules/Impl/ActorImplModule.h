@@ -2,25 +2,101 @@
 #pragma once
 
 #include "Modules/Interfaces/IActorModule.h"
+#include "Math/GenericOctree.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class IEditorBatchModule;
+class ULevel;
+class FTransactionObjectEvent;
+struct FPropertyChangedEvent;
+class UWorld;
+
+/**
+ * Actor bounds stored in the spatial index.
+ */
+struct FActorOctreeElement
+{
+	FObjectKey ActorKey;
+	TWeakObjectPtr<AActor> Actor;
+	FBoxCenterAndExtent Bounds;
+	/** Map receiving the element id whenever the octree moves the element */
+	TMap<FObjectKey, FOctreeElementId2>* ElementIds = nullptr;
+};
+
+struct FActorOctreeSemantics
+{
+	enum { MaxElementsPerLeaf = 16 };
+	enum { MinInclusiveElementsPerNode = 7 };
+	enum { MaxNodeDepth = 12 };
+
+	typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+
+	FORCEINLINE static const FBoxCenterAndExtent& GetBoundingBox(const FActorOctreeElement& Element)
+	{
+		return Element.Bounds;
+	}
+
+	FORCEINLINE static bool AreElementsEqual(const FActorOctreeElement& A, const FActorOctreeElement& B)
+	{
+		return A.ActorKey == B.ActorKey;
+	}
+
+	FORCEINLINE static void SetElementId(const FActorOctreeElement& Element, FOctreeElementId2 Id)
+	{
+		if (Element.ElementIds)
+		{
+			Element.ElementIds->Add(Element.ActorKey, Id);
+		}
+	}
+};
+
+using FActorOctree = TOctree2<FActorOctreeElement, FActorOctreeSemantics>;
+
+/**
+ * Latest journaled change of one actor.
+ */
+struct FActorJournalEntry
+{
+	TWeakObjectPtr<const AActor> Actor;
+	FString ActorName;
+	FString ActorLabel;
+	FString ActorClass;
+	/** Sequence number of the latest change */
+	uint64 Sequence = 0;
+	/** Sequence number at which the actor was added or restored, 0 if it existed before the journal */
+	uint64 AddedSequence = 0;
+	bool bRemoved = false;
+};
 
 /**
  * Actor module implementation using UEditorActorSubsystem.
+ * Keeps a name/label index and a loose octree of actor bounds for the editor world, updated from
+ * editor actor delegates, so identifier lookups and spatial queries do not scan the whole level.
+ * The same delegates feed a change journal that GetLevelChanges reads from a token onwards.
  */
 class FActorImplModule : public IActorModule
 {
 public:
+	explicit FActorImplModule(IEditorBatchModule& InEditorBatch);
+	virtual ~FActorImplModule() override;
+
 	virtual FActorSpawnResult SpawnActor(
 		const FString& ActorClassPath,
 		const FVector& Location,
 		const FRotator& Rotation) override;
 
+	virtual FActorSpawnBatchResult SpawnActorsBatch(const FActorSpawnBatchRequest& Request) override;
+
 	virtual FActorDeleteResult DeleteActor(const FString& ActorIdentifier) override;
 
 	virtual FActorDuplicateResult DuplicateActor(
 		const FString& ActorIdentifier,
 		const FVector& Offset) override;
 
-	virtual FGetActorsResult GetActorsInLevel(const FString& ClassFilter = TEXT("")) override;
+	virtual FGetActorsResult GetActorsInLevel(const FActorQuery& Query = FActorQuery()) override;
+
+	virtual FActorSpatialQueryResult QueryActorsSpatial(const FActorSpatialQuery& Query) override;
 
 	virtual FActorSelectionResult SelectActors(const TArray<FString>& ActorIdentifiers, bool bAddToSelection = false) override;
 
@@ -36,6 +112,8 @@ public:
 
 	virtual FActorPropertyResult GetActorProperty(const FString& ActorIdentifier, const FString& PropertyName) override;
 
+	virtual FActorPropertiesBulkResult GetActorPropertiesBulk(const FActorPropertiesBulkQuery& Query) override;
+
 	virtual FActorSetPropertyResult SetActorProperty(const FString& ActorIdentifier, const FString& PropertyName, const FString& PropertyValue) override;
 
 	virtual FActorConvertResult ConvertActor(const FString& ActorIdentifier, const FString& NewClassPath) override;
@@ -46,7 +124,85 @@ public:
 
 	virtual FSetActorFolderResult SetActorFolder(const FString& ActorIdentifier, const FString& FolderPath) override;
 
+	virtual FMergeToInstancesResult MergeToInstances(const FMergeToInstancesRequest& Request) override;
+
+	virtual FExplodeInstancesResult ExplodeInstances(const TArray<FString>& ActorIdentifiers) override;
+
+	virtual FLevelChangesResult GetLevelChanges(const FString& SinceToken) override;
+
+	virtual AActor* FindActor(const FString& ActorIdentifier) override;
+
+	virtual void BeginBatch(const FString& Description) override;
+	virtual void EndBatch() override;
+
 private:
+	using FActorBucket = TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>>;
+
+	/** Resolve an actor class path, as SpawnActor does. Returns nullptr and sets OutError on failure. */
+	static UClass* ResolveActorClass(const FString& ActorClassPath, FString& OutError);
+
 	/** Find actor by name, label, or path */
 	AActor* FindActorByIdentifier(const FString& ActorIdentifier);
+
+	/** Rebuild the index if the editor world changed or the index was invalidated */
+	void EnsureActorIndex();
+	void RebuildActorIndex(UWorld* World);
+	void AddToActorIndex(AActor* Actor);
+	void RemoveFromActorIndex(AActor* Actor);
+
+	void AddToActorOctree(AActor* Actor);
+	void RemoveFromActorOctree(AActor* Actor);
+
+	/** Editor delegate handlers */
+	void HandleLevelActorAdded(AActor* Actor);
+	void HandleLevelActorDeleted(AActor* Actor);
+	void HandleActorLabelChanged(AActor* Actor);
+	void HandleMapChange(uint32 MapChangeFlags);
+	void HandleLevelListChanged(ULevel* Level, UWorld* World);
+	void HandleLoadedActorAdded(AActor& Actor);
+	void HandleLoadedActorRemoved(AActor& Actor);
+	void HandleActorMoved(AActor* Actor);
+	void HandlePostUndoRedo();
+	void HandleActorFolderChanged(const AActor* Actor, FName OldPath);
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+	void HandleObjectTransacted(UObject* Object, const FTransactionObjectEvent& TransactionEvent);
+
+	/** Journal a change of an editor world actor */
+	void RecordActorChange(const AActor* Actor, EActorChangeKind Kind);
+	/** Start a new journal; tokens from the previous one report a reset */
+	void ResetChangeJournal();
+	FString MakeChangeToken(uint64 Sequence) const;
+
+	IEditorBatchModule& EditorBatch;
+
+	TWeakObjectPtr<UWorld> IndexedWorld;
+	bool bActorIndexDirty = true;
+	TMap<FName, FActorBucket> ActorsByName;
+	TMap<FString, FActorBucket> ActorsByLabel;
+	TMap<FObjectKey, FString> IndexedLabels;
+	FActorOctree ActorOctree;
+	TMap<FObjectKey, FOctreeElementId2> ActorOctreeIds;
+
+	/** Identifies the journal in tokens, so tokens from before a map change or restart are detected */
+	FGuid JournalId;
+	uint64 JournalSequence = 0;
+	/** Tokens below this sequence refer to compacted history */
+	uint64 JournalOldestSequence = 0;
+	TMap<FObjectKey, FActorJournalEntry> JournalEntries;
+	/** Every journaled change in sequence order; entries superseded by a later change of the same actor are skipped on read */
+	TArray<TPair<uint64, FObjectKey>> JournalLog;
+
+	FDelegateHandle LevelActorAddedHandle;
+	FDelegateHandle LevelActorDeletedHandle;
+	FDelegateHandle ActorLabelChangedHandle;
+	FDelegateHandle MapChangeHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle PostUndoRedoHandle;
+	FDelegateHandle ActorFolderChangedHandle;
+	FDelegateHandle ObjectPropertyChangedHandle;
+	FDelegateHandle ObjectTransactedHandle;
+	FDelegateHandle LoadedActorAddedHandle;
+	FDelegateHandle LoadedActorRemovedHandle;
 };
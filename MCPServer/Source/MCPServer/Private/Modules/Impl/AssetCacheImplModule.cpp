@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Modules/Impl/AssetCacheImplModule.h"
+#include "Core/MCPTrace.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+
+FAssetCacheImplModule::FAssetCacheImplModule()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FAssetCacheImplModule::HandleAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FAssetCacheImplModule::HandleAssetRenamed);
+	PackageReloadedHandle = FCoreUObjectDelegates::OnPackageReloaded.AddRaw(this, &FAssetCacheImplModule::HandlePackageReloaded);
+}
+
+FAssetCacheImplModule::~FAssetCacheImplModule()
+{
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+	FCoreUObjectDelegates::OnPackageReloaded.Remove(PackageReloadedHandle);
+}
+
+UObject* FAssetCacheImplModule::LoadAsset(const FString& AssetPath, UClass* AssetClass)
+{
+	MCP_TRACE_SCOPE("FAssetCacheImplModule::LoadAsset");
+
+	const FSoftObjectPath Key(AssetPath);
+
+	if (const TWeakObjectPtr<UObject>* Cached = CachedAssets.Find(Key))
+	{
+		// Weak pointers go stale on GC; the package check catches objects renamed away from this path
+		UObject* Asset = Cached->Get();
+		if (IsValid(Asset) && Asset->GetPackage()->GetFName() == Key.GetLongPackageFName())
+		{
+			if (AssetClass && !Asset->IsA(AssetClass))
+			{
+				return nullptr;
+			}
+			Stats.Hits++;
+			return Asset;
+		}
+		CachedAssets.Remove(Key);
+		Stats.Invalidations++;
+	}
+
+	Stats.Misses++;
+	UObject* Asset = StaticLoadObject(AssetClass ? AssetClass : UObject::StaticClass(), nullptr, *AssetPath);
+	if (Asset)
+	{
+		CachedAssets.Add(Key, Asset);
+	}
+	return Asset;
+}
+
+FAssetCacheStats FAssetCacheImplModule::GetStats() const
+{
+	MCP_TRACE_SCOPE("FAssetCacheImplModule::GetStats");
+
+	FAssetCacheStats Result = Stats;
+	Result.CachedCount = CachedAssets.Num();
+	return Result;
+}
+
+void FAssetCacheImplModule::ClearCache()
+{
+	MCP_TRACE_SCOPE("FAssetCacheImplModule::ClearCache");
+
+	Stats.Invalidations += CachedAssets.Num();
+	CachedAssets.Reset();
+}
+
+void FAssetCacheImplModule::InvalidatePackage(FName PackageName)
+{
+	for (auto It = CachedAssets.CreateIterator(); It; ++It)
+	{
+		if (It.Key().GetLongPackageFName() == PackageName)
+		{
+			It.RemoveCurrent();
+			Stats.Invalidations++;
+		}
+	}
+}
+
+void FAssetCacheImplModule::HandleAssetRemoved(const FAssetData& AssetData)
+{
+	InvalidatePackage(AssetData.PackageName);
+}
+
+void FAssetCacheImplModule::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	InvalidatePackage(FSoftObjectPath(OldObjectPath).GetLongPackageFName());
+}
+
+void FAssetCacheImplModule::HandlePackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* ReloadedEvent)
+{
+	if (Phase == EPackageReloadPhase::PostPackageFixup && ReloadedEvent && ReloadedEvent->GetOldPackage())
+	{
+		InvalidatePackage(ReloadedEvent->GetOldPackage()->GetFName());
+	}
+}
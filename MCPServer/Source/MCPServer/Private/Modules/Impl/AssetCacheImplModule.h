@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "Modules/Interfaces/IAssetCacheModule.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/WeakObjectPtr.h"
+
+struct FAssetData;
+class FPackageReloadedEvent;
+enum class EPackageReloadPhase : uint8;
+
+/**
+ * Asset cache implementation keyed by FSoftObjectPath.
+ * Entries hold weak pointers and are dropped when the Asset Registry reports
+ * the asset removed or renamed, or its package is reloaded.
+ */
+class FAssetCacheImplModule : public IAssetCacheModule
+{
+public:
+	FAssetCacheImplModule();
+	virtual ~FAssetCacheImplModule() override;
+
+	virtual UObject* LoadAsset(const FString& AssetPath, UClass* AssetClass) override;
+	using IAssetCacheModule::LoadAsset;
+
+	virtual FAssetCacheStats GetStats() const override;
+	virtual void ClearCache() override;
+
+private:
+	void InvalidatePackage(FName PackageName);
+
+	void HandleAssetRemoved(const FAssetData& AssetData);
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void HandlePackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* ReloadedEvent);
+
+	TMap<FSoftObjectPath, TWeakObjectPtr<UObject>> CachedAssets;
+	FAssetCacheStats Stats;
+
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle PackageReloadedHandle;
+};
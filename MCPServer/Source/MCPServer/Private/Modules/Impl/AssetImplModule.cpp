@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/AssetImplModule.h"
+#include "Core/MCPTrace.h"
 #include "Editor.h"
 #include "Subsystems/EditorAssetSubsystem.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -14,6 +15,8 @@
 
 FAssetLoadResult FAssetImplModule::LoadAsset(const FString& AssetPath)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::LoadAsset");
+
 	FAssetLoadResult Result;
 
 	UEditorAssetSubsystem* AssetSubsystem = GEditor->GetEditorSubsystem<UEditorAssetSubsystem>();
@@ -41,6 +44,8 @@ FAssetLoadResult FAssetImplModule::LoadAsset(const FString& AssetPath)
 
 FAssetCreateResult FAssetImplModule::CreateAsset(const FString& AssetName, const FString& PackagePath, const FString& AssetClassName)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::CreateAsset");
+
 	FAssetCreateResult Result;
 
 	UClass* AssetClass = FindObject<UClass>(nullptr, *AssetClassName);
@@ -90,6 +95,8 @@ FAssetCreateResult FAssetImplModule::CreateAsset(const FString& AssetName, const
 
 FAssetDuplicateResult FAssetImplModule::DuplicateAsset(const FString& SourcePath, const FString& DestinationPath)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::DuplicateAsset");
+
 	FAssetDuplicateResult Result;
 
 	UEditorAssetSubsystem* AssetSubsystem = GEditor->GetEditorSubsystem<UEditorAssetSubsystem>();
@@ -116,6 +123,8 @@ FAssetDuplicateResult FAssetImplModule::DuplicateAsset(const FString& SourcePath
 
 FAssetRenameResult FAssetImplModule::RenameAsset(const FString& SourcePath, const FString& DestinationPath)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::RenameAsset");
+
 	FAssetRenameResult Result;
 
 	UEditorAssetSubsystem* AssetSubsystem = GEditor->GetEditorSubsystem<UEditorAssetSubsystem>();
@@ -141,6 +150,8 @@ FAssetRenameResult FAssetImplModule::RenameAsset(const FString& SourcePath, cons
 
 FAssetDeleteResult FAssetImplModule::DeleteAsset(const FString& AssetPath)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::DeleteAsset");
+
 	FAssetDeleteResult Result;
 
 	UEditorAssetSubsystem* AssetSubsystem = GEditor->GetEditorSubsystem<UEditorAssetSubsystem>();
@@ -165,6 +176,8 @@ FAssetDeleteResult FAssetImplModule::DeleteAsset(const FString& AssetPath)
 
 FAssetSaveResult FAssetImplModule::SaveAsset(const FString& AssetPath)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::SaveAsset");
+
 	FAssetSaveResult Result;
 
 	// Try loading the object to get its package
@@ -208,6 +221,8 @@ FAssetSaveResult FAssetImplModule::SaveAsset(const FString& AssetPath)
 
 FAssetFindResult FAssetImplModule::FindAssets(const FString& PackagePath, const FString& ClassName, bool bRecursive, const FString& NameFilter, int32 Limit)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::FindAssets");
+
 	FAssetFindResult Result;
 
 	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
@@ -264,6 +279,8 @@ FAssetFindResult FAssetImplModule::FindAssets(const FString& PackagePath, const
 
 FAssetListResult FAssetImplModule::ListAssets(const FString& DirectoryPath, bool bRecursive)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::ListAssets");
+
 	FAssetListResult Result;
 
 	UEditorAssetSubsystem* AssetSubsystem = GEditor->GetEditorSubsystem<UEditorAssetSubsystem>();
@@ -281,6 +298,8 @@ FAssetListResult FAssetImplModule::ListAssets(const FString& DirectoryPath, bool
 
 FAssetImportResult FAssetImplModule::ImportAsset(const FString& FilePath, const FString& DestinationPath)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::ImportAsset");
+
 	FAssetImportResult Result;
 
 	IAssetTools& AssetTools = FAssetToolsModule::GetModule().Get();
@@ -311,6 +330,8 @@ FAssetImportResult FAssetImplModule::ImportAsset(const FString& FilePath, const
 
 FAssetExportResult FAssetImplModule::ExportAsset(const FString& AssetPath, const FString& ExportPath)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::ExportAsset");
+
 	FAssetExportResult Result;
 
 	IAssetTools& AssetTools = FAssetToolsModule::GetModule().Get();
@@ -326,6 +347,8 @@ FAssetExportResult FAssetImplModule::ExportAsset(const FString& AssetPath, const
 
 FAssetDependenciesResult FAssetImplModule::GetAssetDependencies(const FString& AssetPath)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::GetAssetDependencies");
+
 	FAssetDependenciesResult Result;
 
 	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
@@ -351,6 +374,8 @@ FAssetDependenciesResult FAssetImplModule::GetAssetDependencies(const FString& A
 
 FAssetReferencersResult FAssetImplModule::GetAssetReferencers(const FString& AssetPath)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::GetAssetReferencers");
+
 	FAssetReferencersResult Result;
 
 	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
@@ -375,6 +400,8 @@ FAssetReferencersResult FAssetImplModule::GetAssetReferencers(const FString& Ass
 
 FAssetMetadataResult FAssetImplModule::GetAssetMetadata(const FString& AssetPath)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::GetAssetMetadata");
+
 	FAssetMetadataResult Result;
 
 	UEditorAssetSubsystem* AssetSubsystem = GEditor->GetEditorSubsystem<UEditorAssetSubsystem>();
@@ -405,6 +432,8 @@ FAssetMetadataResult FAssetImplModule::GetAssetMetadata(const FString& AssetPath
 
 FAssetSetMetadataResult FAssetImplModule::SetAssetMetadata(const FString& AssetPath, const FString& TagName, const FString& TagValue)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::SetAssetMetadata");
+
 	FAssetSetMetadataResult Result;
 
 	UEditorAssetSubsystem* AssetSubsystem = GEditor->GetEditorSubsystem<UEditorAssetSubsystem>();
@@ -431,6 +460,8 @@ FAssetSetMetadataResult FAssetImplModule::SetAssetMetadata(const FString& AssetP
 
 FAssetSetPropertyResult FAssetImplModule::SetAssetProperty(const FString& AssetPath, const FString& PropertyName, const FString& PropertyValue)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::SetAssetProperty");
+
 	FAssetSetPropertyResult Result;
 
 	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
@@ -465,6 +496,8 @@ FAssetSetPropertyResult FAssetImplModule::SetAssetProperty(const FString& AssetP
 
 FAssetGetPropertyResult FAssetImplModule::GetAssetProperty(const FString& AssetPath, const FString& PropertyName)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::GetAssetProperty");
+
 	FAssetGetPropertyResult Result;
 
 	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
@@ -493,6 +526,8 @@ FAssetGetPropertyResult FAssetImplModule::GetAssetProperty(const FString& AssetP
 
 FAssetFindReferencersOfClassResult FAssetImplModule::FindReferencersOfClass(const FString& ClassPath, const FString& PackagePath, bool bRecursive)
 {
+	MCP_TRACE_SCOPE("FAssetImplModule::FindReferencersOfClass");
+
 	FAssetFindReferencersOfClassResult Result;
 
 	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
@@ -1,7 +1,10 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/BlueprintImplModule.h"
+#include "Core/MCPTrace.h"
 #include "Modules/Interfaces/IActorModule.h"
+#include "Modules/Interfaces/IAssetCacheModule.h"
+#include "Modules/Interfaces/IEditorBatchModule.h"
 #include "Engine/Blueprint.h"
 #include "Engine/SCS_Node.h"
 #include "Engine/SimpleConstructionScript.h"
@@ -10,7 +13,6 @@
 #include "KismetCompilerModule.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Subsystems/AssetEditorSubsystem.h"
-#include "Subsystems/EditorActorSubsystem.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraphNode_Comment.h"
@@ -39,13 +41,28 @@
 #include "Components/SceneComponent.h"
 #include "Components/PrimitiveComponent.h"
 
-FBlueprintImplModule::FBlueprintImplModule(IActorModule& InActorModule)
+FBlueprintImplModule::FBlueprintImplModule(IActorModule& InActorModule, IAssetCacheModule& InAssetCache, IEditorBatchModule& InEditorBatch)
 	: ActorModule(InActorModule)
+	, AssetCache(InAssetCache)
+	, EditorBatch(InEditorBatch)
 {
 }
 
+FBlueprintImplModule::~FBlueprintImplModule()
+{
+	for (TPair<FObjectKey, FGraphNodeCache>& Pair : NodeCaches)
+	{
+		if (UEdGraph* Graph = Pair.Value.Graph.Get())
+		{
+			Graph->RemoveOnGraphChangedHandler(Pair.Value.GraphChangedHandle);
+		}
+	}
+}
+
 FBlueprintCreateResult FBlueprintImplModule::CreateBlueprint(const FString& BlueprintPath, const FString& ParentClassPath)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::CreateBlueprint");
+
 	FBlueprintCreateResult Result;
 
 	// Find parent class
@@ -122,27 +139,12 @@ FBlueprintCreateResult FBlueprintImplModule::CreateBlueprint(const FString& Blue
 
 FBlueprintFromActorResult FBlueprintImplModule::CreateBlueprintFromActor(const FString& BlueprintPath, const FString& ActorIdentifier)
 {
-	FBlueprintFromActorResult Result;
+	MCP_TRACE_SCOPE("FBlueprintImplModule::CreateBlueprintFromActor");
 
-	UEditorActorSubsystem* EditorActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-	if (!EditorActorSubsystem)
-	{
-		Result.bSuccess = false;
-		Result.ErrorMessage = TEXT("UEditorActorSubsystem is not available");
-		return Result;
-	}
+	FBlueprintFromActorResult Result;
 
 	// Find the actor
-	AActor* Actor = nullptr;
-	TArray<AActor*> AllActors = EditorActorSubsystem->GetAllLevelActors();
-	for (AActor* A : AllActors)
-	{
-		if (A && (A->GetName() == ActorIdentifier || A->GetActorLabel() == ActorIdentifier))
-		{
-			Actor = A;
-			break;
-		}
-	}
+	AActor* Actor = ActorModule.FindActor(ActorIdentifier);
 
 	if (!Actor)
 	{
@@ -172,9 +174,11 @@ FBlueprintFromActorResult FBlueprintImplModule::CreateBlueprintFromActor(const F
 
 FBlueprintCompileResult FBlueprintImplModule::CompileBlueprint(const FString& BlueprintPath)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::CompileBlueprint");
+
 	FBlueprintCompileResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -196,9 +200,11 @@ FBlueprintCompileResult FBlueprintImplModule::CompileBlueprint(const FString& Bl
 
 FBlueprintVariableResult FBlueprintImplModule::AddBlueprintVariable(const FString& BlueprintPath, const FString& VariableName, const FString& VariableType)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::AddBlueprintVariable");
+
 	FBlueprintVariableResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -285,7 +291,7 @@ FBlueprintVariableResult FBlueprintImplModule::AddBlueprintVariable(const FStrin
 		return Result;
 	}
 
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	Result.VariableName = VariableName;
@@ -294,9 +300,11 @@ FBlueprintVariableResult FBlueprintImplModule::AddBlueprintVariable(const FStrin
 
 FBlueprintVariableResult FBlueprintImplModule::RemoveBlueprintVariable(const FString& BlueprintPath, const FString& VariableName)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::RemoveBlueprintVariable");
+
 	FBlueprintVariableResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -305,7 +313,7 @@ FBlueprintVariableResult FBlueprintImplModule::RemoveBlueprintVariable(const FSt
 	}
 
 	FBlueprintEditorUtils::RemoveMemberVariable(Blueprint, FName(*VariableName));
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	Result.VariableName = VariableName;
@@ -314,9 +322,11 @@ FBlueprintVariableResult FBlueprintImplModule::RemoveBlueprintVariable(const FSt
 
 FBlueprintFunctionResult FBlueprintImplModule::AddBlueprintFunction(const FString& BlueprintPath, const FString& FunctionName)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::AddBlueprintFunction");
+
 	FBlueprintFunctionResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -339,7 +349,7 @@ FBlueprintFunctionResult FBlueprintImplModule::AddBlueprintFunction(const FStrin
 	}
 
 	FBlueprintEditorUtils::AddFunctionGraph(Blueprint, NewGraph, true, static_cast<UFunction*>(nullptr));
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	Result.FunctionName = FunctionName;
@@ -348,9 +358,11 @@ FBlueprintFunctionResult FBlueprintImplModule::AddBlueprintFunction(const FStrin
 
 FBlueprintInterfaceResult FBlueprintImplModule::AddBlueprintInterface(const FString& BlueprintPath, const FString& InterfacePath)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::AddBlueprintInterface");
+
 	FBlueprintInterfaceResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -381,7 +393,7 @@ FBlueprintInterfaceResult FBlueprintImplModule::AddBlueprintInterface(const FStr
 		return Result;
 	}
 
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	Result.InterfaceName = InterfacePath;
@@ -390,9 +402,11 @@ FBlueprintInterfaceResult FBlueprintImplModule::AddBlueprintInterface(const FStr
 
 FBlueprintGraphsResult FBlueprintImplModule::GetBlueprintGraphs(const FString& BlueprintPath)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::GetBlueprintGraphs");
+
 	FBlueprintGraphsResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -454,9 +468,11 @@ FBlueprintGraphsResult FBlueprintImplModule::GetBlueprintGraphs(const FString& B
 
 FBlueprintReparentResult FBlueprintImplModule::ReparentBlueprint(const FString& BlueprintPath, const FString& NewParentClassPath)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::ReparentBlueprint");
+
 	FBlueprintReparentResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -480,7 +496,7 @@ FBlueprintReparentResult FBlueprintImplModule::ReparentBlueprint(const FString&
 
 	Blueprint->ParentClass = NewParentClass;
 	FBlueprintEditorUtils::RefreshAllNodes(Blueprint);
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipSave, nullptr);
 
 	Result.bSuccess = true;
@@ -490,9 +506,11 @@ FBlueprintReparentResult FBlueprintImplModule::ReparentBlueprint(const FString&
 
 FBlueprintOpenEditorResult FBlueprintImplModule::OpenBlueprintEditor(const FString& BlueprintPath)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::OpenBlueprintEditor");
+
 	FBlueprintOpenEditorResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -523,12 +541,25 @@ FBlueprintOpenEditorResult FBlueprintImplModule::OpenBlueprintEditor(const FStri
 
 UEdGraph* FBlueprintImplModule::FindGraph(UBlueprint* Blueprint, const FString& GraphName)
 {
+	const TPair<FObjectKey, FString> GraphKey(FObjectKey(Blueprint), GraphName);
+	if (const TWeakObjectPtr<UEdGraph>* Cached = GraphsByName.Find(GraphKey))
+	{
+		// Renamed or removed graphs fail these checks and fall through to a fresh search
+		UEdGraph* Graph = Cached->Get();
+		if (IsValid(Graph) && Graph->GetName() == GraphName && Graph->GetTypedOuter<UBlueprint>() == Blueprint)
+		{
+			return Graph;
+		}
+		GraphsByName.Remove(GraphKey);
+	}
+
 	TArray<UEdGraph*> AllGraphs;
 	Blueprint->GetAllGraphs(AllGraphs);
 	for (UEdGraph* Graph : AllGraphs)
 	{
 		if (Graph && Graph->GetName() == GraphName)
 		{
+			GraphsByName.Add(GraphKey, Graph);
 			return Graph;
 		}
 	}
@@ -537,21 +568,104 @@ UEdGraph* FBlueprintImplModule::FindGraph(UBlueprint* Blueprint, const FString&
 
 UEdGraphNode* FBlueprintImplModule::FindNodeById(UEdGraph* Graph, const FString& NodeId)
 {
-	for (UEdGraphNode* Node : Graph->Nodes)
+	// Node IDs are NodeGuid strings; anything that does not parse cannot match
+	FGuid NodeGuid;
+	if (!FGuid::Parse(NodeId, NodeGuid))
 	{
-		if (Node && Node->NodeGuid.ToString() == NodeId)
+		return nullptr;
+	}
+
+	FGraphNodeCache& Cache = GetNodeCache(Graph);
+	if (Cache.bDirty)
+	{
+		Cache.NodesByGuid.Reset();
+		for (UEdGraphNode* Node : Graph->Nodes)
 		{
-			return Node;
+			if (Node)
+			{
+				Cache.NodesByGuid.Add(Node->NodeGuid, Node);
+			}
 		}
+		Cache.bDirty = false;
+	}
+
+	// A miss is final until the graph reports a change; nodes destroyed without one leave dead entries
+	const TWeakObjectPtr<UEdGraphNode>* Cached = Cache.NodesByGuid.Find(NodeGuid);
+	UEdGraphNode* Node = Cached ? Cached->Get() : nullptr;
+	if (IsValid(Node) && Node->NodeGuid == NodeGuid && Node->GetGraph() == Graph)
+	{
+		return Node;
 	}
 	return nullptr;
 }
 
+FBlueprintImplModule::FGraphNodeCache& FBlueprintImplModule::GetNodeCache(UEdGraph* Graph)
+{
+	const FObjectKey GraphKey(Graph);
+	if (FGraphNodeCache* Existing = NodeCaches.Find(GraphKey))
+	{
+		if (Existing->Graph.Get() == Graph)
+		{
+			return *Existing;
+		}
+		NodeCaches.Remove(GraphKey);
+	}
+
+	FGraphNodeCache& Cache = NodeCaches.Add(GraphKey);
+	Cache.Graph = Graph;
+	Cache.GraphChangedHandle = Graph->AddOnGraphChangedHandler(
+		FOnGraphChanged::FDelegate::CreateRaw(this, &FBlueprintImplModule::HandleGraphChanged, GraphKey));
+	return Cache;
+}
+
+void FBlueprintImplModule::HandleGraphChanged(const FEdGraphEditAction& Action, FObjectKey GraphKey)
+{
+	// Bound per graph because undo notifies with an empty action
+	if (FGraphNodeCache* Cache = NodeCaches.Find(GraphKey))
+	{
+		Cache->bDirty = true;
+	}
+}
+
+void FBlueprintImplModule::MarkBlueprintModified(UBlueprint* Blueprint, bool bStructural)
+{
+	if (bStructural)
+	{
+		EditorBatch.RunOrDefer(Blueprint, TEXT("StructurallyModified"), [](UObject* Object)
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(CastChecked<UBlueprint>(Object));
+		});
+	}
+	else
+	{
+		EditorBatch.RunOrDefer(Blueprint, TEXT("Modified"), [](UObject* Object)
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsModified(CastChecked<UBlueprint>(Object));
+		});
+	}
+}
+
+void FBlueprintImplModule::BeginBatch(const FString& Description)
+{
+	MCP_TRACE_SCOPE("FBlueprintImplModule::BeginBatch");
+
+	EditorBatch.BeginBatch(Description);
+}
+
+void FBlueprintImplModule::EndBatch()
+{
+	MCP_TRACE_SCOPE("FBlueprintImplModule::EndBatch");
+
+	EditorBatch.EndBatch();
+}
+
 FGetGraphNodesResult FBlueprintImplModule::GetGraphNodes(const FString& BlueprintPath, const FString& GraphName)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::GetGraphNodes");
+
 	FGetGraphNodesResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -600,7 +714,9 @@ FGetGraphNodesResult FBlueprintImplModule::GetGraphNodes(const FString& Blueprin
 			{
 				if (LinkedPin)
 				{
+					const UEdGraphNode* LinkedNode = LinkedPin->GetOwningNodeUnchecked();
 					PinInfo.ConnectedPinIds.Add(LinkedPin->PinId.ToString());
+					PinInfo.ConnectedNodeIds.Add(LinkedNode ? LinkedNode->NodeGuid.ToString() : FString());
 				}
 			}
 
@@ -616,9 +732,11 @@ FGetGraphNodesResult FBlueprintImplModule::GetGraphNodes(const FString& Blueprin
 
 FSetNodePositionResult FBlueprintImplModule::SetNodePosition(const FString& BlueprintPath, const FString& GraphName, const FString& NodeId, int32 PosX, int32 PosY)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::SetNodePosition");
+
 	FSetNodePositionResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -642,9 +760,10 @@ FSetNodePositionResult FBlueprintImplModule::SetNodePosition(const FString& Blue
 		return Result;
 	}
 
+	Node->Modify();
 	Node->NodePosX = PosX;
 	Node->NodePosY = PosY;
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	return Result;
@@ -652,9 +771,11 @@ FSetNodePositionResult FBlueprintImplModule::SetNodePosition(const FString& Blue
 
 FAddCommentBoxResult FBlueprintImplModule::AddCommentBox(const FString& BlueprintPath, const FString& GraphName, const FString& CommentText, int32 PosX, int32 PosY, int32 Width, int32 Height, const FLinearColor* Color, const TArray<FString>* NodeIds)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::AddCommentBox");
+
 	FAddCommentBoxResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -731,7 +852,7 @@ FAddCommentBoxResult FBlueprintImplModule::AddCommentBox(const FString& Blueprin
 		CommentNode->CommentColor = *Color;
 	}
 
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	Result.NodeId = CommentNode->NodeGuid.ToString();
@@ -740,9 +861,11 @@ FAddCommentBoxResult FBlueprintImplModule::AddCommentBox(const FString& Blueprin
 
 FDeleteCommentBoxResult FBlueprintImplModule::DeleteCommentBox(const FString& BlueprintPath, const FString& GraphName, const FString& NodeId)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::DeleteCommentBox");
+
 	FDeleteCommentBoxResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -775,7 +898,7 @@ FDeleteCommentBoxResult FBlueprintImplModule::DeleteCommentBox(const FString& Bl
 	}
 
 	Graph->RemoveNode(CommentNode);
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	return Result;
@@ -783,9 +906,11 @@ FDeleteCommentBoxResult FBlueprintImplModule::DeleteCommentBox(const FString& Bl
 
 FSetCommentBoxPropertiesResult FBlueprintImplModule::SetCommentBoxProperties(const FString& BlueprintPath, const FString& GraphName, const FString& NodeId, const FString* CommentText, const FLinearColor* Color, const int32* PosX, const int32* PosY, const int32* Width, const int32* Height)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::SetCommentBoxProperties");
+
 	FSetCommentBoxPropertiesResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.bSuccess = false;
@@ -842,7 +967,7 @@ FSetCommentBoxPropertiesResult FBlueprintImplModule::SetCommentBoxProperties(con
 		CommentNode->NodeHeight = *Height;
 	}
 
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	return Result;
@@ -854,9 +979,11 @@ FSetCommentBoxPropertiesResult FBlueprintImplModule::SetCommentBoxProperties(con
 
 FAddBlueprintComponentResult FBlueprintImplModule::AddBlueprintComponent(const FString& BlueprintPath, const FString& ComponentClass, const FString* ComponentName, const FString* ParentComponent)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::AddBlueprintComponent");
+
 	FAddBlueprintComponentResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -924,9 +1051,9 @@ FAddBlueprintComponentResult FBlueprintImplModule::AddBlueprintComponent(const F
 		SCS->AddNode(NewNode);
 	}
 
-	// Use MarkBlueprintAsStructurallyModified to trigger skeleton class regeneration
+	// Structural modification triggers skeleton class regeneration
 	// so that new component variables are immediately available for VariableGet nodes
-	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	MarkBlueprintModified(Blueprint, true);
 
 	Result.bSuccess = true;
 	Result.ComponentName = NewNode->GetVariableName().ToString();
@@ -937,9 +1064,11 @@ FAddBlueprintComponentResult FBlueprintImplModule::AddBlueprintComponent(const F
 
 FRemoveBlueprintComponentResult FBlueprintImplModule::RemoveBlueprintComponent(const FString& BlueprintPath, const FString& ComponentName)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::RemoveBlueprintComponent");
+
 	FRemoveBlueprintComponentResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -970,7 +1099,7 @@ FRemoveBlueprintComponentResult FBlueprintImplModule::RemoveBlueprintComponent(c
 	}
 
 	SCS->RemoveNodeAndPromoteChildren(TargetNode);
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	return Result;
@@ -978,9 +1107,11 @@ FRemoveBlueprintComponentResult FBlueprintImplModule::RemoveBlueprintComponent(c
 
 FGetBlueprintComponentsResult FBlueprintImplModule::GetBlueprintComponents(const FString& BlueprintPath)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::GetBlueprintComponents");
+
 	FGetBlueprintComponentsResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -1025,9 +1156,11 @@ FGetBlueprintComponentsResult FBlueprintImplModule::GetBlueprintComponents(const
 
 FSetBlueprintComponentPropertyResult FBlueprintImplModule::SetBlueprintComponentProperty(const FString& BlueprintPath, const FString& ComponentName, const FString& PropertyName, const FString& PropertyValue)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::SetBlueprintComponentProperty");
+
 	FSetBlueprintComponentPropertyResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -1078,7 +1211,7 @@ FSetBlueprintComponentPropertyResult FBlueprintImplModule::SetBlueprintComponent
 		return Result;
 	}
 
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	return Result;
@@ -1086,9 +1219,11 @@ FSetBlueprintComponentPropertyResult FBlueprintImplModule::SetBlueprintComponent
 
 FGetBlueprintComponentPropertyResult FBlueprintImplModule::GetBlueprintComponentProperty(const FString& BlueprintPath, const FString& ComponentName, const FString& PropertyName)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::GetBlueprintComponentProperty");
+
 	FGetBlueprintComponentPropertyResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -1160,9 +1295,11 @@ FGetBlueprintComponentPropertyResult FBlueprintImplModule::GetBlueprintComponent
 
 FAddGraphNodeResult FBlueprintImplModule::AddGraphNode(const FString& BlueprintPath, const FString& GraphName, const FString& NodeType, const FString* MemberName, const FString* Target, const int32* PosX, const int32* PosY)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::AddGraphNode");
+
 	FAddGraphNodeResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -1612,7 +1749,7 @@ FAddGraphNodeResult FBlueprintImplModule::AddGraphNode(const FString& BlueprintP
 		return Result;
 	}
 
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	Result.NodeId = NewNode->NodeGuid.ToString();
@@ -1635,9 +1772,11 @@ FAddGraphNodeResult FBlueprintImplModule::AddGraphNode(const FString& BlueprintP
 
 FConnectGraphPinsResult FBlueprintImplModule::ConnectGraphPins(const FString& BlueprintPath, const FString& GraphName, const FString& SourceNodeId, const FString& SourcePinName, const FString& TargetNodeId, const FString& TargetPinName)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::ConnectGraphPins");
+
 	FConnectGraphPinsResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -1705,7 +1844,7 @@ FConnectGraphPinsResult FBlueprintImplModule::ConnectGraphPins(const FString& Bl
 		return Result;
 	}
 
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	return Result;
@@ -1713,9 +1852,11 @@ FConnectGraphPinsResult FBlueprintImplModule::ConnectGraphPins(const FString& Bl
 
 FSetPinDefaultValueResult FBlueprintImplModule::SetPinDefaultValue(const FString& BlueprintPath, const FString& GraphName, const FString& NodeId, const FString& PinName, const FString& DefaultValue)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::SetPinDefaultValue");
+
 	FSetPinDefaultValueResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -1760,7 +1901,7 @@ FSetPinDefaultValueResult FBlueprintImplModule::SetPinDefaultValue(const FString
 	const UEdGraphSchema* Schema = Graph->GetSchema();
 	Schema->TrySetDefaultValue(*Pin, DefaultValue);
 
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	return Result;
@@ -1768,9 +1909,11 @@ FSetPinDefaultValueResult FBlueprintImplModule::SetPinDefaultValue(const FString
 
 FDeleteGraphNodeResult FBlueprintImplModule::DeleteGraphNode(const FString& BlueprintPath, const FString& GraphName, const FString& NodeId)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::DeleteGraphNode");
+
 	FDeleteGraphNodeResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -1792,7 +1935,7 @@ FDeleteGraphNodeResult FBlueprintImplModule::DeleteGraphNode(const FString& Blue
 	}
 
 	Graph->RemoveNode(Node);
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	return Result;
@@ -1804,9 +1947,11 @@ FDeleteGraphNodeResult FBlueprintImplModule::DeleteGraphNode(const FString& Blue
 
 FAddEventDispatcherResult FBlueprintImplModule::AddEventDispatcher(const FString& BlueprintPath, const FString& DispatcherName, const TArray<FEventDispatcherParamInfo>* Parameters)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::AddEventDispatcher");
+
 	FAddEventDispatcherResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -1936,7 +2081,7 @@ FAddEventDispatcherResult FBlueprintImplModule::AddEventDispatcher(const FString
 		}
 	}
 
-	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	MarkBlueprintModified(Blueprint, true);
 
 	Result.bSuccess = true;
 	Result.DispatcherName = DispatcherName;
@@ -1950,9 +2095,11 @@ FAddEventDispatcherResult FBlueprintImplModule::AddEventDispatcher(const FString
 
 FGetBlueprintParentClassResult FBlueprintImplModule::GetBlueprintParentClass(const FString& BlueprintPath)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::GetBlueprintParentClass");
+
 	FGetBlueprintParentClassResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -2002,6 +2149,8 @@ static FString ResolveNodeId(const FString& IdOrGuid, const TMap<FString, FStrin
 
 FAddGraphNodesBatchResult FBlueprintImplModule::AddGraphNodesBatch(const FString& BlueprintPath, const FString& GraphName, const TArray<FAddGraphNodesBatchNodeInfo>& Nodes, const TArray<FAddGraphNodesBatchConnection>* Connections)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::AddGraphNodesBatch");
+
 	FAddGraphNodesBatchResult Result;
 
 	// Track created node IDs for rollback
@@ -2096,9 +2245,11 @@ FAddGraphNodesBatchResult FBlueprintImplModule::AddGraphNodesBatch(const FString
 
 FDisconnectGraphPinsResult FBlueprintImplModule::DisconnectGraphPins(const FString& BlueprintPath, const FString& GraphName, const FString& SourceNodeId, const FString& SourcePinName, const FString& TargetNodeId, const FString& TargetPinName)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::DisconnectGraphPins");
+
 	FDisconnectGraphPinsResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -2167,7 +2318,7 @@ FDisconnectGraphPinsResult FBlueprintImplModule::DisconnectGraphPins(const FStri
 	}
 
 	SourcePin->BreakLinkTo(TargetPin);
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	MarkBlueprintModified(Blueprint);
 
 	Result.bSuccess = true;
 	return Result;
@@ -2179,9 +2330,11 @@ FDisconnectGraphPinsResult FBlueprintImplModule::DisconnectGraphPins(const FStri
 
 FGetGraphNodesInAreaResult FBlueprintImplModule::GetGraphNodesInArea(const FString& BlueprintPath, const FString& GraphName, int32 MinX, int32 MinY, int32 MaxX, int32 MaxY)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::GetGraphNodesInArea");
+
 	FGetGraphNodesInAreaResult Result;
 
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+	UBlueprint* Blueprint = AssetCache.LoadAsset<UBlueprint>(BlueprintPath);
 	if (!Blueprint)
 	{
 		Result.ErrorMessage = FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath);
@@ -2225,6 +2378,8 @@ FGetGraphNodesInAreaResult FBlueprintImplModule::GetGraphNodesInArea(const FStri
 
 FFindFunctionResult FBlueprintImplModule::FindFunction(const FString& Search, const FString* ClassName, int32 Limit, bool bBlueprintCallableOnly)
 {
+	MCP_TRACE_SCOPE("FBlueprintImplModule::FindFunction");
+
 	FFindFunctionResult Result;
 
 	if (Search.IsEmpty())
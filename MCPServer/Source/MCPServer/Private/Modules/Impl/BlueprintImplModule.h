@@ -2,15 +2,22 @@
 #pragma once
 
 #include "Modules/Interfaces/IBlueprintModule.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
 
 class IActorModule;
+class IAssetCacheModule;
+class IEditorBatchModule;
+class UBlueprint;
 class UEdGraph;
 class UEdGraphNode;
+struct FEdGraphEditAction;
 
 class FBlueprintImplModule : public IBlueprintModule
 {
 public:
-	explicit FBlueprintImplModule(IActorModule& InActorModule);
+	FBlueprintImplModule(IActorModule& InActorModule, IAssetCacheModule& InAssetCache, IEditorBatchModule& InEditorBatch);
+	virtual ~FBlueprintImplModule() override;
 
 	virtual FBlueprintCreateResult CreateBlueprint(const FString& BlueprintPath, const FString& ParentClassPath) override;
 	virtual FBlueprintFromActorResult CreateBlueprintFromActor(const FString& BlueprintPath, const FString& ActorIdentifier) override;
@@ -51,8 +58,32 @@ public:
 
 	virtual FFindFunctionResult FindFunction(const FString& Search, const FString* ClassName, int32 Limit, bool bBlueprintCallableOnly) override;
 
+	virtual void BeginBatch(const FString& Description) override;
+	virtual void EndBatch() override;
+
 private:
+	/** Node GUID lookup for one graph, rebuilt on the next lookup after the graph reports a change */
+	struct FGraphNodeCache
+	{
+		TWeakObjectPtr<UEdGraph> Graph;
+		TMap<FGuid, TWeakObjectPtr<UEdGraphNode>> NodesByGuid;
+		FDelegateHandle GraphChangedHandle;
+		/** Set by OnGraphChanged (node added or removed, undo); the map is stale until rebuilt */
+		bool bDirty = true;
+	};
+
 	UEdGraph* FindGraph(UBlueprint* Blueprint, const FString& GraphName);
 	UEdGraphNode* FindNodeById(UEdGraph* Graph, const FString& NodeId);
+	FGraphNodeCache& GetNodeCache(UEdGraph* Graph);
+	void HandleGraphChanged(const FEdGraphEditAction& Action, FObjectKey GraphKey);
+
+	/** Mark the Blueprint modified now, or once at the end of the open batch */
+	void MarkBlueprintModified(UBlueprint* Blueprint, bool bStructural = false);
+
 	IActorModule& ActorModule;
+	IAssetCacheModule& AssetCache;
+	IEditorBatchModule& EditorBatch;
+
+	TMap<TPair<FObjectKey, FString>, TWeakObjectPtr<UEdGraph>> GraphsByName;
+	TMap<FObjectKey, FGraphNodeCache> NodeCaches;
 };
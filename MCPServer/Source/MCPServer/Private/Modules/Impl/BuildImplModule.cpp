@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/BuildImplModule.h"
+#include "Core/MCPTrace.h"
 #include "EditorBuildUtils.h"
 #include "UnrealEdGlobals.h"
 #include "Editor/UnrealEdEngine.h"
@@ -8,6 +9,8 @@
 
 FEditorBuildResult FBuildImplModule::BuildGeometry()
 {
+	MCP_TRACE_SCOPE("FBuildImplModule::BuildGeometry");
+
 	FEditorBuildResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -29,6 +32,8 @@ FEditorBuildResult FBuildImplModule::BuildGeometry()
 
 FEditorBuildResult FBuildImplModule::BuildLighting()
 {
+	MCP_TRACE_SCOPE("FBuildImplModule::BuildLighting");
+
 	FEditorBuildResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -50,6 +55,8 @@ FEditorBuildResult FBuildImplModule::BuildLighting()
 
 FEditorBuildResult FBuildImplModule::BuildNavigationData()
 {
+	MCP_TRACE_SCOPE("FBuildImplModule::BuildNavigationData");
+
 	FEditorBuildResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -71,6 +78,8 @@ FEditorBuildResult FBuildImplModule::BuildNavigationData()
 
 FEditorBuildResult FBuildImplModule::BuildHLOD()
 {
+	MCP_TRACE_SCOPE("FBuildImplModule::BuildHLOD");
+
 	FEditorBuildResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -92,6 +101,8 @@ FEditorBuildResult FBuildImplModule::BuildHLOD()
 
 FEditorBuildResult FBuildImplModule::BuildTextureStreaming()
 {
+	MCP_TRACE_SCOPE("FBuildImplModule::BuildTextureStreaming");
+
 	FEditorBuildResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -113,6 +124,8 @@ FEditorBuildResult FBuildImplModule::BuildTextureStreaming()
 
 FEditorBuildResult FBuildImplModule::BuildAll()
 {
+	MCP_TRACE_SCOPE("FBuildImplModule::BuildAll");
+
 	FEditorBuildResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -134,6 +147,8 @@ FEditorBuildResult FBuildImplModule::BuildAll()
 
 FBuildStatusResult FBuildImplModule::GetBuildStatus()
 {
+	MCP_TRACE_SCOPE("FBuildImplModule::GetBuildStatus");
+
 	FBuildStatusResult Result;
 
 	Result.bIsBuilding = FEditorBuildUtils::IsBuildCurrentlyRunning();
@@ -1,12 +1,15 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/ConsoleImplModule.h"
+#include "Core/MCPTrace.h"
 #include "Editor.h"
 #include "Misc/StringOutputDevice.h"
 #include "HAL/IConsoleManager.h"
 
 FConsoleCommandResult FConsoleImplModule::ExecuteConsoleCommand(const FString& Command)
 {
+	MCP_TRACE_SCOPE("FConsoleImplModule::ExecuteConsoleCommand");
+
 	FConsoleCommandResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -31,6 +34,8 @@ FConsoleCommandResult FConsoleImplModule::ExecuteConsoleCommand(const FString& C
 
 FCVarResult FConsoleImplModule::GetCVar(const FString& Name)
 {
+	MCP_TRACE_SCOPE("FConsoleImplModule::GetCVar");
+
 	FCVarResult Result;
 
 	IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(*Name);
@@ -49,6 +54,8 @@ FCVarResult FConsoleImplModule::GetCVar(const FString& Name)
 
 FCVarResult FConsoleImplModule::SetCVar(const FString& Name, const FString& Value)
 {
+	MCP_TRACE_SCOPE("FConsoleImplModule::SetCVar");
+
 	FCVarResult Result;
 
 	IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(*Name);
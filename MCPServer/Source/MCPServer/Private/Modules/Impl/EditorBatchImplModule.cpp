@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Modules/Impl/EditorBatchImplModule.h"
+#include "Core/MCPTrace.h"
+#include "ScopedTransaction.h"
+
+FEditorBatchImplModule::FEditorBatchImplModule() = default;
+
+FEditorBatchImplModule::~FEditorBatchImplModule() = default;
+
+void FEditorBatchImplModule::BeginBatch(const FString& Description)
+{
+	MCP_TRACE_SCOPE("FEditorBatchImplModule::BeginBatch");
+
+	if (BatchDepth++ == 0)
+	{
+		Transaction = MakeUnique<FScopedTransaction>(FText::FromString(Description));
+	}
+}
+
+void FEditorBatchImplModule::EndBatch()
+{
+	MCP_TRACE_SCOPE("FEditorBatchImplModule::EndBatch");
+
+	if (BatchDepth == 0 || --BatchDepth > 0)
+	{
+		return;
+	}
+
+	// Move the list out first: finalizers run with the batch closed, so anything they trigger runs immediately
+	TArray<FDeferredFinalize> CallsToRun = MoveTemp(DeferredCalls);
+	DeferredCalls.Reset();
+	DeferredKeys.Reset();
+
+	for (FDeferredFinalize& Call : CallsToRun)
+	{
+		if (UObject* Object = Call.Object.Get())
+		{
+			Call.Finalize(Object);
+		}
+	}
+
+	Transaction.Reset();
+}
+
+bool FEditorBatchImplModule::IsBatchActive() const
+{
+	MCP_TRACE_SCOPE("FEditorBatchImplModule::IsBatchActive");
+
+	return BatchDepth > 0;
+}
+
+void FEditorBatchImplModule::RunOrDefer(UObject* Object, FName Kind, TFunction<void(UObject*)> Finalize)
+{
+	MCP_TRACE_SCOPE("FEditorBatchImplModule::RunOrDefer");
+
+	if (!Object)
+	{
+		return;
+	}
+
+	if (BatchDepth == 0)
+	{
+		Finalize(Object);
+		return;
+	}
+
+	bool bAlreadyDeferred = false;
+	DeferredKeys.Add(TPair<FObjectKey, FName>(FObjectKey(Object), Kind), &bAlreadyDeferred);
+	if (!bAlreadyDeferred)
+	{
+		FDeferredFinalize& Call = DeferredCalls.AddDefaulted_GetRef();
+		Call.Object = Object;
+		Call.Finalize = MoveTemp(Finalize);
+	}
+}
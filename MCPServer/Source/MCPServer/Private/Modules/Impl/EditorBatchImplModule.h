@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "Modules/Interfaces/IEditorBatchModule.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class FScopedTransaction;
+
+class FEditorBatchImplModule : public IEditorBatchModule
+{
+public:
+	FEditorBatchImplModule();
+	virtual ~FEditorBatchImplModule() override;
+
+	virtual void BeginBatch(const FString& Description) override;
+	virtual void EndBatch() override;
+	virtual bool IsBatchActive() const override;
+	virtual void RunOrDefer(UObject* Object, FName Kind, TFunction<void(UObject*)> Finalize) override;
+
+private:
+	struct FDeferredFinalize
+	{
+		TWeakObjectPtr<UObject> Object;
+		TFunction<void(UObject*)> Finalize;
+	};
+
+	int32 BatchDepth = 0;
+	TUniquePtr<FScopedTransaction> Transaction;
+	TArray<FDeferredFinalize> DeferredCalls;
+	TSet<TPair<FObjectKey, FName>> DeferredKeys;
+};
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/FoliageImplModule.h"
+#include "Core/MCPTrace.h"
+#include "Modules/Interfaces/IAssetCacheModule.h"
 #include "InstancedFoliageActor.h"
 #include "FoliageType_InstancedStaticMesh.h"
 #include "ProceduralFoliageVolume.h"
@@ -9,11 +11,18 @@
 #include "Editor.h"
 #include "Engine/StaticMesh.h"
 
+FFoliageImplModule::FFoliageImplModule(IAssetCacheModule& InAssetCache)
+	: AssetCache(InAssetCache)
+{
+}
+
 FFoliageAddInstancesResult FFoliageImplModule::AddFoliageInstances(const FString& MeshPath, const TArray<FTransform>& Transforms)
 {
+	MCP_TRACE_SCOPE("FFoliageImplModule::AddFoliageInstances");
+
 	FFoliageAddInstancesResult Result;
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	UStaticMesh* Mesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -62,6 +71,8 @@ FFoliageAddInstancesResult FFoliageImplModule::AddFoliageInstances(const FString
 
 FFoliageRemoveInstancesResult FFoliageImplModule::RemoveFoliageInstances(const FString& MeshPath, const FVector& Center, float Radius)
 {
+	MCP_TRACE_SCOPE("FFoliageImplModule::RemoveFoliageInstances");
+
 	FFoliageRemoveInstancesResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -85,7 +96,7 @@ FFoliageRemoveInstancesResult FFoliageImplModule::RemoveFoliageInstances(const F
 	UStaticMesh* TargetMesh = nullptr;
 	if (!MeshPath.IsEmpty())
 	{
-		TargetMesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+		TargetMesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 		if (!TargetMesh)
 		{
 			Result.bSuccess = false;
@@ -144,9 +155,11 @@ FFoliageRemoveInstancesResult FFoliageImplModule::RemoveFoliageInstances(const F
 
 FFoliageRegisterMeshResult FFoliageImplModule::RegisterFoliageMesh(const FString& MeshPath)
 {
+	MCP_TRACE_SCOPE("FFoliageImplModule::RegisterFoliageMesh");
+
 	FFoliageRegisterMeshResult Result;
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	UStaticMesh* Mesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -186,6 +199,8 @@ FFoliageRegisterMeshResult FFoliageImplModule::RegisterFoliageMesh(const FString
 
 FFoliageResimulateResult FFoliageImplModule::ResimulateProceduralFoliage(const FString& VolumeName)
 {
+	MCP_TRACE_SCOPE("FFoliageImplModule::ResimulateProceduralFoliage");
+
 	FFoliageResimulateResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -3,11 +3,18 @@
 
 #include "Modules/Interfaces/IFoliageModule.h"
 
+class IAssetCacheModule;
+
 class FFoliageImplModule : public IFoliageModule
 {
 public:
+	explicit FFoliageImplModule(IAssetCacheModule& InAssetCache);
+
 	virtual FFoliageAddInstancesResult AddFoliageInstances(const FString& MeshPath, const TArray<FTransform>& Transforms) override;
 	virtual FFoliageRemoveInstancesResult RemoveFoliageInstances(const FString& MeshPath, const FVector& Center, float Radius) override;
 	virtual FFoliageRegisterMeshResult RegisterFoliageMesh(const FString& MeshPath) override;
 	virtual FFoliageResimulateResult ResimulateProceduralFoliage(const FString& VolumeName) override;
+
+private:
+	IAssetCacheModule& AssetCache;
 };
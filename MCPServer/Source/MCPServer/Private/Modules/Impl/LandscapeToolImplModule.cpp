@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/LandscapeToolImplModule.h"
+#include "Core/MCPTrace.h"
 #include "Landscape.h"
 #include "LandscapeProxy.h"
 #include "LandscapeInfo.h"
@@ -45,6 +46,8 @@ ALandscapeProxy* FLandscapeToolImplModule::FindLandscapeByName(const FString& Na
 
 FLandscapeHeightmapResult FLandscapeToolImplModule::GetLandscapeHeightmap(const FString& LandscapeActorName)
 {
+	MCP_TRACE_SCOPE("FLandscapeToolImplModule::GetLandscapeHeightmap");
+
 	FLandscapeHeightmapResult Result;
 
 	ALandscapeProxy* Landscape = FindLandscapeByName(LandscapeActorName);
@@ -83,6 +86,8 @@ FLandscapeHeightmapResult FLandscapeToolImplModule::GetLandscapeHeightmap(const
 
 FLandscapeSetHeightmapResult FLandscapeToolImplModule::SetLandscapeHeightmap(const FString& LandscapeActorName, const FString& FilePath)
 {
+	MCP_TRACE_SCOPE("FLandscapeToolImplModule::SetLandscapeHeightmap");
+
 	FLandscapeSetHeightmapResult Result;
 
 	ALandscapeProxy* Landscape = FindLandscapeByName(LandscapeActorName);
@@ -137,6 +142,8 @@ FLandscapeSetHeightmapResult FLandscapeToolImplModule::SetLandscapeHeightmap(con
 
 FLandscapeWeightmapResult FLandscapeToolImplModule::GetLandscapeWeightmap(const FString& LandscapeActorName)
 {
+	MCP_TRACE_SCOPE("FLandscapeToolImplModule::GetLandscapeWeightmap");
+
 	FLandscapeWeightmapResult Result;
 
 	ALandscapeProxy* Landscape = FindLandscapeByName(LandscapeActorName);
@@ -169,6 +176,8 @@ FLandscapeWeightmapResult FLandscapeToolImplModule::GetLandscapeWeightmap(const
 
 FLandscapeSetWeightmapResult FLandscapeToolImplModule::SetLandscapeWeightmap(const FString& LandscapeActorName, const FString& LayerName, const FString& FilePath)
 {
+	MCP_TRACE_SCOPE("FLandscapeToolImplModule::SetLandscapeWeightmap");
+
 	FLandscapeSetWeightmapResult Result;
 
 	ALandscapeProxy* Landscape = FindLandscapeByName(LandscapeActorName);
@@ -231,6 +240,8 @@ FLandscapeSetWeightmapResult FLandscapeToolImplModule::SetLandscapeWeightmap(con
 
 FLandscapeImportResult FLandscapeToolImplModule::ImportLandscape(const FString& HeightmapFilePath, const FVector& Location, const FVector& Scale)
 {
+	MCP_TRACE_SCOPE("FLandscapeToolImplModule::ImportLandscape");
+
 	FLandscapeImportResult Result;
 
 	FLandscapeImportDescriptor ImportDescriptor;
@@ -268,6 +279,8 @@ FLandscapeImportResult FLandscapeToolImplModule::ImportLandscape(const FString&
 
 FLandscapeExportResult FLandscapeToolImplModule::ExportLandscape(const FString& LandscapeActorName, const FString& OutputFilePath)
 {
+	MCP_TRACE_SCOPE("FLandscapeToolImplModule::ExportLandscape");
+
 	FLandscapeExportResult Result;
 
 	ALandscapeProxy* Landscape = FindLandscapeByName(LandscapeActorName);
@@ -295,6 +308,8 @@ FLandscapeExportResult FLandscapeToolImplModule::ExportLandscape(const FString&
 
 FLandscapeRebuildResult FLandscapeToolImplModule::RebuildLandscape(const FString& LandscapeActorName)
 {
+	MCP_TRACE_SCOPE("FLandscapeToolImplModule::RebuildLandscape");
+
 	FLandscapeRebuildResult Result;
 
 	ALandscapeProxy* Landscape = FindLandscapeByName(LandscapeActorName);
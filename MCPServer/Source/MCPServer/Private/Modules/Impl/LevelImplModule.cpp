@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/LevelImplModule.h"
+#include "Core/MCPTrace.h"
 #include "Editor.h"
 #include "LevelEditorSubsystem.h"
 #include "EditorLevelUtils.h"
@@ -11,6 +12,8 @@
 
 FNewLevelResult FLevelImplModule::NewLevel(const FString& LevelPath)
 {
+	MCP_TRACE_SCOPE("FLevelImplModule::NewLevel");
+
 	FNewLevelResult Result;
 
 	ULevelEditorSubsystem* LevelEditorSubsystem = GEditor->GetEditorSubsystem<ULevelEditorSubsystem>();
@@ -37,6 +40,8 @@ FNewLevelResult FLevelImplModule::NewLevel(const FString& LevelPath)
 
 FNewLevelResult FLevelImplModule::NewLevelFromTemplate(const FString& LevelPath, const FString& TemplatePath)
 {
+	MCP_TRACE_SCOPE("FLevelImplModule::NewLevelFromTemplate");
+
 	FNewLevelResult Result;
 
 	ULevelEditorSubsystem* LevelEditorSubsystem = GEditor->GetEditorSubsystem<ULevelEditorSubsystem>();
@@ -64,6 +69,8 @@ FNewLevelResult FLevelImplModule::NewLevelFromTemplate(const FString& LevelPath,
 
 FLoadLevelResult FLevelImplModule::LoadLevel(const FString& LevelPath)
 {
+	MCP_TRACE_SCOPE("FLevelImplModule::LoadLevel");
+
 	FLoadLevelResult Result;
 
 	ULevelEditorSubsystem* LevelEditorSubsystem = GEditor->GetEditorSubsystem<ULevelEditorSubsystem>();
@@ -89,6 +96,8 @@ FLoadLevelResult FLevelImplModule::LoadLevel(const FString& LevelPath)
 
 FSaveLevelResult FLevelImplModule::SaveLevel()
 {
+	MCP_TRACE_SCOPE("FLevelImplModule::SaveLevel");
+
 	FSaveLevelResult Result;
 
 	ULevelEditorSubsystem* LevelEditorSubsystem = GEditor->GetEditorSubsystem<ULevelEditorSubsystem>();
@@ -115,6 +124,8 @@ FSaveLevelResult FLevelImplModule::SaveLevel()
 
 FSaveAllDirtyLevelsResult FLevelImplModule::SaveAllDirtyLevels()
 {
+	MCP_TRACE_SCOPE("FLevelImplModule::SaveAllDirtyLevels");
+
 	FSaveAllDirtyLevelsResult Result;
 
 	ULevelEditorSubsystem* LevelEditorSubsystem = GEditor->GetEditorSubsystem<ULevelEditorSubsystem>();
@@ -139,6 +150,8 @@ FSaveAllDirtyLevelsResult FLevelImplModule::SaveAllDirtyLevels()
 
 FAddSublevelResult FLevelImplModule::AddSublevel(const FString& LevelPath)
 {
+	MCP_TRACE_SCOPE("FLevelImplModule::AddSublevel");
+
 	FAddSublevelResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -166,6 +179,8 @@ FAddSublevelResult FLevelImplModule::AddSublevel(const FString& LevelPath)
 
 FRemoveSublevelResult FLevelImplModule::RemoveSublevel(const FString& LevelName)
 {
+	MCP_TRACE_SCOPE("FLevelImplModule::RemoveSublevel");
+
 	FRemoveSublevelResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -218,6 +233,8 @@ FRemoveSublevelResult FLevelImplModule::RemoveSublevel(const FString& LevelName)
 
 FSetCurrentLevelResult FLevelImplModule::SetCurrentLevel(const FString& LevelName)
 {
+	MCP_TRACE_SCOPE("FLevelImplModule::SetCurrentLevel");
+
 	FSetCurrentLevelResult Result;
 
 	ULevelEditorSubsystem* LevelEditorSubsystem = GEditor->GetEditorSubsystem<ULevelEditorSubsystem>();
@@ -243,6 +260,8 @@ FSetCurrentLevelResult FLevelImplModule::SetCurrentLevel(const FString& LevelNam
 
 FSetLevelVisibilityResult FLevelImplModule::SetLevelVisibility(const FString& LevelName, bool bVisible)
 {
+	MCP_TRACE_SCOPE("FLevelImplModule::SetLevelVisibility");
+
 	FSetLevelVisibilityResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -1,17 +1,28 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/MaterialImplModule.h"
+#include "Core/MCPTrace.h"
+#include "Modules/Interfaces/IAssetCacheModule.h"
+#include "Modules/Interfaces/IEditorBatchModule.h"
 #include "MaterialEditingLibrary.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialInstanceConstant.h"
 #include "Materials/MaterialExpression.h"
 #include "Materials/MaterialInterface.h"
 
+FMaterialImplModule::FMaterialImplModule(IAssetCacheModule& InAssetCache, IEditorBatchModule& InEditorBatch)
+	: AssetCache(InAssetCache)
+	, EditorBatch(InEditorBatch)
+{
+}
+
 FCreateMaterialExpressionResult FMaterialImplModule::CreateMaterialExpression(const FString& MaterialPath, const FString& ExpressionClassName, int32 NodePosX, int32 NodePosY)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::CreateMaterialExpression");
+
 	FCreateMaterialExpressionResult Result;
 
-	UMaterial* Material = LoadObject<UMaterial>(nullptr, *MaterialPath);
+	UMaterial* Material = AssetCache.LoadAsset<UMaterial>(MaterialPath);
 	if (!Material)
 	{
 		Result.bSuccess = false;
@@ -60,9 +71,11 @@ FCreateMaterialExpressionResult FMaterialImplModule::CreateMaterialExpression(co
 
 FDeleteMaterialExpressionResult FMaterialImplModule::DeleteMaterialExpression(const FString& MaterialPath, int32 ExpressionIndex)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::DeleteMaterialExpression");
+
 	FDeleteMaterialExpressionResult Result;
 
-	UMaterial* Material = LoadObject<UMaterial>(nullptr, *MaterialPath);
+	UMaterial* Material = AssetCache.LoadAsset<UMaterial>(MaterialPath);
 	if (!Material)
 	{
 		Result.bSuccess = false;
@@ -87,9 +100,11 @@ FDeleteMaterialExpressionResult FMaterialImplModule::DeleteMaterialExpression(co
 
 FConnectExpressionsResult FMaterialImplModule::ConnectMaterialExpressions(const FString& MaterialPath, int32 FromIndex, const FString& FromOutput, int32 ToIndex, const FString& ToInput)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::ConnectMaterialExpressions");
+
 	FConnectExpressionsResult Result;
 
-	UMaterial* Material = LoadObject<UMaterial>(nullptr, *MaterialPath);
+	UMaterial* Material = AssetCache.LoadAsset<UMaterial>(MaterialPath);
 	if (!Material)
 	{
 		Result.bSuccess = false;
@@ -112,6 +127,8 @@ FConnectExpressionsResult FMaterialImplModule::ConnectMaterialExpressions(const
 		return Result;
 	}
 
+	Expressions[ToIndex]->Modify();
+
 	bool bConnected = UMaterialEditingLibrary::ConnectMaterialExpressions(
 		Expressions[FromIndex], FromOutput,
 		Expressions[ToIndex], ToInput);
@@ -129,9 +146,11 @@ FConnectExpressionsResult FMaterialImplModule::ConnectMaterialExpressions(const
 
 FConnectPropertyResult FMaterialImplModule::ConnectMaterialProperty(const FString& MaterialPath, int32 FromIndex, const FString& FromOutput, const FString& PropertyName)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::ConnectMaterialProperty");
+
 	FConnectPropertyResult Result;
 
-	UMaterial* Material = LoadObject<UMaterial>(nullptr, *MaterialPath);
+	UMaterial* Material = AssetCache.LoadAsset<UMaterial>(MaterialPath);
 	if (!Material)
 	{
 		Result.bSuccess = false;
@@ -201,9 +220,11 @@ FConnectPropertyResult FMaterialImplModule::ConnectMaterialProperty(const FStrin
 
 FRecompileMaterialResult FMaterialImplModule::RecompileMaterial(const FString& MaterialPath)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::RecompileMaterial");
+
 	FRecompileMaterialResult Result;
 
-	UMaterial* Material = LoadObject<UMaterial>(nullptr, *MaterialPath);
+	UMaterial* Material = AssetCache.LoadAsset<UMaterial>(MaterialPath);
 	if (!Material)
 	{
 		Result.bSuccess = false;
@@ -219,9 +240,11 @@ FRecompileMaterialResult FMaterialImplModule::RecompileMaterial(const FString& M
 
 FGetMaterialParameterResult FMaterialImplModule::GetMaterialParameter(const FString& MaterialPath, const FString& ParameterName)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::GetMaterialParameter");
+
 	FGetMaterialParameterResult Result;
 
-	UMaterialInterface* MaterialInterface = LoadObject<UMaterialInterface>(nullptr, *MaterialPath);
+	UMaterialInterface* MaterialInterface = AssetCache.LoadAsset<UMaterialInterface>(MaterialPath);
 	if (!MaterialInterface)
 	{
 		Result.bSuccess = false;
@@ -330,9 +353,11 @@ FGetMaterialParameterResult FMaterialImplModule::GetMaterialParameter(const FStr
 
 FSetMaterialInstanceParamResult FMaterialImplModule::SetMaterialInstanceParameter(const FString& InstancePath, const FString& ParameterName, const FString& Value, const FString& ParameterType)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::SetMaterialInstanceParameter");
+
 	FSetMaterialInstanceParamResult Result;
 
-	UMaterialInstanceConstant* Instance = LoadObject<UMaterialInstanceConstant>(nullptr, *InstancePath);
+	UMaterialInstanceConstant* Instance = AssetCache.LoadAsset<UMaterialInstanceConstant>(InstancePath);
 	if (!Instance)
 	{
 		Result.bSuccess = false;
@@ -372,7 +397,7 @@ FSetMaterialInstanceParamResult FMaterialImplModule::SetMaterialInstanceParamete
 	}
 	else if (ParameterType.Equals(TEXT("Texture"), ESearchCase::IgnoreCase))
 	{
-		UTexture* Texture = LoadObject<UTexture>(nullptr, *Value);
+		UTexture* Texture = AssetCache.LoadAsset<UTexture>(Value);
 		if (!Texture)
 		{
 			Result.bSuccess = false;
@@ -411,9 +436,11 @@ FSetMaterialInstanceParamResult FMaterialImplModule::SetMaterialInstanceParamete
 
 FSetMaterialInstanceParentResult FMaterialImplModule::SetMaterialInstanceParent(const FString& InstancePath, const FString& ParentPath)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::SetMaterialInstanceParent");
+
 	FSetMaterialInstanceParentResult Result;
 
-	UMaterialInstanceConstant* Instance = LoadObject<UMaterialInstanceConstant>(nullptr, *InstancePath);
+	UMaterialInstanceConstant* Instance = AssetCache.LoadAsset<UMaterialInstanceConstant>(InstancePath);
 	if (!Instance)
 	{
 		Result.bSuccess = false;
@@ -421,7 +448,7 @@ FSetMaterialInstanceParentResult FMaterialImplModule::SetMaterialInstanceParent(
 		return Result;
 	}
 
-	UMaterialInterface* NewParent = LoadObject<UMaterialInterface>(nullptr, *ParentPath);
+	UMaterialInterface* NewParent = AssetCache.LoadAsset<UMaterialInterface>(ParentPath);
 	if (!NewParent)
 	{
 		Result.bSuccess = false;
@@ -437,9 +464,11 @@ FSetMaterialInstanceParentResult FMaterialImplModule::SetMaterialInstanceParent(
 
 FMaterialStatisticsResult FMaterialImplModule::GetMaterialStatistics(const FString& MaterialPath)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::GetMaterialStatistics");
+
 	FMaterialStatisticsResult Result;
 
-	UMaterialInterface* MaterialInterface = LoadObject<UMaterialInterface>(nullptr, *MaterialPath);
+	UMaterialInterface* MaterialInterface = AssetCache.LoadAsset<UMaterialInterface>(MaterialPath);
 	if (!MaterialInterface)
 	{
 		Result.bSuccess = false;
@@ -462,9 +491,11 @@ FMaterialStatisticsResult FMaterialImplModule::GetMaterialStatistics(const FStri
 
 FGetMaterialExpressionsResult FMaterialImplModule::GetMaterialExpressions(const FString& MaterialPath)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::GetMaterialExpressions");
+
 	FGetMaterialExpressionsResult Result;
 
-	UMaterial* Material = LoadObject<UMaterial>(nullptr, *MaterialPath);
+	UMaterial* Material = AssetCache.LoadAsset<UMaterial>(MaterialPath);
 	if (!Material)
 	{
 		Result.bSuccess = false;
@@ -489,9 +520,11 @@ FGetMaterialExpressionsResult FMaterialImplModule::GetMaterialExpressions(const
 
 FGetMaterialExpressionPropertyResult FMaterialImplModule::GetMaterialExpressionProperty(const FString& MaterialPath, int32 ExpressionIndex, const FString& PropertyName)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::GetMaterialExpressionProperty");
+
 	FGetMaterialExpressionPropertyResult Result;
 
-	UMaterial* Material = LoadObject<UMaterial>(nullptr, *MaterialPath);
+	UMaterial* Material = AssetCache.LoadAsset<UMaterial>(MaterialPath);
 	if (!Material)
 	{
 		Result.bSuccess = false;
@@ -527,9 +560,11 @@ FGetMaterialExpressionPropertyResult FMaterialImplModule::GetMaterialExpressionP
 
 FSetMaterialExpressionPropertyResult FMaterialImplModule::SetMaterialExpressionProperty(const FString& MaterialPath, int32 ExpressionIndex, const FString& PropertyName, const FString& PropertyValue)
 {
+	MCP_TRACE_SCOPE("FMaterialImplModule::SetMaterialExpressionProperty");
+
 	FSetMaterialExpressionPropertyResult Result;
 
-	UMaterial* Material = LoadObject<UMaterial>(nullptr, *MaterialPath);
+	UMaterial* Material = AssetCache.LoadAsset<UMaterial>(MaterialPath);
 	if (!Material)
 	{
 		Result.bSuccess = false;
@@ -554,14 +589,33 @@ FSetMaterialExpressionPropertyResult FMaterialImplModule::SetMaterialExpressionP
 		return Result;
 	}
 
+	Expression->Modify();
+
 	void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(Expression);
 	const TCHAR* Buffer = *PropertyValue;
 	Prop->ImportText_Direct(Buffer, ValuePtr, Expression, PPF_None);
 
-	Expression->Modify();
-	Material->PreEditChange(nullptr);
-	Material->PostEditChange();
+	// Recompiling the material is the expensive part; inside a batch it runs once per material
+	EditorBatch.RunOrDefer(Material, TEXT("MaterialUpdate"), [](UObject* Object)
+	{
+		Object->PreEditChange(nullptr);
+		Object->PostEditChange();
+	});
 
 	Result.bSuccess = true;
 	return Result;
 }
+
+void FMaterialImplModule::BeginBatch(const FString& Description)
+{
+	MCP_TRACE_SCOPE("FMaterialImplModule::BeginBatch");
+
+	EditorBatch.BeginBatch(Description);
+}
+
+void FMaterialImplModule::EndBatch()
+{
+	MCP_TRACE_SCOPE("FMaterialImplModule::EndBatch");
+
+	EditorBatch.EndBatch();
+}
@@ -3,9 +3,14 @@
 
 #include "Modules/Interfaces/IMaterialModule.h"
 
+class IAssetCacheModule;
+class IEditorBatchModule;
+
 class FMaterialImplModule : public IMaterialModule
 {
 public:
+	FMaterialImplModule(IAssetCacheModule& InAssetCache, IEditorBatchModule& InEditorBatch);
+
 	virtual FCreateMaterialExpressionResult CreateMaterialExpression(const FString& MaterialPath, const FString& ExpressionClass, int32 NodePosX, int32 NodePosY) override;
 	virtual FDeleteMaterialExpressionResult DeleteMaterialExpression(const FString& MaterialPath, int32 ExpressionIndex) override;
 	virtual FConnectExpressionsResult ConnectMaterialExpressions(const FString& MaterialPath, int32 FromIndex, const FString& FromOutput, int32 ToIndex, const FString& ToInput) override;
@@ -18,4 +23,11 @@ public:
 	virtual FGetMaterialExpressionsResult GetMaterialExpressions(const FString& MaterialPath) override;
 	virtual FGetMaterialExpressionPropertyResult GetMaterialExpressionProperty(const FString& MaterialPath, int32 ExpressionIndex, const FString& PropertyName) override;
 	virtual FSetMaterialExpressionPropertyResult SetMaterialExpressionProperty(const FString& MaterialPath, int32 ExpressionIndex, const FString& PropertyName, const FString& PropertyValue) override;
+
+	virtual void BeginBatch(const FString& Description) override;
+	virtual void EndBatch() override;
+
+private:
+	IAssetCacheModule& AssetCache;
+	IEditorBatchModule& EditorBatch;
 };
@@ -1,12 +1,15 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/NavigationImplModule.h"
+#include "Core/MCPTrace.h"
 #include "NavigationSystem.h"
 #include "NavigationPath.h"
 #include "Editor.h"
 
 FNavBuildResult FNavigationImplModule::BuildNavigation()
 {
+	MCP_TRACE_SCOPE("FNavigationImplModule::BuildNavigation");
+
 	FNavBuildResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -33,6 +36,8 @@ FNavBuildResult FNavigationImplModule::BuildNavigation()
 
 FNavBuildResult FNavigationImplModule::RebuildNavigation()
 {
+	MCP_TRACE_SCOPE("FNavigationImplModule::RebuildNavigation");
+
 	FNavBuildResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -61,6 +66,8 @@ FNavBuildResult FNavigationImplModule::RebuildNavigation()
 
 FNavFindPathResult FNavigationImplModule::FindPath(const FVector& Start, const FVector& End)
 {
+	MCP_TRACE_SCOPE("FNavigationImplModule::FindPath");
+
 	FNavFindPathResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -87,6 +94,8 @@ FNavFindPathResult FNavigationImplModule::FindPath(const FVector& Start, const F
 
 FNavProjectPointResult FNavigationImplModule::ProjectPointToNav(const FVector& Point, const FVector& Extent)
 {
+	MCP_TRACE_SCOPE("FNavigationImplModule::ProjectPointToNav");
+
 	FNavProjectPointResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -121,6 +130,8 @@ FNavProjectPointResult FNavigationImplModule::ProjectPointToNav(const FVector& P
 
 FNavRandomPointResult FNavigationImplModule::GetRandomReachablePoint(const FVector& Origin, float Radius)
 {
+	MCP_TRACE_SCOPE("FNavigationImplModule::GetRandomReachablePoint");
+
 	FNavRandomPointResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/PIEImplModule.h"
+#include "Core/MCPTrace.h"
 #include "Editor.h"
 #include "Editor/EditorEngine.h"
 #include "UnrealEdGlobals.h"
@@ -10,6 +11,8 @@
 
 FPIEResult FPIEImplModule::PlayInEditor()
 {
+	MCP_TRACE_SCOPE("FPIEImplModule::PlayInEditor");
+
 	FPIEResult Result;
 
 	if (!GUnrealEd)
@@ -45,6 +48,8 @@ FPIEResult FPIEImplModule::PlayInEditor()
 
 FPIEResult FPIEImplModule::StopPIE()
 {
+	MCP_TRACE_SCOPE("FPIEImplModule::StopPIE");
+
 	FPIEResult Result;
 
 	if (!GUnrealEd)
@@ -70,6 +75,8 @@ FPIEResult FPIEImplModule::StopPIE()
 
 FPIEResult FPIEImplModule::SimulateInEditor()
 {
+	MCP_TRACE_SCOPE("FPIEImplModule::SimulateInEditor");
+
 	FPIEResult Result;
 
 	if (!GUnrealEd)
@@ -105,6 +112,8 @@ FPIEResult FPIEImplModule::SimulateInEditor()
 
 FPIEStatusResult FPIEImplModule::IsPlaying()
 {
+	MCP_TRACE_SCOPE("FPIEImplModule::IsPlaying");
+
 	FPIEStatusResult Result;
 
 	if (!GUnrealEd)
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/PhysicsImplModule.h"
+#include "Core/MCPTrace.h"
+#include "Modules/Interfaces/IActorModule.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "PhysicsEngine/PhysicsConstraintComponent.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
@@ -15,8 +17,15 @@ FPhysicsImplModule::FPhysicsImplModule(IActorModule& InActorModule)
 {
 }
 
-static AActor* FindActorByName(UWorld* World, const FString& Name)
+static AActor* FindActorByName(IActorModule& ActorModule, UWorld* World, const FString& Name)
 {
+	// Exact name/label matches come from the actor module index
+	if (AActor* Actor = ActorModule.FindActor(Name))
+	{
+		return Actor;
+	}
+
+	// Physics tools also accept case-insensitive names
 	for (TActorIterator<AActor> It(World); It; ++It)
 	{
 		if (It->GetActorLabel().Equals(Name, ESearchCase::IgnoreCase) ||
@@ -30,6 +39,8 @@ static AActor* FindActorByName(UWorld* World, const FString& Name)
 
 FPhysicsCollisionResult FPhysicsImplModule::CreatePhysicsCollision(const FString& ActorName, const FString& ShapeType, const FVector& Dimensions, const FVector& Offset)
 {
+	MCP_TRACE_SCOPE("FPhysicsImplModule::CreatePhysicsCollision");
+
 	FPhysicsCollisionResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -40,7 +51,7 @@ FPhysicsCollisionResult FPhysicsImplModule::CreatePhysicsCollision(const FString
 		return Result;
 	}
 
-	AActor* Actor = FindActorByName(World, ActorName);
+	AActor* Actor = FindActorByName(ActorModule, World, ActorName);
 	if (!Actor)
 	{
 		Result.bSuccess = false;
@@ -100,6 +111,8 @@ FPhysicsCollisionResult FPhysicsImplModule::CreatePhysicsCollision(const FString
 
 FPhysicalMaterialResult FPhysicsImplModule::SetPhysicalMaterial(const FString& ActorName, const FString& MaterialPath)
 {
+	MCP_TRACE_SCOPE("FPhysicsImplModule::SetPhysicalMaterial");
+
 	FPhysicalMaterialResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -110,7 +123,7 @@ FPhysicalMaterialResult FPhysicsImplModule::SetPhysicalMaterial(const FString& A
 		return Result;
 	}
 
-	AActor* Actor = FindActorByName(World, ActorName);
+	AActor* Actor = FindActorByName(ActorModule, World, ActorName);
 	if (!Actor)
 	{
 		Result.bSuccess = false;
@@ -142,6 +155,8 @@ FPhysicalMaterialResult FPhysicsImplModule::SetPhysicalMaterial(const FString& A
 
 FPhysicsVelocityResult FPhysicsImplModule::SetPhysicsVelocity(const FString& ActorName, const FVector& LinearVelocity, const FVector& AngularVelocity, bool bEnablePhysics)
 {
+	MCP_TRACE_SCOPE("FPhysicsImplModule::SetPhysicsVelocity");
+
 	FPhysicsVelocityResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -152,7 +167,7 @@ FPhysicsVelocityResult FPhysicsImplModule::SetPhysicsVelocity(const FString& Act
 		return Result;
 	}
 
-	AActor* Actor = FindActorByName(World, ActorName);
+	AActor* Actor = FindActorByName(ActorModule, World, ActorName);
 	if (!Actor)
 	{
 		Result.bSuccess = false;
@@ -182,6 +197,8 @@ FPhysicsVelocityResult FPhysicsImplModule::SetPhysicsVelocity(const FString& Act
 
 FPhysicsConstraintResult FPhysicsImplModule::ManageConstraints(const FString& ActorName1, const FString& ActorName2, const FString& ConstraintType, bool bDisableCollision)
 {
+	MCP_TRACE_SCOPE("FPhysicsImplModule::ManageConstraints");
+
 	FPhysicsConstraintResult Result;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -192,7 +209,7 @@ FPhysicsConstraintResult FPhysicsImplModule::ManageConstraints(const FString& Ac
 		return Result;
 	}
 
-	AActor* Actor1 = FindActorByName(World, ActorName1);
+	AActor* Actor1 = FindActorByName(ActorModule, World, ActorName1);
 	if (!Actor1)
 	{
 		Result.bSuccess = false;
@@ -200,7 +217,7 @@ FPhysicsConstraintResult FPhysicsImplModule::ManageConstraints(const FString& Ac
 		return Result;
 	}
 
-	AActor* Actor2 = FindActorByName(World, ActorName2);
+	AActor* Actor2 = FindActorByName(ActorModule, World, ActorName2);
 	if (!Actor2)
 	{
 		Result.bSuccess = false;
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/ProjectSettingsImplModule.h"
+#include "Core/MCPTrace.h"
 #include "Misc/App.h"
 #include "Misc/Paths.h"
 #include "Misc/EngineVersion.h"
@@ -9,6 +10,8 @@
 
 FProjectInfoResult FProjectSettingsImplModule::GetProjectInfo()
 {
+	MCP_TRACE_SCOPE("FProjectSettingsImplModule::GetProjectInfo");
+
 	FProjectInfoResult Result;
 
 	const UGeneralProjectSettings* Settings = GetDefault<UGeneralProjectSettings>();
@@ -31,6 +34,8 @@ FProjectInfoResult FProjectSettingsImplModule::GetProjectInfo()
 
 FConfigValueResult FProjectSettingsImplModule::GetConfigValue(const FString& ConfigName, const FString& Section, const FString& Key)
 {
+	MCP_TRACE_SCOPE("FProjectSettingsImplModule::GetConfigValue");
+
 	FConfigValueResult Result;
 
 	FString Filename = ResolveConfigFilename(ConfigName);
@@ -58,6 +63,8 @@ FConfigValueResult FProjectSettingsImplModule::GetConfigValue(const FString& Con
 
 FConfigValueResult FProjectSettingsImplModule::SetConfigValue(const FString& ConfigName, const FString& Section, const FString& Key, const FString& Value)
 {
+	MCP_TRACE_SCOPE("FProjectSettingsImplModule::SetConfigValue");
+
 	FConfigValueResult Result;
 
 	FString Filename = ResolveConfigFilename(ConfigName);
@@ -80,6 +87,8 @@ FConfigValueResult FProjectSettingsImplModule::SetConfigValue(const FString& Con
 
 FProjectPathsResult FProjectSettingsImplModule::GetProjectPaths()
 {
+	MCP_TRACE_SCOPE("FProjectSettingsImplModule::GetProjectPaths");
+
 	FProjectPathsResult Result;
 	Result.bSuccess = true;
 	Result.ProjectDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/SequencerToolImplModule.h"
+#include "Core/MCPTrace.h"
 #include "ISequencer.h"
 #include "LevelEditorSequencerIntegration.h"
 #include "MovieScene.h"
@@ -27,6 +28,8 @@ TSharedPtr<ISequencer> FSequencerToolImplModule::GetActiveSequencer() const
 
 FSequencerSimpleResult FSequencerToolImplModule::SequencerPlay()
 {
+	MCP_TRACE_SCOPE("FSequencerToolImplModule::SequencerPlay");
+
 	FSequencerSimpleResult Result;
 
 	TSharedPtr<ISequencer> Sequencer = GetActiveSequencer();
@@ -44,6 +47,8 @@ FSequencerSimpleResult FSequencerToolImplModule::SequencerPlay()
 
 FSequencerSimpleResult FSequencerToolImplModule::SequencerPause()
 {
+	MCP_TRACE_SCOPE("FSequencerToolImplModule::SequencerPause");
+
 	FSequencerSimpleResult Result;
 
 	TSharedPtr<ISequencer> Sequencer = GetActiveSequencer();
@@ -61,6 +66,8 @@ FSequencerSimpleResult FSequencerToolImplModule::SequencerPause()
 
 FSequencerSimpleResult FSequencerToolImplModule::SequencerStop()
 {
+	MCP_TRACE_SCOPE("FSequencerToolImplModule::SequencerStop");
+
 	FSequencerSimpleResult Result;
 
 	TSharedPtr<ISequencer> Sequencer = GetActiveSequencer();
@@ -79,6 +86,8 @@ FSequencerSimpleResult FSequencerToolImplModule::SequencerStop()
 
 FSequencerSimpleResult FSequencerToolImplModule::SequencerSetTime(double TimeInSeconds)
 {
+	MCP_TRACE_SCOPE("FSequencerToolImplModule::SequencerSetTime");
+
 	FSequencerSimpleResult Result;
 
 	TSharedPtr<ISequencer> Sequencer = GetActiveSequencer();
@@ -99,6 +108,8 @@ FSequencerSimpleResult FSequencerToolImplModule::SequencerSetTime(double TimeInS
 
 FSequencerTimeResult FSequencerToolImplModule::SequencerGetTime()
 {
+	MCP_TRACE_SCOPE("FSequencerToolImplModule::SequencerGetTime");
+
 	FSequencerTimeResult Result;
 
 	TSharedPtr<ISequencer> Sequencer = GetActiveSequencer();
@@ -123,6 +134,8 @@ FSequencerTimeResult FSequencerToolImplModule::SequencerGetTime()
 
 FSequencerSimpleResult FSequencerToolImplModule::SequencerSetPlaybackRange(double StartTimeSeconds, double EndTimeSeconds)
 {
+	MCP_TRACE_SCOPE("FSequencerToolImplModule::SequencerSetPlaybackRange");
+
 	FSequencerSimpleResult Result;
 
 	TSharedPtr<ISequencer> Sequencer = GetActiveSequencer();
@@ -162,6 +175,8 @@ FSequencerSimpleResult FSequencerToolImplModule::SequencerSetPlaybackRange(doubl
 
 FSequencerAddActorResult FSequencerToolImplModule::SequencerAddActor(const FString& ActorName)
 {
+	MCP_TRACE_SCOPE("FSequencerToolImplModule::SequencerAddActor");
+
 	FSequencerAddActorResult Result;
 
 	TSharedPtr<ISequencer> Sequencer = GetActiveSequencer();
@@ -216,6 +231,8 @@ FSequencerAddActorResult FSequencerToolImplModule::SequencerAddActor(const FStri
 
 FSequencerAddTrackResult FSequencerToolImplModule::SequencerAddTrack(const FString& TrackType, const FString& BindingGuid)
 {
+	MCP_TRACE_SCOPE("FSequencerToolImplModule::SequencerAddTrack");
+
 	FSequencerAddTrackResult Result;
 
 	TSharedPtr<ISequencer> Sequencer = GetActiveSequencer();
@@ -299,6 +316,8 @@ FSequencerAddTrackResult FSequencerToolImplModule::SequencerAddTrack(const FStri
 
 FSequencerAddMarkerResult FSequencerToolImplModule::SequencerAddMarker(double TimeInSeconds, const FString& Label)
 {
+	MCP_TRACE_SCOPE("FSequencerToolImplModule::SequencerAddMarker");
+
 	FSequencerAddMarkerResult Result;
 
 	TSharedPtr<ISequencer> Sequencer = GetActiveSequencer();
@@ -341,6 +360,8 @@ FSequencerAddMarkerResult FSequencerToolImplModule::SequencerAddMarker(double Ti
 
 FSequencerSimpleResult FSequencerToolImplModule::SequencerForceEvaluate()
 {
+	MCP_TRACE_SCOPE("FSequencerToolImplModule::SequencerForceEvaluate");
+
 	FSequencerSimpleResult Result;
 
 	TSharedPtr<ISequencer> Sequencer = GetActiveSequencer();
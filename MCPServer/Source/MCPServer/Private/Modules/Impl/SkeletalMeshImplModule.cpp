@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/SkeletalMeshImplModule.h"
+#include "Core/MCPTrace.h"
+#include "Modules/Interfaces/IAssetCacheModule.h"
 #include "Engine/SkeletalMesh.h"
 #include "Animation/Skeleton.h"
 #include "PhysicsEngine/PhysicsAsset.h"
@@ -23,11 +25,18 @@
 #include "IAssetTools.h"
 #include "Editor.h"
 
+FSkeletalMeshImplModule::FSkeletalMeshImplModule(IAssetCacheModule& InAssetCache)
+	: AssetCache(InAssetCache)
+{
+}
+
 FRegenerateSkeletalLodResult FSkeletalMeshImplModule::RegenerateSkeletalLod(const FString& MeshPath, int32 NewLodCount, bool bRegenerateEvenIfImported)
 {
+	MCP_TRACE_SCOPE("FSkeletalMeshImplModule::RegenerateSkeletalLod");
+
 	FRegenerateSkeletalLodResult Result;
 
-	USkeletalMesh* Mesh = LoadObject<USkeletalMesh>(nullptr, *MeshPath);
+	USkeletalMesh* Mesh = AssetCache.LoadAsset<USkeletalMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -58,9 +67,11 @@ FRegenerateSkeletalLodResult FSkeletalMeshImplModule::RegenerateSkeletalLod(cons
 
 FSkeletonInfoResult FSkeletalMeshImplModule::GetSkeletonInfo(const FString& MeshPath)
 {
+	MCP_TRACE_SCOPE("FSkeletalMeshImplModule::GetSkeletonInfo");
+
 	FSkeletonInfoResult Result;
 
-	USkeletalMesh* Mesh = LoadObject<USkeletalMesh>(nullptr, *MeshPath);
+	USkeletalMesh* Mesh = AssetCache.LoadAsset<USkeletalMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -104,9 +115,11 @@ FSkeletonInfoResult FSkeletalMeshImplModule::GetSkeletonInfo(const FString& Mesh
 
 FGetPhysicsAssetResult FSkeletalMeshImplModule::GetPhysicsAsset(const FString& MeshPath)
 {
+	MCP_TRACE_SCOPE("FSkeletalMeshImplModule::GetPhysicsAsset");
+
 	FGetPhysicsAssetResult Result;
 
-	USkeletalMesh* Mesh = LoadObject<USkeletalMesh>(nullptr, *MeshPath);
+	USkeletalMesh* Mesh = AssetCache.LoadAsset<USkeletalMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -135,9 +148,11 @@ FGetPhysicsAssetResult FSkeletalMeshImplModule::GetPhysicsAsset(const FString& M
 
 FSetPhysicsAssetResult FSkeletalMeshImplModule::SetPhysicsAsset(const FString& MeshPath, const FString& PhysicsAssetPath)
 {
+	MCP_TRACE_SCOPE("FSkeletalMeshImplModule::SetPhysicsAsset");
+
 	FSetPhysicsAssetResult Result;
 
-	USkeletalMesh* Mesh = LoadObject<USkeletalMesh>(nullptr, *MeshPath);
+	USkeletalMesh* Mesh = AssetCache.LoadAsset<USkeletalMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -148,7 +163,7 @@ FSetPhysicsAssetResult FSkeletalMeshImplModule::SetPhysicsAsset(const FString& M
 	UPhysicsAsset* PhysAsset = nullptr;
 	if (!PhysicsAssetPath.IsEmpty())
 	{
-		PhysAsset = LoadObject<UPhysicsAsset>(nullptr, *PhysicsAssetPath);
+		PhysAsset = AssetCache.LoadAsset<UPhysicsAsset>(PhysicsAssetPath);
 		if (!PhysAsset)
 		{
 			Result.bSuccess = false;
@@ -167,9 +182,11 @@ FSetPhysicsAssetResult FSkeletalMeshImplModule::SetPhysicsAsset(const FString& M
 
 FReimportSkeletalMeshResult FSkeletalMeshImplModule::ReimportSkeletalMesh(const FString& MeshPath)
 {
+	MCP_TRACE_SCOPE("FSkeletalMeshImplModule::ReimportSkeletalMesh");
+
 	FReimportSkeletalMeshResult Result;
 
-	USkeletalMesh* Mesh = LoadObject<USkeletalMesh>(nullptr, *MeshPath);
+	USkeletalMesh* Mesh = AssetCache.LoadAsset<USkeletalMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -199,9 +216,11 @@ FReimportSkeletalMeshResult FSkeletalMeshImplModule::ReimportSkeletalMesh(const
 
 FCreateAnimAssetResult FSkeletalMeshImplModule::CreateAnimAsset(const FString& SkeletonPath, const FString& AssetName, const FString& PackagePath, const FString& AssetType)
 {
+	MCP_TRACE_SCOPE("FSkeletalMeshImplModule::CreateAnimAsset");
+
 	FCreateAnimAssetResult Result;
 
-	USkeleton* Skeleton = LoadObject<USkeleton>(nullptr, *SkeletonPath);
+	USkeleton* Skeleton = AssetCache.LoadAsset<USkeleton>(SkeletonPath);
 	if (!Skeleton)
 	{
 		Result.bSuccess = false;
@@ -260,9 +279,11 @@ FCreateAnimAssetResult FSkeletalMeshImplModule::CreateAnimAsset(const FString& S
 
 FCreateAnimBlueprintResult FSkeletalMeshImplModule::CreateAnimBlueprint(const FString& SkeletonPath, const FString& AssetName, const FString& PackagePath)
 {
+	MCP_TRACE_SCOPE("FSkeletalMeshImplModule::CreateAnimBlueprint");
+
 	FCreateAnimBlueprintResult Result;
 
-	USkeleton* Skeleton = LoadObject<USkeleton>(nullptr, *SkeletonPath);
+	USkeleton* Skeleton = AssetCache.LoadAsset<USkeleton>(SkeletonPath);
 	if (!Skeleton)
 	{
 		Result.bSuccess = false;
@@ -292,9 +313,11 @@ FCreateAnimBlueprintResult FSkeletalMeshImplModule::CreateAnimBlueprint(const FS
 
 FApplyAnimCompressionResult FSkeletalMeshImplModule::ApplyAnimCompression(const FString& AnimSequencePath, const FString& CompressionSettingsPath)
 {
+	MCP_TRACE_SCOPE("FSkeletalMeshImplModule::ApplyAnimCompression");
+
 	FApplyAnimCompressionResult Result;
 
-	UAnimSequence* AnimSequence = LoadObject<UAnimSequence>(nullptr, *AnimSequencePath);
+	UAnimSequence* AnimSequence = AssetCache.LoadAsset<UAnimSequence>(AnimSequencePath);
 	if (!AnimSequence)
 	{
 		Result.bSuccess = false;
@@ -305,7 +328,7 @@ FApplyAnimCompressionResult FSkeletalMeshImplModule::ApplyAnimCompression(const
 	UAnimBoneCompressionSettings* BoneSettings = nullptr;
 	if (!CompressionSettingsPath.IsEmpty())
 	{
-		BoneSettings = LoadObject<UAnimBoneCompressionSettings>(nullptr, *CompressionSettingsPath);
+		BoneSettings = AssetCache.LoadAsset<UAnimBoneCompressionSettings>(CompressionSettingsPath);
 		if (!BoneSettings)
 		{
 			Result.bSuccess = false;
@@ -3,9 +3,13 @@
 
 #include "Modules/Interfaces/ISkeletalMeshModule.h"
 
+class IAssetCacheModule;
+
 class FSkeletalMeshImplModule : public ISkeletalMeshModule
 {
 public:
+	explicit FSkeletalMeshImplModule(IAssetCacheModule& InAssetCache);
+
 	virtual FRegenerateSkeletalLodResult RegenerateSkeletalLod(const FString& MeshPath, int32 NewLodCount, bool bRegenerateEvenIfImported) override;
 	virtual FSkeletonInfoResult GetSkeletonInfo(const FString& MeshPath) override;
 	virtual FGetPhysicsAssetResult GetPhysicsAsset(const FString& MeshPath) override;
@@ -14,4 +18,7 @@ public:
 	virtual FCreateAnimAssetResult CreateAnimAsset(const FString& SkeletonPath, const FString& AssetName, const FString& PackagePath, const FString& AssetType) override;
 	virtual FCreateAnimBlueprintResult CreateAnimBlueprint(const FString& SkeletonPath, const FString& AssetName, const FString& PackagePath) override;
 	virtual FApplyAnimCompressionResult ApplyAnimCompression(const FString& AnimSequencePath, const FString& CompressionSettingsPath) override;
+
+private:
+	IAssetCacheModule& AssetCache;
 };
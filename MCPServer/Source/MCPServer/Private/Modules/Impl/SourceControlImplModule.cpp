@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/SourceControlImplModule.h"
+#include "Core/MCPTrace.h"
 #include "ISourceControlModule.h"
 #include "ISourceControlProvider.h"
 #include "SourceControlOperations.h"
@@ -38,6 +39,8 @@ static FString GetErrorString(const FSourceControlOperationRef& Op)
 
 FSCCOperationResult FSourceControlImplModule::Checkout(const TArray<FString>& Files)
 {
+	MCP_TRACE_SCOPE("FSourceControlImplModule::Checkout");
+
 	FSCCOperationResult Result;
 
 	ISourceControlProvider* Provider = nullptr;
@@ -64,6 +67,8 @@ FSCCOperationResult FSourceControlImplModule::Checkout(const TArray<FString>& Fi
 
 FSCCOperationResult FSourceControlImplModule::Add(const TArray<FString>& Files)
 {
+	MCP_TRACE_SCOPE("FSourceControlImplModule::Add");
+
 	FSCCOperationResult Result;
 
 	ISourceControlProvider* Provider = nullptr;
@@ -90,6 +95,8 @@ FSCCOperationResult FSourceControlImplModule::Add(const TArray<FString>& Files)
 
 FSCCOperationResult FSourceControlImplModule::Delete(const TArray<FString>& Files)
 {
+	MCP_TRACE_SCOPE("FSourceControlImplModule::Delete");
+
 	FSCCOperationResult Result;
 
 	ISourceControlProvider* Provider = nullptr;
@@ -116,6 +123,8 @@ FSCCOperationResult FSourceControlImplModule::Delete(const TArray<FString>& File
 
 FSCCOperationResult FSourceControlImplModule::Revert(const TArray<FString>& Files)
 {
+	MCP_TRACE_SCOPE("FSourceControlImplModule::Revert");
+
 	FSCCOperationResult Result;
 
 	ISourceControlProvider* Provider = nullptr;
@@ -142,6 +151,8 @@ FSCCOperationResult FSourceControlImplModule::Revert(const TArray<FString>& File
 
 FSCCStatusResult FSourceControlImplModule::Status(const TArray<FString>& Files)
 {
+	MCP_TRACE_SCOPE("FSourceControlImplModule::Status");
+
 	FSCCStatusResult Result;
 
 	ISourceControlProvider* Provider = nullptr;
@@ -186,6 +197,8 @@ FSCCStatusResult FSourceControlImplModule::Status(const TArray<FString>& Files)
 
 FSCCOperationResult FSourceControlImplModule::Submit(const TArray<FString>& Files, const FString& Description)
 {
+	MCP_TRACE_SCOPE("FSourceControlImplModule::Submit");
+
 	FSCCOperationResult Result;
 
 	ISourceControlProvider* Provider = nullptr;
@@ -218,6 +231,8 @@ FSCCOperationResult FSourceControlImplModule::Submit(const TArray<FString>& File
 
 FSCCOperationResult FSourceControlImplModule::Sync(const TArray<FString>& Files)
 {
+	MCP_TRACE_SCOPE("FSourceControlImplModule::Sync");
+
 	FSCCOperationResult Result;
 
 	ISourceControlProvider* Provider = nullptr;
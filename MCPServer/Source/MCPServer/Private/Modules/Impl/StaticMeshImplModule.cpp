@@ -1,17 +1,26 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/StaticMeshImplModule.h"
+#include "Core/MCPTrace.h"
+#include "Modules/Interfaces/IAssetCacheModule.h"
 #include "Engine/StaticMesh.h"
 #include "StaticMeshEditorSubsystem.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "Materials/MaterialInterface.h"
 #include "Editor.h"
 
+FStaticMeshImplModule::FStaticMeshImplModule(IAssetCacheModule& InAssetCache)
+	: AssetCache(InAssetCache)
+{
+}
+
 FSetStaticMeshLodResult FStaticMeshImplModule::SetStaticMeshLod(const FString& MeshPath, const TArray<float>& ScreenSizes)
 {
+	MCP_TRACE_SCOPE("FStaticMeshImplModule::SetStaticMeshLod");
+
 	FSetStaticMeshLodResult Result;
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	UStaticMesh* Mesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -41,9 +50,11 @@ FSetStaticMeshLodResult FStaticMeshImplModule::SetStaticMeshLod(const FString& M
 
 FImportLodResult FStaticMeshImplModule::ImportLod(const FString& MeshPath, int32 LodIndex, const FString& SourceFilePath)
 {
+	MCP_TRACE_SCOPE("FStaticMeshImplModule::ImportLod");
+
 	FImportLodResult Result;
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	UStaticMesh* Mesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -74,9 +85,11 @@ FImportLodResult FStaticMeshImplModule::ImportLod(const FString& MeshPath, int32
 
 FGetLodSettingsResult FStaticMeshImplModule::GetLodSettings(const FString& MeshPath)
 {
+	MCP_TRACE_SCOPE("FStaticMeshImplModule::GetLodSettings");
+
 	FGetLodSettingsResult Result;
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	UStaticMesh* Mesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -118,9 +131,11 @@ FGetLodSettingsResult FStaticMeshImplModule::GetLodSettings(const FString& MeshP
 
 FSetCollisionResult FStaticMeshImplModule::SetCollision(const FString& MeshPath, const FString& CollisionType)
 {
+	MCP_TRACE_SCOPE("FStaticMeshImplModule::SetCollision");
+
 	FSetCollisionResult Result;
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	UStaticMesh* Mesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -205,9 +220,11 @@ FSetCollisionResult FStaticMeshImplModule::SetCollision(const FString& MeshPath,
 
 FUVChannelResult FStaticMeshImplModule::AddUVChannel(const FString& MeshPath, int32 LodIndex)
 {
+	MCP_TRACE_SCOPE("FStaticMeshImplModule::AddUVChannel");
+
 	FUVChannelResult Result;
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	UStaticMesh* Mesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -238,9 +255,11 @@ FUVChannelResult FStaticMeshImplModule::AddUVChannel(const FString& MeshPath, in
 
 FUVChannelResult FStaticMeshImplModule::RemoveUVChannel(const FString& MeshPath, int32 LodIndex, int32 UVChannelIndex)
 {
+	MCP_TRACE_SCOPE("FStaticMeshImplModule::RemoveUVChannel");
+
 	FUVChannelResult Result;
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	UStaticMesh* Mesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -271,9 +290,11 @@ FUVChannelResult FStaticMeshImplModule::RemoveUVChannel(const FString& MeshPath,
 
 FUVChannelResult FStaticMeshImplModule::GenerateUVChannel(const FString& MeshPath, int32 LodIndex, int32 UVChannelIndex, const FString& ProjectionType)
 {
+	MCP_TRACE_SCOPE("FStaticMeshImplModule::GenerateUVChannel");
+
 	FUVChannelResult Result;
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	UStaticMesh* Mesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -326,9 +347,11 @@ FUVChannelResult FStaticMeshImplModule::GenerateUVChannel(const FString& MeshPat
 
 FSetMeshMaterialResult FStaticMeshImplModule::SetMeshMaterial(const FString& MeshPath, int32 MaterialIndex, const FString& MaterialPath)
 {
+	MCP_TRACE_SCOPE("FStaticMeshImplModule::SetMeshMaterial");
+
 	FSetMeshMaterialResult Result;
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	UStaticMesh* Mesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -336,7 +359,7 @@ FSetMeshMaterialResult FStaticMeshImplModule::SetMeshMaterial(const FString& Mes
 		return Result;
 	}
 
-	UMaterialInterface* Material = LoadObject<UMaterialInterface>(nullptr, *MaterialPath);
+	UMaterialInterface* Material = AssetCache.LoadAsset<UMaterialInterface>(MaterialPath);
 	if (!Material)
 	{
 		Result.bSuccess = false;
@@ -361,9 +384,11 @@ FSetMeshMaterialResult FStaticMeshImplModule::SetMeshMaterial(const FString& Mes
 
 FMeshBoundsResult FStaticMeshImplModule::GetMeshBounds(const FString& MeshPath)
 {
+	MCP_TRACE_SCOPE("FStaticMeshImplModule::GetMeshBounds");
+
 	FMeshBoundsResult Result;
 
-	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+	UStaticMesh* Mesh = AssetCache.LoadAsset<UStaticMesh>(MeshPath);
 	if (!Mesh)
 	{
 		Result.bSuccess = false;
@@ -3,9 +3,13 @@
 
 #include "Modules/Interfaces/IStaticMeshModule.h"
 
+class IAssetCacheModule;
+
 class FStaticMeshImplModule : public IStaticMeshModule
 {
 public:
+	explicit FStaticMeshImplModule(IAssetCacheModule& InAssetCache);
+
 	virtual FSetStaticMeshLodResult SetStaticMeshLod(const FString& MeshPath, const TArray<float>& ScreenSizes) override;
 	virtual FImportLodResult ImportLod(const FString& MeshPath, int32 LodIndex, const FString& SourceFilePath) override;
 	virtual FGetLodSettingsResult GetLodSettings(const FString& MeshPath) override;
@@ -15,4 +19,7 @@ public:
 	virtual FUVChannelResult GenerateUVChannel(const FString& MeshPath, int32 LodIndex, int32 UVChannelIndex, const FString& ProjectionType) override;
 	virtual FSetMeshMaterialResult SetMeshMaterial(const FString& MeshPath, int32 MaterialIndex, const FString& MaterialPath) override;
 	virtual FMeshBoundsResult GetMeshBounds(const FString& MeshPath) override;
+
+private:
+	IAssetCacheModule& AssetCache;
 };
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/UIImplModule.h"
+#include "Core/MCPTrace.h"
 #include "Editor.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
@@ -12,6 +13,8 @@
 
 FNotificationResult FUIImplModule::ShowNotification(const FString& Message, const FString& SubText, float Duration)
 {
+	MCP_TRACE_SCOPE("FUIImplModule::ShowNotification");
+
 	FNotificationResult Result;
 
 	FNotificationInfo Info(FText::FromString(Message));
@@ -39,6 +42,8 @@ FNotificationResult FUIImplModule::ShowNotification(const FString& Message, cons
 
 FDialogResult FUIImplModule::ShowDialog(const FString& Title, const FString& Message, const FString& DialogType)
 {
+	MCP_TRACE_SCOPE("FUIImplModule::ShowDialog");
+
 	FDialogResult Result;
 
 	EAppMsgType::Type MsgType = EAppMsgType::Ok;
@@ -76,6 +81,8 @@ FDialogResult FUIImplModule::ShowDialog(const FString& Title, const FString& Mes
 
 FAssetEditorResult FUIImplModule::OpenAssetEditor(const FString& AssetPath)
 {
+	MCP_TRACE_SCOPE("FUIImplModule::OpenAssetEditor");
+
 	FAssetEditorResult Result;
 
 	if (!GEditor)
@@ -113,6 +120,8 @@ FAssetEditorResult FUIImplModule::OpenAssetEditor(const FString& AssetPath)
 
 FAssetEditorResult FUIImplModule::CloseAssetEditor(const FString& AssetPath)
 {
+	MCP_TRACE_SCOPE("FUIImplModule::CloseAssetEditor");
+
 	FAssetEditorResult Result;
 
 	if (!GEditor)
@@ -146,6 +155,8 @@ FAssetEditorResult FUIImplModule::CloseAssetEditor(const FString& AssetPath)
 
 FNotificationResult FUIImplModule::SyncContentBrowser(const FString& Path)
 {
+	MCP_TRACE_SCOPE("FUIImplModule::SyncContentBrowser");
+
 	FNotificationResult Result;
 
 	if (Path.Contains(TEXT(".")))
@@ -167,6 +178,8 @@ FNotificationResult FUIImplModule::SyncContentBrowser(const FString& Path)
 
 FContentBrowserSelectionResult FUIImplModule::GetSelectedContentBrowser()
 {
+	MCP_TRACE_SCOPE("FUIImplModule::GetSelectedContentBrowser");
+
 	FContentBrowserSelectionResult Result;
 
 	TArray<FAssetData> SelectedAssets;
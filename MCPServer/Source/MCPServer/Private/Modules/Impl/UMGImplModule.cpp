@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/UMGImplModule.h"
+#include "Core/MCPTrace.h"
+#include "Modules/Interfaces/IAssetCacheModule.h"
 
 #include "WidgetBlueprint.h"
 #include "WidgetBlueprintEditorUtils.h"
@@ -30,9 +32,9 @@
 
 namespace UMGImplHelpers
 {
-	static UWidgetBlueprint* LoadWidgetBlueprint(const FString& BlueprintPath, FString& OutError)
+	static UWidgetBlueprint* LoadWidgetBlueprint(IAssetCacheModule& AssetCache, const FString& BlueprintPath, FString& OutError)
 	{
-		UObject* Asset = LoadObject<UObject>(nullptr, *BlueprintPath);
+		UObject* Asset = AssetCache.LoadAsset<UObject>(BlueprintPath);
 		if (!Asset)
 		{
 			OutError = FString::Printf(TEXT("Asset not found: %s"), *BlueprintPath);
@@ -182,8 +184,15 @@ namespace UMGImplHelpers
 	}
 }
 
+FUMGImplModule::FUMGImplModule(IAssetCacheModule& InAssetCache)
+	: AssetCache(InAssetCache)
+{
+}
+
 FCreateWidgetBlueprintResult FUMGImplModule::CreateWidgetBlueprint(const FString& BlueprintPath, const FString* RootWidgetClass)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::CreateWidgetBlueprint");
+
 	FCreateWidgetBlueprintResult Result;
 
 	FString PackagePath = FPackageName::GetLongPackagePath(BlueprintPath);
@@ -260,10 +269,12 @@ FCreateWidgetBlueprintResult FUMGImplModule::CreateWidgetBlueprint(const FString
 
 FGetWidgetTreeResult FUMGImplModule::GetWidgetTree(const FString& BlueprintPath)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::GetWidgetTree");
+
 	FGetWidgetTreeResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP)
 	{
 		Result.ErrorMessage = Error;
@@ -294,10 +305,12 @@ FGetWidgetTreeResult FUMGImplModule::GetWidgetTree(const FString& BlueprintPath)
 
 FAddWidgetResult FUMGImplModule::AddWidget(const FString& BlueprintPath, const FString& WidgetClass, const FString& ParentName, const FString* WidgetName, const int32* InsertIndex)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::AddWidget");
+
 	FAddWidgetResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP) { Result.ErrorMessage = Error; return Result; }
 
 	UWidget* ParentWidget = UMGImplHelpers::FindWidgetByName(WBP, ParentName, Error);
@@ -361,10 +374,12 @@ FAddWidgetResult FUMGImplModule::AddWidget(const FString& BlueprintPath, const F
 
 FRemoveWidgetResult FUMGImplModule::RemoveWidget(const FString& BlueprintPath, const FString& WidgetName)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::RemoveWidget");
+
 	FRemoveWidgetResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP) { Result.ErrorMessage = Error; return Result; }
 
 	UWidget* Widget = UMGImplHelpers::FindWidgetByName(WBP, WidgetName, Error);
@@ -390,10 +405,12 @@ FRemoveWidgetResult FUMGImplModule::RemoveWidget(const FString& BlueprintPath, c
 
 FMoveWidgetResult FUMGImplModule::MoveWidget(const FString& BlueprintPath, const FString& WidgetName, const FString& NewParentName, const int32* InsertIndex)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::MoveWidget");
+
 	FMoveWidgetResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP) { Result.ErrorMessage = Error; return Result; }
 
 	UWidget* Widget = UMGImplHelpers::FindWidgetByName(WBP, WidgetName, Error);
@@ -461,10 +478,12 @@ FMoveWidgetResult FUMGImplModule::MoveWidget(const FString& BlueprintPath, const
 
 FRenameWidgetResult FUMGImplModule::RenameWidget(const FString& BlueprintPath, const FString& WidgetName, const FString& NewName)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::RenameWidget");
+
 	FRenameWidgetResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP) { Result.ErrorMessage = Error; return Result; }
 
 	UWidget* Widget = UMGImplHelpers::FindWidgetByName(WBP, WidgetName, Error);
@@ -496,10 +515,12 @@ FRenameWidgetResult FUMGImplModule::RenameWidget(const FString& BlueprintPath, c
 
 FReplaceWidgetResult FUMGImplModule::ReplaceWidget(const FString& BlueprintPath, const FString& WidgetName, const FString& NewWidgetClass)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::ReplaceWidget");
+
 	FReplaceWidgetResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP) { Result.ErrorMessage = Error; return Result; }
 
 	UWidget* Widget = UMGImplHelpers::FindWidgetByName(WBP, WidgetName, Error);
@@ -527,10 +548,12 @@ FReplaceWidgetResult FUMGImplModule::ReplaceWidget(const FString& BlueprintPath,
 
 FSetWidgetPropertyResult FUMGImplModule::SetWidgetProperty(const FString& BlueprintPath, const FString& WidgetName, const FString& PropertyName, const FString& PropertyValue)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::SetWidgetProperty");
+
 	FSetWidgetPropertyResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP) { Result.ErrorMessage = Error; return Result; }
 
 	UWidget* Widget = UMGImplHelpers::FindWidgetByName(WBP, WidgetName, Error);
@@ -561,10 +584,12 @@ FSetWidgetPropertyResult FUMGImplModule::SetWidgetProperty(const FString& Bluepr
 
 FGetWidgetPropertyResult FUMGImplModule::GetWidgetProperty(const FString& BlueprintPath, const FString& WidgetName, const FString& PropertyName)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::GetWidgetProperty");
+
 	FGetWidgetPropertyResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP) { Result.ErrorMessage = Error; return Result; }
 
 	UWidget* Widget = UMGImplHelpers::FindWidgetByName(WBP, WidgetName, Error);
@@ -588,10 +613,12 @@ FGetWidgetPropertyResult FUMGImplModule::GetWidgetProperty(const FString& Bluepr
 
 FSetWidgetSlotResult FUMGImplModule::SetWidgetSlot(const FString& BlueprintPath, const FString& WidgetName, const TMap<FString, FString>& SlotProperties)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::SetWidgetSlot");
+
 	FSetWidgetSlotResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP) { Result.ErrorMessage = Error; return Result; }
 
 	UWidget* Widget = UMGImplHelpers::FindWidgetByName(WBP, WidgetName, Error);
@@ -731,10 +758,12 @@ FSetWidgetSlotResult FUMGImplModule::SetWidgetSlot(const FString& BlueprintPath,
 
 FGetWidgetAnimationsResult FUMGImplModule::GetWidgetAnimations(const FString& BlueprintPath)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::GetWidgetAnimations");
+
 	FGetWidgetAnimationsResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP) { Result.ErrorMessage = Error; return Result; }
 
 	for (UWidgetAnimation* Anim : WBP->Animations)
@@ -755,10 +784,12 @@ FGetWidgetAnimationsResult FUMGImplModule::GetWidgetAnimations(const FString& Bl
 
 FExportWidgetsResult FUMGImplModule::ExportWidgets(const FString& BlueprintPath, const TArray<FString>* WidgetNames)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::ExportWidgets");
+
 	FExportWidgetsResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP) { Result.ErrorMessage = Error; return Result; }
 
 	TArray<UWidget*> WidgetsToExport;
@@ -791,10 +822,12 @@ FExportWidgetsResult FUMGImplModule::ExportWidgets(const FString& BlueprintPath,
 
 FImportWidgetsResult FUMGImplModule::ImportWidgets(const FString& BlueprintPath, const FString& ExportedText, const FString* ParentName)
 {
+	MCP_TRACE_SCOPE("FUMGImplModule::ImportWidgets");
+
 	FImportWidgetsResult Result;
 
 	FString Error;
-	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(BlueprintPath, Error);
+	UWidgetBlueprint* WBP = UMGImplHelpers::LoadWidgetBlueprint(AssetCache, BlueprintPath, Error);
 	if (!WBP) { Result.ErrorMessage = Error; return Result; }
 
 	WBP->Modify();
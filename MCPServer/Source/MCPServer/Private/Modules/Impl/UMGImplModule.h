@@ -3,9 +3,13 @@
 
 #include "Modules/Interfaces/IUMGModule.h"
 
+class IAssetCacheModule;
+
 class FUMGImplModule : public IUMGModule
 {
 public:
+	explicit FUMGImplModule(IAssetCacheModule& InAssetCache);
+
 	virtual FCreateWidgetBlueprintResult CreateWidgetBlueprint(const FString& BlueprintPath, const FString* RootWidgetClass) override;
 	virtual FGetWidgetTreeResult GetWidgetTree(const FString& BlueprintPath) override;
 	virtual FAddWidgetResult AddWidget(const FString& BlueprintPath, const FString& WidgetClass, const FString& ParentName, const FString* WidgetName, const int32* InsertIndex) override;
@@ -19,4 +23,7 @@ public:
 	virtual FGetWidgetAnimationsResult GetWidgetAnimations(const FString& BlueprintPath) override;
 	virtual FExportWidgetsResult ExportWidgets(const FString& BlueprintPath, const TArray<FString>* WidgetNames) override;
 	virtual FImportWidgetsResult ImportWidgets(const FString& BlueprintPath, const FString& ExportedText, const FString* ParentName) override;
+
+private:
+	IAssetCacheModule& AssetCache;
 };
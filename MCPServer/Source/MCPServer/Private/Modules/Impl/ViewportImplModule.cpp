@@ -1,12 +1,12 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/ViewportImplModule.h"
+#include "Core/MCPTrace.h"
 #include "Modules/Interfaces/IActorModule.h"
 #include "Editor.h"
 #include "LevelEditorViewport.h"
 #include "EditorViewportClient.h"
 #include "LevelEditorSubsystem.h"
-#include "Subsystems/EditorActorSubsystem.h"
 #include "UnrealClient.h"
 #include "HighResScreenshot.h"
 #include "Bookmarks/IBookmarkTypeTools.h"
@@ -20,6 +20,8 @@ FViewportImplModule::FViewportImplModule(IActorModule& InActorModule)
 
 FViewportCameraResult FViewportImplModule::GetViewportCamera()
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::GetViewportCamera");
+
 	FViewportCameraResult Result;
 
 	FLevelEditorViewportClient* Client = GCurrentLevelEditingViewportClient;
@@ -39,6 +41,8 @@ FViewportCameraResult FViewportImplModule::GetViewportCamera()
 
 FSetViewportCameraResult FViewportImplModule::SetViewportCamera(const FVector& Location, const FRotator& Rotation)
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::SetViewportCamera");
+
 	FSetViewportCameraResult Result;
 
 	FLevelEditorViewportClient* Client = GCurrentLevelEditingViewportClient;
@@ -61,6 +65,8 @@ FSetViewportCameraResult FViewportImplModule::SetViewportCamera(const FVector& L
 
 FSimpleResult FViewportImplModule::SetGameView(bool bEnabled)
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::SetGameView");
+
 	FSimpleResult Result;
 
 	ULevelEditorSubsystem* LevelEditorSubsystem = GEditor->GetEditorSubsystem<ULevelEditorSubsystem>();
@@ -80,6 +86,8 @@ FSimpleResult FViewportImplModule::SetGameView(bool bEnabled)
 
 FSimpleResult FViewportImplModule::SetViewportRealtime(bool bEnabled)
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::SetViewportRealtime");
+
 	FSimpleResult Result;
 
 	ULevelEditorSubsystem* LevelEditorSubsystem = GEditor->GetEditorSubsystem<ULevelEditorSubsystem>();
@@ -99,6 +107,8 @@ FSimpleResult FViewportImplModule::SetViewportRealtime(bool bEnabled)
 
 FSimpleResult FViewportImplModule::SetViewMode(const FString& ModeName)
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::SetViewMode");
+
 	FSimpleResult Result;
 
 	FLevelEditorViewportClient* Client = GCurrentLevelEditingViewportClient;
@@ -167,6 +177,8 @@ FSimpleResult FViewportImplModule::SetViewMode(const FString& ModeName)
 
 FSimpleResult FViewportImplModule::SetCameraFOV(float FOV)
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::SetCameraFOV");
+
 	FSimpleResult Result;
 
 	FLevelEditorViewportClient* Client = GCurrentLevelEditingViewportClient;
@@ -195,6 +207,8 @@ FSimpleResult FViewportImplModule::SetCameraFOV(float FOV)
 
 FSimpleResult FViewportImplModule::FocusOnActors(const TArray<FString>& ActorIdentifiers)
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::FocusOnActors");
+
 	FSimpleResult Result;
 
 	FLevelEditorViewportClient* Client = GCurrentLevelEditingViewportClient;
@@ -205,28 +219,15 @@ FSimpleResult FViewportImplModule::FocusOnActors(const TArray<FString>& ActorIde
 		return Result;
 	}
 
-	UEditorActorSubsystem* EditorActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-	if (!EditorActorSubsystem)
-	{
-		Result.bSuccess = false;
-		Result.ErrorMessage = TEXT("UEditorActorSubsystem is not available");
-		return Result;
-	}
-
 	FBox BoundingBox(ForceInit);
 	int32 FoundCount = 0;
 
-	TArray<AActor*> AllActors = EditorActorSubsystem->GetAllLevelActors();
 	for (const FString& Identifier : ActorIdentifiers)
 	{
-		for (AActor* Actor : AllActors)
+		if (AActor* Actor = ActorModule.FindActor(Identifier))
 		{
-			if (Actor && (Actor->GetName() == Identifier || Actor->GetActorLabel() == Identifier))
-			{
-				BoundingBox += Actor->GetComponentsBoundingBox(true);
-				FoundCount++;
-				break;
-			}
+			BoundingBox += Actor->GetComponentsBoundingBox(true);
+			FoundCount++;
 		}
 	}
 
@@ -246,6 +247,8 @@ FSimpleResult FViewportImplModule::FocusOnActors(const TArray<FString>& ActorIde
 
 FScreenshotResult FViewportImplModule::TakeScreenshot(const FString& Filename)
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::TakeScreenshot");
+
 	FScreenshotResult Result;
 
 	FLevelEditorViewportClient* Client = GCurrentLevelEditingViewportClient;
@@ -271,6 +274,8 @@ FScreenshotResult FViewportImplModule::TakeScreenshot(const FString& Filename)
 
 FSimpleResult FViewportImplModule::PilotActor(const FString& ActorIdentifier)
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::PilotActor");
+
 	FSimpleResult Result;
 
 	ULevelEditorSubsystem* LevelEditorSubsystem = GEditor->GetEditorSubsystem<ULevelEditorSubsystem>();
@@ -281,28 +286,8 @@ FSimpleResult FViewportImplModule::PilotActor(const FString& ActorIdentifier)
 		return Result;
 	}
 
-	UEditorActorSubsystem* EditorActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-	if (!EditorActorSubsystem)
-	{
-		Result.bSuccess = false;
-		Result.ErrorMessage = TEXT("UEditorActorSubsystem is not available");
-		return Result;
-	}
-
 	// Find the actor
-	AActor* Actor = EditorActorSubsystem->GetActorReference(ActorIdentifier);
-	if (!Actor)
-	{
-		TArray<AActor*> AllActors = EditorActorSubsystem->GetAllLevelActors();
-		for (AActor* A : AllActors)
-		{
-			if (A && (A->GetName() == ActorIdentifier || A->GetActorLabel() == ActorIdentifier))
-			{
-				Actor = A;
-				break;
-			}
-		}
-	}
+	AActor* Actor = ActorModule.FindActor(ActorIdentifier);
 
 	if (!Actor)
 	{
@@ -320,6 +305,8 @@ FSimpleResult FViewportImplModule::PilotActor(const FString& ActorIdentifier)
 
 FSimpleResult FViewportImplModule::EjectPilot()
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::EjectPilot");
+
 	FSimpleResult Result;
 
 	ULevelEditorSubsystem* LevelEditorSubsystem = GEditor->GetEditorSubsystem<ULevelEditorSubsystem>();
@@ -339,6 +326,8 @@ FSimpleResult FViewportImplModule::EjectPilot()
 
 FSimpleResult FViewportImplModule::SetBookmark(int32 Index)
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::SetBookmark");
+
 	FSimpleResult Result;
 
 	FLevelEditorViewportClient* Client = GCurrentLevelEditingViewportClient;
@@ -358,6 +347,8 @@ FSimpleResult FViewportImplModule::SetBookmark(int32 Index)
 
 FSimpleResult FViewportImplModule::JumpToBookmark(int32 Index)
 {
+	MCP_TRACE_SCOPE("FViewportImplModule::JumpToBookmark");
+
 	FSimpleResult Result;
 
 	FLevelEditorViewportClient* Client = GCurrentLevelEditingViewportClient;
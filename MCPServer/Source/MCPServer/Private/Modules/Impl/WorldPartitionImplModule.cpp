@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Modules/Impl/WorldPartitionImplModule.h"
+#include "Core/MCPTrace.h"
 #include "Editor.h"
 #include "WorldPartition/IWorldPartitionEditorModule.h"
 #include "WorldPartition/WorldPartition.h"
@@ -16,6 +17,8 @@ static UWorld* GetEditorWorld()
 
 FWorldPartitionResult FWorldPartitionImplModule::BuildHLOD()
 {
+	MCP_TRACE_SCOPE("FWorldPartitionImplModule::BuildHLOD");
+
 	FWorldPartitionResult Result;
 
 	UWorld* World = GetEditorWorld();
@@ -61,6 +64,8 @@ FWorldPartitionResult FWorldPartitionImplModule::BuildHLOD()
 
 FWorldPartitionResult FWorldPartitionImplModule::DeleteHLOD()
 {
+	MCP_TRACE_SCOPE("FWorldPartitionImplModule::DeleteHLOD");
+
 	FWorldPartitionResult Result;
 
 	UWorld* World = GetEditorWorld();
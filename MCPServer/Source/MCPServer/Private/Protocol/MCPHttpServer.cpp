@@ -3,21 +3,33 @@
 #include "Protocol/MCPHttpServer.h"
 #include "Protocol/MCPJsonRpc.h"
 #include "Protocol/MCPSessionManager.h"
+#include "Core/MCPMetrics.h"
+#include "Core/MCPTrace.h"
 #include "HttpServerModule.h"
 #include "IHttpRouter.h"
 #include "HttpServerRequest.h"
 #include "HttpServerResponse.h"
 #include "HttpPath.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Compression.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogMCPHttpServer, Log, All);
 DEFINE_LOG_CATEGORY(LogMCPHttpServer);
 
-FMCPHttpServer::FMCPHttpServer(FMCPJsonRpc& InJsonRpc, FMCPSessionManager& InSessionManager)
+FMCPHttpServer::FMCPHttpServer(FMCPJsonRpc& InJsonRpc, FMCPSessionManager& InSessionManager, FMCPMetrics* InMetrics)
 	: JsonRpc(InJsonRpc)
 	, SessionManager(InSessionManager)
+	, Metrics(InMetrics)
 {
 }
 
+FMCPHttpServer::~FMCPHttpServer()
+{
+	CloseAllStreams();
+}
+
 void FMCPHttpServer::Start(uint32 Port)
 {
 	FHttpServerModule& HttpServerModule = FHttpServerModule::Get();
@@ -39,6 +51,24 @@ void FMCPHttpServer::Start(uint32 Port)
 		EHttpServerRequestVerbs::VERB_DELETE,
 		FHttpRequestHandler::CreateRaw(this, &FMCPHttpServer::HandleDeleteRequest));
 
+	GetRouteHandle = HttpRouter->BindRoute(
+		FHttpPath(TEXT("/mcp")),
+		EHttpServerRequestVerbs::VERB_GET,
+		FHttpRequestHandler::CreateRaw(this, &FMCPHttpServer::HandleGetRequest));
+
+	if (Metrics)
+	{
+		MetricsRouteHandle = HttpRouter->BindRoute(
+			FHttpPath(TEXT("/metrics")),
+			EHttpServerRequestVerbs::VERB_GET,
+			FHttpRequestHandler::CreateRaw(this, &FMCPHttpServer::HandleMetricsRequest));
+	}
+
+	EventQueuedHandle = SessionManager.OnEventQueued().AddRaw(this, &FMCPHttpServer::HandleSessionEventQueued);
+	SessionRemovedHandle = SessionManager.OnSessionRemoved().AddRaw(this, &FMCPHttpServer::HandleSessionRemoved);
+	StreamTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FMCPHttpServer::TickSessions), 1.0f);
+
 	HttpServerModule.StartAllListeners();
 
 	UE_LOG(LogMCPHttpServer, Log, TEXT("MCP HTTP Server started on port %d"), Port);
@@ -46,10 +76,17 @@ void FMCPHttpServer::Start(uint32 Port)
 
 void FMCPHttpServer::Stop()
 {
+	CloseAllStreams();
+
 	if (HttpRouter.IsValid())
 	{
 		HttpRouter->UnbindRoute(PostRouteHandle);
 		HttpRouter->UnbindRoute(DeleteRouteHandle);
+		HttpRouter->UnbindRoute(GetRouteHandle);
+		if (MetricsRouteHandle.IsValid())
+		{
+			HttpRouter->UnbindRoute(MetricsRouteHandle);
+		}
 	}
 
 	FHttpServerModule::Get().StopAllListeners();
@@ -59,12 +96,10 @@ void FMCPHttpServer::Stop()
 
 bool FMCPHttpServer::HandlePostRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
-	FString RequestBody;
-	if (Request.Body.Num() > 0)
-	{
-		FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Request.Body.GetData()), Request.Body.Num());
-		RequestBody = FString(Converter.Length(), Converter.Get());
-	}
+	MCP_TRACE_SCOPE("MCP::HandlePost");
+
+	// Parsed in place; the body is only referenced until ProcessUtf8MessageAsync returns
+	const FUtf8StringView RequestBody(reinterpret_cast<const UTF8CHAR*>(Request.Body.GetData()), Request.Body.Num());
 	if (RequestBody.IsEmpty())
 	{
 		auto Response = FHttpServerResponse::Error(
@@ -82,20 +117,117 @@ bool FMCPHttpServer::HandlePostRequest(const FHttpServerRequest& Request, const
 		SessionId = (*SessionHeaders)[0];
 	}
 
-	FString ResponseBody;
-	FString NewSessionId;
-	int32 HttpCode = 200;
-	JsonRpc.ProcessMessage(RequestBody, SessionId, ResponseBody, NewSessionId, HttpCode);
+	if (!SessionId.IsEmpty() && !SessionManager.TouchSession(SessionId))
+	{
+		auto Response = FHttpServerResponse::Error(
+			EHttpServerResponseCodes::NotFound,
+			TEXT("InvalidSession"),
+			TEXT("Session not found or expired"));
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	// tools/list responses carry an ETag; a client that already has the current list gets 304 without a body
+	FString ToolsListETag;
+	if (JsonRpc.IsToolsListRequest(RequestBody))
+	{
+		ToolsListETag = JsonRpc.GetToolsListETag();
+		if (MatchesETag(Request, ToolsListETag))
+		{
+			auto Response = FHttpServerResponse::Ok();
+			Response->Code = EHttpServerResponseCodes::NotModified;
+			Response->Headers.Add(TEXT("ETag"), { ToolsListETag });
+			OnComplete(MoveTemp(Response));
+			return true;
+		}
+	}
 
+	// Progress goes to the session's open GET stream as it happens. Without a stream it is only
+	// sent to clients that accept an event stream response, ahead of the response itself.
+	const bool bAcceptsEventStream = AcceptsEventStream(Request);
+	const FName ContentEncoding = NegotiateContentEncoding(Request);
+
+	TSharedRef<TArray<FString>> Notifications = MakeShared<TArray<FString>>();
+	FMCPMessageNotification OnNotification;
+	if (!SessionId.IsEmpty() && OpenStreams.Contains(SessionId))
+	{
+		OnNotification = [this, SessionId](const FString& Notification)
+		{
+			SessionManager.PushNotification(SessionId, Notification);
+		};
+	}
+	else if (bAcceptsEventStream)
+	{
+		OnNotification = [Notifications](const FString& Notification)
+		{
+			Notifications->Add(Notification);
+		};
+	}
+
+	JsonRpc.ProcessUtf8MessageAsync(RequestBody, SessionId,
+		[this, OnComplete, Notifications, SessionId, bAcceptsEventStream, ToolsListETag, ContentEncoding](TArray<uint8>&& ResponseBody, const FString& NewSessionId, int32 HttpCode, int32 RetryAfterSeconds)
+		{
+			// Session notifications not picked up by a GET stream go out ahead of the response
+			if (bAcceptsEventStream && HttpCode == 200 && !OpenStreams.Contains(SessionId))
+			{
+				TArray<FString> SessionNotifications = SessionManager.TakeNotifications(SessionId);
+				Notifications->Insert(SessionNotifications, 0);
+			}
+
+			if (Notifications->Num() > 0 && HttpCode == 200)
+			{
+				SendEventStreamResponse(OnComplete, *Notifications, ResponseBody, NewSessionId, ContentEncoding);
+				return;
+			}
+			SendJsonRpcResponse(OnComplete, MoveTemp(ResponseBody), NewSessionId, HttpCode, ToolsListETag, ContentEncoding, RetryAfterSeconds);
+		},
+		MoveTemp(OnNotification));
+	return true;
+}
+
+bool FMCPHttpServer::MatchesETag(const FHttpServerRequest& Request, const FString& ETag)
+{
+	const TArray<FString>* IfNoneMatchHeaders = Request.Headers.Find(TEXT("If-None-Match"));
+	if (!IfNoneMatchHeaders || ETag.IsEmpty())
+	{
+		return false;
+	}
+
+	for (const FString& IfNoneMatch : *IfNoneMatchHeaders)
+	{
+		TArray<FString> Candidates;
+		IfNoneMatch.ParseIntoArray(Candidates, TEXT(","));
+		for (FString& Candidate : Candidates)
+		{
+			Candidate.TrimStartAndEndInline();
+			Candidate.RemoveFromStart(TEXT("W/"));
+			if (Candidate == TEXT("*") || Candidate == ETag)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void FMCPHttpServer::SendJsonRpcResponse(
+	const FHttpResultCallback& OnComplete,
+	TArray<uint8>&& ResponseBody,
+	const FString& NewSessionId,
+	int32 HttpCode,
+	const FString& ETag,
+	FName ContentEncoding,
+	int32 RetryAfterSeconds)
+{
 	if (HttpCode == 202)
 	{
 		auto Response = FHttpServerResponse::Ok();
 		Response->Code = EHttpServerResponseCodes::Accepted;
 		OnComplete(MoveTemp(Response));
-		return true;
+		return;
 	}
 
-	auto Response = FHttpServerResponse::Create(ResponseBody, TEXT("application/json"));
+	auto Response = FHttpServerResponse::Create(MoveTemp(ResponseBody), TEXT("application/json"));
 	Response->Code = static_cast<EHttpServerResponseCodes>(HttpCode);
 
 	if (!NewSessionId.IsEmpty())
@@ -103,8 +235,127 @@ bool FMCPHttpServer::HandlePostRequest(const FHttpServerRequest& Request, const
 		Response->Headers.Add(TEXT("Mcp-Session-Id"), { NewSessionId });
 	}
 
-	OnComplete(MoveTemp(Response));
-	return true;
+	if (!ETag.IsEmpty() && HttpCode == 200)
+	{
+		Response->Headers.Add(TEXT("ETag"), { ETag });
+	}
+
+	if (RetryAfterSeconds > 0)
+	{
+		Response->Headers.Add(TEXT("Retry-After"), { FString::FromInt(RetryAfterSeconds) });
+	}
+
+	CompleteResponse(OnComplete, MoveTemp(Response), ContentEncoding);
+}
+
+void FMCPHttpServer::SendEventStreamResponse(
+	const FHttpResultCallback& OnComplete,
+	const TArray<FString>& Notifications,
+	const TArray<uint8>& ResponseBody,
+	const FString& NewSessionId,
+	FName ContentEncoding)
+{
+	auto AppendUtf8 = [](TArray<uint8>& Body, const FString& Text)
+	{
+		FTCHARToUTF8 Converter(*Text, Text.Len());
+		Body.Append(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+	};
+
+	TArray<uint8> StreamBody;
+	StreamBody.Reserve(ResponseBody.Num() + 64);
+	for (const FString& Notification : Notifications)
+	{
+		AppendUtf8(StreamBody, FString::Printf(TEXT("event: message\ndata: %s\n\n"), *Notification));
+	}
+	AppendUtf8(StreamBody, TEXT("event: message\ndata: "));
+	StreamBody.Append(ResponseBody);
+	AppendUtf8(StreamBody, TEXT("\n\n"));
+
+	auto Response = FHttpServerResponse::Create(MoveTemp(StreamBody), TEXT("text/event-stream"));
+	if (!NewSessionId.IsEmpty())
+	{
+		Response->Headers.Add(TEXT("Mcp-Session-Id"), { NewSessionId });
+	}
+
+	CompleteResponse(OnComplete, MoveTemp(Response), ContentEncoding);
+}
+
+FName FMCPHttpServer::NegotiateContentEncoding(const FHttpServerRequest& Request)
+{
+	const TArray<FString>* AcceptEncodingHeaders = Request.Headers.Find(TEXT("Accept-Encoding"));
+	if (!AcceptEncodingHeaders)
+	{
+		return NAME_None;
+	}
+
+	bool bAcceptsGzip = false;
+	bool bAcceptsDeflate = false;
+	for (const FString& AcceptEncoding : *AcceptEncodingHeaders)
+	{
+		TArray<FString> Codings;
+		AcceptEncoding.ParseIntoArray(Codings, TEXT(","));
+		for (const FString& Coding : Codings)
+		{
+			FString Name = Coding;
+			FString CodingParams;
+			Coding.Split(TEXT(";"), &Name, &CodingParams);
+			Name.TrimStartAndEndInline();
+			CodingParams.TrimStartAndEndInline();
+
+			// "gzip;q=0" explicitly refuses the coding
+			if (CodingParams.StartsWith(TEXT("q=")) && FCString::Atof(*CodingParams.RightChop(2)) <= 0.0f)
+			{
+				continue;
+			}
+
+			if (Name.Equals(TEXT("gzip"), ESearchCase::IgnoreCase) || Name == TEXT("*"))
+			{
+				bAcceptsGzip = true;
+			}
+			else if (Name.Equals(TEXT("deflate"), ESearchCase::IgnoreCase))
+			{
+				bAcceptsDeflate = true;
+			}
+		}
+	}
+
+	if (bAcceptsGzip)
+	{
+		return NAME_Gzip;
+	}
+	return bAcceptsDeflate ? NAME_Zlib : NAME_None;
+}
+
+void FMCPHttpServer::CompleteResponse(const FHttpResultCallback& OnComplete, TUniquePtr<FHttpServerResponse> Response, FName ContentEncoding)
+{
+	if (ContentEncoding.IsNone() || Response->Body.Num() < CompressionThresholdBytes)
+	{
+		OnComplete(MoveTemp(Response));
+		return;
+	}
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [OnComplete, Response = MoveTemp(Response), ContentEncoding]() mutable
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(ContentEncoding, Response->Body.Num());
+		TArray<uint8> CompressedBody;
+		CompressedBody.SetNumUninitialized(CompressedSize);
+
+		// Incompressible bodies are sent as they are
+		if (FCompression::CompressMemory(ContentEncoding, CompressedBody.GetData(), CompressedSize, Response->Body.GetData(), Response->Body.Num()) &&
+			CompressedSize < Response->Body.Num())
+		{
+			CompressedBody.SetNum(CompressedSize);
+			Response->Body = MoveTemp(CompressedBody);
+			Response->Headers.Add(TEXT("Content-Encoding"), { ContentEncoding == NAME_Gzip ? TEXT("gzip") : TEXT("deflate") });
+		}
+		Response->Headers.Add(TEXT("Vary"), { TEXT("Accept-Encoding") });
+
+		// The HTTP server processes completions on the game thread
+		AsyncTask(ENamedThreads::GameThread, [OnComplete, Response = MoveTemp(Response)]() mutable
+		{
+			OnComplete(MoveTemp(Response));
+		});
+	});
 }
 
 bool FMCPHttpServer::HandleDeleteRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
@@ -126,9 +377,178 @@ bool FMCPHttpServer::HandleDeleteRequest(const FHttpServerRequest& Request, cons
 		return true;
 	}
 
+	CompleteStream(SessionId, TArray<FMCPSessionEvent>());
 	SessionManager.RemoveSession(SessionId);
 
 	auto Response = FHttpServerResponse::Ok();
 	OnComplete(MoveTemp(Response));
 	return true;
 }
+
+bool FMCPHttpServer::HandleMetricsRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	FString Body = Metrics->ExportPrometheus();
+	Body += FString::Printf(TEXT("# HELP mcp_sessions Live MCP sessions.\n# TYPE mcp_sessions gauge\nmcp_sessions %d\n"),
+		SessionManager.GetSessionCount());
+	Body += FString::Printf(TEXT("# HELP mcp_open_streams Held GET /mcp streams.\n# TYPE mcp_open_streams gauge\nmcp_open_streams %d\n"),
+		OpenStreams.Num());
+
+	auto Response = FHttpServerResponse::Create(Body, TEXT("text/plain; version=0.0.4; charset=utf-8"));
+	CompleteResponse(OnComplete, MoveTemp(Response), NegotiateContentEncoding(Request));
+	return true;
+}
+
+bool FMCPHttpServer::HandleGetRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	if (!AcceptsEventStream(Request))
+	{
+		auto Response = FHttpServerResponse::Error(
+			EHttpServerResponseCodes::NotAcceptable,
+			TEXT("NotAcceptable"),
+			TEXT("GET /mcp only serves text/event-stream"));
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	FString SessionId;
+	const TArray<FString>* SessionHeaders = Request.Headers.Find(TEXT("Mcp-Session-Id"));
+	if (SessionHeaders && SessionHeaders->Num() > 0)
+	{
+		SessionId = (*SessionHeaders)[0];
+	}
+
+	if (SessionId.IsEmpty() || !SessionManager.IsValidSession(SessionId))
+	{
+		auto Response = FHttpServerResponse::Error(
+			EHttpServerResponseCodes::NotFound,
+			TEXT("InvalidSession"),
+			TEXT("Session not found"));
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	TOptional<uint64> LastEventId;
+	const TArray<FString>* LastEventIdHeaders = Request.Headers.Find(TEXT("Last-Event-ID"));
+	if (LastEventIdHeaders && LastEventIdHeaders->Num() > 0 && (*LastEventIdHeaders)[0].IsNumeric())
+	{
+		LastEventId = FCString::Strtoui64(*(*LastEventIdHeaders)[0], nullptr, 10);
+	}
+
+	// One stream per session; a new GET replaces the previous one
+	CompleteStream(SessionId, TArray<FMCPSessionEvent>());
+
+	TArray<FMCPSessionEvent> Events = SessionManager.GetEventsForStream(SessionId, LastEventId);
+	if (Events.Num() > 0)
+	{
+		SendStreamEvents(OnComplete, Events);
+		return true;
+	}
+
+	FOpenStream& Stream = OpenStreams.Add(SessionId);
+	Stream.OnComplete = OnComplete;
+	Stream.OpenedAt = FPlatformTime::Seconds();
+	return true;
+}
+
+void FMCPHttpServer::HandleSessionEventQueued(const FString& SessionId)
+{
+	if (OpenStreams.Contains(SessionId))
+	{
+		CompleteStream(SessionId, SessionManager.GetEventsForStream(SessionId, TOptional<uint64>()));
+	}
+}
+
+void FMCPHttpServer::HandleSessionRemoved(const FString& SessionId)
+{
+	CompleteStream(SessionId, TArray<FMCPSessionEvent>());
+}
+
+bool FMCPHttpServer::TickSessions(float DeltaTime)
+{
+	SessionManager.RemoveExpiredSessions();
+
+	const double Now = FPlatformTime::Seconds();
+	TArray<FString> ExpiredSessions;
+	for (const auto& Pair : OpenStreams)
+	{
+		if (Now - Pair.Value.OpenedAt >= StreamHoldSeconds)
+		{
+			ExpiredSessions.Add(Pair.Key);
+		}
+	}
+
+	for (const FString& SessionId : ExpiredSessions)
+	{
+		CompleteStream(SessionId, TArray<FMCPSessionEvent>());
+	}
+	return true;
+}
+
+void FMCPHttpServer::CompleteStream(const FString& SessionId, const TArray<FMCPSessionEvent>& Events)
+{
+	FOpenStream Stream;
+	if (OpenStreams.RemoveAndCopyValue(SessionId, Stream))
+	{
+		SendStreamEvents(Stream.OnComplete, Events);
+	}
+}
+
+void FMCPHttpServer::CloseAllStreams()
+{
+	if (StreamTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(StreamTickerHandle);
+		StreamTickerHandle.Reset();
+	}
+	if (EventQueuedHandle.IsValid())
+	{
+		SessionManager.OnEventQueued().Remove(EventQueuedHandle);
+		EventQueuedHandle.Reset();
+	}
+	if (SessionRemovedHandle.IsValid())
+	{
+		SessionManager.OnSessionRemoved().Remove(SessionRemovedHandle);
+		SessionRemovedHandle.Reset();
+	}
+
+	TMap<FString, FOpenStream> Streams = MoveTemp(OpenStreams);
+	OpenStreams.Reset();
+	for (auto& Pair : Streams)
+	{
+		SendStreamEvents(Pair.Value.OnComplete, TArray<FMCPSessionEvent>());
+	}
+}
+
+void FMCPHttpServer::SendStreamEvents(const FHttpResultCallback& OnComplete, const TArray<FMCPSessionEvent>& Events)
+{
+	// The response ends the stream; retry tells the client to reconnect right away with Last-Event-ID
+	FString StreamBody = FString::Printf(TEXT("retry: %d\n\n"), StreamRetryMilliseconds);
+	for (const FMCPSessionEvent& Event : Events)
+	{
+		StreamBody += FString::Printf(TEXT("id: %llu\nevent: message\ndata: %s\n\n"), Event.EventId, *Event.Data);
+	}
+	if (Events.Num() == 0)
+	{
+		StreamBody += TEXT(": keepalive\n\n");
+	}
+
+	auto Response = FHttpServerResponse::Create(StreamBody, TEXT("text/event-stream"));
+	Response->Headers.Add(TEXT("Cache-Control"), { TEXT("no-cache") });
+	OnComplete(MoveTemp(Response));
+}
+
+bool FMCPHttpServer::AcceptsEventStream(const FHttpServerRequest& Request)
+{
+	const TArray<FString>* AcceptHeaders = Request.Headers.Find(TEXT("Accept"));
+	if (AcceptHeaders)
+	{
+		for (const FString& AcceptHeader : *AcceptHeaders)
+		{
+			if (AcceptHeader.Contains(TEXT("text/event-stream")))
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
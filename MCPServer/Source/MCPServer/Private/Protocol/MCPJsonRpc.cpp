@@ -2,20 +2,50 @@
 
 #include "Protocol/MCPJsonRpc.h"
 #include "Protocol/MCPSessionManager.h"
+#include "Protocol/MCPRateLimiter.h"
+#include "Core/MCPMetrics.h"
+#include "Core/MCPTrace.h"
 #include "Tools/MCPToolRegistry.h"
+#include "Tools/MCPToolCallQueue.h"
 #include "Dom/JsonValue.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryWriter.h"
+#include "String/Find.h"
 
 #define MCP_PROTOCOL_VERSION TEXT("2025-03-26")
 #define MCP_SERVER_NAME TEXT("UnrealEngine-MCPServer")
 #define MCP_SERVER_VERSION TEXT("1.0.0")
 
-FMCPJsonRpc::FMCPJsonRpc(FMCPToolRegistry& InToolRegistry, FMCPSessionManager& InSessionManager)
+FMCPJsonRpc::FMCPJsonRpc(
+	FMCPToolRegistry& InToolRegistry,
+	FMCPSessionManager& InSessionManager,
+	FMCPToolCallQueue* InToolCallQueue,
+	FMCPRateLimiter* InRateLimiter,
+	FMCPMetrics* InMetrics)
 	: ToolRegistry(InToolRegistry)
 	, SessionManager(InSessionManager)
+	, ToolCallQueue(InToolCallQueue)
+	, RateLimiter(InRateLimiter)
+	, Metrics(InMetrics)
 {
+	ToolsListChangedHandle = ToolRegistry.OnToolsListChanged().AddRaw(this, &FMCPJsonRpc::HandleToolsListChanged);
+}
+
+FMCPJsonRpc::~FMCPJsonRpc()
+{
+	ToolRegistry.OnToolsListChanged().Remove(ToolsListChangedHandle);
+
+	*bDeliverWorkerResponses = false;
+	while (InFlightWorkerCalls.GetValue() > 0)
+	{
+		FPlatformProcess::Sleep(0.001f);
+	}
 }
 
 void FMCPJsonRpc::ProcessMessage(
@@ -29,70 +59,623 @@ void FMCPJsonRpc::ProcessMessage(
 	OutNewSessionId.Empty();
 	OutHttpCode = 200;
 
+	FMCPTraceSessionScope TraceSession(SessionId);
+	const double ReceivedAt = FPlatformTime::Seconds();
+	const int64 RequestBytes = FPlatformString::ConvertedLength<UTF8CHAR>(*RequestBody, RequestBody.Len());
+
+	// Nothing is deferred, so the completion runs before ProcessMessageInternal returns
+	ProcessMessageInternal(ParseMessage(RequestBody), SessionId, false,
+		[&OutResponse, &OutNewSessionId, &OutHttpCode](TArray<uint8>&& Response, const FString& NewSessionId, int32 HttpCode, int32 RetryAfterSeconds)
+		{
+			OutResponse = Utf8ToString(Response);
+			OutNewSessionId = NewSessionId;
+			OutHttpCode = HttpCode;
+		},
+		nullptr, ReceivedAt, RequestBytes);
+}
+
+void FMCPJsonRpc::ProcessMessageAsync(
+	const FString& RequestBody,
+	const FString& SessionId,
+	FMCPMessageCompletion OnProcessed,
+	FMCPMessageNotification OnNotification)
+{
+	FMCPTraceSessionScope TraceSession(SessionId);
+	const double ReceivedAt = FPlatformTime::Seconds();
+	const int64 RequestBytes = FPlatformString::ConvertedLength<UTF8CHAR>(*RequestBody, RequestBody.Len());
+
+	ProcessMessageInternal(ParseMessage(RequestBody), SessionId, ToolCallQueue != nullptr,
+		[OnProcessed = MoveTemp(OnProcessed)](TArray<uint8>&& Response, const FString& NewSessionId, int32 HttpCode, int32 RetryAfterSeconds)
+		{
+			OnProcessed(Utf8ToString(Response), NewSessionId, HttpCode);
+		},
+		MoveTemp(OnNotification), ReceivedAt, RequestBytes);
+}
+
+void FMCPJsonRpc::ProcessUtf8MessageAsync(
+	FUtf8StringView RequestBody,
+	const FString& SessionId,
+	FMCPMessageCompletionUtf8 OnProcessed,
+	FMCPMessageNotification OnNotification)
+{
+	FMCPTraceSessionScope TraceSession(SessionId);
+	const double ReceivedAt = FPlatformTime::Seconds();
+	ProcessMessageInternal(ParseMessage(RequestBody), SessionId, ToolCallQueue != nullptr, MoveTemp(OnProcessed), MoveTemp(OnNotification),
+		ReceivedAt, RequestBody.Len());
+}
+
+TSharedPtr<FJsonValue> FMCPJsonRpc::ParseMessage(const FString& RequestBody)
+{
+	MCP_TRACE_SCOPE("MCP::Parse");
+	MCPTrace::TraceScopeMetadata(TEXT("MCP::Parse"), FString(), RequestBody.Len());
+
 	TSharedPtr<FJsonValue> ParsedValue;
 	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(RequestBody);
-	if (!FJsonSerializer::Deserialize(Reader, ParsedValue) || !ParsedValue.IsValid())
+	if (!FJsonSerializer::Deserialize(Reader, ParsedValue))
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = MakeError(nullptr, -32700, TEXT("Parse error"));
-		OutResponse = SerializeJson(ErrorResponse);
-		OutHttpCode = 400;
+		return nullptr;
+	}
+	return ParsedValue;
+}
+
+TSharedPtr<FJsonValue> FMCPJsonRpc::ParseMessage(FUtf8StringView RequestBody)
+{
+	MCP_TRACE_SCOPE("MCP::Parse");
+	MCPTrace::TraceScopeMetadata(TEXT("MCP::Parse"), FString(), RequestBody.Len());
+
+	TSharedPtr<FJsonValue> ParsedValue;
+	TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(RequestBody);
+	if (!FJsonSerializer::Deserialize(Reader, ParsedValue))
+	{
+		return nullptr;
+	}
+	return ParsedValue;
+}
+
+FString FMCPJsonRpc::Utf8ToString(const TArray<uint8>& Utf8)
+{
+	if (Utf8.Num() == 0)
+	{
+		return FString();
+	}
+	FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Utf8.GetData()), Utf8.Num());
+	return FString(Converter.Length(), Converter.Get());
+}
+
+namespace MCPJsonRpcPrivate
+{
+	/** Responses collected for one HTTP request body, possibly completed later by the tool call queue */
+	struct FPendingMessage
+	{
+		TArray<TSharedPtr<FJsonObject>> Responses;
+		int32 Outstanding = 0;
+		bool bIsBatch = false;
+		bool bDispatchFinished = false;
+		FString NewSessionId;
+		int32 HttpCode = 200;
+		int32 RetryAfterSeconds = 0;
+		FMCPMessageCompletionUtf8 OnProcessed;
+
+		/** Set when metrics are collected */
+		FMCPMetrics* Metrics = nullptr;
+		double ReceivedAt = 0.0;
+		int64 RequestBytes = 0;
+		TArray<FString> MetricsMethods;
+		FString CalledToolName;
+	};
+
+	/** Append a JSON value as condensed UTF-8, without an intermediate TCHAR string */
+	template <typename JsonType>
+	void WriteJsonUtf8(const JsonType& Json, TArray<uint8>& OutUtf8)
+	{
+		FMemoryWriter Archive(OutUtf8, false, true);
+		TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> Writer =
+			TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Archive);
+		FJsonSerializer::Serialize(Json, Writer);
+	}
+
+	/** Record every message of a completed body; sizes are only known for a message sent on its own */
+	void RecordMetrics(const FPendingMessage& Pending, int64 ResponseBytes)
+	{
+		const double LatencySeconds = FPlatformTime::Seconds() - Pending.ReceivedAt;
+		for (int32 MessageIndex = 0; MessageIndex < Pending.MetricsMethods.Num(); ++MessageIndex)
+		{
+			const TSharedPtr<FJsonObject>& ResponseObj = Pending.Responses[MessageIndex];
+			const TSharedPtr<FJsonObject>* ResultPtr;
+			const bool bError = ResponseObj.IsValid() && (ResponseObj->HasField(TEXT("error")) ||
+				(ResponseObj->TryGetObjectField(TEXT("result"), ResultPtr) && FMCPMetrics::IsToolError(*ResultPtr)));
+
+			Pending.Metrics->RecordMethodCall(Pending.MetricsMethods[MessageIndex], LatencySeconds, bError,
+				Pending.bIsBatch ? -1 : Pending.RequestBytes, Pending.bIsBatch ? -1 : ResponseBytes);
+		}
+
+		if (!Pending.bIsBatch && !Pending.CalledToolName.IsEmpty())
+		{
+			Pending.Metrics->RecordToolBytes(Pending.CalledToolName, Pending.RequestBytes, ResponseBytes);
+		}
+	}
+
+	/** The id of a request when it is a string, which is how in-flight requests are listed on their session */
+	FString GetStringRequestId(const TSharedPtr<FJsonObject>& Message)
+	{
+		FString RequestId;
+		TSharedPtr<FJsonValue> IdValue = Message->TryGetField(TEXT("id"));
+		if (IdValue.IsValid())
+		{
+			IdValue->TryGetString(RequestId);
+		}
+		return RequestId;
+	}
+
+	void TryComplete(FPendingMessage& Pending)
+	{
+		if (!Pending.bDispatchFinished || Pending.Outstanding > 0 || !Pending.OnProcessed)
+		{
+			return;
+		}
+
+		MCP_TRACE_SCOPE("MCP::Serialize");
+
+		TArray<uint8> Response;
+		int32 HttpCode = Pending.HttpCode;
+
+		if (Pending.bIsBatch)
+		{
+			TArray<TSharedPtr<FJsonValue>> ResponseValues;
+			for (const TSharedPtr<FJsonObject>& ResponseObj : Pending.Responses)
+			{
+				if (ResponseObj.IsValid())
+				{
+					ResponseValues.Add(MakeShared<FJsonValueObject>(ResponseObj));
+				}
+			}
+
+			if (ResponseValues.Num() > 0)
+			{
+				WriteJsonUtf8(ResponseValues, Response);
+				HttpCode = 200;
+			}
+			else
+			{
+				HttpCode = 202;
+			}
+		}
+		else if (Pending.Responses.Num() > 0 && Pending.Responses[0].IsValid())
+		{
+			Response = FMCPJsonRpc::SerializeJsonUtf8(Pending.Responses[0]);
+		}
+
+		if (Pending.Metrics)
+		{
+			RecordMetrics(Pending, Response.Num());
+		}
+
+		FMCPMessageCompletionUtf8 OnProcessed = MoveTemp(Pending.OnProcessed);
+		OnProcessed(MoveTemp(Response), Pending.NewSessionId, HttpCode, Pending.RetryAfterSeconds);
+	}
+}
+
+void FMCPJsonRpc::ProcessMessageInternal(
+	const TSharedPtr<FJsonValue>& ParsedValue,
+	const FString& SessionId,
+	bool bDeferToolCalls,
+	FMCPMessageCompletionUtf8 OnProcessed,
+	FMCPMessageNotification OnNotification,
+	double ReceivedAt,
+	int64 RequestBytes)
+{
+	using namespace MCPJsonRpcPrivate;
+
+	MCP_TRACE_SCOPE("MCP::Dispatch");
+	MCPTrace::TraceScopeMetadata(TEXT("MCP::Dispatch"), FString(), RequestBytes);
+
+	if (!ParsedValue.IsValid())
+	{
+		TArray<uint8> Response = SerializeJsonUtf8(MakeError(nullptr, -32700, TEXT("Parse error")));
+		if (Metrics)
+		{
+			Metrics->RecordMethodCall(TEXT("invalid"), FPlatformTime::Seconds() - ReceivedAt, true, RequestBytes, Response.Num());
+		}
+		OnProcessed(MoveTemp(Response), FString(), 400, 0);
 		return;
 	}
 
+	// Fast path: a lone tools/list is answered from the cached, already serialized tools array
+	if (ParsedValue->Type == EJson::Object && IsToolsListMessage(ParsedValue->AsObject()))
+	{
+		TArray<uint8> Response = MakeToolsListResponseJson(ParsedValue->AsObject()->TryGetField(TEXT("id")));
+		if (Metrics)
+		{
+			Metrics->RecordMethodCall(TEXT("tools/list"), FPlatformTime::Seconds() - ReceivedAt, false, RequestBytes, Response.Num());
+		}
+		OnProcessed(MoveTemp(Response), FString(), 200, 0);
+		return;
+	}
+
+	TArray<TSharedPtr<FJsonObject>> Messages;
 	if (ParsedValue->Type == EJson::Array)
 	{
-		const TArray<TSharedPtr<FJsonValue>>& BatchArray = ParsedValue->AsArray();
-		TArray<TSharedPtr<FJsonValue>> Responses;
-		bool bHasRequests = false;
+		for (const TSharedPtr<FJsonValue>& Item : ParsedValue->AsArray())
+		{
+			if (Item->Type == EJson::Object)
+			{
+				Messages.Add(Item->AsObject());
+			}
+		}
+	}
+	else if (ParsedValue->Type == EJson::Object)
+	{
+		Messages.Add(ParsedValue->AsObject());
+	}
+	else
+	{
+		TArray<uint8> Response = SerializeJsonUtf8(MakeError(nullptr, -32600, TEXT("Invalid Request")));
+		if (Metrics)
+		{
+			Metrics->RecordMethodCall(TEXT("invalid"), FPlatformTime::Seconds() - ReceivedAt, true, RequestBytes, Response.Num());
+		}
+		OnProcessed(MoveTemp(Response), FString(), 400, 0);
+		return;
+	}
 
-		for (const TSharedPtr<FJsonValue>& Item : BatchArray)
+	if (!SessionId.IsEmpty())
+	{
+		int32 ToolCallCount = 0;
+		for (const TSharedPtr<FJsonObject>& Message : Messages)
 		{
-			if (Item->Type != EJson::Object)
+			FString Method;
+			if (Message->TryGetStringField(TEXT("method"), Method) && Method == TEXT("tools/call"))
 			{
-				continue;
+				ToolCallCount++;
 			}
+		}
+		if (ToolCallCount > 0)
+		{
+			SessionManager.RecordToolCalls(SessionId, ToolCallCount);
+		}
+	}
 
-			TSharedPtr<FJsonObject> ResponseObj;
-			HandleSingleMessage(Item->AsObject(), SessionId, ResponseObj, OutNewSessionId, OutHttpCode);
+	TSharedRef<FPendingMessage> Pending = MakeShared<FPendingMessage>();
+	Pending->bIsBatch = ParsedValue->Type == EJson::Array;
+	Pending->Responses.SetNum(Messages.Num());
+	Pending->OnProcessed = MoveTemp(OnProcessed);
 
-			if (ResponseObj.IsValid())
+	if (Metrics)
+	{
+		Pending->Metrics = Metrics;
+		Pending->ReceivedAt = ReceivedAt;
+		Pending->RequestBytes = RequestBytes;
+		for (const TSharedPtr<FJsonObject>& Message : Messages)
+		{
+			Pending->MetricsMethods.Add(GetMetricsMethodName(Message));
+		}
+		if (!Pending->bIsBatch)
+		{
+			Pending->CalledToolName = GetCalledToolName(Messages[0]);
+		}
+	}
+
+	// Refused tools/call requests are answered with an error right away and never dispatched
+	TArray<int32> RefusedIndices;
+	int32 AdmittedPerLane[static_cast<int32>(EMCPToolPriority::Num)] = {};
+	for (int32 MessageIndex = 0; MessageIndex < Messages.Num(); ++MessageIndex)
+	{
+		double RetryAfterSeconds = 0.0;
+		TSharedPtr<FJsonObject> Refusal = AdmitToolsCall(Messages[MessageIndex], SessionId, AdmittedPerLane, RetryAfterSeconds);
+		if (Refusal.IsValid())
+		{
+			Pending->Responses[MessageIndex] = Refusal;
+			Pending->RetryAfterSeconds = FMath::Max(Pending->RetryAfterSeconds, FMath::CeilToInt(RetryAfterSeconds));
+			RefusedIndices.Add(MessageIndex);
+		}
+	}
+	if (!Pending->bIsBatch && RefusedIndices.Num() > 0)
+	{
+		Pending->HttpCode = 429;
+	}
+
+	// Fan read-only tool calls of a batch out to worker threads. Responses keep their batch position.
+	TArray<int32> WorkerIndices;
+	if (Pending->bIsBatch)
+	{
+		for (int32 MessageIndex = 0; MessageIndex < Messages.Num(); ++MessageIndex)
+		{
+			if (!RefusedIndices.Contains(MessageIndex) && IsReadOnlyToolsCall(Messages[MessageIndex]))
 			{
-				Responses.Add(MakeShared<FJsonValueObject>(ResponseObj));
-				bHasRequests = true;
+				WorkerIndices.Add(MessageIndex);
 			}
 		}
+		if (WorkerIndices.Num() < 2)
+		{
+			WorkerIndices.Reset();
+		}
+	}
 
-		if (bHasRequests)
+	// Listed on the session until answered, like queued tool calls, so the session does not expire meanwhile
+	TArray<FString> WorkerRequestIds;
+	if (!SessionId.IsEmpty())
+	{
+		for (int32 MessageIndex : WorkerIndices)
 		{
-			FString OutputString;
-			TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-			FJsonSerializer::Serialize(Responses, Writer);
-			OutResponse = OutputString;
-			OutHttpCode = 200;
+			const FString RequestId = GetStringRequestId(Messages[MessageIndex]);
+			if (!RequestId.IsEmpty())
+			{
+				SessionManager.AddInFlightRequest(SessionId, RequestId);
+				WorkerRequestIds.Add(RequestId);
+			}
 		}
-		else
+	}
+
+	if (WorkerIndices.Num() > 0 && bDeferToolCalls)
+	{
+		// Answered on the game thread once the worker is done, like queued tool calls
+		for (int32 MessageIndex : WorkerIndices)
 		{
-			OutHttpCode = 202;
+			Pending->Outstanding++;
+			InFlightWorkerCalls.Increment();
+			TSharedPtr<FJsonObject> Message = Messages[MessageIndex];
+			const FString RequestId = SessionId.IsEmpty() ? FString() : GetStringRequestId(Message);
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Message, MessageIndex, Pending, SessionId, RequestId]()
+			{
+				FMCPTraceSessionScope TraceSession(SessionId);
+				TSharedPtr<FJsonObject> Params = Message->GetObjectField(TEXT("params"));
+				TSharedPtr<FJsonObject> ResponseObj = HandleToolsCall(Message->TryGetField(TEXT("id")), Params);
+				TSharedRef<FThreadSafeBool> bDeliver = bDeliverWorkerResponses;
+
+				if (!RequestId.IsEmpty())
+				{
+					SessionManager.RemoveInFlightRequest(SessionId, RequestId);
+				}
+
+				// Nothing may touch this after the decrement; the destructor only waits for the counter
+				InFlightWorkerCalls.Decrement();
+
+				AsyncTask(ENamedThreads::GameThread, [Pending, MessageIndex, ResponseObj, bDeliver]()
+				{
+					if (!*bDeliver)
+					{
+						return;
+					}
+					Pending->Responses[MessageIndex] = ResponseObj;
+					Pending->Outstanding--;
+					TryComplete(*Pending);
+				});
+			});
 		}
 	}
-	else if (ParsedValue->Type == EJson::Object)
+	else if (WorkerIndices.Num() > 0)
+	{
+		ParallelFor(WorkerIndices.Num(), [this, &Messages, &WorkerIndices, &Pending, &SessionId](int32 WorkerIndex)
+		{
+			FMCPTraceSessionScope TraceSession(SessionId);
+			const TSharedPtr<FJsonObject>& Message = Messages[WorkerIndices[WorkerIndex]];
+			Pending->Responses[WorkerIndices[WorkerIndex]] = HandleToolsCall(Message->TryGetField(TEXT("id")), Message->GetObjectField(TEXT("params")));
+		});
+		for (const FString& RequestId : WorkerRequestIds)
+		{
+			SessionManager.RemoveInFlightRequest(SessionId, RequestId);
+		}
+	}
+
+	for (int32 MessageIndex = 0; MessageIndex < Messages.Num(); ++MessageIndex)
 	{
-		TSharedPtr<FJsonObject> MessageObj = ParsedValue->AsObject();
-		TSharedPtr<FJsonObject> ResponseObj;
+		const TSharedPtr<FJsonObject>& Message = Messages[MessageIndex];
 
-		HandleSingleMessage(MessageObj, SessionId, ResponseObj, OutNewSessionId, OutHttpCode);
+		if (WorkerIndices.Contains(MessageIndex) || RefusedIndices.Contains(MessageIndex))
+		{
+			continue;
+		}
 
-		if (ResponseObj.IsValid())
+		if (bDeferToolCalls)
 		{
-			OutResponse = SerializeJson(ResponseObj);
+			Pending->Outstanding++;
+			const bool bQueued = TryEnqueueToolsCall(Message, SessionId,
+				[Pending, MessageIndex](const TSharedPtr<FJsonObject>& ResponseObj)
+				{
+					Pending->Responses[MessageIndex] = ResponseObj;
+					Pending->Outstanding--;
+					TryComplete(*Pending);
+				},
+				OnNotification);
+
+			if (bQueued)
+			{
+				continue;
+			}
+			Pending->Outstanding--;
 		}
+
+		HandleSingleMessage(Message, SessionId, Pending->Responses[MessageIndex], Pending->NewSessionId, Pending->HttpCode);
+	}
+
+	Pending->bDispatchFinished = true;
+	TryComplete(*Pending);
+}
+
+TSharedPtr<FJsonObject> FMCPJsonRpc::AdmitToolsCall(
+	const TSharedPtr<FJsonObject>& Message,
+	const FString& SessionId,
+	TArrayView<int32> AdmittedPerLane,
+	double& OutRetryAfterSeconds) const
+{
+	FString Method;
+	const TSharedPtr<FJsonObject>* ParamsPtr;
+	FString ToolName;
+	if (!RateLimiter ||
+		!Message->TryGetStringField(TEXT("method"), Method) || Method != TEXT("tools/call") ||
+		!Message->TryGetObjectField(TEXT("params"), ParamsPtr) ||
+		!(*ParamsPtr)->TryGetStringField(TEXT("name"), ToolName) ||
+		!ToolRegistry.HasTool(ToolName))
+	{
+		return nullptr;
+	}
+
+	const EMCPToolPriority Priority = ToolRegistry.GetToolPriority(ToolName);
+	const int32 MaxQueuedCalls = RateLimiter->GetLaneLimits(Priority).MaxQueuedCalls;
+
+	// Calls admitted earlier in the same batch are not queued yet, so the queue count alone would let a batch overshoot
+	int32& AdmittedInBody = AdmittedPerLane[static_cast<int32>(Priority)];
+
+	FString Reason;
+	if (ToolCallQueue && MaxQueuedCalls > 0 && ToolCallQueue->GetPendingCount(Priority) + AdmittedInBody >= MaxQueuedCalls)
+	{
+		RateLimiter->RecordQueueFull(Priority);
+		OutRetryAfterSeconds = 1.0;
+		Reason = FString::Printf(TEXT("Too many queued %s tool calls"), LexToString(Priority));
+	}
+	else if (!RateLimiter->TryAcquire(SessionId, Priority, OutRetryAfterSeconds))
+	{
+		Reason = FString::Printf(TEXT("Rate limit exceeded for %s tool calls"), LexToString(Priority));
 	}
 	else
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = MakeError(nullptr, -32600, TEXT("Invalid Request"));
-		OutResponse = SerializeJson(ErrorResponse);
-		OutHttpCode = 400;
+		AdmittedInBody++;
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetStringField(TEXT("lane"), LexToString(Priority));
+	Data->SetNumberField(TEXT("retryAfterSeconds"), OutRetryAfterSeconds);
+
+	TSharedPtr<FJsonObject> ErrorResponse = MakeError(Message->TryGetField(TEXT("id")), -32000,
+		FString::Printf(TEXT("%s, retry after %.1f s"), *Reason, OutRetryAfterSeconds));
+	ErrorResponse->GetObjectField(TEXT("error"))->SetObjectField(TEXT("data"), Data);
+	return ErrorResponse;
+}
+
+FString FMCPJsonRpc::GetMetricsMethodName(const TSharedPtr<FJsonObject>& Message)
+{
+	static const TCHAR* KnownMethods[] = {
+		TEXT("initialize"),
+		TEXT("notifications/initialized"),
+		TEXT("notifications/cancelled"),
+		TEXT("ping"),
+		TEXT("tools/list"),
+		TEXT("tools/call")
+	};
+
+	FString JsonRpcVersion;
+	FString Method;
+	if (!Message->TryGetStringField(TEXT("jsonrpc"), JsonRpcVersion) || JsonRpcVersion != TEXT("2.0"))
+	{
+		return TEXT("invalid");
+	}
+	if (!Message->TryGetStringField(TEXT("method"), Method))
+	{
+		return TEXT("response");
+	}
+
+	for (const TCHAR* KnownMethod : KnownMethods)
+	{
+		if (Method == KnownMethod)
+		{
+			return Method;
+		}
+	}
+	return Method.StartsWith(TEXT("notifications/")) ? TEXT("notifications/other") : TEXT("other");
+}
+
+FString FMCPJsonRpc::GetCalledToolName(const TSharedPtr<FJsonObject>& Message) const
+{
+	FString Method;
+	const TSharedPtr<FJsonObject>* ParamsPtr;
+	FString ToolName;
+	if (Message->TryGetStringField(TEXT("method"), Method) && Method == TEXT("tools/call") &&
+		Message->TryGetObjectField(TEXT("params"), ParamsPtr) &&
+		(*ParamsPtr)->TryGetStringField(TEXT("name"), ToolName) &&
+		ToolRegistry.HasTool(ToolName))
+	{
+		return ToolName;
+	}
+	return FString();
+}
+
+bool FMCPJsonRpc::IsReadOnlyToolsCall(const TSharedPtr<FJsonObject>& Message) const
+{
+	FString JsonRpcVersion;
+	FString Method;
+	if (!Message->TryGetStringField(TEXT("jsonrpc"), JsonRpcVersion) || JsonRpcVersion != TEXT("2.0") ||
+		!Message->TryGetStringField(TEXT("method"), Method) || Method != TEXT("tools/call"))
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* ParamsPtr;
+	FString ToolName;
+	return Message->TryGetObjectField(TEXT("params"), ParamsPtr) &&
+		(*ParamsPtr)->TryGetStringField(TEXT("name"), ToolName) &&
+		ToolRegistry.IsReadOnlyTool(ToolName);
+}
+
+bool FMCPJsonRpc::TryEnqueueToolsCall(
+	const TSharedPtr<FJsonObject>& Message,
+	const FString& SessionId,
+	TFunction<void(const TSharedPtr<FJsonObject>&)> OnResponse,
+	const FMCPMessageNotification& OnNotification)
+{
+	if (!ToolCallQueue)
+	{
+		return false;
+	}
+
+	FString JsonRpcVersion;
+	FString Method;
+	if (!Message->TryGetStringField(TEXT("jsonrpc"), JsonRpcVersion) || JsonRpcVersion != TEXT("2.0") ||
+		!Message->TryGetStringField(TEXT("method"), Method) || Method != TEXT("tools/call"))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonValue> IdValue = Message->TryGetField(TEXT("id"));
+
+	TSharedPtr<FJsonObject> Params;
+	const TSharedPtr<FJsonObject>* ParamsPtr;
+	if (Message->TryGetObjectField(TEXT("params"), ParamsPtr))
+	{
+		Params = *ParamsPtr;
+	}
+
+	FString ToolName;
+	TSharedPtr<FJsonObject> Arguments;
+	if (ValidateToolsCall(IdValue, Params, ToolName, Arguments).IsValid())
+	{
+		// Invalid calls are answered inline with the same error as the synchronous path
+		return false;
+	}
+
+	// Progress is only reported when the client asked for it with a progress token
+	FMCPToolCallProgress OnProgress;
+	const TSharedPtr<FJsonObject>* MetaPtr;
+	if (OnNotification && Params->TryGetObjectField(TEXT("_meta"), MetaPtr))
+	{
+		TSharedPtr<FJsonValue> ProgressToken = (*MetaPtr)->TryGetField(TEXT("progressToken"));
+		if (ProgressToken.IsValid() && !ProgressToken->IsNull())
+		{
+			OnProgress = [ProgressToken, OnNotification](int32 Progress, int32 Total)
+			{
+				OnNotification(SerializeJson(MakeProgressNotification(ProgressToken, Progress, Total)));
+			};
+		}
+	}
+
+	// Listed on the session until answered, which also keeps the session from expiring meanwhile
+	FString RequestId;
+	if (!SessionId.IsEmpty() && IdValue.IsValid() && IdValue->TryGetString(RequestId))
+	{
+		SessionManager.AddInFlightRequest(SessionId, RequestId);
 	}
+
+	ToolCallQueue->Enqueue(ToolName, Arguments,
+		[this, IdValue, ToolName, SessionId, RequestId, OnResponse = MoveTemp(OnResponse)](const TSharedPtr<FJsonObject>& ToolResult)
+		{
+			if (!RequestId.IsEmpty())
+			{
+				SessionManager.RemoveInFlightRequest(SessionId, RequestId);
+			}
+			OnResponse(MakeToolsCallResponse(IdValue, ToolName, ToolResult));
+		},
+		MoveTemp(OnProgress));
+	return true;
 }
 
 void FMCPJsonRpc::HandleSingleMessage(
@@ -176,8 +759,27 @@ TSharedPtr<FJsonObject> FMCPJsonRpc::HandleInitialize(
 {
 	OutNewSessionId = SessionManager.CreateSession();
 
+	FString ClientName;
+	FString ClientVersion;
+	TSharedPtr<FJsonObject> ClientCapabilities;
+	if (Params.IsValid())
+	{
+		const TSharedPtr<FJsonObject>* ClientInfoPtr;
+		if (Params->TryGetObjectField(TEXT("clientInfo"), ClientInfoPtr))
+		{
+			(*ClientInfoPtr)->TryGetStringField(TEXT("name"), ClientName);
+			(*ClientInfoPtr)->TryGetStringField(TEXT("version"), ClientVersion);
+		}
+		const TSharedPtr<FJsonObject>* CapabilitiesPtr;
+		if (Params->TryGetObjectField(TEXT("capabilities"), CapabilitiesPtr))
+		{
+			ClientCapabilities = *CapabilitiesPtr;
+		}
+	}
+	SessionManager.SetClientInfo(OutNewSessionId, MCP_PROTOCOL_VERSION, ClientName, ClientVersion, ClientCapabilities);
+
 	TSharedPtr<FJsonObject> ToolsCap = MakeShared<FJsonObject>();
-	ToolsCap->SetBoolField(TEXT("listChanged"), false);
+	ToolsCap->SetBoolField(TEXT("listChanged"), true);
 
 	TSharedPtr<FJsonObject> Capabilities = MakeShared<FJsonObject>();
 	Capabilities->SetObjectField(TEXT("tools"), ToolsCap);
@@ -203,38 +805,130 @@ TSharedPtr<FJsonObject> FMCPJsonRpc::HandleToolsList(
 	return MakeResponse(Id, Result);
 }
 
+bool FMCPJsonRpc::IsToolsListRequest(FUtf8StringView RequestBody) const
+{
+	// tools/list bodies are tiny; skip parsing anything that cannot be one
+	if (RequestBody.Len() > 1024 || UE::String::FindFirst(RequestBody, UTF8TEXTVIEW("tools/list")) == INDEX_NONE)
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonValue> ParsedValue = ParseMessage(RequestBody);
+	return ParsedValue.IsValid() && ParsedValue->Type == EJson::Object && IsToolsListMessage(ParsedValue->AsObject());
+}
+
+const FString& FMCPJsonRpc::GetToolsListETag() const
+{
+	return ToolRegistry.GetToolsListETag();
+}
+
+bool FMCPJsonRpc::IsToolsListMessage(const TSharedPtr<FJsonObject>& Message)
+{
+	FString JsonRpcVersion;
+	FString Method;
+	return Message.IsValid() &&
+		Message->TryGetStringField(TEXT("jsonrpc"), JsonRpcVersion) && JsonRpcVersion == TEXT("2.0") &&
+		Message->TryGetStringField(TEXT("method"), Method) && Method == TEXT("tools/list");
+}
+
+TArray<uint8> FMCPJsonRpc::MakeToolsListResponseJson(const TSharedPtr<FJsonValue>& Id) const
+{
+	static const FAnsiStringView Prefix = "{\"jsonrpc\":\"2.0\",\"id\":";
+	static const FAnsiStringView Infix = ",\"result\":{\"tools\":";
+	static const FAnsiStringView Suffix = "}}";
+
+	MCP_TRACE_SCOPE("MCP::SerializeToolsList");
+
+	const TArray<uint8>& ToolsJson = ToolRegistry.GetToolsListJson();
+	TArray<uint8> Response;
+	Response.Reserve(Prefix.Len() + Infix.Len() + Suffix.Len() + ToolsJson.Num() + 32);
+
+	Response.Append(reinterpret_cast<const uint8*>(Prefix.GetData()), Prefix.Len());
+	if (Id.IsValid() && !Id->IsNull())
+	{
+		FMemoryWriter Archive(Response, false, true);
+		TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> Writer =
+			TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Archive);
+		FJsonSerializer::Serialize(Id, FString(), Writer);
+	}
+	else
+	{
+		Response.Append(reinterpret_cast<const uint8*>("null"), 4);
+	}
+	Response.Append(reinterpret_cast<const uint8*>(Infix.GetData()), Infix.Len());
+	Response.Append(ToolsJson);
+	Response.Append(reinterpret_cast<const uint8*>(Suffix.GetData()), Suffix.Len());
+	return Response;
+}
+
+void FMCPJsonRpc::HandleToolsListChanged()
+{
+	TSharedPtr<FJsonObject> Notification = MakeShared<FJsonObject>();
+	Notification->SetStringField(TEXT("jsonrpc"), TEXT("2.0"));
+	Notification->SetStringField(TEXT("method"), TEXT("notifications/tools/list_changed"));
+	SessionManager.BroadcastNotification(SerializeJson(Notification));
+}
+
 TSharedPtr<FJsonObject> FMCPJsonRpc::HandleToolsCall(
 	const TSharedPtr<FJsonValue>& Id,
 	const TSharedPtr<FJsonObject>& Params)
+{
+	FString ToolName;
+	TSharedPtr<FJsonObject> Arguments;
+	TSharedPtr<FJsonObject> ValidationError = ValidateToolsCall(Id, Params, ToolName, Arguments);
+	if (ValidationError.IsValid())
+	{
+		return ValidationError;
+	}
+
+	const double ExecuteStart = FPlatformTime::Seconds();
+	TSharedPtr<FJsonObject> ToolResult = ToolRegistry.CallTool(ToolName, Arguments);
+	if (Metrics)
+	{
+		Metrics->RecordToolCall(ToolName, FPlatformTime::Seconds() - ExecuteStart, -1.0, FMCPMetrics::IsToolError(ToolResult));
+	}
+	return MakeToolsCallResponse(Id, ToolName, ToolResult);
+}
+
+TSharedPtr<FJsonObject> FMCPJsonRpc::ValidateToolsCall(
+	const TSharedPtr<FJsonValue>& Id,
+	const TSharedPtr<FJsonObject>& Params,
+	FString& OutToolName,
+	TSharedPtr<FJsonObject>& OutArguments) const
 {
 	if (!Params.IsValid())
 	{
 		return MakeError(Id, -32602, TEXT("Invalid params: params required"));
 	}
 
-	FString ToolName;
-	if (!Params->TryGetStringField(TEXT("name"), ToolName))
+	if (!Params->TryGetStringField(TEXT("name"), OutToolName))
 	{
 		return MakeError(Id, -32602, TEXT("Invalid params: missing tool name"));
 	}
 
-	if (!ToolRegistry.HasTool(ToolName))
+	if (!ToolRegistry.HasTool(OutToolName))
 	{
-		return MakeError(Id, -32602, FString::Printf(TEXT("Unknown tool: %s"), *ToolName));
+		return MakeError(Id, -32602, FString::Printf(TEXT("Unknown tool: %s"), *OutToolName));
 	}
 
-	TSharedPtr<FJsonObject> Arguments;
 	const TSharedPtr<FJsonObject>* ArgumentsPtr;
 	if (Params->TryGetObjectField(TEXT("arguments"), ArgumentsPtr))
 	{
-		Arguments = *ArgumentsPtr;
+		OutArguments = *ArgumentsPtr;
 	}
 	else
 	{
-		Arguments = MakeShared<FJsonObject>();
+		OutArguments = MakeShared<FJsonObject>();
 	}
 
-	TSharedPtr<FJsonObject> ToolResult = ToolRegistry.CallTool(ToolName, Arguments);
+	return nullptr;
+}
+
+TSharedPtr<FJsonObject> FMCPJsonRpc::MakeToolsCallResponse(
+	const TSharedPtr<FJsonValue>& Id,
+	const FString& ToolName,
+	const TSharedPtr<FJsonObject>& ToolResult)
+{
 	if (!ToolResult.IsValid())
 	{
 		TSharedPtr<FJsonObject> ErrorResult = MakeShared<FJsonObject>();
@@ -300,10 +994,36 @@ TSharedPtr<FJsonObject> FMCPJsonRpc::MakeError(const TSharedPtr<FJsonValue>& Id,
 	return Response;
 }
 
+TSharedPtr<FJsonObject> FMCPJsonRpc::MakeProgressNotification(const TSharedPtr<FJsonValue>& ProgressToken, int32 Progress, int32 Total)
+{
+	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetField(TEXT("progressToken"), ProgressToken);
+	Params->SetNumberField(TEXT("progress"), Progress);
+	if (Total > 0)
+	{
+		Params->SetNumberField(TEXT("total"), Total);
+	}
+
+	TSharedPtr<FJsonObject> Notification = MakeShared<FJsonObject>();
+	Notification->SetStringField(TEXT("jsonrpc"), TEXT("2.0"));
+	Notification->SetStringField(TEXT("method"), TEXT("notifications/progress"));
+	Notification->SetObjectField(TEXT("params"), Params);
+	return Notification;
+}
+
 FString FMCPJsonRpc::SerializeJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
+	// Condensed so that a message always fits on a single SSE data: line
 	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 	return OutputString;
 }
+
+TArray<uint8> FMCPJsonRpc::SerializeJsonUtf8(const TSharedPtr<FJsonObject>& JsonObject)
+{
+	TArray<uint8> Output;
+	MCPJsonRpcPrivate::WriteJsonUtf8(JsonObject.ToSharedRef(), Output);
+	return Output;
+}
@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Protocol/MCPRateLimiter.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+FMCPRateLimiter::FMCPRateLimiter(const FMCPRateLimits& InLimits)
+	: Limits(InLimits)
+{
+}
+
+bool FMCPRateLimiter::TryAcquire(const FString& SessionId, EMCPToolPriority Priority, double& OutRetryAfterSeconds)
+{
+	OutRetryAfterSeconds = 0.0;
+	const int32 LaneIndex = static_cast<int32>(Priority);
+	const FMCPLaneLimits& LaneLimits = Limits.Lanes[LaneIndex];
+
+	FScopeLock Lock(&BucketsLock);
+	if (LaneLimits.CallsPerSecond <= 0.0)
+	{
+		LaneStats[LaneIndex].Admitted++;
+		return true;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const TPair<FString, EMCPToolPriority> Key(SessionId, Priority);
+	FTokenBucket* Bucket = Buckets.Find(Key);
+	if (!Bucket)
+	{
+		if (Buckets.Num() >= MaxTrackedBuckets)
+		{
+			PruneBuckets(Now);
+		}
+		Bucket = &Buckets.Add(Key);
+		Bucket->Tokens = FMath::Max(1.0, LaneLimits.Burst);
+		Bucket->LastRefillAt = Now;
+	}
+	else
+	{
+		Refill(*Bucket, LaneLimits, Now);
+	}
+
+	if (Bucket->Tokens >= 1.0)
+	{
+		Bucket->Tokens -= 1.0;
+		LaneStats[LaneIndex].Admitted++;
+		return true;
+	}
+
+	OutRetryAfterSeconds = (1.0 - Bucket->Tokens) / LaneLimits.CallsPerSecond;
+	LaneStats[LaneIndex].RateLimited++;
+	return false;
+}
+
+void FMCPRateLimiter::RecordQueueFull(EMCPToolPriority Priority)
+{
+	FScopeLock Lock(&BucketsLock);
+	LaneStats[static_cast<int32>(Priority)].QueueFull++;
+}
+
+const FMCPLaneLimits& FMCPRateLimiter::GetLaneLimits(EMCPToolPriority Priority) const
+{
+	return Limits.Lanes[static_cast<int32>(Priority)];
+}
+
+FMCPLaneAdmissionStats FMCPRateLimiter::GetLaneStats(EMCPToolPriority Priority) const
+{
+	FScopeLock Lock(&BucketsLock);
+	return LaneStats[static_cast<int32>(Priority)];
+}
+
+bool FMCPRateLimiter::Refill(FTokenBucket& Bucket, const FMCPLaneLimits& LaneLimits, double Now)
+{
+	const double Capacity = FMath::Max(1.0, LaneLimits.Burst);
+	Bucket.Tokens = FMath::Min(Capacity, Bucket.Tokens + (Now - Bucket.LastRefillAt) * LaneLimits.CallsPerSecond);
+	Bucket.LastRefillAt = Now;
+	return Bucket.Tokens >= Capacity;
+}
+
+void FMCPRateLimiter::PruneBuckets(double Now)
+{
+	for (auto It = Buckets.CreateIterator(); It; ++It)
+	{
+		if (Refill(It.Value(), Limits.Lanes[static_cast<int32>(It.Key().Value)], Now))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
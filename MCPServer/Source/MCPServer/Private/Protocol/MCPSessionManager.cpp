@@ -1,21 +1,307 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Protocol/MCPSessionManager.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/Guid.h"
+#include "Misc/ScopeLock.h"
+
+FMCPSessionManager::FMCPSessionManager(const FMCPSessionLimits& InLimits)
+	: Limits(InLimits)
+{
+}
 
 FString FMCPSessionManager::CreateSession()
 {
 	FString SessionId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
-	ActiveSessions.Add(SessionId);
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<FString> DroppedSessions;
+	{
+		FScopeLock Lock(&SessionsLock);
+
+		// Make room by dropping expired sessions first, then the least recently active ones
+		if (Limits.MaxSessions > 0 && ActiveSessions.Num() >= Limits.MaxSessions)
+		{
+			for (const auto& Pair : ActiveSessions)
+			{
+				if (IsExpired(Pair.Value, Now))
+				{
+					DroppedSessions.Add(Pair.Key);
+				}
+			}
+			for (const FString& DroppedId : DroppedSessions)
+			{
+				ActiveSessions.Remove(DroppedId);
+			}
+
+			while (ActiveSessions.Num() >= Limits.MaxSessions)
+			{
+				const FString* OldestId = nullptr;
+				double OldestActivity = TNumericLimits<double>::Max();
+				for (const auto& Pair : ActiveSessions)
+				{
+					if (Pair.Value.LastActivityAt < OldestActivity)
+					{
+						OldestActivity = Pair.Value.LastActivityAt;
+						OldestId = &Pair.Key;
+					}
+				}
+				const FString DroppedId = *OldestId;
+				ActiveSessions.Remove(DroppedId);
+				DroppedSessions.Add(DroppedId);
+			}
+		}
+
+		FSession& Session = ActiveSessions.Add(SessionId);
+		Session.CreatedAt = Now;
+		Session.LastActivityAt = Now;
+	}
+
+	for (const FString& DroppedId : DroppedSessions)
+	{
+		SessionRemovedDelegate.Broadcast(DroppedId);
+	}
 	return SessionId;
 }
 
 bool FMCPSessionManager::IsValidSession(const FString& SessionId) const
 {
-	return ActiveSessions.Contains(SessionId);
+	FScopeLock Lock(&SessionsLock);
+	return FindLiveSession(SessionId, FPlatformTime::Seconds()) != nullptr;
 }
 
 void FMCPSessionManager::RemoveSession(const FString& SessionId)
 {
+	FScopeLock Lock(&SessionsLock);
 	ActiveSessions.Remove(SessionId);
 }
+
+bool FMCPSessionManager::TouchSession(const FString& SessionId)
+{
+	const double Now = FPlatformTime::Seconds();
+	FScopeLock Lock(&SessionsLock);
+	FSession* Session = FindLiveSession(SessionId, Now);
+	if (!Session)
+	{
+		return false;
+	}
+
+	Session->LastActivityAt = Now;
+	Session->RequestCount++;
+	return true;
+}
+
+void FMCPSessionManager::SetClientInfo(
+	const FString& SessionId,
+	const FString& ProtocolVersion,
+	const FString& ClientName,
+	const FString& ClientVersion,
+	const TSharedPtr<FJsonObject>& ClientCapabilities)
+{
+	FScopeLock Lock(&SessionsLock);
+	FSession* Session = ActiveSessions.Find(SessionId);
+	if (Session)
+	{
+		Session->ProtocolVersion = ProtocolVersion;
+		Session->ClientName = ClientName;
+		Session->ClientVersion = ClientVersion;
+		Session->ClientCapabilities = ClientCapabilities;
+	}
+}
+
+void FMCPSessionManager::RecordToolCalls(const FString& SessionId, int32 Count)
+{
+	FScopeLock Lock(&SessionsLock);
+	FSession* Session = ActiveSessions.Find(SessionId);
+	if (Session)
+	{
+		Session->ToolCallCount += Count;
+	}
+}
+
+void FMCPSessionManager::AddInFlightRequest(const FString& SessionId, const FString& RequestId)
+{
+	FScopeLock Lock(&SessionsLock);
+	FSession* Session = ActiveSessions.Find(SessionId);
+	if (Session)
+	{
+		Session->InFlightRequestIds.Add(RequestId);
+	}
+}
+
+void FMCPSessionManager::RemoveInFlightRequest(const FString& SessionId, const FString& RequestId)
+{
+	FScopeLock Lock(&SessionsLock);
+	FSession* Session = ActiveSessions.Find(SessionId);
+	if (Session)
+	{
+		Session->InFlightRequestIds.Remove(RequestId);
+	}
+}
+
+TOptional<FMCPSessionInfo> FMCPSessionManager::GetSessionInfo(const FString& SessionId) const
+{
+	FScopeLock Lock(&SessionsLock);
+	const FSession* Session = FindLiveSession(SessionId, FPlatformTime::Seconds());
+	if (!Session)
+	{
+		return TOptional<FMCPSessionInfo>();
+	}
+
+	FMCPSessionInfo Info;
+	Info.SessionId = SessionId;
+	Info.ProtocolVersion = Session->ProtocolVersion;
+	Info.ClientName = Session->ClientName;
+	Info.ClientVersion = Session->ClientVersion;
+	Info.ClientCapabilities = Session->ClientCapabilities;
+	Info.CreatedAt = Session->CreatedAt;
+	Info.LastActivityAt = Session->LastActivityAt;
+	Info.RequestCount = Session->RequestCount;
+	Info.ToolCallCount = Session->ToolCallCount;
+	Info.InFlightRequestIds = Session->InFlightRequestIds.Array();
+	return Info;
+}
+
+int32 FMCPSessionManager::GetSessionCount() const
+{
+	FScopeLock Lock(&SessionsLock);
+	return ActiveSessions.Num();
+}
+
+void FMCPSessionManager::RemoveExpiredSessions()
+{
+	const double Now = FPlatformTime::Seconds();
+	TArray<FString> ExpiredSessions;
+	{
+		FScopeLock Lock(&SessionsLock);
+		for (const auto& Pair : ActiveSessions)
+		{
+			if (IsExpired(Pair.Value, Now))
+			{
+				ExpiredSessions.Add(Pair.Key);
+			}
+		}
+		for (const FString& SessionId : ExpiredSessions)
+		{
+			ActiveSessions.Remove(SessionId);
+		}
+	}
+
+	for (const FString& SessionId : ExpiredSessions)
+	{
+		SessionRemovedDelegate.Broadcast(SessionId);
+	}
+}
+
+void FMCPSessionManager::PushNotification(const FString& SessionId, const FString& Notification)
+{
+	{
+		FScopeLock Lock(&SessionsLock);
+		FSession* Session = ActiveSessions.Find(SessionId);
+		if (!Session)
+		{
+			return;
+		}
+		AppendEvent(*Session, Notification);
+	}
+
+	EventQueuedDelegate.Broadcast(SessionId);
+}
+
+void FMCPSessionManager::BroadcastNotification(const FString& Notification)
+{
+	TArray<FString> SessionIds;
+	{
+		FScopeLock Lock(&SessionsLock);
+		for (auto& Pair : ActiveSessions)
+		{
+			AppendEvent(Pair.Value, Notification);
+			SessionIds.Add(Pair.Key);
+		}
+	}
+
+	// Listeners may complete streams and touch the session map, so notify after iterating
+	for (const FString& SessionId : SessionIds)
+	{
+		EventQueuedDelegate.Broadcast(SessionId);
+	}
+}
+
+TArray<FString> FMCPSessionManager::TakeNotifications(const FString& SessionId)
+{
+	TArray<FString> Notifications;
+	for (const FMCPSessionEvent& Event : GetEventsForStream(SessionId, TOptional<uint64>()))
+	{
+		Notifications.Add(Event.Data);
+	}
+	return Notifications;
+}
+
+TArray<FMCPSessionEvent> FMCPSessionManager::GetEventsForStream(const FString& SessionId, TOptional<uint64> LastEventId)
+{
+	TArray<FMCPSessionEvent> Result;
+	FScopeLock Lock(&SessionsLock);
+	FSession* Session = ActiveSessions.Find(SessionId);
+	if (!Session)
+	{
+		return Result;
+	}
+
+	// An open stream keeps the session alive while the client waits for events
+	Session->LastActivityAt = FPlatformTime::Seconds();
+
+	const uint64 AfterEventId = LastEventId.Get(Session->DeliveredEventId);
+	for (const FMCPSessionEvent& Event : Session->Events)
+	{
+		if (Event.EventId > AfterEventId)
+		{
+			Result.Add(Event);
+		}
+	}
+
+	if (Result.Num() > 0)
+	{
+		Session->DeliveredEventId = FMath::Max(Session->DeliveredEventId, Result.Last().EventId);
+	}
+	return Result;
+}
+
+bool FMCPSessionManager::HasUndeliveredEvents(const FString& SessionId) const
+{
+	FScopeLock Lock(&SessionsLock);
+	const FSession* Session = ActiveSessions.Find(SessionId);
+	return Session && Session->Events.Num() > 0 && Session->Events.Last().EventId > Session->DeliveredEventId;
+}
+
+void FMCPSessionManager::AppendEvent(FSession& Session, const FString& Notification)
+{
+	FMCPSessionEvent Event;
+	Event.EventId = Session.NextEventId++;
+	Event.Data = Notification;
+	Session.Events.Add(MoveTemp(Event));
+
+	// Oldest events are dropped first, delivered or not, so a client that never reads cannot grow the log
+	if (Session.Events.Num() > MaxRetainedEvents)
+	{
+		Session.Events.RemoveAt(0, Session.Events.Num() - MaxRetainedEvents);
+	}
+}
+
+FMCPSessionManager::FSession* FMCPSessionManager::FindLiveSession(const FString& SessionId, double Now)
+{
+	FSession* Session = ActiveSessions.Find(SessionId);
+	return Session && !IsExpired(*Session, Now) ? Session : nullptr;
+}
+
+const FMCPSessionManager::FSession* FMCPSessionManager::FindLiveSession(const FString& SessionId, double Now) const
+{
+	const FSession* Session = ActiveSessions.Find(SessionId);
+	return Session && !IsExpired(*Session, Now) ? Session : nullptr;
+}
+
+bool FMCPSessionManager::IsExpired(const FSession& Session, double Now) const
+{
+	// A session waiting on a long tool call is not idle
+	return Limits.IdleTimeoutSeconds > 0.0 && Session.InFlightRequestIds.Num() == 0 &&
+		Now - Session.LastActivityAt > Limits.IdleTimeoutSeconds;
+}
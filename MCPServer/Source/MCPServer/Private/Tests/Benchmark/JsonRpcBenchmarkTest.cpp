@@ -0,0 +1,544 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Protocol/MCPJsonRpc.h"
+#include "Protocol/MCPSessionManager.h"
+#include "Tools/MCPToolRegistry.h"
+#include "Tools/Impl/GetActorTransformImplTool.h"
+#include "Tools/Impl/GetActorsInLevelImplTool.h"
+#include "Tools/Impl/GetBlueprintGraphsImplTool.h"
+#include "Tests/Mocks/MockActorModule.h"
+#include "Tests/Mocks/MockBlueprintModule.h"
+#include "Async/Async.h"
+#include "Dom/JsonValue.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Protocol hot path benchmarks: FMCPJsonRpc::ProcessMessage driving real tools over the mock modules.
+ * They are PerfFilter tests, so they only run when asked for, e.g.
+ *   UnrealEditor-Cmd <Project> -nullrhi -ExecCmds="Automation RunTests MCPServer.Benchmark; Quit"
+ * Optional command line settings (lists are comma separated):
+ *   -MCPBenchConcurrency=1,4        client threads calling ProcessMessage at once
+ *   -MCPBenchPayloadBytes=256,16384 request padding (Parse) and approximate response size (Serialize)
+ *   -MCPBenchBatchSize=1,16,64      requests per batch array (Batch)
+ *   -MCPBenchIterations=1000        messages measured per run, split across the client threads
+ *   -MCPBenchOutput=<dir>           where JsonRpc.<Scenario>.json is written, Saved/MCPServer/Benchmarks by default
+ */
+namespace JsonRpcBenchmarkHelpers
+{
+	constexpr int32 WarmupMessages = 20;
+
+	/** Rough condensed size of one get_actors_in_level entry, counted twice (text and structuredContent) */
+	constexpr int32 BytesPerListedActor = 360;
+
+	struct FBenchmarkConfig
+	{
+		TArray<int32> Concurrency = { 1, 4 };
+		TArray<int32> PayloadBytes = { 256, 16384, 262144 };
+		TArray<int32> BatchSizes = { 1, 16, 64 };
+		int32 Iterations = 1000;
+		FString OutputDir = FPaths::ProjectSavedDir() / TEXT("MCPServer") / TEXT("Benchmarks");
+
+		static FBenchmarkConfig FromCommandLine()
+		{
+			FBenchmarkConfig Config;
+			ParseList(TEXT("MCPBenchConcurrency="), Config.Concurrency);
+			ParseList(TEXT("MCPBenchPayloadBytes="), Config.PayloadBytes);
+			ParseList(TEXT("MCPBenchBatchSize="), Config.BatchSizes);
+			FParse::Value(FCommandLine::Get(), TEXT("MCPBenchIterations="), Config.Iterations);
+			Config.Iterations = FMath::Max(1, Config.Iterations);
+			FParse::Value(FCommandLine::Get(), TEXT("MCPBenchOutput="), Config.OutputDir);
+			return Config;
+		}
+
+	private:
+		static void ParseList(const TCHAR* Key, TArray<int32>& InOutValues)
+		{
+			FString ListString;
+			if (!FParse::Value(FCommandLine::Get(), Key, ListString, false))
+			{
+				return;
+			}
+
+			TArray<FString> Items;
+			ListString.ParseIntoArray(Items, TEXT(","));
+			TArray<int32> Parsed;
+			for (const FString& Item : Items)
+			{
+				if (Item.IsNumeric() && FCString::Atoi(*Item) > 0)
+				{
+					Parsed.Add(FCString::Atoi(*Item));
+				}
+			}
+			if (Parsed.Num() > 0)
+			{
+				InOutValues = MoveTemp(Parsed);
+			}
+		}
+	};
+
+	/**
+	 * Forwards to the allocator it wraps and counts every Malloc and growing Realloc while installed as GMalloc.
+	 * The count is process wide, so other editor threads add a little noise; run headless for stable numbers.
+	 * The instance is never destroyed and keeps forwarding to Inner after Uninstall, so a thread that
+	 * loaded GMalloc before the swap back still reaches the real allocator.
+	 */
+	class FJsonRpcBenchCountingMalloc final : public FMalloc
+	{
+	public:
+		static FJsonRpcBenchCountingMalloc& Get()
+		{
+			static FJsonRpcBenchCountingMalloc Instance;
+			return Instance;
+		}
+
+		void Install()
+		{
+			check(!bInstalled);
+			bInstalled = true;
+			Allocations.Reset();
+			Inner = GMalloc;
+			GMalloc = this;
+		}
+
+		void Uninstall()
+		{
+			check(bInstalled && GMalloc == this);
+			GMalloc = Inner;
+			bInstalled = false;
+		}
+
+		int64 GetAllocations() const { return Allocations.GetValue(); }
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Allocations.Increment();
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Allocations.Increment();
+			return Inner->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				Allocations.Increment();
+			}
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				Allocations.Increment();
+			}
+			return Inner->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("MCPBenchmarkCounting"); }
+
+	private:
+		FMalloc* Inner = nullptr;
+		bool bInstalled = false;
+		FThreadSafeCounter64 Allocations;
+	};
+
+	/** One client thread's tools and dispatcher. Mocks record calls unsynchronized, so nothing but the session manager is shared. */
+	struct FBenchmarkWorker
+	{
+		FMockActorModule ActorModule;
+		FMockBlueprintModule BlueprintModule;
+		FMCPToolRegistry Registry;
+		TUniquePtr<FMCPJsonRpc> JsonRpc;
+
+		TArray<uint32> LatencyMicros;
+		int64 ResponseBytes = 0;
+		FString LastResponse;
+
+		explicit FBenchmarkWorker(FMCPSessionManager& SessionManager)
+		{
+			Registry.RegisterTool(MakeShared<FGetActorTransformImplTool>(ActorModule));
+			Registry.RegisterTool(MakeShared<FGetActorsInLevelImplTool>(ActorModule));
+			Registry.RegisterTool(MakeShared<FGetBlueprintGraphsImplTool>(BlueprintModule));
+			JsonRpc = MakeUnique<FMCPJsonRpc>(Registry, SessionManager);
+
+			ActorModule.GetActorTransformResult.bSuccess = true;
+			ActorModule.GetActorTransformResult.Location = FVector(120.0, -45.5, 300.0);
+			ActorModule.GetActorTransformResult.Rotation = FRotator(0.0, 90.0, 0.0);
+
+			BlueprintModule.GetBlueprintGraphsResult.bSuccess = true;
+			for (const TCHAR* GraphName : { TEXT("EventGraph"), TEXT("ConstructionScript"), TEXT("UserConstructionScript") })
+			{
+				FBlueprintGraphInfo& Graph = BlueprintModule.GetBlueprintGraphsResult.Graphs.AddDefaulted_GetRef();
+				Graph.GraphName = GraphName;
+				Graph.GraphType = TEXT("Ubergraph");
+			}
+		}
+
+		/** Process each body in turn until Count messages were answered, optionally recording latency */
+		void Run(const TArray<FString>& Bodies, int32 Count, bool bMeasure)
+		{
+			FString NewSessionId;
+			int32 HttpCode = 0;
+			for (int32 MessageIndex = 0; MessageIndex < Count; ++MessageIndex)
+			{
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				JsonRpc->ProcessMessage(Bodies[MessageIndex % Bodies.Num()], FString(), LastResponse, NewSessionId, HttpCode);
+				if (bMeasure)
+				{
+					const double Micros = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0;
+					LatencyMicros.Add(static_cast<uint32>(FMath::Min(Micros, static_cast<double>(MAX_uint32))));
+					ResponseBytes += LastResponse.Len();
+				}
+			}
+		}
+	};
+
+	/** One protocol path to measure; Size is the scenario's variable (payload bytes or batch size), 0 if it has none */
+	struct FBenchmarkScenario
+	{
+		FString Name;
+		FString SizeName;
+		TArray<int32> Sizes = { 0 };
+		bool bSizeIsBatchLength = false;
+		TFunction<TArray<FString>(int32 Size)> MakeBodies;
+		TFunction<void(FBenchmarkWorker& Worker, int32 Size)> SetupWorker;
+	};
+
+	struct FBenchmarkResult
+	{
+		int32 Concurrency = 0;
+		int32 Size = 0;
+		int64 Messages = 0;
+		int64 Requests = 0;
+		double Seconds = 0.0;
+		double MeanRequestBytes = 0.0;
+		double MeanResponseBytes = 0.0;
+		uint32 P50Micros = 0;
+		uint32 P99Micros = 0;
+		uint32 MaxMicros = 0;
+		double MeanMicros = 0.0;
+		double AllocationsPerRequest = 0.0;
+		FString LastResponse;
+	};
+
+	uint32 GetPercentile(const TArray<uint32>& Sorted, double Quantile)
+	{
+		if (Sorted.Num() == 0)
+		{
+			return 0;
+		}
+		const int32 Index = FMath::Clamp(FMath::CeilToInt32(Quantile * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Index];
+	}
+
+	FBenchmarkResult RunBenchmark(const FBenchmarkConfig& Config, const FBenchmarkScenario& Scenario, int32 Concurrency, int32 Size)
+	{
+		const TArray<FString> Bodies = Scenario.MakeBodies(Size);
+		const int32 MessagesPerWorker = FMath::Max(1, Config.Iterations / Concurrency);
+
+		FMCPSessionManager SessionManager;
+		TArray<TUniquePtr<FBenchmarkWorker>> Workers;
+		for (int32 WorkerIndex = 0; WorkerIndex < Concurrency; ++WorkerIndex)
+		{
+			TUniquePtr<FBenchmarkWorker>& Worker = Workers.Add_GetRef(MakeUnique<FBenchmarkWorker>(SessionManager));
+			if (Scenario.SetupWorker)
+			{
+				Scenario.SetupWorker(*Worker, Size);
+			}
+			Worker->LatencyMicros.Reserve(MessagesPerWorker);
+			Worker->Run(Bodies, WarmupMessages, false);
+		}
+
+		// Everything the measured loop needs is allocated up front so the counter only sees the protocol
+		FJsonRpcBenchCountingMalloc& Counter = FJsonRpcBenchCountingMalloc::Get();
+		Counter.Install();
+		const double StartSeconds = FPlatformTime::Seconds();
+		if (Concurrency == 1)
+		{
+			Workers[0]->Run(Bodies, MessagesPerWorker, true);
+		}
+		else
+		{
+			TArray<TFuture<void>> Futures;
+			Futures.Reserve(Concurrency);
+			for (const TUniquePtr<FBenchmarkWorker>& Worker : Workers)
+			{
+				FBenchmarkWorker* WorkerPtr = Worker.Get();
+				Futures.Add(Async(EAsyncExecution::Thread, [WorkerPtr, &Bodies, MessagesPerWorker]()
+				{
+					WorkerPtr->Run(Bodies, MessagesPerWorker, true);
+				}));
+			}
+			for (TFuture<void>& Future : Futures)
+			{
+				Future.Wait();
+			}
+		}
+		const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+		const int64 Allocations = Counter.GetAllocations();
+		Counter.Uninstall();
+
+		FBenchmarkResult Result;
+		Result.Concurrency = Concurrency;
+		Result.Size = Size;
+		Result.Messages = static_cast<int64>(MessagesPerWorker) * Concurrency;
+		Result.Requests = Result.Messages * (Scenario.bSizeIsBatchLength ? FMath::Max(1, Size) : 1);
+		Result.Seconds = ElapsedSeconds;
+
+		int64 BodyBytes = 0;
+		for (const FString& Body : Bodies)
+		{
+			BodyBytes += FTCHARToUTF8(*Body).Length();
+		}
+		Result.MeanRequestBytes = static_cast<double>(BodyBytes) / Bodies.Num();
+
+		TArray<uint32> Latencies;
+		Latencies.Reserve(static_cast<int32>(Result.Messages));
+		int64 ResponseBytes = 0;
+		for (const TUniquePtr<FBenchmarkWorker>& Worker : Workers)
+		{
+			Latencies.Append(Worker->LatencyMicros);
+			ResponseBytes += Worker->ResponseBytes;
+		}
+		Latencies.Sort();
+
+		uint64 TotalMicros = 0;
+		for (uint32 Micros : Latencies)
+		{
+			TotalMicros += Micros;
+		}
+		Result.MeanResponseBytes = static_cast<double>(ResponseBytes) / Result.Messages;
+		Result.P50Micros = GetPercentile(Latencies, 0.5);
+		Result.P99Micros = GetPercentile(Latencies, 0.99);
+		Result.MaxMicros = Latencies.Num() > 0 ? Latencies.Last() : 0;
+		Result.MeanMicros = Latencies.Num() > 0 ? static_cast<double>(TotalMicros) / Latencies.Num() : 0.0;
+		Result.AllocationsPerRequest = static_cast<double>(Allocations) / Result.Requests;
+		Result.LastResponse = Workers[0]->LastResponse;
+		return Result;
+	}
+
+	bool WriteResults(const FBenchmarkConfig& Config, const FBenchmarkScenario& Scenario, const TArray<FBenchmarkResult>& Results, FString& OutPath)
+	{
+		TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("benchmark"), TEXT("JsonRpc.") + Scenario.Name);
+		Root->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+		Root->SetNumberField(TEXT("iterations"), Config.Iterations);
+
+		TArray<TSharedPtr<FJsonValue>> RunsArray;
+		for (const FBenchmarkResult& Result : Results)
+		{
+			TSharedPtr<FJsonObject> Run = MakeShared<FJsonObject>();
+			Run->SetNumberField(TEXT("concurrency"), Result.Concurrency);
+			if (!Scenario.SizeName.IsEmpty())
+			{
+				Run->SetNumberField(Scenario.SizeName, Result.Size);
+			}
+			Run->SetNumberField(TEXT("messages"), static_cast<double>(Result.Messages));
+			Run->SetNumberField(TEXT("requests"), static_cast<double>(Result.Requests));
+			Run->SetNumberField(TEXT("seconds"), Result.Seconds);
+			Run->SetNumberField(TEXT("messagesPerSecond"), Result.Seconds > 0.0 ? Result.Messages / Result.Seconds : 0.0);
+			Run->SetNumberField(TEXT("requestsPerSecond"), Result.Seconds > 0.0 ? Result.Requests / Result.Seconds : 0.0);
+			Run->SetNumberField(TEXT("p50LatencyMicros"), Result.P50Micros);
+			Run->SetNumberField(TEXT("p99LatencyMicros"), Result.P99Micros);
+			Run->SetNumberField(TEXT("maxLatencyMicros"), Result.MaxMicros);
+			Run->SetNumberField(TEXT("meanLatencyMicros"), Result.MeanMicros);
+			Run->SetNumberField(TEXT("allocationsPerRequest"), Result.AllocationsPerRequest);
+			Run->SetNumberField(TEXT("requestBytes"), Result.MeanRequestBytes);
+			Run->SetNumberField(TEXT("responseBytes"), Result.MeanResponseBytes);
+			RunsArray.Add(MakeShared<FJsonValueObject>(Run));
+		}
+		Root->SetArrayField(TEXT("runs"), RunsArray);
+
+		FString Json;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+
+		OutPath = Config.OutputDir / FString::Printf(TEXT("JsonRpc.%s.json"), *Scenario.Name);
+		return FFileHelper::SaveStringToFile(Json, *OutPath);
+	}
+
+	/** Run every concurrency and size combination, check the responses, log a summary and write the JSON report */
+	void RunScenario(FAutomationTestBase& Test, const FBenchmarkScenario& Scenario, const FString& ExpectedText)
+	{
+		const FBenchmarkConfig Config = FBenchmarkConfig::FromCommandLine();
+
+		TArray<FBenchmarkResult> Results;
+		for (int32 Concurrency : Config.Concurrency)
+		{
+			for (int32 Size : Scenario.Sizes)
+			{
+				FBenchmarkResult& Result = Results.Add_GetRef(RunBenchmark(Config, Scenario, Concurrency, Size));
+
+				const FString RunName = FString::Printf(TEXT("%s concurrency=%d %s=%d"), *Scenario.Name, Concurrency,
+					Scenario.SizeName.IsEmpty() ? TEXT("size") : *Scenario.SizeName, Size);
+				Test.TestTrue(RunName + TEXT(" answered"), Result.LastResponse.Contains(ExpectedText));
+				Test.TestFalse(RunName + TEXT(" has no errors"), Result.LastResponse.Contains(TEXT("\"error\"")));
+				Test.AddInfo(FString::Printf(TEXT("%s: %.0f req/s, p50 %u us, p99 %u us, %.1f allocs/req"), *RunName,
+					Result.Seconds > 0.0 ? Result.Requests / Result.Seconds : 0.0, Result.P50Micros, Result.P99Micros, Result.AllocationsPerRequest));
+			}
+		}
+
+		FString OutPath;
+		Test.TestTrue(TEXT("Results written"), WriteResults(Config, Scenario, Results, OutPath));
+		Test.AddInfo(FString::Printf(TEXT("Benchmark results: %s"), *OutPath));
+	}
+
+	FString MakeToolsCallBody(int32 Id, const FString& ToolName, const FString& ArgumentsJson)
+	{
+		return FString::Printf(TEXT("{\"jsonrpc\":\"2.0\",\"id\":%d,\"method\":\"tools/call\",\"params\":{\"name\":\"%s\",\"arguments\":%s}}"),
+			Id, *ToolName, *ArgumentsJson);
+	}
+}
+
+// ---- Parse: ping padded to the payload size, so the cost is reading the body ----
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonRpcBenchmarkParseTest,
+	"MCPServer.Benchmark.JsonRpc.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FJsonRpcBenchmarkParseTest::RunTest(const FString& Parameters)
+{
+	using namespace JsonRpcBenchmarkHelpers;
+
+	FBenchmarkScenario Scenario;
+	Scenario.Name = TEXT("Parse");
+	Scenario.SizeName = TEXT("payloadBytes");
+	Scenario.Sizes = FBenchmarkConfig::FromCommandLine().PayloadBytes;
+	Scenario.MakeBodies = [](int32 Size)
+	{
+		const FString Prefix = TEXT("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"ping\",\"params\":{\"padding\":[");
+		FString Body = Prefix;
+		Body.Reserve(Size + 64);
+		for (int32 Index = 0; Body.Len() < Size; ++Index)
+		{
+			Body += FString::Printf(TEXT("%s{\"name\":\"Actor_%d\",\"x\":%d.5}"), Index > 0 ? TEXT(",") : TEXT(""), Index, Index);
+		}
+		Body += TEXT("]}}");
+		return TArray<FString>{ Body };
+	};
+
+	RunScenario(*this, Scenario, TEXT("\"result\""));
+	return true;
+}
+
+// ---- Dispatch: small tools/call requests alternating between actor and blueprint tools ----
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonRpcBenchmarkDispatchTest,
+	"MCPServer.Benchmark.JsonRpc.Dispatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FJsonRpcBenchmarkDispatchTest::RunTest(const FString& Parameters)
+{
+	using namespace JsonRpcBenchmarkHelpers;
+
+	FBenchmarkScenario Scenario;
+	Scenario.Name = TEXT("Dispatch");
+	Scenario.MakeBodies = [](int32 Size)
+	{
+		return TArray<FString>{
+			MakeToolsCallBody(1, TEXT("get_actor_transform"), TEXT("{\"actor_identifier\":\"PointLight_1\"}")),
+			MakeToolsCallBody(2, TEXT("get_blueprint_graphs"), TEXT("{\"blueprint_path\":\"/Game/Blueprints/BP_Door\"}"))
+		};
+	};
+
+	RunScenario(*this, Scenario, TEXT("\"isError\":false"));
+	return true;
+}
+
+// ---- Batch: arrays of tools/call requests, answered as one response array ----
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonRpcBenchmarkBatchTest,
+	"MCPServer.Benchmark.JsonRpc.Batch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FJsonRpcBenchmarkBatchTest::RunTest(const FString& Parameters)
+{
+	using namespace JsonRpcBenchmarkHelpers;
+
+	FBenchmarkScenario Scenario;
+	Scenario.Name = TEXT("Batch");
+	Scenario.SizeName = TEXT("batchSize");
+	Scenario.Sizes = FBenchmarkConfig::FromCommandLine().BatchSizes;
+	Scenario.bSizeIsBatchLength = true;
+	Scenario.MakeBodies = [](int32 Size)
+	{
+		TArray<FString> Requests;
+		for (int32 Index = 0; Index < Size; ++Index)
+		{
+			Requests.Add(Index % 2 == 0
+				? MakeToolsCallBody(Index + 1, TEXT("get_actor_transform"), FString::Printf(TEXT("{\"actor_identifier\":\"PointLight_%d\"}"), Index))
+				: MakeToolsCallBody(Index + 1, TEXT("get_blueprint_graphs"), FString::Printf(TEXT("{\"blueprint_path\":\"/Game/Blueprints/BP_%d\"}"), Index)));
+		}
+		return TArray<FString>{ TEXT("[") + FString::Join(Requests, TEXT(",")) + TEXT("]") };
+	};
+
+	RunScenario(*this, Scenario, TEXT("\"isError\":false"));
+	return true;
+}
+
+// ---- Serialize: get_actors_in_level listing enough mock actors to reach the payload size ----
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonRpcBenchmarkSerializeTest,
+	"MCPServer.Benchmark.JsonRpc.Serialize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FJsonRpcBenchmarkSerializeTest::RunTest(const FString& Parameters)
+{
+	using namespace JsonRpcBenchmarkHelpers;
+
+	FBenchmarkScenario Scenario;
+	Scenario.Name = TEXT("Serialize");
+	Scenario.SizeName = TEXT("payloadBytes");
+	Scenario.Sizes = FBenchmarkConfig::FromCommandLine().PayloadBytes;
+	Scenario.MakeBodies = [](int32 Size)
+	{
+		return TArray<FString>{ MakeToolsCallBody(1, TEXT("get_actors_in_level"), TEXT("{\"limit\":10000}")) };
+	};
+	Scenario.SetupWorker = [](FBenchmarkWorker& Worker, int32 Size)
+	{
+		FGetActorsResult& Listing = Worker.ActorModule.GetActorsInLevelResult;
+		Listing.bSuccess = true;
+
+		const int32 ActorCount = FMath::Clamp(Size / BytesPerListedActor, 1, 10000);
+		Listing.Actors.Reserve(ActorCount);
+		for (int32 Index = 0; Index < ActorCount; ++Index)
+		{
+			FActorInfo& Info = Listing.Actors.AddDefaulted_GetRef();
+			Info.ActorName = FString::Printf(TEXT("StaticMeshActor_%d"), Index);
+			Info.ActorLabel = FString::Printf(TEXT("Rock_%d"), Index);
+			Info.ActorClass = TEXT("StaticMeshActor");
+			Info.Location = FVector(Index * 100.0, Index * -50.0, 12.5);
+			Info.Rotation = FRotator(0.0, Index % 360, 0.0);
+			Info.FolderPath = TEXT("Environment/Rocks");
+		}
+	};
+
+	RunScenario(*this, Scenario, TEXT("\"structuredContent\""));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
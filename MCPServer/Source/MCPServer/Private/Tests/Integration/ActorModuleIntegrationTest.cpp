@@ -0,0 +1,329 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/Scaling/ScalingTestFixtures.h"
+#include "Modules/Impl/ActorImplModule.h"
+#include "Modules/Impl/EditorBatchImplModule.h"
+#include "Components/SceneComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/Level.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Correctness tests that run FActorImplModule against a blank editor map.
+ * They share the world fixtures of the Scaling suite but are product tests.
+ */
+namespace ActorModuleIntegrationTestPrivate
+{
+	using namespace MCPScalingTest;
+
+	constexpr int32 IndexActors = 64;
+
+	/** Transient actor Blueprint, whose construction script has the DefaultSceneRoot node as its root */
+	struct FActorBlueprintFixture
+	{
+		TStrongObjectPtr<UBlueprint> Blueprint;
+
+		FActorBlueprintFixture()
+		{
+			const FName PackageName = MakeUniqueObjectName(nullptr, UPackage::StaticClass(), FName(TEXT("/Temp/MCPIntegration/BP_Spawn")));
+			UPackage* Package = CreatePackage(*PackageName.ToString());
+			Blueprint.Reset(FKismetEditorUtilities::CreateBlueprint(
+				AActor::StaticClass(),
+				Package,
+				FName(*FPackageName::GetShortName(Package->GetName())),
+				BPTYPE_Normal,
+				UBlueprint::StaticClass(),
+				UBlueprintGeneratedClass::StaticClass()));
+		}
+
+		~FActorBlueprintFixture()
+		{
+			if (UBlueprint* Asset = Blueprint.Get())
+			{
+				Asset->ClearFlags(RF_Public | RF_Standalone);
+				Asset->MarkAsGarbage();
+			}
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorModuleSpawnBatchBlueprintScaleTest,
+	"MCPServer.Integration.ActorModule.SpawnBatch.BlueprintScale",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FActorModuleSpawnBatchBlueprintScaleTest::RunTest(const FString& Parameters)
+{
+	using namespace ActorModuleIntegrationTestPrivate;
+
+	FScalingWorld World;
+	FEditorBatchImplModule EditorBatch;
+	FActorImplModule ActorModule(EditorBatch);
+
+	FActorBlueprintFixture Fixture;
+	UBlueprint* Blueprint = Fixture.Blueprint.Get();
+	if (!TestNotNull(TEXT("Blueprint created"), Blueprint) || !TestNotNull(TEXT("Blueprint compiled"), Blueprint->GeneratedClass.Get()))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Construction script has a root component"),
+		Blueprint->SimpleConstructionScript && Blueprint->SimpleConstructionScript->GetRootNodes().Num() > 0);
+
+	// Construction from an SCS root must keep the requested scale rather than the template's
+	const FTransform Requested(FRotator(0.0, 45.0, 0.0), FVector(100.0, 200.0, 300.0), FVector(2.0, 3.0, 4.0));
+	FActorSpawnBatchRequest Request;
+	Request.ClassPaths.Add(Blueprint->GeneratedClass->GetPathName());
+	Request.Items.Add({ 0, Requested });
+	Request.Items.Add({ 0, FTransform(FVector(-100.0, 0.0, 0.0)) });
+
+	const FActorSpawnBatchResult Result = ActorModule.SpawnActorsBatch(Request);
+	TestEqual(TEXT("Both actors spawned"), Result.SpawnedCount, 2);
+	if (!TestEqual(TEXT("One name per item"), Result.ActorNames.Num(), 2))
+	{
+		return false;
+	}
+
+	AActor* Scaled = ActorModule.FindActor(Result.ActorNames[0]);
+	if (!TestNotNull(TEXT("Scaled actor found"), Scaled))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Requested scale kept"), Scaled->GetActorScale3D().Equals(Requested.GetScale3D()));
+	TestTrue(TEXT("Requested location kept"), Scaled->GetActorLocation().Equals(Requested.GetLocation()));
+	TestTrue(TEXT("Requested rotation kept"), Scaled->GetActorRotation().Equals(Requested.Rotator()));
+
+	AActor* Unscaled = ActorModule.FindActor(Result.ActorNames[1]);
+	TestTrue(TEXT("Unit scale kept"), Unscaled && Unscaled->GetActorScale3D().Equals(FVector::OneVector));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorModuleIndexLabelChangeTest,
+	"MCPServer.Integration.ActorModule.Index.LabelChange",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FActorModuleIndexLabelChangeTest::RunTest(const FString& Parameters)
+{
+	using namespace ActorModuleIntegrationTestPrivate;
+
+	FScalingWorld World;
+	FActorFixture Fixture(World.GetWorld(), IndexActors, GetSeed());
+	FEditorBatchImplModule EditorBatch;
+	FActorImplModule ActorModule(EditorBatch);
+
+	AActor* Actor = ActorModule.FindActor(Fixture.Labels[0]);
+	if (!TestNotNull(TEXT("Actor found by its fixture label"), Actor))
+	{
+		return false;
+	}
+
+	Actor->SetActorLabel(TEXT("Integration_Relabelled"));
+	TestTrue(TEXT("New label resolves to the actor"), ActorModule.FindActor(TEXT("Integration_Relabelled")) == Actor);
+	TestNull(TEXT("Old label no longer resolves"), ActorModule.FindActor(Fixture.Labels[0]));
+	TestTrue(TEXT("Object name still resolves"), ActorModule.FindActor(Actor->GetName()) == Actor);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorModuleIndexDeleteTest,
+	"MCPServer.Integration.ActorModule.Index.Delete",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FActorModuleIndexDeleteTest::RunTest(const FString& Parameters)
+{
+	using namespace ActorModuleIntegrationTestPrivate;
+
+	FScalingWorld World;
+	FActorFixture Fixture(World.GetWorld(), IndexActors, GetSeed());
+	FEditorBatchImplModule EditorBatch;
+	FActorImplModule ActorModule(EditorBatch);
+
+	TestNotNull(TEXT("Actor found before delete"), ActorModule.FindActor(Fixture.Names[0]));
+	TestTrue(TEXT("DeleteActor succeeds"), ActorModule.DeleteActor(Fixture.Names[0]).bSuccess);
+
+	TestNull(TEXT("Deleted actor not found by name"), ActorModule.FindActor(Fixture.Names[0]));
+	TestNull(TEXT("Deleted actor not found by label"), ActorModule.FindActor(Fixture.Labels[0]));
+	TestNotNull(TEXT("Other actors still found"), ActorModule.FindActor(Fixture.Labels[1]));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorModuleIndexStaleEntryTest,
+	"MCPServer.Integration.ActorModule.Index.StaleEntry",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FActorModuleIndexStaleEntryTest::RunTest(const FString& Parameters)
+{
+	using namespace ActorModuleIntegrationTestPrivate;
+
+	FScalingWorld World;
+	FActorFixture Fixture(World.GetWorld(), IndexActors, GetSeed());
+	FEditorBatchImplModule EditorBatch;
+	FActorImplModule ActorModule(EditorBatch);
+
+	AActor* Stale = ActorModule.FindActor(Fixture.Labels[0]);
+	AActor* Other = ActorModule.FindActor(Fixture.Labels[1]);
+	if (!TestNotNull(TEXT("First actor found"), Stale) || !TestNotNull(TEXT("Second actor found"), Other))
+	{
+		return false;
+	}
+
+	// Garbage without a delete notification leaves dead weak pointers in the name and label buckets
+	Stale->MarkAsGarbage();
+	TestNull(TEXT("Dead entry not returned by label"), ActorModule.FindActor(Fixture.Labels[0]));
+	TestNull(TEXT("Dead entry not returned by name"), ActorModule.FindActor(Fixture.Names[0]));
+
+	// A live actor taking over the label is found past the dead entry
+	Other->SetActorLabel(Fixture.Labels[0]);
+	TestTrue(TEXT("Live actor found past the dead entry"), ActorModule.FindActor(Fixture.Labels[0]) == Other);
+
+	Stale->ClearGarbage();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorModuleIndexPropertyMoveTest,
+	"MCPServer.Integration.ActorModule.Index.PropertyMove",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FActorModuleIndexPropertyMoveTest::RunTest(const FString& Parameters)
+{
+	using namespace ActorModuleIntegrationTestPrivate;
+
+	FScalingWorld World;
+	FActorFixture Fixture(World.GetWorld(), IndexActors, GetSeed());
+	FEditorBatchImplModule EditorBatch;
+	FActorImplModule ActorModule(EditorBatch);
+
+	AActor* Actor = ActorModule.FindActor(Fixture.Labels[0]);
+	if (!TestNotNull(TEXT("Actor found"), Actor) || !TestNotNull(TEXT("Actor has a root component"), Actor->GetRootComponent()))
+	{
+		return false;
+	}
+
+	// Well above the fixture, so nothing else is in the box
+	const FVector NewLocation(0.0, 0.0, 4000000.0);
+	FActorSpatialQuery Query;
+	Query.Box = FBox(NewLocation - FVector(100.0), NewLocation + FVector(100.0));
+	TestEqual(TEXT("Nothing at the new location yet"), ActorModule.QueryActorsSpatial(Query).Actors.Num(), 0);
+
+	// A details panel edit of RelativeLocation: the component moves and only OnObjectPropertyChanged fires
+	USceneComponent* Root = Actor->GetRootComponent();
+	Root->SetRelativeLocation(NewLocation);
+	FProperty* LocationProperty = FindFProperty<FProperty>(USceneComponent::StaticClass(), USceneComponent::GetRelativeLocationPropertyName());
+	FPropertyChangedEvent PropertyChangedEvent(LocationProperty);
+	Root->PostEditChangeProperty(PropertyChangedEvent);
+
+	const FActorSpatialQueryResult Result = ActorModule.QueryActorsSpatial(Query);
+	TestEqual(TEXT("Moved actor found at its new location"), Result.Actors.Num(), 1);
+	TestEqual(TEXT("Match is the moved actor"), Result.Actors.Num() == 1 ? Result.Actors[0].ActorName : FString(), Fixture.Names[0]);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorModuleIndexBoundsFilterTest,
+	"MCPServer.Integration.ActorModule.Index.BoundsFilter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FActorModuleIndexBoundsFilterTest::RunTest(const FString& Parameters)
+{
+	using namespace ActorModuleIntegrationTestPrivate;
+
+	FScalingWorld World;
+	FActorFixture Fixture(World.GetWorld(), IndexActors, GetSeed());
+	FEditorBatchImplModule EditorBatch;
+	FActorImplModule ActorModule(EditorBatch);
+
+	const FBox Box(FVector(0.0, 0.0, -1000000.0), FVector(1000000.0, 1000000.0, 1000000.0));
+
+	// A large cube centred just outside the box: its location is outside but its bounds overlap
+	AStaticMeshActor* Straddling = Cast<AStaticMeshActor>(ActorModule.FindActor(Fixture.Names[0]));
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Fixture actor is a static mesh actor"), Straddling) || !TestNotNull(TEXT("Cube mesh loaded"), Cube))
+	{
+		return false;
+	}
+	Straddling->GetStaticMeshComponent()->SetStaticMesh(Cube);
+	const FVector StraddlingLocation(Box.Max.X + 200.0, 500000.0, 0.0);
+	const FVector StraddlingScale(10.0);
+	ActorModule.SetActorTransform(Fixture.Names[0], &StraddlingLocation, nullptr, &StraddlingScale);
+
+	FActorQuery ListQuery;
+	ListQuery.Bounds = Box;
+	const FGetActorsResult Listed = ActorModule.GetActorsInLevel(ListQuery);
+	TSet<FString> ListedNames;
+	for (const FActorInfo& Info : Listed.Actors)
+	{
+		ListedNames.Add(Info.ActorName);
+	}
+
+	FActorPropertiesBulkQuery BulkQuery;
+	BulkQuery.Bounds = Box;
+	BulkQuery.PropertyPaths = { TEXT("bHidden") };
+	const FActorPropertiesBulkResult Bulk = ActorModule.GetActorPropertiesBulk(BulkQuery);
+
+	FActorSpatialQuery SpatialQuery;
+	SpatialQuery.Box = Box;
+	const FActorSpatialQueryResult Spatial = ActorModule.QueryActorsSpatial(SpatialQuery);
+	TSet<FString> SpatialNames;
+	for (const FActorSpatialMatch& Match : Spatial.Actors)
+	{
+		SpatialNames.Add(Match.ActorName);
+	}
+
+	TestTrue(TEXT("Listing succeeds"), Listed.bSuccess);
+	TestTrue(TEXT("Listing matches by bounds overlap"), ListedNames.Contains(Fixture.Names[0]));
+	TestTrue(TEXT("Listing and bulk read select the same actors"),
+		ListedNames.Num() == Bulk.ActorNames.Num() && ListedNames.Includes(TSet<FString>(Bulk.ActorNames)));
+	TestTrue(TEXT("Listing and spatial query select the same actors"),
+		ListedNames.Num() == SpatialNames.Num() && ListedNames.Includes(SpatialNames));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorModuleLevelChangesLoadedActorsTest,
+	"MCPServer.Integration.ActorModule.LevelChanges.LoadedActors",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FActorModuleLevelChangesLoadedActorsTest::RunTest(const FString& Parameters)
+{
+	using namespace ActorModuleIntegrationTestPrivate;
+
+	FScalingWorld World;
+	FActorFixture Fixture(World.GetWorld(), 4, GetSeed());
+	FEditorBatchImplModule EditorBatch;
+	FActorImplModule ActorModule(EditorBatch);
+
+	AActor* Actor = ActorModule.FindActor(Fixture.Names[0]);
+	if (!TestNotNull(TEXT("Fixture actor found"), Actor))
+	{
+		return false;
+	}
+	const FString Token = ActorModule.GetLevelChanges(FString()).Token;
+
+	// World Partition unloads and loads cells with these events only, not OnLevelActorDeleted/Added
+	ULevel::OnLoadedActorRemovedFromLevelEvent.Broadcast(*Actor);
+	FLevelChangesResult Unloaded = ActorModule.GetLevelChanges(Token);
+	TestFalse(TEXT("Unload keeps the token"), Unloaded.bReset);
+	if (TestEqual(TEXT("Unloaded actor listed"), Unloaded.Changes.Num(), 1))
+	{
+		TestTrue(TEXT("Unloaded actor removed"), Unloaded.Changes[0].Kind == EActorChangeKind::Removed);
+		TestEqual(TEXT("Unloaded actor name"), Unloaded.Changes[0].ActorName, Fixture.Names[0]);
+	}
+
+	ULevel::OnLoadedActorAddedToLevelEvent.Broadcast(*Actor);
+	FLevelChangesResult Loaded = ActorModule.GetLevelChanges(Unloaded.Token);
+	TestFalse(TEXT("Load keeps the token"), Loaded.bReset);
+	if (TestEqual(TEXT("Loaded actor listed"), Loaded.Changes.Num(), 1))
+	{
+		TestTrue(TEXT("Loaded actor added"), Loaded.Changes[0].Kind == EActorChangeKind::Added);
+	}
+	TestTrue(TEXT("Loaded actor in the index"), ActorModule.FindActor(Fixture.Names[0]) == Actor);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -11,19 +11,33 @@ public:
 
 	// Configurable results
 	FActorSpawnResult SpawnActorResult;
+	FActorSpawnBatchResult SpawnActorsBatchResult;
+	FActorSpawnBatchRequest LastSpawnBatchRequest;
 	FActorDeleteResult DeleteActorResult;
 	FActorDuplicateResult DuplicateActorResult;
 	FGetActorsResult GetActorsInLevelResult;
+	FActorQuery LastActorQuery;
+	FActorSpatialQueryResult QueryActorsSpatialResult;
+	FActorSpatialQuery LastSpatialQuery;
 	FActorSelectionResult SelectActorsResult;
 	FActorSelectionResult DeselectAllResult;
 	FActorTransformResult GetActorTransformResult;
 	FActorSetTransformResult SetActorTransformResult;
 	FActorPropertyResult GetActorPropertyResult;
+	FActorPropertiesBulkResult GetActorPropertiesBulkResult;
+	FActorPropertiesBulkQuery LastPropertiesBulkQuery;
 	FActorSetPropertyResult SetActorPropertyResult;
 	FActorConvertResult ConvertActorResult;
 	FMoveActorsToLevelResult MoveActorsToLevelResult;
 	FGroupActorsResult GroupActorsResult;
 	FSetActorFolderResult SetActorFolderResult;
+	FMergeToInstancesResult MergeToInstancesResult;
+	FMergeToInstancesRequest LastMergeToInstancesRequest;
+	FExplodeInstancesResult ExplodeInstancesResult;
+	TArray<FString> LastExplodeIdentifiers;
+	FLevelChangesResult GetLevelChangesResult;
+	FString LastSinceToken;
+	AActor* FindActorResult = nullptr;
 
 	virtual FActorSpawnResult SpawnActor(const FString& ActorClassPath, const FVector& Location, const FRotator& Rotation) override
 	{
@@ -31,6 +45,13 @@ public:
 		return SpawnActorResult;
 	}
 
+	virtual FActorSpawnBatchResult SpawnActorsBatch(const FActorSpawnBatchRequest& Request) override
+	{
+		Recorder.RecordCall(TEXT("SpawnActorsBatch"));
+		LastSpawnBatchRequest = Request;
+		return SpawnActorsBatchResult;
+	}
+
 	virtual FActorDeleteResult DeleteActor(const FString& ActorIdentifier) override
 	{
 		Recorder.RecordCall(TEXT("DeleteActor"));
@@ -43,12 +64,20 @@ public:
 		return DuplicateActorResult;
 	}
 
-	virtual FGetActorsResult GetActorsInLevel(const FString& ClassFilter = TEXT("")) override
+	virtual FGetActorsResult GetActorsInLevel(const FActorQuery& Query = FActorQuery()) override
 	{
 		Recorder.RecordCall(TEXT("GetActorsInLevel"));
+		LastActorQuery = Query;
 		return GetActorsInLevelResult;
 	}
 
+	virtual FActorSpatialQueryResult QueryActorsSpatial(const FActorSpatialQuery& Query) override
+	{
+		Recorder.RecordCall(TEXT("QueryActorsSpatial"));
+		LastSpatialQuery = Query;
+		return QueryActorsSpatialResult;
+	}
+
 	virtual FActorSelectionResult SelectActors(const TArray<FString>& ActorIdentifiers, bool bAddToSelection = false) override
 	{
 		Recorder.RecordCall(TEXT("SelectActors"));
@@ -79,6 +108,13 @@ public:
 		return GetActorPropertyResult;
 	}
 
+	virtual FActorPropertiesBulkResult GetActorPropertiesBulk(const FActorPropertiesBulkQuery& Query) override
+	{
+		Recorder.RecordCall(TEXT("GetActorPropertiesBulk"));
+		LastPropertiesBulkQuery = Query;
+		return GetActorPropertiesBulkResult;
+	}
+
 	virtual FActorSetPropertyResult SetActorProperty(const FString& ActorIdentifier, const FString& PropertyName, const FString& PropertyValue) override
 	{
 		Recorder.RecordCall(TEXT("SetActorProperty"));
@@ -108,4 +144,41 @@ public:
 		Recorder.RecordCall(TEXT("SetActorFolder"));
 		return SetActorFolderResult;
 	}
+
+	virtual FMergeToInstancesResult MergeToInstances(const FMergeToInstancesRequest& Request) override
+	{
+		Recorder.RecordCall(TEXT("MergeToInstances"));
+		LastMergeToInstancesRequest = Request;
+		return MergeToInstancesResult;
+	}
+
+	virtual FExplodeInstancesResult ExplodeInstances(const TArray<FString>& ActorIdentifiers) override
+	{
+		Recorder.RecordCall(TEXT("ExplodeInstances"));
+		LastExplodeIdentifiers = ActorIdentifiers;
+		return ExplodeInstancesResult;
+	}
+
+	virtual FLevelChangesResult GetLevelChanges(const FString& SinceToken) override
+	{
+		Recorder.RecordCall(TEXT("GetLevelChanges"));
+		LastSinceToken = SinceToken;
+		return GetLevelChangesResult;
+	}
+
+	virtual AActor* FindActor(const FString& ActorIdentifier) override
+	{
+		Recorder.RecordCall(TEXT("FindActor"));
+		return FindActorResult;
+	}
+
+	virtual void BeginBatch(const FString& Description) override
+	{
+		Recorder.RecordCall(TEXT("BeginBatch"));
+	}
+
+	virtual void EndBatch() override
+	{
+		Recorder.RecordCall(TEXT("EndBatch"));
+	}
 };
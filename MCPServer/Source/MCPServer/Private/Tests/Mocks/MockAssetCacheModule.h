@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "Modules/Interfaces/IAssetCacheModule.h"
+#include "MockCallRecorder.h"
+
+class FMockAssetCacheModule : public IAssetCacheModule
+{
+public:
+	FMockCallRecorder Recorder;
+
+	UObject* LoadAssetResult = nullptr;
+	FAssetCacheStats StatsResult;
+
+	virtual UObject* LoadAsset(const FString& AssetPath, UClass* AssetClass) override
+	{
+		Recorder.RecordCall(TEXT("LoadAsset"));
+		return LoadAssetResult;
+	}
+	using IAssetCacheModule::LoadAsset;
+
+	virtual FAssetCacheStats GetStats() const override
+	{
+		return StatsResult;
+	}
+
+	virtual void ClearCache() override
+	{
+		Recorder.RecordCall(TEXT("ClearCache"));
+	}
+};
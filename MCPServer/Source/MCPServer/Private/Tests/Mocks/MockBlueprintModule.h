@@ -99,4 +99,8 @@ public:
 	FFindFunctionResult FindFunctionResult;
 
 	virtual FFindFunctionResult FindFunction(const FString& Search, const FString* ClassName, int32 Limit, bool bBlueprintCallableOnly) override { Recorder.RecordCall(TEXT("FindFunction")); return FindFunctionResult; }
+
+	// Batching
+	virtual void BeginBatch(const FString& Description) override { Recorder.RecordCall(TEXT("BeginBatch")); }
+	virtual void EndBatch() override { Recorder.RecordCall(TEXT("EndBatch")); }
 };
@@ -34,4 +34,7 @@ public:
 	virtual FGetMaterialExpressionsResult GetMaterialExpressions(const FString& MaterialPath) override { Recorder.RecordCall(TEXT("GetMaterialExpressions")); return GetMaterialExpressionsResult; }
 	virtual FGetMaterialExpressionPropertyResult GetMaterialExpressionProperty(const FString& MaterialPath, int32 ExpressionIndex, const FString& PropertyName) override { Recorder.RecordCall(TEXT("GetMaterialExpressionProperty")); return GetMaterialExpressionPropertyResult; }
 	virtual FSetMaterialExpressionPropertyResult SetMaterialExpressionProperty(const FString& MaterialPath, int32 ExpressionIndex, const FString& PropertyName, const FString& PropertyValue) override { Recorder.RecordCall(TEXT("SetMaterialExpressionProperty")); return SetMaterialExpressionPropertyResult; }
+
+	virtual void BeginBatch(const FString& Description) override { Recorder.RecordCall(TEXT("BeginBatch")); }
+	virtual void EndBatch() override { Recorder.RecordCall(TEXT("EndBatch")); }
 };
@@ -0,0 +1,191 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Protocol/MCPHttpServer.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/Compression.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace HttpServerTestHelpers
+{
+	FName Negotiate(const FString& AcceptEncoding)
+	{
+		FHttpServerRequest Request;
+		Request.Headers.Add(TEXT("Accept-Encoding"), { AcceptEncoding });
+		return FMCPHttpServer::NegotiateContentEncoding(Request);
+	}
+
+	/** Body of repeated JSON text, which compresses well */
+	TArray<uint8> MakeCompressibleBody(int32 NumBytes)
+	{
+		const FTCHARToUTF8 Chunk(TEXT("{\"name\":\"StaticMeshActor\",\"location\":[0,0,0]},"));
+		TArray<uint8> Body;
+		Body.Reserve(NumBytes);
+		while (Body.Num() < NumBytes)
+		{
+			Body.Append(reinterpret_cast<const uint8*>(Chunk.Get()), FMath::Min(Chunk.Length(), NumBytes - Body.Num()));
+		}
+		return Body;
+	}
+
+	/** Body of random bytes, which no coding makes smaller */
+	TArray<uint8> MakeIncompressibleBody(int32 NumBytes)
+	{
+		FRandomStream Random(1234);
+		TArray<uint8> Body;
+		Body.SetNumUninitialized(NumBytes);
+		for (uint8& Byte : Body)
+		{
+			Byte = static_cast<uint8>(Random.RandHelper(256));
+		}
+		return Body;
+	}
+
+	/** Run CompleteResponse and pump the game thread until it answered. Returns nullptr on timeout. */
+	TUniquePtr<FHttpServerResponse> Complete(const TArray<uint8>& Body, FName ContentEncoding)
+	{
+		TUniquePtr<FHttpServerResponse> Response = MakeUnique<FHttpServerResponse>();
+		Response->Code = EHttpServerResponseCodes::Ok;
+		Response->Body = Body;
+
+		TUniquePtr<FHttpServerResponse> Completed;
+		FMCPHttpServer::CompleteResponse(
+			[&Completed](TUniquePtr<FHttpServerResponse>&& InResponse) { Completed = MoveTemp(InResponse); },
+			MoveTemp(Response), ContentEncoding);
+
+		const double Deadline = FPlatformTime::Seconds() + 10.0;
+		while (!Completed.IsValid() && FPlatformTime::Seconds() < Deadline)
+		{
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		}
+		return Completed;
+	}
+
+	bool HasHeader(const FHttpServerResponse& Response, const FString& Name, const FString& Value)
+	{
+		const TArray<FString>* Values = Response.Headers.Find(Name);
+		return Values && Values->Contains(Value);
+	}
+}
+
+// ---- Accept-Encoding negotiation ----
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHttpServerNegotiateEncodingTest,
+	"MCPServer.Protocol.HttpServer.ContentEncoding.Negotiate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHttpServerNegotiateEncodingTest::RunTest(const FString& Parameters)
+{
+	using namespace HttpServerTestHelpers;
+
+	FHttpServerRequest NoHeader;
+	TestEqual(TEXT("No Accept-Encoding, no coding"), FMCPHttpServer::NegotiateContentEncoding(NoHeader), FName(NAME_None));
+
+	// gzip is preferred whenever it is accepted
+	TestEqual(TEXT("gzip alone"), Negotiate(TEXT("gzip")), FName(NAME_Gzip));
+	TestEqual(TEXT("gzip preferred over deflate"), Negotiate(TEXT("deflate, gzip")), FName(NAME_Gzip));
+	TestEqual(TEXT("Coding names are case-insensitive"), Negotiate(TEXT("GZIP")), FName(NAME_Gzip));
+	TestEqual(TEXT("Wildcard gets gzip"), Negotiate(TEXT("*")), FName(NAME_Gzip));
+
+	// deflate is the fallback
+	TestEqual(TEXT("deflate alone"), Negotiate(TEXT("deflate")), FName(NAME_Zlib));
+	TestEqual(TEXT("deflate with other codings"), Negotiate(TEXT("br, deflate;q=0.5")), FName(NAME_Zlib));
+
+	// q=0 refuses a coding
+	TestEqual(TEXT("Refused gzip falls back to deflate"), Negotiate(TEXT("gzip;q=0, deflate")), FName(NAME_Zlib));
+	TestEqual(TEXT("Refused gzip alone"), Negotiate(TEXT("gzip;q=0")), FName(NAME_None));
+	TestEqual(TEXT("Both refused"), Negotiate(TEXT("gzip;q=0.0, deflate;q=0")), FName(NAME_None));
+	TestEqual(TEXT("Unsupported codings only"), Negotiate(TEXT("br, identity")), FName(NAME_None));
+	return true;
+}
+
+// ---- Response compression ----
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHttpServerCompressResponseTest,
+	"MCPServer.Protocol.HttpServer.ContentEncoding.Compress",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHttpServerCompressResponseTest::RunTest(const FString& Parameters)
+{
+	using namespace HttpServerTestHelpers;
+
+	const TArray<uint8> Body = MakeCompressibleBody(64 * 1024);
+
+	TUniquePtr<FHttpServerResponse> Gzipped = Complete(Body, NAME_Gzip);
+	if (!TestTrue(TEXT("gzip response completed"), Gzipped.IsValid()))
+	{
+		return false;
+	}
+	TestTrue(TEXT("gzip Content-Encoding"), HasHeader(*Gzipped, TEXT("Content-Encoding"), TEXT("gzip")));
+	TestTrue(TEXT("Vary on Accept-Encoding"), HasHeader(*Gzipped, TEXT("Vary"), TEXT("Accept-Encoding")));
+	TestTrue(TEXT("gzip body is smaller"), Gzipped->Body.Num() < Body.Num());
+
+	TArray<uint8> Uncompressed;
+	Uncompressed.SetNumUninitialized(Body.Num());
+	TestTrue(TEXT("gzip body decompresses"),
+		FCompression::UncompressMemory(NAME_Gzip, Uncompressed.GetData(), Uncompressed.Num(), Gzipped->Body.GetData(), Gzipped->Body.Num()));
+	TestTrue(TEXT("gzip body round-trips"), Uncompressed == Body);
+
+	TUniquePtr<FHttpServerResponse> Deflated = Complete(Body, NAME_Zlib);
+	if (!TestTrue(TEXT("deflate response completed"), Deflated.IsValid()))
+	{
+		return false;
+	}
+	TestTrue(TEXT("deflate Content-Encoding"), HasHeader(*Deflated, TEXT("Content-Encoding"), TEXT("deflate")));
+	TestTrue(TEXT("deflate body is smaller"), Deflated->Body.Num() < Body.Num());
+
+	TUniquePtr<FHttpServerResponse> Plain = Complete(Body, NAME_None);
+	if (!TestTrue(TEXT("Uncompressed response completed"), Plain.IsValid()))
+	{
+		return false;
+	}
+	TestFalse(TEXT("No coding negotiated, no Content-Encoding"), Plain->Headers.Contains(TEXT("Content-Encoding")));
+	TestTrue(TEXT("No coding negotiated, body unchanged"), Plain->Body == Body);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHttpServerCompressThresholdTest,
+	"MCPServer.Protocol.HttpServer.ContentEncoding.Threshold",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHttpServerCompressThresholdTest::RunTest(const FString& Parameters)
+{
+	using namespace HttpServerTestHelpers;
+
+	// Just under the threshold is sent as it is, without touching the headers
+	const TArray<uint8> SmallBody = MakeCompressibleBody(FMCPHttpServer::CompressionThresholdBytes - 1);
+	TUniquePtr<FHttpServerResponse> Small = Complete(SmallBody, NAME_Gzip);
+	if (!TestTrue(TEXT("Small response completed"), Small.IsValid()))
+	{
+		return false;
+	}
+	TestFalse(TEXT("Small body not encoded"), Small->Headers.Contains(TEXT("Content-Encoding")));
+	TestFalse(TEXT("Small body has no Vary"), Small->Headers.Contains(TEXT("Vary")));
+	TestTrue(TEXT("Small body unchanged"), Small->Body == SmallBody);
+
+	// At the threshold it is compressed
+	const TArray<uint8> ThresholdBody = MakeCompressibleBody(FMCPHttpServer::CompressionThresholdBytes);
+	TUniquePtr<FHttpServerResponse> AtThreshold = Complete(ThresholdBody, NAME_Gzip);
+	if (!TestTrue(TEXT("Threshold response completed"), AtThreshold.IsValid()))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Body at the threshold is encoded"), HasHeader(*AtThreshold, TEXT("Content-Encoding"), TEXT("gzip")));
+
+	// A body compression would not shrink is sent as it is, still varying on Accept-Encoding
+	const TArray<uint8> RandomBody = MakeIncompressibleBody(FMCPHttpServer::CompressionThresholdBytes * 2);
+	TUniquePtr<FHttpServerResponse> Random = Complete(RandomBody, NAME_Gzip);
+	if (!TestTrue(TEXT("Incompressible response completed"), Random.IsValid()))
+	{
+		return false;
+	}
+	TestFalse(TEXT("Incompressible body not encoded"), Random->Headers.Contains(TEXT("Content-Encoding")));
+	TestTrue(TEXT("Incompressible body varies on Accept-Encoding"), HasHeader(*Random, TEXT("Vary"), TEXT("Accept-Encoding")));
+	TestTrue(TEXT("Incompressible body unchanged"), Random->Body == RandomBody);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -6,6 +6,7 @@
 #include "Tools/MCPToolRegistry.h"
 #include "Tools/Interfaces/IMCPTool.h"
 #include "Dom/JsonValue.h"
+#include "HAL/ThreadSafeCounter.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
@@ -37,6 +38,69 @@ public:
 	}
 };
 
+/** Read-only tool that echoes its "value" argument */
+class FJsonRpcReadOnlyTestTool : public IMCPTool
+{
+public:
+	FThreadSafeCounter TotalCalls;
+
+	virtual FString GetName() const override { return TEXT("test_read"); }
+	virtual FString GetDescription() const override { return TEXT("Read-only tool for tests"); }
+	virtual TSharedPtr<FJsonObject> GetInputSchema() const override
+	{
+		auto Schema = MakeShared<FJsonObject>();
+		Schema->SetStringField(TEXT("type"), TEXT("object"));
+		return Schema;
+	}
+	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override
+	{
+		TotalCalls.Increment();
+
+		auto Result = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> ContentArray;
+		auto TextContent = MakeShared<FJsonObject>();
+		TextContent->SetStringField(TEXT("type"), TEXT("text"));
+		TextContent->SetStringField(TEXT("text"), Arguments->GetStringField(TEXT("value")));
+		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+		Result->SetArrayField(TEXT("content"), ContentArray);
+		Result->SetBoolField(TEXT("isError"), false);
+		return Result;
+	}
+	virtual bool IsReadOnly() const override { return true; }
+};
+
+/** Read-only tool that records whether its own request is listed as in flight on the session while it runs */
+class FJsonRpcInFlightProbeTool : public IMCPTool
+{
+public:
+	FMCPSessionManager* SessionManager = nullptr;
+	FString SessionId;
+	FThreadSafeCounter ListedCalls;
+
+	virtual FString GetName() const override { return TEXT("test_inflight_probe"); }
+	virtual FString GetDescription() const override { return TEXT("In-flight probe tool for tests"); }
+	virtual TSharedPtr<FJsonObject> GetInputSchema() const override
+	{
+		auto Schema = MakeShared<FJsonObject>();
+		Schema->SetStringField(TEXT("type"), TEXT("object"));
+		return Schema;
+	}
+	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override
+	{
+		TOptional<FMCPSessionInfo> Info = SessionManager->GetSessionInfo(SessionId);
+		if (Info.IsSet() && Info->InFlightRequestIds.Contains(Arguments->GetStringField(TEXT("value"))))
+		{
+			ListedCalls.Increment();
+		}
+
+		auto Result = MakeShared<FJsonObject>();
+		Result->SetArrayField(TEXT("content"), TArray<TSharedPtr<FJsonValue>>());
+		Result->SetBoolField(TEXT("isError"), false);
+		return Result;
+	}
+	virtual bool IsReadOnly() const override { return true; }
+};
+
 namespace JsonRpcTestHelpers
 {
 	struct FTestContext
@@ -337,4 +401,228 @@ bool FJsonRpcBatchNotificationsTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+// ---- Batch (read-only tool calls run on workers) ----
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonRpcBatchReadOnlyTest,
+	"MCPServer.Protocol.JsonRpc.Batch.ReadOnlyConcurrent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FJsonRpcBatchReadOnlyTest::RunTest(const FString& Parameters)
+{
+	JsonRpcTestHelpers::FTestContext Ctx;
+	TSharedPtr<FJsonRpcReadOnlyTestTool> ReadTool = MakeShared<FJsonRpcReadOnlyTestTool>();
+	Ctx.Registry.RegisterTool(ReadTool);
+
+	// Reads interleaved with a game-thread tool and a ping
+	FString Body = TEXT("[");
+	for (int32 CallIndex = 0; CallIndex < 8; ++CallIndex)
+	{
+		Body += FString::Printf(TEXT("{\"jsonrpc\":\"2.0\",\"id\":%d,\"method\":\"tools/call\",\"params\":{\"name\":\"test_read\",\"arguments\":{\"value\":\"read_%d\"}}},"), CallIndex, CallIndex);
+	}
+	Body += TEXT("{\"jsonrpc\":\"2.0\",\"id\":8,\"method\":\"tools/call\",\"params\":{\"name\":\"test_echo\"}},");
+	Body += TEXT("{\"jsonrpc\":\"2.0\",\"id\":9,\"method\":\"ping\"}]");
+
+	FString Response, NewSessionId;
+	int32 HttpCode;
+	Ctx.Process(Body, Response, NewSessionId, HttpCode);
+
+	TestEqual(TEXT("HTTP 200"), HttpCode, 200);
+	TSharedPtr<FJsonValue> Parsed;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response);
+	FJsonSerializer::Deserialize(Reader, Parsed);
+	if (!TestTrue(TEXT("Response is array"), Parsed.IsValid() && Parsed->Type == EJson::Array))
+	{
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>& Responses = Parsed->AsArray();
+	TestEqual(TEXT("Ten responses"), Responses.Num(), 10);
+	TestEqual(TEXT("Every read ran once"), ReadTool->TotalCalls.GetValue(), 8);
+
+	// Responses stay in request order
+	for (int32 ResponseIndex = 0; ResponseIndex < Responses.Num(); ++ResponseIndex)
+	{
+		TestEqual(TEXT("Response id matches position"), static_cast<int32>(Responses[ResponseIndex]->AsObject()->GetNumberField(TEXT("id"))), ResponseIndex);
+	}
+	const TSharedPtr<FJsonObject> ThirdResult = Responses[3]->AsObject()->GetObjectField(TEXT("result"));
+	TestEqual(TEXT("Read result matches its request"),
+		ThirdResult->GetArrayField(TEXT("content"))[0]->AsObject()->GetStringField(TEXT("text")), TEXT("read_3"));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonRpcBatchReadOnlyInFlightTest,
+	"MCPServer.Protocol.JsonRpc.Batch.ReadOnlyInFlight",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FJsonRpcBatchReadOnlyInFlightTest::RunTest(const FString& Parameters)
+{
+	JsonRpcTestHelpers::FTestContext Ctx;
+	TSharedPtr<FJsonRpcInFlightProbeTool> ProbeTool = MakeShared<FJsonRpcInFlightProbeTool>();
+	ProbeTool->SessionManager = &Ctx.SessionManager;
+	ProbeTool->SessionId = Ctx.SessionManager.CreateSession();
+	Ctx.Registry.RegisterTool(ProbeTool);
+
+	// Each call passes its own request id, so the tool can look for it on the session
+	FString Body = TEXT("[");
+	for (int32 CallIndex = 0; CallIndex < 4; ++CallIndex)
+	{
+		Body += FString::Printf(TEXT("%s{\"jsonrpc\":\"2.0\",\"id\":\"req_%d\",\"method\":\"tools/call\",\"params\":{\"name\":\"test_inflight_probe\",\"arguments\":{\"value\":\"req_%d\"}}}"),
+			CallIndex > 0 ? TEXT(",") : TEXT(""), CallIndex, CallIndex);
+	}
+	Body += TEXT("]");
+
+	FString Response, NewSessionId;
+	int32 HttpCode;
+	Ctx.Process(Body, Response, NewSessionId, HttpCode, ProbeTool->SessionId);
+
+	TestEqual(TEXT("HTTP 200"), HttpCode, 200);
+	TestEqual(TEXT("Every worker call was listed as in flight while it ran"), ProbeTool->ListedCalls.GetValue(), 4);
+
+	TOptional<FMCPSessionInfo> Info = Ctx.SessionManager.GetSessionInfo(ProbeTool->SessionId);
+	if (!TestTrue(TEXT("Session still live"), Info.IsSet()))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Answered calls are no longer in flight"), Info->InFlightRequestIds.Num(), 0);
+	return true;
+}
+
+// ---- ToolsList (read-only annotation) ----
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonRpcToolsListReadOnlyHintTest,
+	"MCPServer.Protocol.JsonRpc.ToolsList.ReadOnlyHint",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FJsonRpcToolsListReadOnlyHintTest::RunTest(const FString& Parameters)
+{
+	JsonRpcTestHelpers::FTestContext Ctx;
+	Ctx.Registry.RegisterTool(MakeShared<FJsonRpcReadOnlyTestTool>());
+	FString Response, NewSessionId;
+	int32 HttpCode;
+	Ctx.Process(TEXT("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"tools/list\",\"params\":{}}"), Response, NewSessionId, HttpCode);
+
+	auto Obj = JsonRpcTestHelpers::ParseResponse(Response);
+	const TArray<TSharedPtr<FJsonValue>>& ToolsArray = Obj->GetObjectField(TEXT("result"))->GetArrayField(TEXT("tools"));
+	for (const TSharedPtr<FJsonValue>& ToolValue : ToolsArray)
+	{
+		const TSharedPtr<FJsonObject> ToolObj = ToolValue->AsObject();
+		const TSharedPtr<FJsonObject>* Annotations;
+		const bool bHasHint = ToolObj->TryGetObjectField(TEXT("annotations"), Annotations) && (*Annotations)->GetBoolField(TEXT("readOnlyHint"));
+		TestEqual(*FString::Printf(TEXT("readOnlyHint of %s"), *ToolObj->GetStringField(TEXT("name"))),
+			bHasHint, ToolObj->GetStringField(TEXT("name")) == TEXT("test_read"));
+	}
+	return true;
+}
+
+// ---- ToolsList (cached response) ----
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonRpcToolsListCachedTest,
+	"MCPServer.Protocol.JsonRpc.ToolsList.Cached",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FJsonRpcToolsListCachedTest::RunTest(const FString& Parameters)
+{
+	JsonRpcTestHelpers::FTestContext Ctx;
+	const FString Body = TEXT("{\"jsonrpc\":\"2.0\",\"id\":\"list-1\",\"method\":\"tools/list\"}");
+	TestTrue(TEXT("Detected as tools/list"), Ctx.JsonRpc->IsToolsListRequest(UTF8TEXTVIEW("{\"jsonrpc\":\"2.0\",\"id\":\"list-1\",\"method\":\"tools/list\"}")));
+	TestFalse(TEXT("ping is not tools/list"), Ctx.JsonRpc->IsToolsListRequest(UTF8TEXTVIEW("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"ping\"}")));
+	TestFalse(TEXT("Batch is not a single tools/list"), Ctx.JsonRpc->IsToolsListRequest(UTF8TEXTVIEW("[{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"tools/list\"}]")));
+
+	FString Response, NewSessionId;
+	int32 HttpCode;
+	Ctx.Process(Body, Response, NewSessionId, HttpCode);
+	TestEqual(TEXT("HTTP 200"), HttpCode, 200);
+
+	auto Obj = JsonRpcTestHelpers::ParseResponse(Response);
+	if (!TestTrue(TEXT("Cached response is valid JSON"), Obj.IsValid()))
+	{
+		return false;
+	}
+	TestEqual(TEXT("String id echoed"), Obj->GetStringField(TEXT("id")), TEXT("list-1"));
+	TestEqual(TEXT("One tool listed"), Obj->GetObjectField(TEXT("result"))->GetArrayField(TEXT("tools")).Num(), 1);
+
+	// Inside a batch tools/list goes through the regular path
+	Ctx.Process(FString::Printf(TEXT("[%s]"), *Body), Response, NewSessionId, HttpCode);
+	TSharedPtr<FJsonValue> Parsed;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response);
+	FJsonSerializer::Deserialize(Reader, Parsed);
+	TestTrue(TEXT("Batch response is array"), Parsed.IsValid() && Parsed->Type == EJson::Array && Parsed->AsArray().Num() == 1);
+	return true;
+}
+
+// ---- ToolsList (list_changed) ----
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonRpcToolsListChangedTest,
+	"MCPServer.Protocol.JsonRpc.ToolsList.ListChanged",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FJsonRpcToolsListChangedTest::RunTest(const FString& Parameters)
+{
+	JsonRpcTestHelpers::FTestContext Ctx;
+	FString Response, SessionId;
+	int32 HttpCode;
+	Ctx.Process(TEXT("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"initialize\",\"params\":{}}"), Response, SessionId, HttpCode);
+
+	auto Obj = JsonRpcTestHelpers::ParseResponse(Response);
+	const TSharedPtr<FJsonObject> ToolsCap = Obj->GetObjectField(TEXT("result"))->GetObjectField(TEXT("capabilities"))->GetObjectField(TEXT("tools"));
+	TestTrue(TEXT("listChanged advertised"), ToolsCap->GetBoolField(TEXT("listChanged")));
+
+	const FString ETagBefore = Ctx.JsonRpc->GetToolsListETag();
+	TestEqual(TEXT("No notification before a change"), Ctx.SessionManager.TakeNotifications(SessionId).Num(), 0);
+
+	Ctx.Registry.RegisterTool(MakeShared<FJsonRpcReadOnlyTestTool>());
+
+	TArray<FString> Notifications = Ctx.SessionManager.TakeNotifications(SessionId);
+	TestEqual(TEXT("One notification queued"), Notifications.Num(), 1);
+	if (Notifications.Num() == 1)
+	{
+		auto NotificationObj = JsonRpcTestHelpers::ParseResponse(Notifications[0]);
+		TestEqual(TEXT("list_changed method"), NotificationObj->GetStringField(TEXT("method")), TEXT("notifications/tools/list_changed"));
+	}
+	TestNotEqual(TEXT("ETag changed"), Ctx.JsonRpc->GetToolsListETag(), ETagBefore);
+	return true;
+}
+
+// ---- UTF-8 entry point ----
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonRpcUtf8MessageTest,
+	"MCPServer.Protocol.JsonRpc.Utf8Message",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FJsonRpcUtf8MessageTest::RunTest(const FString& Parameters)
+{
+	JsonRpcTestHelpers::FTestContext Ctx;
+	Ctx.Registry.RegisterTool(MakeShared<FJsonRpcReadOnlyTestTool>());
+
+	const FString Value = TEXT("Gr\u00f6\u00dfe \u65e5\u672c \U0001F600");
+	const FString Body = FString::Printf(
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":7,\"method\":\"tools/call\",\"params\":{\"name\":\"test_read\",\"arguments\":{\"value\":\"%s\"}}}"), *Value);
+	FTCHARToUTF8 Utf8Body(*Body, Body.Len());
+
+	TArray<uint8> Response;
+	int32 HttpCode = 0;
+	// Without a tool call queue the completion runs before the call returns
+	Ctx.JsonRpc->ProcessUtf8MessageAsync(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8Body.Get()), Utf8Body.Length()), FString(),
+		[&Response, &HttpCode](TArray<uint8>&& InResponse, const FString& NewSessionId, int32 InHttpCode, int32 RetryAfterSeconds)
+		{
+			Response = MoveTemp(InResponse);
+			HttpCode = InHttpCode;
+		});
+
+	TestEqual(TEXT("HTTP 200"), HttpCode, 200);
+	TestFalse(TEXT("Response is condensed to one line"), Response.Contains(static_cast<uint8>('\n')));
+
+	FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Response.GetData()), Response.Num());
+	auto Obj = JsonRpcTestHelpers::ParseResponse(FString(Converter.Length(), Converter.Get()));
+	if (!TestTrue(TEXT("Response is valid UTF-8 JSON"), Obj.IsValid()))
+	{
+		return false;
+	}
+	const FString Text = Obj->GetObjectField(TEXT("result"))->GetArrayField(TEXT("content"))[0]->AsObject()->GetStringField(TEXT("text"));
+	TestEqual(TEXT("Non-ASCII argument round-trips"), Text, Value);
+
+	Ctx.JsonRpc->ProcessUtf8MessageAsync(UTF8TEXTVIEW("{\"jsonrpc\":"), FString(),
+		[&HttpCode](TArray<uint8>&& InResponse, const FString& NewSessionId, int32 InHttpCode, int32 RetryAfterSeconds)
+		{
+			HttpCode = InHttpCode;
+		});
+	TestEqual(TEXT("Truncated body is a parse error"), HttpCode, 400);
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
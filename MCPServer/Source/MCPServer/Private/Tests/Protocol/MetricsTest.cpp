@@ -0,0 +1,129 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Core/MCPMetrics.h"
+#include "Protocol/MCPJsonRpc.h"
+#include "Protocol/MCPSessionManager.h"
+#include "Tools/MCPToolRegistry.h"
+#include "Tools/Interfaces/IMCPTool.h"
+#include "Dom/JsonValue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Tool that fails when called with {"fail": true} */
+class FMetricsTestTool : public IMCPTool
+{
+public:
+	virtual FString GetName() const override { return TEXT("metrics_test"); }
+	virtual FString GetDescription() const override { return TEXT("Tool for metrics tests"); }
+	virtual TSharedPtr<FJsonObject> GetInputSchema() const override
+	{
+		auto Schema = MakeShared<FJsonObject>();
+		Schema->SetStringField(TEXT("type"), TEXT("object"));
+		return Schema;
+	}
+	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override
+	{
+		bool bFail = false;
+		Arguments->TryGetBoolField(TEXT("fail"), bFail);
+
+		auto Result = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> ContentArray;
+		auto TextContent = MakeShared<FJsonObject>();
+		TextContent->SetStringField(TEXT("type"), TEXT("text"));
+		TextContent->SetStringField(TEXT("text"), bFail ? TEXT("failed") : TEXT("metrics_ok"));
+		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+		Result->SetArrayField(TEXT("content"), ContentArray);
+		Result->SetBoolField(TEXT("isError"), bFail);
+		return Result;
+	}
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetricsHistogramTest,
+	"MCPServer.Protocol.Metrics.Histogram",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMetricsHistogramTest::RunTest(const FString& Parameters)
+{
+	FMCPHistogram Histogram;
+	TestEqual(TEXT("Empty histogram percentile"), Histogram.GetPercentile(0.5), (uint64)0);
+
+	for (uint64 Value = 1; Value <= 1000; ++Value)
+	{
+		Histogram.Record(Value * 1000);
+	}
+
+	TestEqual(TEXT("Count"), Histogram.GetCount(), (int64)1000);
+	TestEqual(TEXT("Max"), Histogram.GetMax(), (uint64)1000000);
+
+	const double P50 = static_cast<double>(Histogram.GetPercentile(0.5));
+	const double P99 = static_cast<double>(Histogram.GetPercentile(0.99));
+	TestTrue(TEXT("p50 within 2%"), FMath::Abs(P50 - 500000.0) <= 500000.0 * 0.02);
+	TestTrue(TEXT("p99 within 2%"), FMath::Abs(P99 - 990000.0) <= 990000.0 * 0.02);
+	TestEqual(TEXT("p100 is the max"), Histogram.GetPercentile(1.0), (uint64)1000000);
+
+	FMCPHistogram Small;
+	Small.Record(3);
+	Small.Record(7);
+	TestEqual(TEXT("Small values are exact"), Small.GetPercentile(1.0), (uint64)7);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetricsJsonRpcTest,
+	"MCPServer.Protocol.Metrics.JsonRpc",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMetricsJsonRpcTest::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	Registry.RegisterTool(MakeShared<FMetricsTestTool>());
+	FMCPSessionManager SessionManager;
+	FMCPMetrics Metrics;
+	FMCPJsonRpc JsonRpc(Registry, SessionManager, nullptr, nullptr, &Metrics);
+
+	FString Response;
+	FString NewSessionId;
+	int32 HttpCode = 0;
+	const FString CallBody = TEXT("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"tools/call\",\"params\":{\"name\":\"metrics_test\"}}");
+	JsonRpc.ProcessMessage(CallBody, TEXT(""), Response, NewSessionId, HttpCode);
+	JsonRpc.ProcessMessage(
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"tools/call\",\"params\":{\"name\":\"metrics_test\",\"arguments\":{\"fail\":true}}}"),
+		TEXT(""), Response, NewSessionId, HttpCode);
+	JsonRpc.ProcessMessage(TEXT("{\"jsonrpc\":\"2.0\",\"id\":3,\"method\":\"made/up\"}"), TEXT(""), Response, NewSessionId, HttpCode);
+	JsonRpc.ProcessMessage(TEXT("not json"), TEXT(""), Response, NewSessionId, HttpCode);
+
+	const TMap<FString, FMCPMetricSeries> Methods = Metrics.GetMethodSeries();
+	TestTrue(TEXT("tools/call recorded"), Methods.Contains(TEXT("tools/call")));
+	TestTrue(TEXT("Unknown method grouped"), Methods.Contains(TEXT("other")) && !Methods.Contains(TEXT("made/up")));
+	TestTrue(TEXT("Parse error recorded"), Methods.Contains(TEXT("invalid")));
+	if (Methods.Contains(TEXT("tools/call")))
+	{
+		const FMCPMetricSeries& ToolsCall = Methods[TEXT("tools/call")];
+		TestEqual(TEXT("Two tools/call messages"), ToolsCall.Calls, (int64)2);
+		TestEqual(TEXT("Failed tool counts as a method error"), ToolsCall.Errors, (int64)1);
+		TestEqual(TEXT("Request size recorded"), ToolsCall.RequestBytes.GetCount(), (int64)2);
+		TestTrue(TEXT("Request size matches the body"), ToolsCall.RequestBytes.GetMax() >= static_cast<uint64>(CallBody.Len()));
+	}
+
+	const TMap<FString, FMCPMetricSeries> Tools = Metrics.GetToolSeries();
+	TestTrue(TEXT("Tool recorded"), Tools.Contains(TEXT("metrics_test")));
+	if (Tools.Contains(TEXT("metrics_test")))
+	{
+		const FMCPMetricSeries& Tool = Tools[TEXT("metrics_test")];
+		TestEqual(TEXT("Two executions"), Tool.Calls, (int64)2);
+		TestEqual(TEXT("One failed execution"), Tool.Errors, (int64)1);
+		TestEqual(TEXT("Not queued"), Tool.QueueWaitMicros.GetCount(), (int64)0);
+		TestEqual(TEXT("Response sizes recorded"), Tool.ResponseBytes.GetCount(), (int64)2);
+	}
+
+	const FString Exported = Metrics.ExportPrometheus();
+	TestTrue(TEXT("Prometheus counter"), Exported.Contains(TEXT("mcp_tool_calls_total{tool=\"metrics_test\"} 2")));
+	TestTrue(TEXT("Prometheus summary quantile"), Exported.Contains(TEXT("mcp_tool_duration_seconds{tool=\"metrics_test\",quantile=\"0.99\"}")));
+	TestTrue(TEXT("Prometheus type line"), Exported.Contains(TEXT("# TYPE mcp_method_duration_seconds summary")));
+
+	Metrics.Reset();
+	TestEqual(TEXT("Reset drops series"), Metrics.GetToolSeries().Num(), 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -2,6 +2,7 @@
 
 #include "Misc/AutomationTest.h"
 #include "Protocol/MCPSessionManager.h"
+#include "HAL/PlatformProcess.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -82,4 +83,193 @@ bool FSessionManagerUniqueIdsTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSessionManagerNotificationsTest,
+	"MCPServer.Protocol.SessionManager.Notifications",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSessionManagerNotificationsTest::RunTest(const FString& Parameters)
+{
+	FMCPSessionManager Manager;
+	FString FirstId = Manager.CreateSession();
+	FString SecondId = Manager.CreateSession();
+
+	Manager.BroadcastNotification(TEXT("first"));
+	Manager.BroadcastNotification(TEXT("second"));
+
+	TArray<FString> Notifications = Manager.TakeNotifications(FirstId);
+	TestEqual(TEXT("Both notifications queued"), Notifications.Num(), 2);
+	TestEqual(TEXT("Oldest first"), Notifications[0], TEXT("first"));
+	TestEqual(TEXT("Taken notifications are not returned again"), Manager.TakeNotifications(FirstId).Num(), 0);
+	TestEqual(TEXT("Other sessions keep their queue"), Manager.TakeNotifications(SecondId).Num(), 2);
+	TestEqual(TEXT("Unknown session has no notifications"), Manager.TakeNotifications(TEXT("unknown")).Num(), 0);
+
+	Manager.RemoveSession(FirstId);
+	Manager.BroadcastNotification(TEXT("third"));
+	TestEqual(TEXT("Removed session receives nothing"), Manager.TakeNotifications(FirstId).Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSessionManagerTakeNotificationsReplayTest,
+	"MCPServer.Protocol.SessionManager.TakeNotificationsReplay",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSessionManagerTakeNotificationsReplayTest::RunTest(const FString& Parameters)
+{
+	FMCPSessionManager Manager;
+	FString SessionId = Manager.CreateSession();
+
+	Manager.PushNotification(SessionId, TEXT("a"));
+	Manager.PushNotification(SessionId, TEXT("b"));
+	TestEqual(TEXT("Both notifications taken"), Manager.TakeNotifications(SessionId).Num(), 2);
+	TestFalse(TEXT("Taken notifications are marked delivered"), Manager.HasUndeliveredEvents(SessionId));
+	TestEqual(TEXT("Stream without Last-Event-ID gets nothing"), Manager.GetEventsForStream(SessionId, TOptional<uint64>()).Num(), 0);
+
+	// Taking marks events delivered without dropping them, so Last-Event-ID can replay them
+	TArray<FMCPSessionEvent> Replayed = Manager.GetEventsForStream(SessionId, static_cast<uint64>(0));
+	TestEqual(TEXT("Taken notifications kept for replay"), Replayed.Num(), 2);
+	TestEqual(TEXT("Replay keeps order"), Replayed.Num() == 2 ? Replayed[1].Data : FString(), TEXT("b"));
+
+	// Only newer events are taken next time
+	Manager.PushNotification(SessionId, TEXT("c"));
+	TArray<FString> Taken = Manager.TakeNotifications(SessionId);
+	TestEqual(TEXT("Only the new notification taken"), Taken.Num(), 1);
+	TestEqual(TEXT("New notification data"), Taken.Num() == 1 ? Taken[0] : FString(), TEXT("c"));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSessionManagerEventStreamTest,
+	"MCPServer.Protocol.SessionManager.EventStream",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSessionManagerEventStreamTest::RunTest(const FString& Parameters)
+{
+	FMCPSessionManager Manager;
+	FString SessionId = Manager.CreateSession();
+
+	TArray<FString> QueuedFor;
+	Manager.OnEventQueued().AddLambda([&QueuedFor](const FString& QueuedSessionId) { QueuedFor.Add(QueuedSessionId); });
+
+	Manager.PushNotification(SessionId, TEXT("a"));
+	Manager.PushNotification(SessionId, TEXT("b"));
+	Manager.PushNotification(TEXT("unknown"), TEXT("ignored"));
+	TestEqual(TEXT("Delegate fired for the session only"), QueuedFor.Num(), 2);
+	TestTrue(TEXT("Undelivered events pending"), Manager.HasUndeliveredEvents(SessionId));
+
+	TArray<FMCPSessionEvent> Events = Manager.GetEventsForStream(SessionId, TOptional<uint64>());
+	TestEqual(TEXT("Two events"), Events.Num(), 2);
+	TestTrue(TEXT("Event ids increase"), Events.Num() == 2 && Events[1].EventId > Events[0].EventId);
+	TestFalse(TEXT("Nothing pending after delivery"), Manager.HasUndeliveredEvents(SessionId));
+	TestEqual(TEXT("No new events"), Manager.GetEventsForStream(SessionId, TOptional<uint64>()).Num(), 0);
+
+	// Reconnect with Last-Event-ID of the first event resumes after it
+	TArray<FMCPSessionEvent> Resumed = Manager.GetEventsForStream(SessionId, Events[0].EventId);
+	TestEqual(TEXT("Resumed after Last-Event-ID"), Resumed.Num(), 1);
+	TestEqual(TEXT("Resumed event data"), Resumed.Num() == 1 ? Resumed[0].Data : FString(), TEXT("b"));
+
+	// The log is capped
+	for (int32 EventIndex = 0; EventIndex < FMCPSessionManager::MaxRetainedEvents + 10; ++EventIndex)
+	{
+		Manager.PushNotification(SessionId, FString::FromInt(EventIndex));
+	}
+	TestEqual(TEXT("Log capped at MaxRetainedEvents"),
+		Manager.GetEventsForStream(SessionId, static_cast<uint64>(0)).Num(), FMCPSessionManager::MaxRetainedEvents);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSessionManagerExpiryTest,
+	"MCPServer.Protocol.SessionManager.Expiry",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSessionManagerExpiryTest::RunTest(const FString& Parameters)
+{
+	FMCPSessionLimits Limits;
+	Limits.IdleTimeoutSeconds = 0.05;
+	FMCPSessionManager Manager(Limits);
+
+	TArray<FString> Removed;
+	Manager.OnSessionRemoved().AddLambda([&Removed](const FString& SessionId) { Removed.Add(SessionId); });
+
+	FString IdleId = Manager.CreateSession();
+	FString BusyId = Manager.CreateSession();
+	Manager.AddInFlightRequest(BusyId, TEXT("1"));
+	TestTrue(TEXT("Touch refreshes a live session"), Manager.TouchSession(IdleId));
+
+	FPlatformProcess::Sleep(0.1f);
+	TestFalse(TEXT("Idle session is invalid once expired"), Manager.IsValidSession(IdleId));
+	TestFalse(TEXT("Expired session cannot be touched"), Manager.TouchSession(IdleId));
+	TestTrue(TEXT("Session with an in-flight request does not expire"), Manager.IsValidSession(BusyId));
+
+	Manager.RemoveExpiredSessions();
+	TestEqual(TEXT("Only the idle session was removed"), Removed.Num(), 1);
+	TestEqual(TEXT("Removed session id"), Removed.Num() == 1 ? Removed[0] : FString(), IdleId);
+	TestEqual(TEXT("One session left"), Manager.GetSessionCount(), 1);
+
+	Manager.RemoveInFlightRequest(BusyId, TEXT("1"));
+	FPlatformProcess::Sleep(0.1f);
+	Manager.RemoveExpiredSessions();
+	TestEqual(TEXT("Session expires once its request is answered"), Manager.GetSessionCount(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSessionManagerCapTest,
+	"MCPServer.Protocol.SessionManager.Cap",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSessionManagerCapTest::RunTest(const FString& Parameters)
+{
+	FMCPSessionLimits Limits;
+	Limits.MaxSessions = 2;
+	FMCPSessionManager Manager(Limits);
+
+	TArray<FString> Removed;
+	Manager.OnSessionRemoved().AddLambda([&Removed](const FString& SessionId) { Removed.Add(SessionId); });
+
+	FString FirstId = Manager.CreateSession();
+	FPlatformProcess::Sleep(0.01f);
+	FString SecondId = Manager.CreateSession();
+	FPlatformProcess::Sleep(0.01f);
+	Manager.TouchSession(FirstId);
+
+	FString ThirdId = Manager.CreateSession();
+	TestEqual(TEXT("Cap holds"), Manager.GetSessionCount(), 2);
+	TestFalse(TEXT("Least recently active session dropped"), Manager.IsValidSession(SecondId));
+	TestTrue(TEXT("Recently touched session kept"), Manager.IsValidSession(FirstId));
+	TestTrue(TEXT("New session valid"), Manager.IsValidSession(ThirdId));
+	TestEqual(TEXT("Drop broadcast"), Removed.Num(), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSessionManagerInfoTest,
+	"MCPServer.Protocol.SessionManager.Info",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSessionManagerInfoTest::RunTest(const FString& Parameters)
+{
+	FMCPSessionManager Manager;
+	FString SessionId = Manager.CreateSession();
+	TestFalse(TEXT("No info for unknown session"), Manager.GetSessionInfo(TEXT("unknown")).IsSet());
+
+	TSharedPtr<FJsonObject> Capabilities = MakeShared<FJsonObject>();
+	Capabilities->SetObjectField(TEXT("roots"), MakeShared<FJsonObject>());
+	Manager.SetClientInfo(SessionId, TEXT("2025-03-26"), TEXT("test-client"), TEXT("1.2.3"), Capabilities);
+	Manager.TouchSession(SessionId);
+	Manager.TouchSession(SessionId);
+	Manager.RecordToolCalls(SessionId, 3);
+	Manager.AddInFlightRequest(SessionId, TEXT("7"));
+
+	TOptional<FMCPSessionInfo> Info = Manager.GetSessionInfo(SessionId);
+	if (!TestTrue(TEXT("Info available"), Info.IsSet()))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Protocol version"), Info->ProtocolVersion, TEXT("2025-03-26"));
+	TestEqual(TEXT("Client name"), Info->ClientName, TEXT("test-client"));
+	TestEqual(TEXT("Client version"), Info->ClientVersion, TEXT("1.2.3"));
+	TestTrue(TEXT("Capabilities kept"), Info->ClientCapabilities.IsValid() && Info->ClientCapabilities->HasField(TEXT("roots")));
+	TestEqual(TEXT("Request count"), Info->RequestCount, static_cast<int64>(2));
+	TestEqual(TEXT("Tool call count"), Info->ToolCallCount, static_cast<int64>(3));
+	TestEqual(TEXT("In-flight request listed"), Info->InFlightRequestIds.Num(), 1);
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
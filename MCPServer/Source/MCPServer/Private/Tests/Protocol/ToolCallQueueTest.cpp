@@ -0,0 +1,636 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Protocol/MCPJsonRpc.h"
+#include "Protocol/MCPSessionManager.h"
+#include "Protocol/MCPRateLimiter.h"
+#include "Tools/MCPToolRegistry.h"
+#include "Tools/MCPToolCallQueue.h"
+#include "Tools/MCPBatchToolTask.h"
+#include "Tools/Interfaces/IMCPTool.h"
+#include "Tools/Interfaces/IMCPToolTask.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Counting tool for queue tests */
+class FQueueTestTool : public IMCPTool
+{
+public:
+	int32 ExecuteCount = 0;
+	/** Called from Execute, so a test can look at other state while the call runs */
+	TFunction<void()> OnExecute;
+
+	virtual FString GetName() const override { return TEXT("queue_test"); }
+	virtual FString GetDescription() const override { return TEXT("Counting tool for queue tests"); }
+	virtual TSharedPtr<FJsonObject> GetInputSchema() const override
+	{
+		auto Schema = MakeShared<FJsonObject>();
+		Schema->SetStringField(TEXT("type"), TEXT("object"));
+		return Schema;
+	}
+	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override
+	{
+		ExecuteCount++;
+		if (OnExecute)
+		{
+			OnExecute();
+		}
+		auto Result = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> ContentArray;
+		auto TextContent = MakeShared<FJsonObject>();
+		TextContent->SetStringField(TEXT("type"), TEXT("text"));
+		TextContent->SetStringField(TEXT("text"), TEXT("queued_ok"));
+		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+		Result->SetArrayField(TEXT("content"), ContentArray);
+		Result->SetBoolField(TEXT("isError"), false);
+		return Result;
+	}
+};
+
+/** Task that completes one unit of work per tick */
+class FQueueTestTask : public IMCPToolTask
+{
+public:
+	explicit FQueueTestTask(int32 InTotal) : Total(InTotal) {}
+
+	virtual bool Tick(double EndTimeSeconds) override
+	{
+		Progress++;
+		return Progress >= Total;
+	}
+	virtual int32 GetProgress() const override { return Progress; }
+	virtual int32 GetTotal() const override { return Total; }
+	virtual TSharedPtr<FJsonObject> GetResult() const override
+	{
+		auto Result = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> ContentArray;
+		auto TextContent = MakeShared<FJsonObject>();
+		TextContent->SetStringField(TEXT("type"), TEXT("text"));
+		TextContent->SetStringField(TEXT("text"), TEXT("task_ok"));
+		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+		Result->SetArrayField(TEXT("content"), ContentArray);
+		Result->SetBoolField(TEXT("isError"), false);
+		return Result;
+	}
+
+private:
+	int32 Total = 0;
+	int32 Progress = 0;
+};
+
+/** Incremental tool for queue tests */
+class FQueueTestTaskTool : public IMCPTool
+{
+public:
+	virtual FString GetName() const override { return TEXT("queue_task_test"); }
+	virtual FString GetDescription() const override { return TEXT("Incremental tool for queue tests"); }
+	virtual TSharedPtr<FJsonObject> GetInputSchema() const override
+	{
+		auto Schema = MakeShared<FJsonObject>();
+		Schema->SetStringField(TEXT("type"), TEXT("object"));
+		return Schema;
+	}
+	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override
+	{
+		return nullptr;
+	}
+	virtual TSharedPtr<IMCPToolTask> StartTask(const TSharedPtr<FJsonObject>& Arguments) override
+	{
+		return MakeShared<FQueueTestTask>(3);
+	}
+};
+
+/** Build-lane tool for queue tests */
+class FQueueTestBuildTool : public FQueueTestTool
+{
+public:
+	virtual FString GetName() const override { return TEXT("queue_build_test"); }
+	virtual EMCPToolPriority GetPriority() const override { return EMCPToolPriority::Build; }
+};
+
+/** Mutating bulk-lane tool for queue tests */
+class FQueueTestBulkTool : public FQueueTestTool
+{
+public:
+	virtual FString GetName() const override { return TEXT("queue_bulk_test"); }
+	virtual EMCPToolPriority GetPriority() const override { return EMCPToolPriority::Bulk; }
+};
+
+/** Bulk batch tool counting how often its module batch is opened and closed */
+class FQueueTestBatchTool : public IMCPTool
+{
+public:
+	int32 BeginCount = 0;
+	int32 EndCount = 0;
+	int32 OperationsInBatch = 0;
+
+	bool IsBatchOpen() const { return BeginCount > EndCount; }
+
+	virtual FString GetName() const override { return TEXT("queue_batch_test"); }
+	virtual FString GetDescription() const override { return TEXT("Batch tool for queue tests"); }
+	virtual TSharedPtr<FJsonObject> GetInputSchema() const override
+	{
+		auto Schema = MakeShared<FJsonObject>();
+		Schema->SetStringField(TEXT("type"), TEXT("object"));
+		return Schema;
+	}
+	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override
+	{
+		return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+	}
+	virtual TSharedPtr<IMCPToolTask> StartTask(const TSharedPtr<FJsonObject>& Arguments) override
+	{
+		TArray<TSharedPtr<FJsonValue>> Operations;
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			Operations.Add(MakeShared<FJsonValueNumber>(Index));
+		}
+		return MakeShared<FMCPBatchToolTask>(TEXT("Batch completed"), Operations,
+			[this](const TSharedPtr<FJsonValue>& Operation, FString& OutError)
+			{
+				OperationsInBatch += IsBatchOpen() ? 1 : 0;
+				return true;
+			},
+			[this]() { BeginCount++; },
+			[this]() { EndCount++; });
+	}
+	virtual EMCPToolPriority GetPriority() const override { return EMCPToolPriority::Bulk; }
+};
+
+namespace ToolCallQueueTestHelpers
+{
+	struct FTestContext
+	{
+		TSharedRef<FQueueTestTool> Tool = MakeShared<FQueueTestTool>();
+		TSharedRef<FQueueTestBuildTool> BuildTool = MakeShared<FQueueTestBuildTool>();
+		TSharedRef<FQueueTestBulkTool> BulkTool = MakeShared<FQueueTestBulkTool>();
+		TSharedRef<FQueueTestBatchTool> BatchTool = MakeShared<FQueueTestBatchTool>();
+		FMCPToolRegistry Registry;
+		FMCPSessionManager SessionManager;
+		TUniquePtr<FMCPToolCallQueue> Queue;
+		TUniquePtr<FMCPJsonRpc> JsonRpc;
+
+		FTestContext()
+		{
+			Registry.RegisterTool(Tool);
+			Registry.RegisterTool(MakeShared<FQueueTestTaskTool>());
+			Registry.RegisterTool(BuildTool);
+			Registry.RegisterTool(BulkTool);
+			Registry.RegisterTool(BatchTool);
+			Queue = MakeUnique<FMCPToolCallQueue>(Registry);
+			JsonRpc = MakeUnique<FMCPJsonRpc>(Registry, SessionManager, Queue.Get());
+		}
+	};
+
+	struct FCapturedResponse
+	{
+		bool bCompleted = false;
+		FString Response;
+		int32 HttpCode = 0;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueExecuteTest,
+	"MCPServer.Protocol.ToolCallQueue.Execute",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueExecuteTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+	TSharedPtr<FJsonObject> CapturedResult;
+	bool bCompleted = false;
+
+	Ctx.Queue->Enqueue(TEXT("queue_test"), MakeShared<FJsonObject>(),
+		[&CapturedResult, &bCompleted](const TSharedPtr<FJsonObject>& ToolResult)
+		{
+			CapturedResult = ToolResult;
+			bCompleted = true;
+		});
+
+	TestEqual(TEXT("Queued call is pending"), Ctx.Queue->GetQueueDepth(), 1);
+	TestFalse(TEXT("Not executed before processing"), bCompleted);
+	TestEqual(TEXT("Per-tool queue depth"), Ctx.Queue->GetToolStats()[TEXT("queue_test")].QueueDepth, 1);
+
+	TestEqual(TEXT("One call executed"), Ctx.Queue->ProcessQueue(1.0), 1);
+	TestTrue(TEXT("Completion fired"), bCompleted);
+	TestTrue(TEXT("Result valid"), CapturedResult.IsValid());
+	TestEqual(TEXT("Queue drained"), Ctx.Queue->GetQueueDepth(), 0);
+
+	const FMCPToolQueueStats Stats = Ctx.Queue->GetToolStats()[TEXT("queue_test")];
+	TestEqual(TEXT("Completed count"), Stats.CompletedCount, (int64)1);
+	TestEqual(TEXT("Queue depth after"), Stats.QueueDepth, 0);
+	TestTrue(TEXT("Wait time recorded"), Stats.TotalWaitSeconds >= 0.0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueTimeSliceTest,
+	"MCPServer.Protocol.ToolCallQueue.TimeSlice",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueTimeSliceTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		Ctx.Queue->Enqueue(TEXT("queue_test"), MakeShared<FJsonObject>(), nullptr);
+	}
+
+	TestEqual(TEXT("Zero budget still executes one call"), Ctx.Queue->ProcessQueue(0.0), 1);
+	TestEqual(TEXT("Two calls left"), Ctx.Queue->GetQueueDepth(), 2);
+	TestEqual(TEXT("Remaining calls executed"), Ctx.Queue->ProcessQueue(1.0), 2);
+	TestEqual(TEXT("Tool executed three times"), Ctx.Tool->ExecuteCount, 3);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueAsyncPingTest,
+	"MCPServer.Protocol.ToolCallQueue.AsyncPingNotQueued",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueAsyncPingTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+	ToolCallQueueTestHelpers::FCapturedResponse Captured;
+
+	// A pending tool call must not delay ping
+	Ctx.Queue->Enqueue(TEXT("queue_test"), MakeShared<FJsonObject>(), nullptr);
+	Ctx.JsonRpc->ProcessMessageAsync(TEXT("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"ping\"}"), TEXT(""),
+		[&Captured](const FString& Response, const FString& NewSessionId, int32 HttpCode)
+		{
+			Captured.bCompleted = true;
+			Captured.Response = Response;
+			Captured.HttpCode = HttpCode;
+		});
+
+	TestTrue(TEXT("Ping answered immediately"), Captured.bCompleted);
+	TestEqual(TEXT("HTTP 200"), Captured.HttpCode, 200);
+	TestEqual(TEXT("Tool call still pending"), Ctx.Queue->GetQueueDepth(), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueAsyncToolsCallTest,
+	"MCPServer.Protocol.ToolCallQueue.AsyncToolsCall",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueAsyncToolsCallTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+	ToolCallQueueTestHelpers::FCapturedResponse Captured;
+
+	Ctx.JsonRpc->ProcessMessageAsync(
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"tools/call\",\"params\":{\"name\":\"queue_test\",\"arguments\":{}}}"),
+		TEXT(""),
+		[&Captured](const FString& Response, const FString& NewSessionId, int32 HttpCode)
+		{
+			Captured.bCompleted = true;
+			Captured.Response = Response;
+			Captured.HttpCode = HttpCode;
+		});
+
+	TestFalse(TEXT("Deferred until the queue runs"), Captured.bCompleted);
+	TestEqual(TEXT("Tool not yet executed"), Ctx.Tool->ExecuteCount, 0);
+
+	Ctx.Queue->ProcessQueue(1.0);
+
+	TestTrue(TEXT("Completed after processing"), Captured.bCompleted);
+	TestEqual(TEXT("HTTP 200"), Captured.HttpCode, 200);
+	TestTrue(TEXT("Contains tool output"), Captured.Response.Contains(TEXT("queued_ok")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueAsyncBatchTest,
+	"MCPServer.Protocol.ToolCallQueue.AsyncBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueAsyncBatchTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+	ToolCallQueueTestHelpers::FCapturedResponse Captured;
+
+	Ctx.JsonRpc->ProcessMessageAsync(
+		TEXT("[{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"ping\"},")
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"tools/call\",\"params\":{\"name\":\"queue_test\"}},")
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":3,\"method\":\"tools/call\",\"params\":{\"name\":\"nonexistent\"}}]"),
+		TEXT(""),
+		[&Captured](const FString& Response, const FString& NewSessionId, int32 HttpCode)
+		{
+			Captured.bCompleted = true;
+			Captured.Response = Response;
+			Captured.HttpCode = HttpCode;
+		});
+
+	TestFalse(TEXT("Batch waits for the queued call"), Captured.bCompleted);
+	Ctx.Queue->ProcessQueue(1.0);
+	TestTrue(TEXT("Batch completed"), Captured.bCompleted);
+
+	TSharedPtr<FJsonValue> Parsed;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Captured.Response);
+	FJsonSerializer::Deserialize(Reader, Parsed);
+	TestTrue(TEXT("Response is array"), Parsed.IsValid() && Parsed->Type == EJson::Array);
+	TestEqual(TEXT("Three responses in request order"), Parsed->AsArray().Num(), 3);
+
+	double FirstId = 0.0;
+	Parsed->AsArray()[0]->AsObject()->TryGetNumberField(TEXT("id"), FirstId);
+	TestEqual(TEXT("First response is ping"), FirstId, 1.0);
+	TestTrue(TEXT("Unknown tool answered with error"), Parsed->AsArray()[2]->AsObject()->HasField(TEXT("error")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueTaskSlicesTest,
+	"MCPServer.Protocol.ToolCallQueue.TaskSlices",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueTaskSlicesTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+	TArray<int32> ReportedProgress;
+	bool bTaskCompleted = false;
+
+	Ctx.Queue->Enqueue(TEXT("queue_task_test"), MakeShared<FJsonObject>(),
+		[&bTaskCompleted](const TSharedPtr<FJsonObject>& ToolResult)
+		{
+			bTaskCompleted = ToolResult.IsValid();
+		},
+		[&ReportedProgress](int32 Progress, int32 Total)
+		{
+			ReportedProgress.Add(Progress);
+		});
+	Ctx.Queue->Enqueue(TEXT("queue_test"), MakeShared<FJsonObject>(), nullptr);
+
+	// The cheap call completes in the first tick while the task keeps running
+	TestEqual(TEXT("Cheap call completed"), Ctx.Queue->ProcessQueue(1.0), 1);
+	TestEqual(TEXT("Cheap tool executed"), Ctx.Tool->ExecuteCount, 1);
+	TestEqual(TEXT("Task still running"), Ctx.Queue->GetActiveTaskCount(), 1);
+	TestEqual(TEXT("Running task counts as queued"), Ctx.Queue->GetQueueDepth(), 1);
+	TestFalse(TEXT("Task not completed"), bTaskCompleted);
+
+	Ctx.Queue->ProcessQueue(1.0);
+	TestEqual(TEXT("Task completes on third tick"), Ctx.Queue->ProcessQueue(1.0), 1);
+	TestTrue(TEXT("Task completed"), bTaskCompleted);
+	TestEqual(TEXT("Queue drained"), Ctx.Queue->GetQueueDepth(), 0);
+	TestEqual(TEXT("Progress reported per slice"), ReportedProgress.Num(), 3);
+	TestEqual(TEXT("Last progress"), ReportedProgress.Last(), 3);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueProgressNotificationTest,
+	"MCPServer.Protocol.ToolCallQueue.ProgressNotification",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueProgressNotificationTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+	ToolCallQueueTestHelpers::FCapturedResponse Captured;
+	TArray<FString> Notifications;
+
+	Ctx.JsonRpc->ProcessMessageAsync(
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":4,\"method\":\"tools/call\",\"params\":{\"name\":\"queue_task_test\",\"_meta\":{\"progressToken\":\"tok-1\"}}}"),
+		TEXT(""),
+		[&Captured](const FString& Response, const FString& NewSessionId, int32 HttpCode)
+		{
+			Captured.bCompleted = true;
+			Captured.Response = Response;
+			Captured.HttpCode = HttpCode;
+		},
+		[&Notifications](const FString& Notification)
+		{
+			Notifications.Add(Notification);
+		});
+
+	for (int32 TickIndex = 0; TickIndex < 3; ++TickIndex)
+	{
+		Ctx.Queue->ProcessQueue(1.0);
+	}
+
+	TestTrue(TEXT("Completed"), Captured.bCompleted);
+	TestTrue(TEXT("Contains task output"), Captured.Response.Contains(TEXT("task_ok")));
+	TestEqual(TEXT("One notification per slice"), Notifications.Num(), 3);
+	if (Notifications.Num() > 0)
+	{
+		TestTrue(TEXT("Progress method"), Notifications[0].Contains(TEXT("notifications/progress")));
+		TestTrue(TEXT("Echoes progress token"), Notifications[0].Contains(TEXT("tok-1")));
+	}
+
+	// Without a progress token no notifications are produced
+	Notifications.Reset();
+	Ctx.JsonRpc->ProcessMessageAsync(
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":5,\"method\":\"tools/call\",\"params\":{\"name\":\"queue_task_test\"}}"),
+		TEXT(""),
+		[](const FString& Response, const FString& NewSessionId, int32 HttpCode) {},
+		[&Notifications](const FString& Notification)
+		{
+			Notifications.Add(Notification);
+		});
+	for (int32 TickIndex = 0; TickIndex < 3; ++TickIndex)
+	{
+		Ctx.Queue->ProcessQueue(1.0);
+	}
+	TestEqual(TEXT("No notifications without token"), Notifications.Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueLanesTest,
+	"MCPServer.Protocol.ToolCallQueue.Lanes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueLanesTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+
+	// A build queued first still runs after the interactive call
+	Ctx.Queue->Enqueue(TEXT("queue_build_test"), MakeShared<FJsonObject>(), nullptr);
+	Ctx.Queue->Enqueue(TEXT("queue_test"), MakeShared<FJsonObject>(), nullptr);
+
+	TestEqual(TEXT("Build lane pending"), Ctx.Queue->GetPendingCount(EMCPToolPriority::Build), 1);
+	TestEqual(TEXT("Interactive lane pending"), Ctx.Queue->GetPendingCount(EMCPToolPriority::Interactive), 1);
+
+	TestEqual(TEXT("Zero budget executes one call"), Ctx.Queue->ProcessQueue(0.0), 1);
+	TestEqual(TEXT("Interactive call ran first"), Ctx.Tool->ExecuteCount, 1);
+	TestEqual(TEXT("Build call still waiting"), Ctx.BuildTool->ExecuteCount, 0);
+
+	Ctx.Queue->ProcessQueue(0.0);
+	TestEqual(TEXT("Build call ran next"), Ctx.BuildTool->ExecuteCount, 1);
+	TestEqual(TEXT("Queue drained"), Ctx.Queue->GetQueueDepth(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueRateLimitTest,
+	"MCPServer.Protocol.ToolCallQueue.RateLimit",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueRateLimitTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+
+	FMCPRateLimits Limits;
+	Limits.Lanes[static_cast<int32>(EMCPToolPriority::Build)].CallsPerSecond = 0.01;
+	Limits.Lanes[static_cast<int32>(EMCPToolPriority::Build)].Burst = 1.0;
+	FMCPRateLimiter RateLimiter(Limits);
+	FMCPJsonRpc LimitedJsonRpc(Ctx.Registry, Ctx.SessionManager, Ctx.Queue.Get(), &RateLimiter);
+
+	TArray<ToolCallQueueTestHelpers::FCapturedResponse> Captured;
+	Captured.SetNum(3);
+	const TCHAR* Messages[] = {
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"tools/call\",\"params\":{\"name\":\"queue_build_test\"}}"),
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"tools/call\",\"params\":{\"name\":\"queue_build_test\"}}"),
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":3,\"method\":\"tools/call\",\"params\":{\"name\":\"queue_test\"}}")
+	};
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		ToolCallQueueTestHelpers::FCapturedResponse& Slot = Captured[Index];
+		LimitedJsonRpc.ProcessMessageAsync(Messages[Index], TEXT(""),
+			[&Slot](const FString& Response, const FString& NewSessionId, int32 HttpCode)
+			{
+				Slot.bCompleted = true;
+				Slot.Response = Response;
+				Slot.HttpCode = HttpCode;
+			});
+	}
+
+	// The second build is refused at once; the interactive lane is unaffected
+	TestTrue(TEXT("Second build refused immediately"), Captured[1].bCompleted);
+	TestEqual(TEXT("Refused with HTTP 429"), Captured[1].HttpCode, 429);
+	TestTrue(TEXT("Refusal carries retryAfterSeconds"), Captured[1].Response.Contains(TEXT("retryAfterSeconds")));
+	TestEqual(TEXT("Two calls queued"), Ctx.Queue->GetQueueDepth(), 2);
+
+	Ctx.Queue->ProcessQueue(1.0);
+	TestEqual(TEXT("First build answered"), Captured[0].HttpCode, 200);
+	TestEqual(TEXT("Interactive call answered"), Captured[2].HttpCode, 200);
+	TestEqual(TEXT("Build tool ran once"), Ctx.BuildTool->ExecuteCount, 1);
+
+	const FMCPLaneAdmissionStats BuildStats = RateLimiter.GetLaneStats(EMCPToolPriority::Build);
+	TestEqual(TEXT("Build admitted"), BuildStats.Admitted, (int64)1);
+	TestEqual(TEXT("Build rate limited"), BuildStats.RateLimited, (int64)1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueBatchOverCapTest,
+	"MCPServer.Protocol.ToolCallQueue.BatchOverCap",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueBatchOverCapTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+
+	// Generous rate limit, so only the queue limit refuses calls
+	FMCPRateLimits Limits;
+	Limits.Lanes[static_cast<int32>(EMCPToolPriority::Build)].CallsPerSecond = 100.0;
+	Limits.Lanes[static_cast<int32>(EMCPToolPriority::Build)].Burst = 10.0;
+	Limits.Lanes[static_cast<int32>(EMCPToolPriority::Build)].MaxQueuedCalls = 2;
+	FMCPRateLimiter RateLimiter(Limits);
+	FMCPJsonRpc LimitedJsonRpc(Ctx.Registry, Ctx.SessionManager, Ctx.Queue.Get(), &RateLimiter);
+
+	// One batch with twice as many build calls as the lane may queue
+	ToolCallQueueTestHelpers::FCapturedResponse Captured;
+	LimitedJsonRpc.ProcessMessageAsync(
+		TEXT("[")
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":1,\"method\":\"tools/call\",\"params\":{\"name\":\"queue_build_test\"}},")
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":2,\"method\":\"tools/call\",\"params\":{\"name\":\"queue_build_test\"}},")
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":3,\"method\":\"tools/call\",\"params\":{\"name\":\"queue_build_test\"}},")
+		TEXT("{\"jsonrpc\":\"2.0\",\"id\":4,\"method\":\"tools/call\",\"params\":{\"name\":\"queue_build_test\"}}")
+		TEXT("]"),
+		TEXT(""),
+		[&Captured](const FString& Response, const FString& NewSessionId, int32 HttpCode)
+		{
+			Captured.bCompleted = true;
+			Captured.Response = Response;
+			Captured.HttpCode = HttpCode;
+		});
+
+	TestEqual(TEXT("Only the lane limit is queued"), Ctx.Queue->GetPendingCount(EMCPToolPriority::Build), 2);
+
+	for (int32 Pass = 0; Pass < 10 && !Captured.bCompleted; ++Pass)
+	{
+		Ctx.Queue->ProcessQueue(1.0);
+	}
+	if (!TestTrue(TEXT("Batch answered"), Captured.bCompleted))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Admitted builds ran"), Ctx.BuildTool->ExecuteCount, 2);
+
+	int32 RefusedCount = 0;
+	for (int32 Found = Captured.Response.Find(TEXT("Too many queued")); Found != INDEX_NONE;
+		Found = Captured.Response.Find(TEXT("Too many queued"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Found + 1))
+	{
+		RefusedCount++;
+	}
+	TestEqual(TEXT("Calls over the limit refused"), RefusedCount, 2);
+
+	const FMCPLaneAdmissionStats BuildStats = RateLimiter.GetLaneStats(EMCPToolPriority::Build);
+	TestEqual(TEXT("Build admitted"), BuildStats.Admitted, (int64)2);
+	TestEqual(TEXT("Build queue full"), BuildStats.QueueFull, (int64)2);
+	TestEqual(TEXT("Build not rate limited"), BuildStats.RateLimited, (int64)0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueBatchPerSliceTest,
+	"MCPServer.Protocol.ToolCallQueue.BatchPerSlice",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueBatchPerSliceTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+	bool bBatchCompleted = false;
+
+	Ctx.Queue->Enqueue(TEXT("queue_batch_test"), MakeShared<FJsonObject>(),
+		[&bBatchCompleted](const TSharedPtr<FJsonObject>& ToolResult)
+		{
+			bBatchCompleted = ToolResult.IsValid();
+		});
+	Ctx.Queue->Enqueue(TEXT("queue_bulk_test"), MakeShared<FJsonObject>(), nullptr);
+
+	// With a zero budget the batch runs one operation per tick and closes its batch every time
+	Ctx.Queue->ProcessQueue(0.0);
+	TestFalse(TEXT("Batch closed after the first slice"), Ctx.BatchTool->IsBatchOpen());
+	Ctx.Queue->ProcessQueue(0.0);
+	TestEqual(TEXT("One batch per slice"), Ctx.BatchTool->BeginCount, 2);
+	TestFalse(TEXT("Batch closed after the second slice"), Ctx.BatchTool->IsBatchOpen());
+	TestEqual(TEXT("Bulk call waits for the running batch"), Ctx.BulkTool->ExecuteCount, 0);
+	TestEqual(TEXT("Bulk call still pending"), Ctx.Queue->GetPendingCount(EMCPToolPriority::Bulk), 1);
+
+	// Calls of other lanes run between slices, outside the batch
+	bool bRanInsideBatch = false;
+	Ctx.Tool->OnExecute = [&Ctx, &bRanInsideBatch]() { bRanInsideBatch |= Ctx.BatchTool->IsBatchOpen(); };
+	Ctx.Queue->Enqueue(TEXT("queue_test"), MakeShared<FJsonObject>(), nullptr);
+	Ctx.Queue->ProcessQueue(0.0);
+	TestEqual(TEXT("Interactive call ran between slices"), Ctx.Tool->ExecuteCount, 1);
+	TestFalse(TEXT("Interactive call ran outside the batch"), bRanInsideBatch);
+
+	TestTrue(TEXT("Batch completed"), bBatchCompleted);
+	TestEqual(TEXT("Begin for every slice"), Ctx.BatchTool->BeginCount, 3);
+	TestEqual(TEXT("End for every slice"), Ctx.BatchTool->EndCount, 3);
+	TestEqual(TEXT("Every operation ran inside a batch"), Ctx.BatchTool->OperationsInBatch, 3);
+
+	Ctx.Queue->ProcessQueue(0.0);
+	TestEqual(TEXT("Bulk call runs after the batch finished"), Ctx.BulkTool->ExecuteCount, 1);
+	TestEqual(TEXT("Queue drained"), Ctx.Queue->GetQueueDepth(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolCallQueueBatchStopTest,
+	"MCPServer.Protocol.ToolCallQueue.BatchStop",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolCallQueueBatchStopTest::RunTest(const FString& Parameters)
+{
+	ToolCallQueueTestHelpers::FTestContext Ctx;
+
+	Ctx.Queue->Enqueue(TEXT("queue_batch_test"), MakeShared<FJsonObject>(), nullptr);
+	Ctx.Queue->ProcessQueue(0.0);
+	TestEqual(TEXT("Batch task running"), Ctx.Queue->GetActiveTaskCount(), 1);
+	TestFalse(TEXT("No batch left open while the task waits"), Ctx.BatchTool->IsBatchOpen());
+
+	Ctx.Queue->Stop();
+	TestEqual(TEXT("Task dropped"), Ctx.Queue->GetActiveTaskCount(), 0);
+
+	// The bulk lane is free again after the stop
+	Ctx.Queue->Enqueue(TEXT("queue_bulk_test"), MakeShared<FJsonObject>(), nullptr);
+	Ctx.Queue->ProcessQueue(0.0);
+	TestEqual(TEXT("Bulk call runs after stop"), Ctx.BulkTool->ExecuteCount, 1);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -127,4 +127,42 @@ bool FToolRegistryDuplicateTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FToolRegistryToolsListCacheTest,
+	"MCPServer.Protocol.ToolRegistry.ToolsListCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FToolRegistryToolsListCacheTest::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	int32 ChangeCount = 0;
+	Registry.OnToolsListChanged().AddLambda([&ChangeCount]() { ChangeCount++; });
+
+	Registry.RegisterTool(MakeShared<FTestTool>(TEXT("tool_a")));
+	TestEqual(TEXT("RegisterTool broadcasts a change"), ChangeCount, 1);
+
+	auto GetToolsJson = [&Registry]()
+	{
+		const TArray<uint8>& Utf8Json = Registry.GetToolsListJson();
+		FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Utf8Json.GetData()), Utf8Json.Num());
+		return FString(Converter.Length(), Converter.Get());
+	};
+
+	const FString FirstJson = GetToolsJson();
+	const FString FirstETag = Registry.GetToolsListETag();
+	TestTrue(TEXT("JSON contains the tool"), FirstJson.Contains(TEXT("\"tool_a\"")));
+	TestTrue(TEXT("ETag is quoted"), FirstETag.StartsWith(TEXT("\"")) && FirstETag.EndsWith(TEXT("\"")));
+	TestEqual(TEXT("ETag is stable while the list is unchanged"), Registry.GetToolsListETag(), FirstETag);
+	TestEqual(TEXT("Cached list is reused"), &Registry.GetToolsList(), &Registry.GetToolsList());
+
+	Registry.RegisterTool(MakeShared<FTestTool>(TEXT("tool_b")));
+	TestEqual(TEXT("Second registration broadcasts"), ChangeCount, 2);
+	TestNotEqual(TEXT("ETag changes after RegisterTool"), Registry.GetToolsListETag(), FirstETag);
+	TestTrue(TEXT("JSON contains the new tool"), GetToolsJson().Contains(TEXT("\"tool_b\"")));
+	TestEqual(TEXT("List has both tools"), Registry.GetToolsList().Num(), 2);
+
+	Registry.RegisterTool(nullptr);
+	TestEqual(TEXT("Null registration does not broadcast"), ChangeCount, 2);
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,214 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/Scaling/ScalingTestFixtures.h"
+#include "Modules/Impl/ActorImplModule.h"
+#include "Modules/Impl/EditorBatchImplModule.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ActorScalingTestPrivate
+{
+	using namespace MCPScalingTest;
+
+	constexpr int32 BaselineActors = 1000;
+	constexpr int32 LookupCalls = 2000;
+	constexpr int32 PageCalls = 20;
+	constexpr int32 PageSize = 100;
+	constexpr int32 NearestCount = 8;
+	constexpr int32 MovesPerSync = 4;
+	constexpr int32 SpawnCount = 2000;
+	const TCHAR* const SpawnClassPath = TEXT("/Script/Engine.StaticMeshActor");
+
+	struct FActorSamples
+	{
+		FScalingSample FindByLabel;
+		FScalingSample TransformByName;
+		FScalingSample ListPage;
+		FScalingSample Nearest;
+		FScalingSample PropertiesBulk;
+		FScalingSample LevelChanges;
+		int32 Misses = 0;
+	};
+
+	FActorSamples MeasureActorModule(int32 ActorCount)
+	{
+		FScalingWorld World;
+		FActorFixture Fixture(World.GetWorld(), ActorCount, GetSeed());
+		FEditorBatchImplModule EditorBatch;
+		FActorImplModule ActorModule(EditorBatch);
+
+		FActorSamples Samples;
+		const int32 Spawned = Fixture.Labels.Num();
+		FRandomStream Stream(GetSeed());
+
+		Samples.FindByLabel = Measure(Spawned, LookupCalls, [&](int32 CallIndex)
+		{
+			Samples.Misses += ActorModule.FindActor(Fixture.Labels[Stream.RandHelper(Spawned)]) ? 0 : 1;
+		});
+
+		Samples.TransformByName = Measure(Spawned, LookupCalls, [&](int32 CallIndex)
+		{
+			Samples.Misses += ActorModule.GetActorTransform(Fixture.Names[Stream.RandHelper(Spawned)]).bSuccess ? 0 : 1;
+		});
+
+		// Listing walks the level once per page, so it is budgeted as linear
+		Samples.ListPage = Measure(Spawned, PageCalls, [&](int32 CallIndex)
+		{
+			FActorQuery Query;
+			Query.FolderFilter = TEXT("Scaling/Props");
+			Query.Offset = Stream.RandHelper(FMath::Max(1, Spawned / 4));
+			Query.Limit = PageSize;
+			Samples.Misses += ActorModule.GetActorsInLevel(Query).bSuccess ? 0 : 1;
+		});
+
+		// Served from the actor octree, so only the handful of nodes around the point are visited
+		Samples.Nearest = Measure(Spawned, LookupCalls, [&](int32 CallIndex)
+		{
+			FActorSpatialQuery Query;
+			Query.Shape = EActorSpatialShape::Nearest;
+			Query.Center = FVector(Stream.FRandRange(-100000.0, 100000.0), Stream.FRandRange(-100000.0, 100000.0), 0.0);
+			Query.Count = NearestCount;
+			const FActorSpatialQueryResult Result = ActorModule.QueryActorsSpatial(Query);
+			Samples.Misses += Result.bSuccess && Result.Actors.Num() == NearestCount ? 0 : 1;
+		});
+
+		// A fixed set of rows and columns: cost follows the cells read, not the level size
+		Samples.PropertiesBulk = Measure(Spawned, PageCalls, [&](int32 CallIndex)
+		{
+			FActorPropertiesBulkQuery Query;
+			Query.PropertyPaths = { TEXT("bHidden"), TEXT("RootComponent.Mobility"), TEXT("RootComponent.RelativeScale3D.X") };
+			for (int32 Row = 0; Row < PageSize; ++Row)
+			{
+				Query.ActorIdentifiers.Add(Fixture.Names[Stream.RandHelper(Spawned)]);
+			}
+			const FActorPropertiesBulkResult Result = ActorModule.GetActorPropertiesBulk(Query);
+			Samples.Misses += Result.bSuccess && Result.MissingActors.IsEmpty() ? 0 : 1;
+		});
+
+		// Each sync reads back only the few actors moved since the previous token
+		FString ChangeToken = ActorModule.GetLevelChanges(FString()).Token;
+		Samples.LevelChanges = Measure(Spawned, LookupCalls, [&](int32 CallIndex)
+		{
+			for (int32 Move = 0; Move < MovesPerSync; ++Move)
+			{
+				const FVector Location(Stream.FRandRange(-100000.0, 100000.0), Stream.FRandRange(-100000.0, 100000.0), 0.0);
+				ActorModule.SetActorTransform(Fixture.Names[Stream.RandHelper(Spawned)], &Location);
+			}
+			const FLevelChangesResult Result = ActorModule.GetLevelChanges(ChangeToken);
+			Samples.Misses += Result.bSuccess && !Result.bReset && Result.Changes.Num() >= 1 && Result.Changes.Num() <= MovesPerSync ? 0 : 1;
+			ChangeToken = Result.Token;
+		});
+
+		return Samples;
+	}
+
+	void RunActorScalingTest(FAutomationTestBase& Test, int32 ActorCount)
+	{
+		const FActorSamples Baseline = MeasureActorModule(BaselineActors);
+		const FActorSamples Scaled = MeasureActorModule(ActorCount);
+
+		Test.TestEqual(TEXT("Baseline lookups all hit"), Baseline.Misses, 0);
+		Test.TestEqual(TEXT("Scaled lookups all hit"), Scaled.Misses, 0);
+		Test.TestEqual(TEXT("Every actor spawned"), Scaled.FindByLabel.Size, ActorCount);
+
+		TestScalingBudget(Test, TEXT("FindActor by label"), Baseline.FindByLabel, Scaled.FindByLabel, EScalingBudget::Constant);
+		TestScalingBudget(Test, TEXT("GetActorTransform by name"), Baseline.TransformByName, Scaled.TransformByName, EScalingBudget::Constant);
+		TestScalingBudget(Test, TEXT("GetActorsInLevel folder page"), Baseline.ListPage, Scaled.ListPage, EScalingBudget::Linear);
+		TestScalingBudget(Test, TEXT("QueryActorsSpatial nearest"), Baseline.Nearest, Scaled.Nearest, EScalingBudget::Constant);
+		TestScalingBudget(Test, TEXT("GetActorPropertiesBulk by name"), Baseline.PropertiesBulk, Scaled.PropertiesBulk, EScalingBudget::Constant);
+		TestScalingBudget(Test, TEXT("GetLevelChanges after moves"), Baseline.LevelChanges, Scaled.LevelChanges, EScalingBudget::Constant);
+	}
+
+	/** Seconds per actor spawned one call at a time, or in a single SpawnActorsBatch call */
+	double MeasureSpawnSeconds(bool bBatch, int32& OutSpawned)
+	{
+		FScalingWorld World;
+		FEditorBatchImplModule EditorBatch;
+		FActorImplModule ActorModule(EditorBatch);
+		FRandomStream Stream(GetSeed());
+
+		TArray<FTransform> Transforms;
+		for (int32 Index = 0; Index < SpawnCount; ++Index)
+		{
+			Transforms.Add(FTransform(FVector(Stream.FRandRange(-100000.0, 100000.0), Stream.FRandRange(-100000.0, 100000.0), 0.0)));
+		}
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		OutSpawned = 0;
+		if (bBatch)
+		{
+			FActorSpawnBatchRequest Request;
+			Request.ClassPaths.Add(SpawnClassPath);
+			for (const FTransform& Transform : Transforms)
+			{
+				Request.Items.Add({ 0, Transform });
+			}
+			OutSpawned = ActorModule.SpawnActorsBatch(Request).SpawnedCount;
+		}
+		else
+		{
+			for (const FTransform& Transform : Transforms)
+			{
+				OutSpawned += ActorModule.SpawnActor(SpawnClassPath, Transform.GetLocation(), Transform.Rotator()).bSuccess ? 1 : 0;
+			}
+		}
+		return (FPlatformTime::Seconds() - StartSeconds) / SpawnCount;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorScaling10kTest,
+	"MCPServer.Scaling.Actors.10k",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FActorScaling10kTest::RunTest(const FString& Parameters)
+{
+	ActorScalingTestPrivate::RunActorScalingTest(*this, 10000);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorScaling100kTest,
+	"MCPServer.Scaling.Actors.100k",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FActorScaling100kTest::RunTest(const FString& Parameters)
+{
+	ActorScalingTestPrivate::RunActorScalingTest(*this, 100000);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorScaling500kTest,
+	"MCPServer.Scaling.Actors.500k",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FActorScaling500kTest::RunTest(const FString& Parameters)
+{
+	ActorScalingTestPrivate::RunActorScalingTest(*this, 500000);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorScalingSpawnBatchTest,
+	"MCPServer.Scaling.Actors.SpawnBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FActorScalingSpawnBatchTest::RunTest(const FString& Parameters)
+{
+	using namespace ActorScalingTestPrivate;
+
+	int32 SingleSpawned = 0;
+	int32 BatchSpawned = 0;
+	const double SingleSeconds = MeasureSpawnSeconds(false, SingleSpawned);
+	const double BatchSeconds = MeasureSpawnSeconds(true, BatchSpawned);
+
+	TestEqual(TEXT("Every single spawn succeeds"), SingleSpawned, SpawnCount);
+	TestEqual(TEXT("Every batch spawn succeeds"), BatchSpawned, SpawnCount);
+
+	// Module-level comparison only; the per-request HTTP round trip saved by batching is not included
+	AddInfo(FString::Printf(TEXT("SpawnActor: %.1f us/actor, SpawnActorsBatch: %.1f us/actor (%.1fx)"),
+		SingleSeconds * 1e6, BatchSeconds * 1e6, SingleSeconds / FMath::Max(BatchSeconds, UE_DOUBLE_SMALL_NUMBER)));
+	TestTrue(TEXT("Batch spawning is faster per actor"), BatchSeconds < SingleSeconds);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,243 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/Scaling/ScalingTestFixtures.h"
+#include "Tests/Mocks/MockActorModule.h"
+#include "Tests/Mocks/MockAssetCacheModule.h"
+#include "Tests/Integration/IntegrationTestUtils.h"
+#include "Modules/Impl/BlueprintImplModule.h"
+#include "Modules/Impl/EditorBatchImplModule.h"
+#include "Tools/Impl/GetGraphNodesSummaryImplTool.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Engine/Blueprint.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace BlueprintScalingTestPrivate
+{
+	using namespace MCPScalingTest;
+
+	constexpr int32 BaselineNodes = 500;
+	constexpr int32 ScaledNodes = 5000;
+	constexpr int32 EditCalls = 500;
+	constexpr int32 ReadCalls = 20;
+	constexpr int32 CacheNodes = 32;
+
+	struct FBlueprintSamples
+	{
+		FScalingSample SetNodePosition;
+		FScalingSample GetGraphNodes;
+		FScalingSample GetGraphNodesSummary;
+		FScalingSample GetGraphNodesInArea;
+		int32 Failures = 0;
+	};
+
+	FBlueprintSamples MeasureBlueprintModule(int32 NodeCount)
+	{
+		FBlueprintGraphFixture Fixture(NodeCount, GetSeed());
+		FMockActorModule ActorModule;
+		FMockAssetCacheModule AssetCache;
+		AssetCache.LoadAssetResult = Fixture.Blueprint.Get();
+		FEditorBatchImplModule EditorBatch;
+		FBlueprintImplModule BlueprintModule(ActorModule, AssetCache, EditorBatch);
+		FGetGraphNodesSummaryImplTool SummaryTool(BlueprintModule);
+
+		FBlueprintSamples Samples;
+		const FString BlueprintPath = Fixture.Blueprint->GetPathName();
+		const FString GraphName = Fixture.Graph ? Fixture.Graph->GetName() : FString();
+		const int32 Nodes = Fixture.NodeIds.Num();
+		FRandomStream Stream(GetSeed());
+
+		// Resolves the node through FindNodeById; marking the Blueprint modified may touch more than the node
+		Samples.SetNodePosition = Measure(Nodes, EditCalls, [&](int32 CallIndex)
+		{
+			const FString& NodeId = Fixture.NodeIds[Stream.RandHelper(Nodes)];
+			Samples.Failures += BlueprintModule.SetNodePosition(BlueprintPath, GraphName, NodeId, Stream.RandRange(0, 20000), Stream.RandRange(0, 20000)).bSuccess ? 0 : 1;
+		});
+
+		Samples.GetGraphNodes = Measure(Nodes, ReadCalls, [&](int32 CallIndex)
+		{
+			Samples.Failures += BlueprintModule.GetGraphNodes(BlueprintPath, GraphName).bSuccess ? 0 : 1;
+		});
+
+		TSharedPtr<FJsonObject> SummaryArgs = MakeShared<FJsonObject>();
+		SummaryArgs->SetStringField(TEXT("blueprint_path"), BlueprintPath);
+		SummaryArgs->SetStringField(TEXT("graph_name"), GraphName);
+		Samples.GetGraphNodesSummary = Measure(Nodes, ReadCalls, [&](int32 CallIndex)
+		{
+			Samples.Failures += MCPTestUtils::IsSuccess(SummaryTool.Execute(SummaryArgs)) ? 0 : 1;
+		});
+
+		Samples.GetGraphNodesInArea = Measure(Nodes, ReadCalls, [&](int32 CallIndex)
+		{
+			const int32 MinX = Stream.RandRange(0, 18000);
+			const int32 MinY = Stream.RandRange(0, 18000);
+			Samples.Failures += BlueprintModule.GetGraphNodesInArea(BlueprintPath, GraphName, MinX, MinY, MinX + 2000, MinY + 2000).bSuccess ? 0 : 1;
+		});
+
+		return Samples;
+	}
+
+	/** Small generated graph and a Blueprint module resolving it, for the node cache tests */
+	struct FNodeCacheFixture
+	{
+		FBlueprintGraphFixture Graph;
+		FMockActorModule ActorModule;
+		FMockAssetCacheModule AssetCache;
+		FEditorBatchImplModule EditorBatch;
+		FBlueprintImplModule BlueprintModule;
+		FString BlueprintPath;
+
+		FNodeCacheFixture()
+			: Graph(CacheNodes, GetSeed())
+			, BlueprintModule(ActorModule, AssetCache, EditorBatch)
+		{
+			AssetCache.LoadAssetResult = Graph.Blueprint.Get();
+			BlueprintPath = Graph.Blueprint->GetPathName();
+		}
+
+		/** Resolve the node through the module's graph and node caches */
+		bool MoveNode(const FString& GraphName, const FString& NodeId)
+		{
+			return BlueprintModule.SetNodePosition(BlueprintPath, GraphName, NodeId, 100, 200).bSuccess;
+		}
+
+		bool MoveNode(const FString& NodeId)
+		{
+			return MoveNode(Graph.Graph->GetName(), NodeId);
+		}
+
+		UEdGraphNode* FindGeneratedNode(const FString& NodeId) const
+		{
+			FGuid NodeGuid;
+			FGuid::Parse(NodeId, NodeGuid);
+			const TObjectPtr<UEdGraphNode>* Found = Graph.Graph->Nodes.FindByPredicate([&NodeGuid](const UEdGraphNode* Node)
+			{
+				return Node && Node->NodeGuid == NodeGuid;
+			});
+			return Found ? Found->Get() : nullptr;
+		}
+
+		UEdGraphNode_Comment* MakeCommentNode() const
+		{
+			UEdGraphNode_Comment* Comment = NewObject<UEdGraphNode_Comment>(Graph.Graph);
+			Comment->CreateNewGuid();
+			return Comment;
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBlueprintScalingGraphNodesTest,
+	"MCPServer.Scaling.Blueprint.GraphNodes5k",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FBlueprintScalingGraphNodesTest::RunTest(const FString& Parameters)
+{
+	using namespace BlueprintScalingTestPrivate;
+
+	const FBlueprintSamples Baseline = MeasureBlueprintModule(BaselineNodes);
+	const FBlueprintSamples Scaled = MeasureBlueprintModule(ScaledNodes);
+
+	TestEqual(TEXT("Baseline calls succeed"), Baseline.Failures, 0);
+	TestEqual(TEXT("Scaled calls succeed"), Scaled.Failures, 0);
+	TestEqual(TEXT("Every node generated"), Scaled.GetGraphNodes.Size, ScaledNodes);
+
+	TestScalingBudget(*this, TEXT("SetNodePosition"), Baseline.SetNodePosition, Scaled.SetNodePosition, EScalingBudget::Linear);
+	TestScalingBudget(*this, TEXT("GetGraphNodes"), Baseline.GetGraphNodes, Scaled.GetGraphNodes, EScalingBudget::Linear);
+	TestScalingBudget(*this, TEXT("get_graph_nodes_summary"), Baseline.GetGraphNodesSummary, Scaled.GetGraphNodesSummary, EScalingBudget::Linear);
+	TestScalingBudget(*this, TEXT("GetGraphNodesInArea"), Baseline.GetGraphNodesInArea, Scaled.GetGraphNodesInArea, EScalingBudget::Linear);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBlueprintNodeCacheRemovedNodeTest,
+	"MCPServer.Scaling.Blueprint.NodeCache.RemovedNode",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FBlueprintNodeCacheRemovedNodeTest::RunTest(const FString& Parameters)
+{
+	using namespace BlueprintScalingTestPrivate;
+
+	FNodeCacheFixture Fixture;
+	const FString RemovedId = Fixture.Graph.NodeIds[0];
+	const FString DestroyedId = Fixture.Graph.NodeIds[1];
+	TestTrue(TEXT("Node found before removal"), Fixture.MoveNode(RemovedId));
+	TestTrue(TEXT("Second node found before it is destroyed"), Fixture.MoveNode(DestroyedId));
+
+	FBlueprintEditorUtils::RemoveNode(Fixture.Graph.Blueprint.Get(), Fixture.FindGeneratedNode(RemovedId), true);
+	TestFalse(TEXT("Removed node is not returned from the cache"), Fixture.MoveNode(RemovedId));
+
+	// Garbage without a graph notification leaves a dead cache entry behind
+	UEdGraphNode* Destroyed = Fixture.FindGeneratedNode(DestroyedId);
+	Destroyed->MarkAsGarbage();
+	TestFalse(TEXT("Dead cache entry is not returned"), Fixture.MoveNode(DestroyedId));
+	Destroyed->ClearGarbage();
+
+	TestTrue(TEXT("Other nodes still found"), Fixture.MoveNode(Fixture.Graph.NodeIds[2]));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBlueprintNodeCacheGraphChangedTest,
+	"MCPServer.Scaling.Blueprint.NodeCache.GraphChanged",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FBlueprintNodeCacheGraphChangedTest::RunTest(const FString& Parameters)
+{
+	using namespace BlueprintScalingTestPrivate;
+
+	FNodeCacheFixture Fixture;
+	TestTrue(TEXT("Cache built on first lookup"), Fixture.MoveNode(Fixture.Graph.NodeIds[0]));
+
+	UEdGraphNode_Comment* Added = Fixture.MakeCommentNode();
+	Fixture.Graph.Graph->AddNode(Added, false, false);
+	TestTrue(TEXT("Node added through AddNode is found"), Fixture.MoveNode(Added->NodeGuid.ToString()));
+
+	// A miss does not rebuild the cache; only a graph change does, as undo sends with an empty action
+	UEdGraphNode_Comment* Unannounced = Fixture.MakeCommentNode();
+	Fixture.Graph.Graph->Nodes.Add(Unannounced);
+	TestFalse(TEXT("Node added without a notification is not found yet"), Fixture.MoveNode(Unannounced->NodeGuid.ToString()));
+	Fixture.Graph.Graph->NotifyGraphChanged();
+	TestTrue(TEXT("Node found after the graph reports a change"), Fixture.MoveNode(Unannounced->NodeGuid.ToString()));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBlueprintNodeCacheGraphRenameTest,
+	"MCPServer.Scaling.Blueprint.NodeCache.GraphRename",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FBlueprintNodeCacheGraphRenameTest::RunTest(const FString& Parameters)
+{
+	using namespace BlueprintScalingTestPrivate;
+
+	FNodeCacheFixture Fixture;
+	const FString OldName = Fixture.Graph.Graph->GetName();
+	const FString NewName = TEXT("ScalingRenamedGraph");
+	const FString NodeId = Fixture.Graph.NodeIds[0];
+	TestTrue(TEXT("Graph found by its original name"), Fixture.MoveNode(OldName, NodeId));
+
+	FBlueprintEditorUtils::RenameGraph(Fixture.Graph.Graph, NewName);
+	TestFalse(TEXT("Cached graph not returned under its old name"), Fixture.MoveNode(OldName, NodeId));
+	TestTrue(TEXT("Graph found by its new name"), Fixture.MoveNode(NewName, NodeId));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBlueprintNodeCacheUnparseableIdTest,
+	"MCPServer.Scaling.Blueprint.NodeCache.UnparseableId",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FBlueprintNodeCacheUnparseableIdTest::RunTest(const FString& Parameters)
+{
+	using namespace BlueprintScalingTestPrivate;
+
+	FNodeCacheFixture Fixture;
+	const FSetNodePositionResult Result = Fixture.BlueprintModule.SetNodePosition(
+		Fixture.BlueprintPath, Fixture.Graph.Graph->GetName(), TEXT("not-a-node-guid"), 0, 0);
+	TestFalse(TEXT("Unparseable node id fails"), Result.bSuccess);
+	TestTrue(TEXT("Error names the node id"), Result.ErrorMessage.Contains(TEXT("not-a-node-guid")));
+	TestTrue(TEXT("Valid ids still resolve"), Fixture.MoveNode(Fixture.Graph.NodeIds[0]));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
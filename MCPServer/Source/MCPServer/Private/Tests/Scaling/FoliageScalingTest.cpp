@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/Scaling/ScalingTestFixtures.h"
+#include "Tests/Mocks/MockAssetCacheModule.h"
+#include "Modules/Impl/FoliageImplModule.h"
+#include "Engine/StaticMesh.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FoliageScalingTestPrivate
+{
+	using namespace MCPScalingTest;
+
+	constexpr int32 BaselineInstances = 10000;
+	constexpr int32 ScaledInstances = 1000000;
+	constexpr int32 EditCalls = 20;
+	constexpr int32 InstancesPerAdd = 16;
+	constexpr double Extent = 500000.0;
+
+	struct FFoliageSamples
+	{
+		FScalingSample RemoveInRadius;
+		FScalingSample AddInstances;
+		int32 Failures = 0;
+	};
+
+	FFoliageSamples MeasureFoliageModule(int32 InstanceCount)
+	{
+		FScalingWorld World;
+		FFoliageFixture Fixture(World.GetWorld(), InstanceCount, GetSeed(), Extent);
+		FMockAssetCacheModule AssetCache;
+		AssetCache.LoadAssetResult = Fixture.Mesh.Get();
+		FFoliageImplModule FoliageModule(AssetCache);
+
+		FFoliageSamples Samples;
+		Samples.Failures += Fixture.Mesh.IsValid() ? 0 : 1;
+		FRandomStream Stream(GetSeed());
+
+		// Both calls rebuild the foliage tree after editing, which is linear in the instance count
+		Samples.RemoveInRadius = Measure(InstanceCount, EditCalls, [&](int32 CallIndex)
+		{
+			const FVector Center(Stream.FRandRange(-Extent, Extent), Stream.FRandRange(-Extent, Extent), 0.0);
+			Samples.Failures += FoliageModule.RemoveFoliageInstances(Fixture.MeshPath, Center, 2000.0f).bSuccess ? 0 : 1;
+		});
+
+		Samples.AddInstances = Measure(InstanceCount, EditCalls, [&](int32 CallIndex)
+		{
+			TArray<FTransform> Transforms;
+			for (int32 Index = 0; Index < InstancesPerAdd; ++Index)
+			{
+				Transforms.Add(FTransform(FVector(Stream.FRandRange(-Extent, Extent), Stream.FRandRange(-Extent, Extent), 0.0)));
+			}
+			Samples.Failures += FoliageModule.AddFoliageInstances(Fixture.MeshPath, Transforms).bSuccess ? 0 : 1;
+		});
+
+		return Samples;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFoliageScalingInstancesTest,
+	"MCPServer.Scaling.Foliage.Instances1M",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FFoliageScalingInstancesTest::RunTest(const FString& Parameters)
+{
+	using namespace FoliageScalingTestPrivate;
+
+	const FFoliageSamples Baseline = MeasureFoliageModule(BaselineInstances);
+	const FFoliageSamples Scaled = MeasureFoliageModule(ScaledInstances);
+
+	TestEqual(TEXT("Baseline calls succeed"), Baseline.Failures, 0);
+	TestEqual(TEXT("Scaled calls succeed"), Scaled.Failures, 0);
+
+	TestScalingBudget(*this, TEXT("RemoveFoliageInstances in radius"), Baseline.RemoveInRadius, Scaled.RemoveInRadius, EScalingBudget::Linear);
+	TestScalingBudget(*this, TEXT("AddFoliageInstances"), Baseline.AddInstances, Scaled.AddInstances, EScalingBudget::Linear);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/Scaling/ScalingTestFixtures.h"
+#include "Tests/Mocks/MockAssetCacheModule.h"
+#include "Modules/Impl/MaterialImplModule.h"
+#include "Modules/Impl/EditorBatchImplModule.h"
+#include "Materials/Material.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MaterialScalingTestPrivate
+{
+	using namespace MCPScalingTest;
+
+	constexpr int32 BaselineExpressions = 100;
+	constexpr int32 ScaledExpressions = 1000;
+	constexpr int32 LookupCalls = 1000;
+	constexpr int32 ReadCalls = 50;
+
+	struct FMaterialSamples
+	{
+		FScalingSample GetExpressionProperty;
+		FScalingSample ConnectExpressions;
+		FScalingSample GetExpressions;
+		FScalingSample GetParameter;
+		int32 Failures = 0;
+	};
+
+	FMaterialSamples MeasureMaterialModule(int32 ExpressionCount)
+	{
+		FMaterialFixture Fixture(ExpressionCount, GetSeed());
+		FMockAssetCacheModule AssetCache;
+		AssetCache.LoadAssetResult = Fixture.Material.Get();
+		FEditorBatchImplModule EditorBatch;
+		FMaterialImplModule MaterialModule(AssetCache, EditorBatch);
+
+		FMaterialSamples Samples;
+		const FString MaterialPath = Fixture.Material->GetPathName();
+		const int32 Expressions = Fixture.Material->GetExpressions().Num();
+		const int32 Pairs = Expressions / 2;
+		FRandomStream Stream(GetSeed());
+
+		// Even indices are scalar parameters, odd ones Add expressions
+		Samples.GetExpressionProperty = Measure(Expressions, LookupCalls, [&](int32 CallIndex)
+		{
+			Samples.Failures += MaterialModule.GetMaterialExpressionProperty(MaterialPath, Stream.RandHelper(Pairs) * 2, TEXT("DefaultValue")).bSuccess ? 0 : 1;
+		});
+
+		Samples.ConnectExpressions = Measure(Expressions, LookupCalls, [&](int32 CallIndex)
+		{
+			const int32 FromIndex = Stream.RandHelper(Pairs) * 2;
+			const int32 ToIndex = Stream.RandHelper(Pairs) * 2 + 1;
+			Samples.Failures += MaterialModule.ConnectMaterialExpressions(MaterialPath, FromIndex, FString(), ToIndex, TEXT("B")).bSuccess ? 0 : 1;
+		});
+
+		Samples.GetExpressions = Measure(Expressions, ReadCalls, [&](int32 CallIndex)
+		{
+			Samples.Failures += MaterialModule.GetMaterialExpressions(MaterialPath).bSuccess ? 0 : 1;
+		});
+
+		// Parameter names are collected from the whole material on every call
+		Samples.GetParameter = Measure(Expressions, ReadCalls, [&](int32 CallIndex)
+		{
+			const FName& ParameterName = Fixture.ParameterNames[Stream.RandHelper(Fixture.ParameterNames.Num())];
+			Samples.Failures += MaterialModule.GetMaterialParameter(MaterialPath, ParameterName.ToString()).bSuccess ? 0 : 1;
+		});
+
+		return Samples;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMaterialScalingExpressionsTest,
+	"MCPServer.Scaling.Material.Expressions1k",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FMaterialScalingExpressionsTest::RunTest(const FString& Parameters)
+{
+	using namespace MaterialScalingTestPrivate;
+
+	const FMaterialSamples Baseline = MeasureMaterialModule(BaselineExpressions);
+	const FMaterialSamples Scaled = MeasureMaterialModule(ScaledExpressions);
+
+	TestEqual(TEXT("Baseline calls succeed"), Baseline.Failures, 0);
+	TestEqual(TEXT("Scaled calls succeed"), Scaled.Failures, 0);
+	TestEqual(TEXT("Every expression generated"), Scaled.GetExpressions.Size, ScaledExpressions);
+
+	TestScalingBudget(*this, TEXT("GetMaterialExpressionProperty"), Baseline.GetExpressionProperty, Scaled.GetExpressionProperty, EScalingBudget::Constant);
+	TestScalingBudget(*this, TEXT("ConnectMaterialExpressions"), Baseline.ConnectExpressions, Scaled.ConnectExpressions, EScalingBudget::Constant);
+	TestScalingBudget(*this, TEXT("GetMaterialExpressions"), Baseline.GetExpressions, Scaled.GetExpressions, EScalingBudget::Linear);
+	TestScalingBudget(*this, TEXT("GetMaterialParameter"), Baseline.GetParameter, Scaled.GetParameter, EScalingBudget::Linear);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,279 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tests/Scaling/ScalingTestFixtures.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/AutomationEditorCommon.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "FoliageType.h"
+#include "InstancedFoliageActor.h"
+#include "K2Node_CallFunction.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "MaterialEditingLibrary.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialExpressionAdd.h"
+#include "Materials/MaterialExpressionScalarParameter.h"
+#include "Math/RandomStream.h"
+#include "Misc/CommandLine.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace MCPScalingTest
+{
+	namespace FixturesPrivate
+	{
+		/** Allowance for timer resolution and one-off hitches on calls that take microseconds */
+		constexpr double NoiseSeconds = 0.0001;
+
+		constexpr double DefaultTolerance = 4.0;
+
+		const TCHAR* const ActorFolders[] = { TEXT("Scaling/Props"), TEXT("Scaling/Props/Rocks"), TEXT("Scaling/Lights"), TEXT("Scaling/Gameplay") };
+
+		/** Columns of the node and expression grids */
+		constexpr int32 GridColumns = 50;
+
+		UPackage* CreateTempPackage(const TCHAR* BaseName)
+		{
+			const FName PackageName = MakeUniqueObjectName(nullptr, UPackage::StaticClass(), FName(*FString::Printf(TEXT("/Temp/MCPScaling/%s"), BaseName)));
+			return CreatePackage(*PackageName.ToString());
+		}
+
+		void DiscardAsset(UObject* Asset)
+		{
+			if (Asset)
+			{
+				Asset->ClearFlags(RF_Public | RF_Standalone);
+				Asset->MarkAsGarbage();
+			}
+		}
+
+		double GetTolerance()
+		{
+			double Tolerance = DefaultTolerance;
+			FParse::Value(FCommandLine::Get(), TEXT("MCPScalingTolerance="), Tolerance);
+			return FMath::Max(1.0, Tolerance);
+		}
+	}
+
+	int32 GetSeed()
+	{
+		int32 Seed = DefaultSeed;
+		FParse::Value(FCommandLine::Get(), TEXT("MCPScalingSeed="), Seed);
+		return Seed;
+	}
+
+	FScalingWorld::FScalingWorld()
+	{
+		World = FAutomationEditorCommonUtils::CreateNewMap();
+	}
+
+	FScalingWorld::~FScalingWorld()
+	{
+		FAutomationEditorCommonUtils::CreateNewMap();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	FActorFixture::FActorFixture(UWorld* World, int32 Count, int32 Seed, double Extent)
+	{
+		using namespace FixturesPrivate;
+
+		FRandomStream Stream(Seed);
+		Names.Reserve(Count);
+		Labels.Reserve(Count);
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FVector Location(Stream.FRandRange(-Extent, Extent), Stream.FRandRange(-Extent, Extent), Stream.FRandRange(0.0, 5000.0));
+			const FRotator Rotation(0.0, Stream.FRandRange(0.0, 360.0), 0.0);
+			AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>(Location, Rotation, SpawnParams);
+			if (!Actor)
+			{
+				continue;
+			}
+
+			Actor->SetActorLabel(FString::Printf(TEXT("Scaling_%d"), Index), false);
+			Actor->SetFolderPath(FName(ActorFolders[Stream.RandHelper(UE_ARRAY_COUNT(ActorFolders))]));
+			Names.Add(Actor->GetName());
+			Labels.Add(Actor->GetActorLabel());
+		}
+	}
+
+	FBlueprintGraphFixture::FBlueprintGraphFixture(int32 NodeCount, int32 Seed)
+	{
+		using namespace FixturesPrivate;
+
+		UPackage* Package = CreateTempPackage(TEXT("BP_Scaling"));
+		Blueprint.Reset(FKismetEditorUtilities::CreateBlueprint(
+			AActor::StaticClass(),
+			Package,
+			FName(*FPackageName::GetShortName(Package->GetName())),
+			BPTYPE_Normal,
+			UBlueprint::StaticClass(),
+			UBlueprintGeneratedClass::StaticClass()));
+		Graph = FBlueprintEditorUtils::FindEventGraph(Blueprint.Get());
+		if (!Graph)
+		{
+			return;
+		}
+
+		UFunction* PrintString = UKismetSystemLibrary::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, PrintString));
+		FRandomStream Stream(Seed);
+		NodeIds.Reserve(NodeCount);
+		UEdGraphPin* PreviousThen = nullptr;
+
+		for (int32 Index = 0; Index < NodeCount; ++Index)
+		{
+			FGraphNodeCreator<UK2Node_CallFunction> NodeCreator(*Graph);
+			UK2Node_CallFunction* Node = NodeCreator.CreateNode(false);
+			Node->SetFromFunction(PrintString);
+			Node->NodePosX = (Index % GridColumns) * 400 + Stream.RandRange(-50, 50);
+			Node->NodePosY = (Index / GridColumns) * 300 + Stream.RandRange(-50, 50);
+			NodeCreator.Finalize();
+
+			if (UEdGraphPin* TextPin = Node->FindPin(TEXT("InString")))
+			{
+				TextPin->DefaultValue = FString::Printf(TEXT("Node %d"), Index);
+			}
+			UEdGraphPin* ExecPin = Node->FindPin(UEdGraphSchema_K2::PN_Execute);
+			if (PreviousThen && ExecPin)
+			{
+				PreviousThen->MakeLinkTo(ExecPin);
+			}
+			PreviousThen = Node->FindPin(UEdGraphSchema_K2::PN_Then);
+			NodeIds.Add(Node->NodeGuid.ToString());
+		}
+	}
+
+	FBlueprintGraphFixture::~FBlueprintGraphFixture()
+	{
+		FixturesPrivate::DiscardAsset(Blueprint.Get());
+	}
+
+	FMaterialFixture::FMaterialFixture(int32 ExpressionCount, int32 Seed)
+	{
+		using namespace FixturesPrivate;
+
+		UPackage* Package = CreateTempPackage(TEXT("M_Scaling"));
+		Material.Reset(NewObject<UMaterial>(Package, FName(*FPackageName::GetShortName(Package->GetName())), RF_Public | RF_Standalone | RF_Transient));
+
+		FRandomStream Stream(Seed);
+		UMaterialExpression* PreviousParameter = nullptr;
+		UMaterialExpression* PreviousAdd = nullptr;
+
+		for (int32 Index = 0; Index < ExpressionCount; ++Index)
+		{
+			const int32 PosX = -300 * (Index % GridColumns);
+			const int32 PosY = 150 * (Index / GridColumns);
+			if (Index % 2 == 0)
+			{
+				UMaterialExpressionScalarParameter* Parameter = Cast<UMaterialExpressionScalarParameter>(
+					UMaterialEditingLibrary::CreateMaterialExpression(Material.Get(), UMaterialExpressionScalarParameter::StaticClass(), PosX, PosY));
+				Parameter->ParameterName = FName(*FString::Printf(TEXT("Param_%d"), ParameterNames.Num()));
+				Parameter->DefaultValue = Stream.FRand();
+				ParameterNames.Add(Parameter->ParameterName);
+				PreviousParameter = Parameter;
+			}
+			else
+			{
+				UMaterialExpression* Add = UMaterialEditingLibrary::CreateMaterialExpression(Material.Get(), UMaterialExpressionAdd::StaticClass(), PosX, PosY);
+				UMaterialEditingLibrary::ConnectMaterialExpressions(PreviousAdd ? PreviousAdd : PreviousParameter, FString(), Add, TEXT("A"));
+				UMaterialEditingLibrary::ConnectMaterialExpressions(PreviousParameter, FString(), Add, TEXT("B"));
+				PreviousAdd = Add;
+			}
+		}
+
+		// Parameter lookups read the cached expression data, which is otherwise only built on load or edit
+		Material->UpdateCachedExpressionData();
+	}
+
+	FMaterialFixture::~FMaterialFixture()
+	{
+		FixturesPrivate::DiscardAsset(Material.Get());
+	}
+
+	FFoliageFixture::FFoliageFixture(UWorld* World, int32 InstanceCount, int32 Seed, double Extent)
+	{
+		Mesh.Reset(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+		if (!Mesh.IsValid())
+		{
+			return;
+		}
+		MeshPath = Mesh->GetPathName();
+
+		AInstancedFoliageActor* FoliageActor = AInstancedFoliageActor::Get(World, true);
+		UFoliageType* FoliageType = nullptr;
+		FFoliageInfo* FoliageInfo = FoliageActor ? FoliageActor->AddMesh(Mesh.Get(), &FoliageType) : nullptr;
+		if (!FoliageInfo || !FoliageType)
+		{
+			return;
+		}
+
+		FRandomStream Stream(Seed);
+		TArray<FFoliageInstance> Instances;
+		Instances.SetNum(InstanceCount);
+		TArray<const FFoliageInstance*> InstancePointers;
+		InstancePointers.Reserve(InstanceCount);
+		for (FFoliageInstance& Instance : Instances)
+		{
+			const FVector Location(Stream.FRandRange(-Extent, Extent), Stream.FRandRange(-Extent, Extent), 0.0);
+			const FRotator Rotation(0.0, Stream.FRandRange(0.0, 360.0), 0.0);
+			Instance.SetInstanceWorldTransform(FTransform(Rotation, Location, FVector(Stream.FRandRange(0.5, 1.5))));
+			InstancePointers.Add(&Instance);
+		}
+
+		FoliageInfo->AddInstances(FoliageType, InstancePointers);
+		FoliageInfo->Refresh(true, false);
+	}
+
+	FScalingSample Measure(int32 Size, int32 Calls, TFunctionRef<void(int32 CallIndex)> Operation)
+	{
+		// Caches and indices are built by the first call, outside the timed loop
+		Operation(0);
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		for (int32 CallIndex = 0; CallIndex < Calls; ++CallIndex)
+		{
+			Operation(CallIndex);
+		}
+
+		FScalingSample Sample;
+		Sample.Size = Size;
+		Sample.SecondsPerCall = (FPlatformTime::Seconds() - StartSeconds) / FMath::Max(1, Calls);
+		return Sample;
+	}
+
+	void TestScalingBudget(
+		FAutomationTestBase& Test,
+		const FString& What,
+		const FScalingSample& Baseline,
+		const FScalingSample& Scaled,
+		EScalingBudget Budget)
+	{
+		using namespace FixturesPrivate;
+
+		const double SizeRatio = static_cast<double>(Scaled.Size) / FMath::Max(1, Baseline.Size);
+		const double Growth = Budget == EScalingBudget::Constant ? 1.0 : SizeRatio;
+		const double AllowedSeconds = Baseline.SecondsPerCall * Growth * GetTolerance() + NoiseSeconds;
+
+		Test.AddInfo(FString::Printf(TEXT("%s: %.1f us/call at %d, %.1f us/call at %d (budget %.1f us)"),
+			*What, Baseline.SecondsPerCall * 1e6, Baseline.Size, Scaled.SecondsPerCall * 1e6, Scaled.Size, AllowedSeconds * 1e6));
+		Test.TestTrue(FString::Printf(TEXT("%s stays within its %s scaling budget"), *What,
+			Budget == EScalingBudget::Constant ? TEXT("constant") : TEXT("linear")), Scaled.SecondsPerCall <= AllowedSeconds);
+	}
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
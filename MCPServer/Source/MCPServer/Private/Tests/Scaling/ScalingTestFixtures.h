@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class UBlueprint;
+class UEdGraph;
+class UMaterial;
+class UStaticMesh;
+class UWorld;
+
+/**
+ * Synthetic content for the MCPServer.Scaling tests. Every generator is driven by an FRandomStream,
+ * so the same seed always produces the same world, graph or material.
+ * The tests are StressFilter tests and run headless, e.g.
+ *   UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests MCPServer.Scaling; Quit"
+ * Each one times module methods on a small baseline fixture and on a large one and checks that the
+ * cost per call grows no faster than the method's budget allows.
+ * The Integration tests that check the real modules for correctness reuse these fixtures.
+ */
+namespace MCPScalingTest
+{
+	/** Seed used unless -MCPScalingSeed= is given */
+	constexpr int32 DefaultSeed = 20250326;
+
+	/** Seed for this run */
+	int32 GetSeed();
+
+	/**
+	 * Opens a blank editor map for the fixture's lifetime, so generated actors and foliage never mix with
+	 * the user's level. Another blank map is opened on destruction and garbage collected to release them.
+	 */
+	class FScalingWorld
+	{
+	public:
+		FScalingWorld();
+		~FScalingWorld();
+
+		FScalingWorld(const FScalingWorld&) = delete;
+		FScalingWorld& operator=(const FScalingWorld&) = delete;
+
+		UWorld* GetWorld() const { return World; }
+
+	private:
+		UWorld* World = nullptr;
+	};
+
+	/** Static mesh actors scattered over a square, labelled Scaling_<Index> and spread over a few outliner folders */
+	struct FActorFixture
+	{
+		/** Object names and labels in spawn order */
+		TArray<FString> Names;
+		TArray<FString> Labels;
+
+		FActorFixture(UWorld* World, int32 Count, int32 Seed, double Extent = 1000000.0);
+	};
+
+	/** Transient Blueprint whose event graph holds a chain of PrintString nodes linked through their exec pins */
+	struct FBlueprintGraphFixture
+	{
+		TStrongObjectPtr<UBlueprint> Blueprint;
+		UEdGraph* Graph = nullptr;
+		/** NodeGuid strings of the generated nodes, in chain order */
+		TArray<FString> NodeIds;
+
+		FBlueprintGraphFixture(int32 NodeCount, int32 Seed);
+		~FBlueprintGraphFixture();
+	};
+
+	/** Transient material alternating scalar parameters (Param_<Index>) and Add expressions chained through input A */
+	struct FMaterialFixture
+	{
+		TStrongObjectPtr<UMaterial> Material;
+		/** Names of the generated scalar parameters */
+		TArray<FName> ParameterNames;
+
+		FMaterialFixture(int32 ExpressionCount, int32 Seed);
+		~FMaterialFixture();
+	};
+
+	/** Foliage instances of the engine cube scattered over a square in the world's foliage actor */
+	struct FFoliageFixture
+	{
+		TStrongObjectPtr<UStaticMesh> Mesh;
+		FString MeshPath;
+
+		FFoliageFixture(UWorld* World, int32 InstanceCount, int32 Seed, double Extent = 500000.0);
+	};
+
+	/** How the cost of one call may grow with the fixture size */
+	enum class EScalingBudget : uint8
+	{
+		/** Indexed lookups: about the same cost at any size */
+		Constant,
+		/** Calls that walk the content once: proportional to the size */
+		Linear
+	};
+
+	/** Average cost of one call at a fixture size */
+	struct FScalingSample
+	{
+		int32 Size = 0;
+		double SecondsPerCall = 0.0;
+	};
+
+	/** Run Operation Calls times (after one untimed warm-up call) and return the average cost per call */
+	FScalingSample Measure(int32 Size, int32 Calls, TFunctionRef<void(int32 CallIndex)> Operation);
+
+	/**
+	 * Check that the cost per call grew no faster than Budget allows between the baseline and the scaled fixture.
+	 * The allowance is multiplied by -MCPScalingTolerance= (4 by default) and a small constant absorbs timer noise.
+	 */
+	void TestScalingBudget(
+		FAutomationTestBase& Test,
+		const FString& What,
+		const FScalingSample& Baseline,
+		const FScalingSample& Scaled,
+		EScalingBudget Budget);
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -5,16 +5,21 @@
 #include "Tools/Impl/DeleteActorImplTool.h"
 #include "Tools/Impl/DuplicateActorImplTool.h"
 #include "Tools/Impl/GetActorsInLevelImplTool.h"
+#include "Tools/Impl/QueryActorsSpatialImplTool.h"
+#include "Tools/Impl/GetLevelChangesImplTool.h"
 #include "Tools/Impl/SelectActorImplTool.h"
 #include "Tools/Impl/DeselectAllImplTool.h"
 #include "Tools/Impl/GetActorTransformImplTool.h"
 #include "Tools/Impl/SetActorTransformImplTool.h"
 #include "Tools/Impl/GetActorPropertyImplTool.h"
+#include "Tools/Impl/GetActorPropertiesBulkImplTool.h"
 #include "Tools/Impl/SetActorPropertyImplTool.h"
 #include "Tools/Impl/ConvertActorImplTool.h"
 #include "Tools/Impl/MoveActorsToLevelImplTool.h"
 #include "Tools/Impl/GroupActorsImplTool.h"
 #include "Tools/Impl/SetActorFolderImplTool.h"
+#include "Tools/Impl/MergeToInstancesImplTool.h"
+#include "Tools/Impl/ExplodeInstancesImplTool.h"
 #include "Tests/Mocks/MockActorModule.h"
 #include "Tests/Integration/IntegrationTestUtils.h"
 
@@ -330,6 +335,360 @@ bool FGetActorsInLevelModuleFailureTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetActorsInLevelQueryArgsTest,
+	"MCPServer.Unit.Actors.GetActorsInLevel.QueryArgs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetActorsInLevelQueryArgsTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.GetActorsInLevelResult.bSuccess = true;
+
+	FGetActorsInLevelImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetStringField(TEXT("folder"), TEXT("Lighting"));
+	Args->SetStringField(TEXT("cursor"), TEXT("200"));
+	Args->SetNumberField(TEXT("limit"), 50);
+	TArray<TSharedPtr<FJsonValue>> Fields;
+	Fields.Add(MakeShared<FJsonValueString>(TEXT("name")));
+	Fields.Add(MakeShared<FJsonValueString>(TEXT("location")));
+	Args->SetArrayField(TEXT("fields"), Fields);
+	auto Bounds = MakeShared<FJsonObject>();
+	auto Min = MakeShared<FJsonObject>();
+	Min->SetNumberField(TEXT("x"), -100.0);
+	Min->SetNumberField(TEXT("y"), -100.0);
+	Min->SetNumberField(TEXT("z"), -100.0);
+	auto Max = MakeShared<FJsonObject>();
+	Max->SetNumberField(TEXT("x"), 100.0);
+	Max->SetNumberField(TEXT("y"), 100.0);
+	Max->SetNumberField(TEXT("z"), 100.0);
+	Bounds->SetObjectField(TEXT("min"), Min);
+	Bounds->SetObjectField(TEXT("max"), Max);
+	Args->SetObjectField(TEXT("bounds"), Bounds);
+
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	TestEqual(TEXT("Folder passed"), Mock.LastActorQuery.FolderFilter, TEXT("Lighting"));
+	TestEqual(TEXT("Cursor decoded to offset"), Mock.LastActorQuery.Offset, 200);
+	TestEqual(TEXT("Limit passed"), Mock.LastActorQuery.Limit, 50);
+	TestTrue(TEXT("Bounds valid"), Mock.LastActorQuery.Bounds.IsValid != 0);
+	TestTrue(TEXT("Projected fields"), Mock.LastActorQuery.Fields == (EActorInfoFields::Name | EActorInfoFields::Location));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetActorsInLevelStructuredTest,
+	"MCPServer.Unit.Actors.GetActorsInLevel.Structured",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetActorsInLevelStructuredTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.GetActorsInLevelResult.bSuccess = true;
+	Mock.GetActorsInLevelResult.bHasMore = true;
+	Mock.GetActorsInLevelResult.NextOffset = 1;
+	FActorInfo A1;
+	A1.ActorName = TEXT("Actor1");
+	A1.ActorLabel = TEXT("Label1");
+	Mock.GetActorsInLevelResult.Actors.Add(A1);
+
+	FGetActorsInLevelImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Fields;
+	Fields.Add(MakeShared<FJsonValueString>(TEXT("name")));
+	Args->SetArrayField(TEXT("fields"), Fields);
+
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+
+	const TSharedPtr<FJsonObject>* Structured;
+	TestTrue(TEXT("Has structuredContent"), Result->TryGetObjectField(TEXT("structuredContent"), Structured));
+	TestEqual(TEXT("Next cursor"), (*Structured)->GetStringField(TEXT("next_cursor")), TEXT("1"));
+	const TSharedPtr<FJsonObject> ActorObj = (*Structured)->GetArrayField(TEXT("actors"))[0]->AsObject();
+	TestEqual(TEXT("Name returned"), ActorObj->GetStringField(TEXT("name")), TEXT("Actor1"));
+	TestFalse(TEXT("Label not projected"), ActorObj->HasField(TEXT("label")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetActorsInLevelInvalidArgsTest,
+	"MCPServer.Unit.Actors.GetActorsInLevel.InvalidArgs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetActorsInLevelInvalidArgsTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.GetActorsInLevelResult.bSuccess = true;
+	FGetActorsInLevelImplTool Tool(Mock);
+
+	auto BadCursor = MakeShared<FJsonObject>();
+	BadCursor->SetStringField(TEXT("cursor"), TEXT("abc"));
+	TestTrue(TEXT("Invalid cursor rejected"), MCPTestUtils::IsError(Tool.Execute(BadCursor)));
+
+	auto BadField = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Fields;
+	Fields.Add(MakeShared<FJsonValueString>(TEXT("mass")));
+	BadField->SetArrayField(TEXT("fields"), Fields);
+	TestTrue(TEXT("Unknown field rejected"), MCPTestUtils::IsError(Tool.Execute(BadField)));
+
+	TestEqual(TEXT("Module not called"), Mock.Recorder.GetCallCount(TEXT("GetActorsInLevel")), 0);
+	return true;
+}
+
+// ============================================================================
+// QueryActorsSpatial
+// ============================================================================
+
+namespace ActorToolsTestHelpers
+{
+	TSharedPtr<FJsonObject> MakeSpatialVector(double X, double Y, double Z)
+	{
+		auto Vector = MakeShared<FJsonObject>();
+		Vector->SetNumberField(TEXT("x"), X);
+		Vector->SetNumberField(TEXT("y"), Y);
+		Vector->SetNumberField(TEXT("z"), Z);
+		return Vector;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQueryActorsSpatialMetadataTest,
+	"MCPServer.Unit.Actors.QueryActorsSpatial.Metadata",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FQueryActorsSpatialMetadataTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	FQueryActorsSpatialImplTool Tool(Mock);
+	TestEqual(TEXT("Name"), Tool.GetName(), TEXT("query_actors_spatial"));
+	TestTrue(TEXT("Description not empty"), !Tool.GetDescription().IsEmpty());
+	TestTrue(TEXT("Schema valid"), Tool.GetInputSchema().IsValid());
+	TestTrue(TEXT("Schema has required"), Tool.GetInputSchema()->HasField(TEXT("required")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQueryActorsSpatialSuccessTest,
+	"MCPServer.Unit.Actors.QueryActorsSpatial.Success",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FQueryActorsSpatialSuccessTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.QueryActorsSpatialResult.bSuccess = true;
+	Mock.QueryActorsSpatialResult.TotalMatches = 2;
+	Mock.QueryActorsSpatialResult.bTruncated = true;
+	FActorSpatialMatch Match;
+	Match.ActorName = TEXT("Actor1");
+	Match.ActorLabel = TEXT("Rock");
+	Match.Distance = 42.0;
+	Mock.QueryActorsSpatialResult.Actors.Add(Match);
+
+	FQueryActorsSpatialImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetStringField(TEXT("shape"), TEXT("sphere"));
+	Args->SetObjectField(TEXT("center"), ActorToolsTestHelpers::MakeSpatialVector(100.0, 0.0, 0.0));
+	Args->SetNumberField(TEXT("radius"), 500.0);
+	Args->SetStringField(TEXT("class_filter"), TEXT("/Script/Engine.StaticMeshActor"));
+	Args->SetNumberField(TEXT("limit"), 1);
+
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	TestTrue(TEXT("Shape passed"), Mock.LastSpatialQuery.Shape == EActorSpatialShape::Sphere);
+	TestEqual(TEXT("Center passed"), Mock.LastSpatialQuery.Center.X, 100.0);
+	TestEqual(TEXT("Radius passed"), Mock.LastSpatialQuery.Radius, 500.0);
+	TestEqual(TEXT("Class filter passed"), Mock.LastSpatialQuery.ClassFilter, TEXT("/Script/Engine.StaticMeshActor"));
+	TestEqual(TEXT("Limit passed"), Mock.LastSpatialQuery.Limit, 1);
+
+	const TSharedPtr<FJsonObject>* Structured;
+	TestTrue(TEXT("Has structuredContent"), Result->TryGetObjectField(TEXT("structuredContent"), Structured));
+	TestEqual(TEXT("Total"), (*Structured)->GetIntegerField(TEXT("total")), 2);
+	TestTrue(TEXT("Truncated"), (*Structured)->GetBoolField(TEXT("truncated")));
+	const TSharedPtr<FJsonObject> ActorObj = (*Structured)->GetArrayField(TEXT("actors"))[0]->AsObject();
+	TestEqual(TEXT("Label returned"), ActorObj->GetStringField(TEXT("label")), TEXT("Rock"));
+	TestEqual(TEXT("Distance returned"), ActorObj->GetNumberField(TEXT("distance")), 42.0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQueryActorsSpatialShapeArgsTest,
+	"MCPServer.Unit.Actors.QueryActorsSpatial.ShapeArgs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FQueryActorsSpatialShapeArgsTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.QueryActorsSpatialResult.bSuccess = true;
+	FQueryActorsSpatialImplTool Tool(Mock);
+
+	auto BoxArgs = MakeShared<FJsonObject>();
+	BoxArgs->SetStringField(TEXT("shape"), TEXT("box"));
+	BoxArgs->SetObjectField(TEXT("min"), ActorToolsTestHelpers::MakeSpatialVector(-10.0, -10.0, -10.0));
+	BoxArgs->SetObjectField(TEXT("max"), ActorToolsTestHelpers::MakeSpatialVector(10.0, 10.0, 10.0));
+	TestTrue(TEXT("Box succeeds"), MCPTestUtils::IsSuccess(Tool.Execute(BoxArgs)));
+	TestTrue(TEXT("Box passed"), Mock.LastSpatialQuery.Box.IsValid != 0);
+
+	auto FrustumArgs = MakeShared<FJsonObject>();
+	FrustumArgs->SetStringField(TEXT("shape"), TEXT("frustum"));
+	FrustumArgs->SetObjectField(TEXT("origin"), ActorToolsTestHelpers::MakeSpatialVector(0.0, 0.0, 200.0));
+	auto Rotation = MakeShared<FJsonObject>();
+	Rotation->SetNumberField(TEXT("yaw"), 90.0);
+	FrustumArgs->SetObjectField(TEXT("rotation"), Rotation);
+	FrustumArgs->SetNumberField(TEXT("fov"), 60.0);
+	FrustumArgs->SetNumberField(TEXT("far"), 5000.0);
+	TestTrue(TEXT("Frustum succeeds"), MCPTestUtils::IsSuccess(Tool.Execute(FrustumArgs)));
+	TestEqual(TEXT("Yaw passed"), Mock.LastSpatialQuery.Rotation.Yaw, 90.0);
+	TestEqual(TEXT("FOV passed"), Mock.LastSpatialQuery.FieldOfView, 60.0);
+	TestEqual(TEXT("Far passed"), Mock.LastSpatialQuery.FarDistance, 5000.0);
+
+	auto NearestArgs = MakeShared<FJsonObject>();
+	NearestArgs->SetStringField(TEXT("shape"), TEXT("nearest"));
+	NearestArgs->SetObjectField(TEXT("center"), ActorToolsTestHelpers::MakeSpatialVector(0.0, 0.0, 0.0));
+	NearestArgs->SetNumberField(TEXT("k"), 5);
+	TestTrue(TEXT("Nearest succeeds"), MCPTestUtils::IsSuccess(Tool.Execute(NearestArgs)));
+	TestTrue(TEXT("Nearest shape passed"), Mock.LastSpatialQuery.Shape == EActorSpatialShape::Nearest);
+	TestEqual(TEXT("K passed"), Mock.LastSpatialQuery.Count, 5);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQueryActorsSpatialInvalidArgsTest,
+	"MCPServer.Unit.Actors.QueryActorsSpatial.InvalidArgs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FQueryActorsSpatialInvalidArgsTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.QueryActorsSpatialResult.bSuccess = true;
+	FQueryActorsSpatialImplTool Tool(Mock);
+
+	TestTrue(TEXT("Missing shape rejected"), MCPTestUtils::IsError(Tool.Execute(MakeShared<FJsonObject>())));
+
+	auto BadShape = MakeShared<FJsonObject>();
+	BadShape->SetStringField(TEXT("shape"), TEXT("cone"));
+	TestTrue(TEXT("Unknown shape rejected"), MCPTestUtils::IsError(Tool.Execute(BadShape)));
+
+	auto MissingRadius = MakeShared<FJsonObject>();
+	MissingRadius->SetStringField(TEXT("shape"), TEXT("sphere"));
+	MissingRadius->SetObjectField(TEXT("center"), ActorToolsTestHelpers::MakeSpatialVector(0.0, 0.0, 0.0));
+	TestTrue(TEXT("Sphere without radius rejected"), MCPTestUtils::IsError(Tool.Execute(MissingRadius)));
+
+	TestEqual(TEXT("Module not called"), Mock.Recorder.GetCallCount(TEXT("QueryActorsSpatial")), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQueryActorsSpatialModuleFailureTest,
+	"MCPServer.Unit.Actors.QueryActorsSpatial.ModuleFailure",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FQueryActorsSpatialModuleFailureTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.QueryActorsSpatialResult.bSuccess = false;
+	Mock.QueryActorsSpatialResult.ErrorMessage = TEXT("Class not found");
+
+	FQueryActorsSpatialImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetStringField(TEXT("shape"), TEXT("nearest"));
+	Args->SetObjectField(TEXT("center"), ActorToolsTestHelpers::MakeSpatialVector(0.0, 0.0, 0.0));
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("IsError"), MCPTestUtils::IsError(Result));
+	TestTrue(TEXT("Contains error"), MCPTestUtils::GetResultText(Result).Contains(TEXT("Class not found")));
+	return true;
+}
+
+// ============================================================================
+// GetLevelChanges
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetLevelChangesMetadataTest,
+	"MCPServer.Unit.Actors.GetLevelChanges.Metadata",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetLevelChangesMetadataTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	FGetLevelChangesImplTool Tool(Mock);
+	TestEqual(TEXT("Name"), Tool.GetName(), TEXT("get_level_changes"));
+	TestTrue(TEXT("Description not empty"), !Tool.GetDescription().IsEmpty());
+	TestTrue(TEXT("Schema valid"), Tool.GetInputSchema().IsValid());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetLevelChangesSuccessTest,
+	"MCPServer.Unit.Actors.GetLevelChanges.Success",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetLevelChangesSuccessTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.GetLevelChangesResult.bSuccess = true;
+	Mock.GetLevelChangesResult.Token = TEXT("Journal:7");
+	FActorChange Added;
+	Added.Kind = EActorChangeKind::Added;
+	Added.ActorName = TEXT("Actor1");
+	Added.Location = FVector(10.0, 0.0, 0.0);
+	Mock.GetLevelChangesResult.Changes.Add(Added);
+	FActorChange Removed;
+	Removed.Kind = EActorChangeKind::Removed;
+	Removed.ActorName = TEXT("Actor2");
+	Mock.GetLevelChangesResult.Changes.Add(Removed);
+
+	FGetLevelChangesImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetStringField(TEXT("since_token"), TEXT("Journal:3"));
+
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	TestEqual(TEXT("Token passed"), Mock.LastSinceToken, TEXT("Journal:3"));
+
+	const TSharedPtr<FJsonObject>* Structured;
+	TestTrue(TEXT("Has structuredContent"), Result->TryGetObjectField(TEXT("structuredContent"), Structured));
+	TestEqual(TEXT("New token"), (*Structured)->GetStringField(TEXT("token")), TEXT("Journal:7"));
+	TestFalse(TEXT("Not reset"), (*Structured)->GetBoolField(TEXT("reset")));
+	TestEqual(TEXT("One added"), (*Structured)->GetArrayField(TEXT("added")).Num(), 1);
+	TestEqual(TEXT("None modified"), (*Structured)->GetArrayField(TEXT("modified")).Num(), 0);
+	TestEqual(TEXT("One removed"), (*Structured)->GetArrayField(TEXT("removed")).Num(), 1);
+	const TSharedPtr<FJsonObject> RemovedObj = (*Structured)->GetArrayField(TEXT("removed"))[0]->AsObject();
+	TestEqual(TEXT("Removed name"), RemovedObj->GetStringField(TEXT("name")), TEXT("Actor2"));
+	TestFalse(TEXT("Removed has no location"), RemovedObj->HasField(TEXT("location")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetLevelChangesResetTest,
+	"MCPServer.Unit.Actors.GetLevelChanges.Reset",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetLevelChangesResetTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.GetLevelChangesResult.bSuccess = true;
+	Mock.GetLevelChangesResult.bReset = true;
+	Mock.GetLevelChangesResult.Token = TEXT("Journal:0");
+
+	FGetLevelChangesImplTool Tool(Mock);
+	auto Result = Tool.Execute(MakeShared<FJsonObject>());
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	TestTrue(TEXT("Empty token passed"), Mock.LastSinceToken.IsEmpty());
+
+	const TSharedPtr<FJsonObject>* Structured;
+	TestTrue(TEXT("Has structuredContent"), Result->TryGetObjectField(TEXT("structuredContent"), Structured));
+	TestTrue(TEXT("Reset"), (*Structured)->GetBoolField(TEXT("reset")));
+	TestEqual(TEXT("Token returned"), (*Structured)->GetStringField(TEXT("token")), TEXT("Journal:0"));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetLevelChangesModuleFailureTest,
+	"MCPServer.Unit.Actors.GetLevelChanges.ModuleFailure",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetLevelChangesModuleFailureTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.GetLevelChangesResult.bSuccess = false;
+	Mock.GetLevelChangesResult.ErrorMessage = TEXT("No editor world available");
+
+	FGetLevelChangesImplTool Tool(Mock);
+	auto Result = Tool.Execute(MakeShared<FJsonObject>());
+	TestTrue(TEXT("IsError"), MCPTestUtils::IsError(Result));
+	TestTrue(TEXT("Contains error"), MCPTestUtils::GetResultText(Result).Contains(TEXT("No editor world available")));
+	return true;
+}
+
 // ============================================================================
 // SelectActor
 // ============================================================================
@@ -704,6 +1063,123 @@ bool FGetActorPropertyModuleFailureTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+// ============================================================================
+// GetActorPropertiesBulk
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetActorPropertiesBulkMetadataTest,
+	"MCPServer.Unit.Actors.GetActorPropertiesBulk.Metadata",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetActorPropertiesBulkMetadataTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	FGetActorPropertiesBulkImplTool Tool(Mock);
+	TestEqual(TEXT("Name"), Tool.GetName(), TEXT("get_actor_properties_bulk"));
+	TestTrue(TEXT("Description not empty"), !Tool.GetDescription().IsEmpty());
+	TestTrue(TEXT("Schema valid"), Tool.GetInputSchema().IsValid());
+	TestTrue(TEXT("Schema has required"), Tool.GetInputSchema()->HasField(TEXT("required")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetActorPropertiesBulkSuccessTest,
+	"MCPServer.Unit.Actors.GetActorPropertiesBulk.Success",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetActorPropertiesBulkSuccessTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.GetActorPropertiesBulkResult.bSuccess = true;
+	Mock.GetActorPropertiesBulkResult.ActorNames = { TEXT("Actor1"), TEXT("Actor2") };
+	Mock.GetActorPropertiesBulkResult.MissingActors = { TEXT("Gone") };
+	Mock.GetActorPropertiesBulkResult.bHasMore = true;
+	Mock.GetActorPropertiesBulkResult.NextOffset = 2;
+	FActorPropertyColumn& Column = Mock.GetActorPropertiesBulkResult.Columns.AddDefaulted_GetRef();
+	Column.PropertyPath = TEXT("RootComponent.RelativeScale3D.X");
+	Column.PropertyType = TEXT("double");
+	Column.Values.Add(TOptional<FString>(TEXT("2.000000")));
+	Column.Values.AddDefaulted();
+
+	FGetActorPropertiesBulkImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Properties;
+	Properties.Add(MakeShared<FJsonValueString>(TEXT("RootComponent.RelativeScale3D.X")));
+	Args->SetArrayField(TEXT("properties"), Properties);
+	TArray<TSharedPtr<FJsonValue>> Actors;
+	Actors.Add(MakeShared<FJsonValueString>(TEXT("Actor1")));
+	Actors.Add(MakeShared<FJsonValueString>(TEXT("Actor2")));
+	Actors.Add(MakeShared<FJsonValueString>(TEXT("Gone")));
+	Args->SetArrayField(TEXT("actors"), Actors);
+	Args->SetStringField(TEXT("class_filter"), TEXT("/Script/Engine.StaticMeshActor"));
+	Args->SetStringField(TEXT("cursor"), TEXT("10"));
+	Args->SetNumberField(TEXT("limit"), 2);
+
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	TestEqual(TEXT("Paths passed"), Mock.LastPropertiesBulkQuery.PropertyPaths.Num(), 1);
+	TestEqual(TEXT("Actors passed"), Mock.LastPropertiesBulkQuery.ActorIdentifiers.Num(), 3);
+	TestEqual(TEXT("Class filter passed"), Mock.LastPropertiesBulkQuery.ClassFilter, TEXT("/Script/Engine.StaticMeshActor"));
+	TestEqual(TEXT("Cursor decoded to offset"), Mock.LastPropertiesBulkQuery.Offset, 10);
+	TestEqual(TEXT("Limit passed"), Mock.LastPropertiesBulkQuery.Limit, 2);
+
+	const TSharedPtr<FJsonObject>* Structured;
+	TestTrue(TEXT("Has structuredContent"), Result->TryGetObjectField(TEXT("structuredContent"), Structured));
+	TestEqual(TEXT("Row count"), (*Structured)->GetIntegerField(TEXT("count")), 2);
+	TestEqual(TEXT("Next cursor"), (*Structured)->GetStringField(TEXT("next_cursor")), TEXT("2"));
+	TestEqual(TEXT("Missing reported"), (*Structured)->GetArrayField(TEXT("missing")).Num(), 1);
+	const TSharedPtr<FJsonObject> ColumnObj = (*Structured)->GetArrayField(TEXT("columns"))[0]->AsObject();
+	const TArray<TSharedPtr<FJsonValue>>& Values = ColumnObj->GetArrayField(TEXT("values"));
+	TestEqual(TEXT("Column path"), ColumnObj->GetStringField(TEXT("path")), TEXT("RootComponent.RelativeScale3D.X"));
+	TestEqual(TEXT("One value per row"), Values.Num(), 2);
+	TestEqual(TEXT("Resolved value"), Values[0]->AsString(), TEXT("2.000000"));
+	TestTrue(TEXT("Unresolved value is null"), Values[1]->IsNull());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetActorPropertiesBulkInvalidArgsTest,
+	"MCPServer.Unit.Actors.GetActorPropertiesBulk.InvalidArgs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetActorPropertiesBulkInvalidArgsTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.GetActorPropertiesBulkResult.bSuccess = true;
+	FGetActorPropertiesBulkImplTool Tool(Mock);
+
+	TestTrue(TEXT("Missing properties rejected"), MCPTestUtils::IsError(Tool.Execute(MakeShared<FJsonObject>())));
+
+	auto BadCursor = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Properties;
+	Properties.Add(MakeShared<FJsonValueString>(TEXT("bHidden")));
+	BadCursor->SetArrayField(TEXT("properties"), Properties);
+	BadCursor->SetStringField(TEXT("cursor"), TEXT("abc"));
+	TestTrue(TEXT("Invalid cursor rejected"), MCPTestUtils::IsError(Tool.Execute(BadCursor)));
+
+	TestEqual(TEXT("Module not called"), Mock.Recorder.GetCallCount(TEXT("GetActorPropertiesBulk")), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetActorPropertiesBulkModuleFailureTest,
+	"MCPServer.Unit.Actors.GetActorPropertiesBulk.ModuleFailure",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetActorPropertiesBulkModuleFailureTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.GetActorPropertiesBulkResult.bSuccess = false;
+	Mock.GetActorPropertiesBulkResult.ErrorMessage = TEXT("Invalid property path: .X");
+
+	FGetActorPropertiesBulkImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Properties;
+	Properties.Add(MakeShared<FJsonValueString>(TEXT(".X")));
+	Args->SetArrayField(TEXT("properties"), Properties);
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("IsError"), MCPTestUtils::IsError(Result));
+	TestTrue(TEXT("Contains error"), MCPTestUtils::GetResultText(Result).Contains(TEXT("Invalid property path")));
+	return true;
+}
+
 // ============================================================================
 // SetActorProperty
 // ============================================================================
@@ -1088,4 +1564,182 @@ bool FSetActorFolderModuleFailureTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+// ============================================================================
+// MergeToInstances
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMergeToInstancesMetadataTest,
+	"MCPServer.Unit.Actors.MergeToInstances.Metadata",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMergeToInstancesMetadataTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	FMergeToInstancesImplTool Tool(Mock);
+	TestEqual(TEXT("Name"), Tool.GetName(), TEXT("merge_to_instances"));
+	TestTrue(TEXT("Description not empty"), !Tool.GetDescription().IsEmpty());
+	TestTrue(TEXT("Schema valid"), Tool.GetInputSchema().IsValid());
+	TestTrue(TEXT("Bulk priority"), Tool.GetPriority() == EMCPToolPriority::Bulk);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMergeToInstancesSuccessTest,
+	"MCPServer.Unit.Actors.MergeToInstances.Success",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMergeToInstancesSuccessTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.MergeToInstancesResult.bSuccess = true;
+	Mock.MergeToInstancesResult.MergedActorCount = 3;
+	FInstanceMergeGroup Group;
+	Group.ActorName = TEXT("Actor_0");
+	Group.StaticMeshPath = TEXT("/Game/Meshes/Rock.Rock");
+	Group.InstanceCount = 3;
+	Mock.MergeToInstancesResult.Groups.Add(Group);
+	Mock.MergeToInstancesResult.Skipped.Add({ TEXT("PointLight_0"), TEXT("Not a StaticMeshActor") });
+	Mock.MergeToInstancesResult.Stats.DrawCallsBefore = 6;
+	Mock.MergeToInstancesResult.Stats.DrawCallsAfter = 2;
+
+	FMergeToInstancesImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetStringField(TEXT("folder"), TEXT("Props"));
+	Args->SetBoolField(TEXT("hierarchical"), false);
+	Args->SetNumberField(TEXT("min_instances"), 3);
+
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	TestEqual(TEXT("Folder passed"), Mock.LastMergeToInstancesRequest.FolderFilter, TEXT("Props"));
+	TestFalse(TEXT("Hierarchical passed"), Mock.LastMergeToInstancesRequest.bHierarchical);
+	TestEqual(TEXT("Min instances passed"), Mock.LastMergeToInstancesRequest.MinInstances, 3);
+
+	const TSharedPtr<FJsonObject>* Structured;
+	TestTrue(TEXT("Has structuredContent"), Result->TryGetObjectField(TEXT("structuredContent"), Structured));
+	TestEqual(TEXT("Merged"), (*Structured)->GetIntegerField(TEXT("merged")), 3);
+	const TSharedPtr<FJsonObject> GroupObj = (*Structured)->GetArrayField(TEXT("groups"))[0]->AsObject();
+	TestEqual(TEXT("Group mesh"), GroupObj->GetStringField(TEXT("mesh")), TEXT("/Game/Meshes/Rock.Rock"));
+	TestEqual(TEXT("Group instances"), GroupObj->GetIntegerField(TEXT("instances")), 3);
+	TestEqual(TEXT("Skipped listed"), (*Structured)->GetArrayField(TEXT("skipped")).Num(), 1);
+	TestEqual(TEXT("Draw calls before"), (*Structured)->GetObjectField(TEXT("draw_calls"))->GetIntegerField(TEXT("before")), 6);
+	TestEqual(TEXT("Draw calls after"), (*Structured)->GetObjectField(TEXT("draw_calls"))->GetIntegerField(TEXT("after")), 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMergeToInstancesMissingArgsTest,
+	"MCPServer.Unit.Actors.MergeToInstances.MissingArgs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMergeToInstancesMissingArgsTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	FMergeToInstancesImplTool Tool(Mock);
+	TestTrue(TEXT("No scope rejected"), MCPTestUtils::IsError(Tool.Execute(MakeShared<FJsonObject>())));
+
+	auto BadBounds = MakeShared<FJsonObject>();
+	BadBounds->SetObjectField(TEXT("bounds"), MakeShared<FJsonObject>());
+	TestTrue(TEXT("Invalid bounds rejected"), MCPTestUtils::IsError(Tool.Execute(BadBounds)));
+
+	TestEqual(TEXT("Module not called"), Mock.Recorder.GetCallCount(TEXT("MergeToInstances")), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMergeToInstancesModuleFailureTest,
+	"MCPServer.Unit.Actors.MergeToInstances.ModuleFailure",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMergeToInstancesModuleFailureTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.MergeToInstancesResult.bSuccess = false;
+	Mock.MergeToInstancesResult.ErrorMessage = TEXT("No editor world available");
+
+	FMergeToInstancesImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetBoolField(TEXT("use_selection"), true);
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("IsError"), MCPTestUtils::IsError(Result));
+	TestTrue(TEXT("Contains error"), MCPTestUtils::GetResultText(Result).Contains(TEXT("No editor world available")));
+	return true;
+}
+
+// ============================================================================
+// ExplodeInstances
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FExplodeInstancesMetadataTest,
+	"MCPServer.Unit.Actors.ExplodeInstances.Metadata",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FExplodeInstancesMetadataTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	FExplodeInstancesImplTool Tool(Mock);
+	TestEqual(TEXT("Name"), Tool.GetName(), TEXT("explode_instances"));
+	TestTrue(TEXT("Description not empty"), !Tool.GetDescription().IsEmpty());
+	TestTrue(TEXT("Schema valid"), Tool.GetInputSchema().IsValid());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FExplodeInstancesSuccessTest,
+	"MCPServer.Unit.Actors.ExplodeInstances.Success",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FExplodeInstancesSuccessTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.ExplodeInstancesResult.bSuccess = true;
+	Mock.ExplodeInstancesResult.ExplodedActorCount = 1;
+	Mock.ExplodeInstancesResult.ActorNames = { TEXT("StaticMeshActor_1"), TEXT("StaticMeshActor_2") };
+
+	FExplodeInstancesImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Actors;
+	Actors.Add(MakeShared<FJsonValueString>(TEXT("Rock_Instances")));
+	Args->SetArrayField(TEXT("actors"), Actors);
+
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	TestEqual(TEXT("Identifier passed"), Mock.LastExplodeIdentifiers.Num(), 1);
+
+	const TSharedPtr<FJsonObject>* Structured;
+	TestTrue(TEXT("Has structuredContent"), Result->TryGetObjectField(TEXT("structuredContent"), Structured));
+	TestEqual(TEXT("Exploded"), (*Structured)->GetIntegerField(TEXT("exploded")), 1);
+	TestEqual(TEXT("Spawned"), (*Structured)->GetIntegerField(TEXT("spawned")), 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FExplodeInstancesAllSkippedTest,
+	"MCPServer.Unit.Actors.ExplodeInstances.AllSkipped",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FExplodeInstancesAllSkippedTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.ExplodeInstancesResult.bSuccess = true;
+	Mock.ExplodeInstancesResult.Skipped.Add({ TEXT("Foliage"), TEXT("Not a plain actor holding instanced static meshes") });
+
+	FExplodeInstancesImplTool Tool(Mock);
+	auto Result = Tool.Execute(MakeShared<FJsonObject>());
+	TestTrue(TEXT("IsError when nothing exploded"), MCPTestUtils::IsError(Result));
+	TestTrue(TEXT("Selection used"), Mock.LastExplodeIdentifiers.IsEmpty());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FExplodeInstancesModuleFailureTest,
+	"MCPServer.Unit.Actors.ExplodeInstances.ModuleFailure",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FExplodeInstancesModuleFailureTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.ExplodeInstancesResult.bSuccess = false;
+	Mock.ExplodeInstancesResult.ErrorMessage = TEXT("No actors given and none selected");
+
+	FExplodeInstancesImplTool Tool(Mock);
+	auto Result = Tool.Execute(MakeShared<FJsonObject>());
+	TestTrue(TEXT("IsError"), MCPTestUtils::IsError(Result));
+	TestTrue(TEXT("Contains error"), MCPTestUtils::GetResultText(Result).Contains(TEXT("none selected")));
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
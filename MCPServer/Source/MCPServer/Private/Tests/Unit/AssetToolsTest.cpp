@@ -18,7 +18,9 @@
 #include "Tools/Impl/SetAssetPropertyImplTool.h"
 #include "Tools/Impl/GetAssetPropertyImplTool.h"
 #include "Tools/Impl/FindReferencersOfClassImplTool.h"
+#include "Tools/Impl/GetAssetCacheStatsImplTool.h"
 #include "Tests/Mocks/MockAssetModule.h"
+#include "Tests/Mocks/MockAssetCacheModule.h"
 #include "Tests/Integration/IntegrationTestUtils.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -1294,4 +1296,60 @@ bool FFindReferencersOfClassModuleFailureTest::RunTest(const FString& Parameters
 	return true;
 }
 
+// ============================================================================
+// GetAssetCacheStats
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetAssetCacheStatsMetadataTest,
+	"MCPServer.Unit.Assets.GetAssetCacheStats.Metadata",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetAssetCacheStatsMetadataTest::RunTest(const FString& Parameters)
+{
+	FMockAssetCacheModule Mock;
+	FGetAssetCacheStatsImplTool Tool(Mock);
+	TestEqual(TEXT("Name"), Tool.GetName(), TEXT("get_asset_cache_stats"));
+	TestTrue(TEXT("Description not empty"), !Tool.GetDescription().IsEmpty());
+	TestTrue(TEXT("Schema valid"), Tool.GetInputSchema().IsValid());
+	TestTrue(TEXT("Schema has type"), Tool.GetInputSchema()->HasField(TEXT("type")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetAssetCacheStatsSuccessTest,
+	"MCPServer.Unit.Assets.GetAssetCacheStats.Success",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetAssetCacheStatsSuccessTest::RunTest(const FString& Parameters)
+{
+	FMockAssetCacheModule Mock;
+	Mock.StatsResult.Hits = 30;
+	Mock.StatsResult.Misses = 10;
+	Mock.StatsResult.CachedCount = 7;
+
+	FGetAssetCacheStatsImplTool Tool(Mock);
+	auto Result = Tool.Execute(MakeShared<FJsonObject>());
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	FString Text = MCPTestUtils::GetResultText(Result);
+	TestTrue(TEXT("Contains hits"), Text.Contains(TEXT("30 hits")));
+	TestTrue(TEXT("Contains hit rate"), Text.Contains(TEXT("75.0%")));
+	TestEqual(TEXT("Cache not cleared"), Mock.Recorder.GetCallCount(TEXT("ClearCache")), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetAssetCacheStatsClearTest,
+	"MCPServer.Unit.Assets.GetAssetCacheStats.Clear",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetAssetCacheStatsClearTest::RunTest(const FString& Parameters)
+{
+	FMockAssetCacheModule Mock;
+	FGetAssetCacheStatsImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetBoolField(TEXT("clear"), true);
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	TestEqual(TEXT("Cache cleared"), Mock.Recorder.GetCallCount(TEXT("ClearCache")), 1);
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -2,6 +2,7 @@
 
 #include "Misc/AutomationTest.h"
 #include "Tools/Impl/BatchSetActorTransformsImplTool.h"
+#include "Tools/Impl/SpawnActorsBatchImplTool.h"
 #include "Tools/Impl/BatchSetActorFoldersImplTool.h"
 #include "Tools/Impl/BatchSetActorPropertiesImplTool.h"
 #include "Tools/Impl/BatchSetMaterialExpressionPropertiesImplTool.h"
@@ -11,6 +12,7 @@
 #include "Tools/Impl/BatchSetPinDefaultsImplTool.h"
 #include "Tools/Impl/BatchDeleteGraphNodesImplTool.h"
 #include "Tools/Impl/BatchDisconnectGraphPinsImplTool.h"
+#include "Tools/Interfaces/IMCPToolTask.h"
 #include "Tests/Mocks/MockActorModule.h"
 #include "Tests/Mocks/MockMaterialModule.h"
 #include "Tests/Mocks/MockBlueprintModule.h"
@@ -132,6 +134,166 @@ bool FBatchSetActorTransformsModuleFailureTest::RunTest(const FString& Parameter
 	return true;
 }
 
+// ===========================================================================
+// SpawnActorsBatch
+// ===========================================================================
+
+namespace SpawnActorsBatchTestHelpers
+{
+	TSharedPtr<FJsonValue> MakeTransform(std::initializer_list<double> Numbers)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		for (double Number : Numbers)
+		{
+			Values.Add(MakeShared<FJsonValueNumber>(Number));
+		}
+		return MakeShared<FJsonValueArray>(Values);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> MakeClasses()
+	{
+		TArray<TSharedPtr<FJsonValue>> Classes;
+		Classes.Add(MakeShared<FJsonValueString>(TEXT("/Script/Engine.StaticMeshActor")));
+		Classes.Add(MakeShared<FJsonValueString>(TEXT("/Script/Engine.PointLight")));
+		return Classes;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpawnActorsBatchMetadataTest,
+	"MCPServer.Unit.Batch.SpawnActorsBatch.Metadata",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSpawnActorsBatchMetadataTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	FSpawnActorsBatchImplTool Tool(Mock);
+	TestEqual(TEXT("Name"), Tool.GetName(), TEXT("spawn_actors_batch"));
+	TestTrue(TEXT("Description not empty"), !Tool.GetDescription().IsEmpty());
+	TestTrue(TEXT("Schema valid"), Tool.GetInputSchema().IsValid());
+	TestTrue(TEXT("Schema has type"), Tool.GetInputSchema()->HasField(TEXT("type")));
+	TestTrue(TEXT("Bulk priority"), Tool.GetPriority() == EMCPToolPriority::Bulk);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpawnActorsBatchSuccessTest,
+	"MCPServer.Unit.Batch.SpawnActorsBatch.Success",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSpawnActorsBatchSuccessTest::RunTest(const FString& Parameters)
+{
+	using namespace SpawnActorsBatchTestHelpers;
+
+	FMockActorModule Mock;
+	Mock.SpawnActorsBatchResult.bSuccess = true;
+	Mock.SpawnActorsBatchResult.SpawnedCount = 3;
+	Mock.SpawnActorsBatchResult.ActorNames = { TEXT("StaticMeshActor_0"), TEXT("StaticMeshActor_1"), TEXT("PointLight_0") };
+	FSpawnActorsBatchImplTool Tool(Mock);
+
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetArrayField(TEXT("classes"), MakeClasses());
+	TArray<TSharedPtr<FJsonValue>> Transforms;
+	Transforms.Add(MakeTransform({ 100, 200, 0 }));
+	Transforms.Add(MakeTransform({ 0, 0, 0, 0, 90, 0 }));
+	Transforms.Add(MakeTransform({ 0, 0, 300, 0, 0, 0, 2, 2, 2 }));
+	Args->SetArrayField(TEXT("transforms"), Transforms);
+	TArray<TSharedPtr<FJsonValue>> ClassIndices;
+	ClassIndices.Add(MakeShared<FJsonValueNumber>(0));
+	ClassIndices.Add(MakeShared<FJsonValueNumber>(0));
+	ClassIndices.Add(MakeShared<FJsonValueNumber>(1));
+	Args->SetArrayField(TEXT("class_indices"), ClassIndices);
+	Args->SetStringField(TEXT("label_prefix"), TEXT("Prop"));
+
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	TestEqual(TEXT("One module call"), Mock.Recorder.GetCallCount(TEXT("SpawnActorsBatch")), 1);
+
+	const FActorSpawnBatchRequest& Request = Mock.LastSpawnBatchRequest;
+	TestEqual(TEXT("Classes passed once"), Request.ClassPaths.Num(), 2);
+	TestEqual(TEXT("Items passed"), Request.Items.Num(), 3);
+	TestEqual(TEXT("Location parsed"), Request.Items[0].Transform.GetLocation(), FVector(100, 200, 0));
+	TestEqual(TEXT("Rotation parsed"), Request.Items[1].Transform.Rotator().Yaw, 90.0, 0.001);
+	TestEqual(TEXT("Scale parsed"), Request.Items[2].Transform.GetScale3D(), FVector(2, 2, 2));
+	TestEqual(TEXT("Class index parsed"), Request.Items[2].ClassIndex, 1);
+	TestEqual(TEXT("Label prefix passed"), Request.LabelPrefix, TEXT("Prop"));
+
+	const TSharedPtr<FJsonObject>* Structured;
+	TestTrue(TEXT("Has structuredContent"), Result->TryGetObjectField(TEXT("structuredContent"), Structured));
+	TestEqual(TEXT("Spawned count"), (*Structured)->GetIntegerField(TEXT("spawned")), 3);
+	TestEqual(TEXT("Actor names returned"), (*Structured)->GetArrayField(TEXT("actors")).Num(), 3);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpawnActorsBatchMissingArgsTest,
+	"MCPServer.Unit.Batch.SpawnActorsBatch.MissingArgs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSpawnActorsBatchMissingArgsTest::RunTest(const FString& Parameters)
+{
+	using namespace SpawnActorsBatchTestHelpers;
+
+	FMockActorModule Mock;
+	FSpawnActorsBatchImplTool Tool(Mock);
+
+	auto Result = Tool.Execute(MakeShared<FJsonObject>());
+	TestTrue(TEXT("Error"), MCPTestUtils::IsError(Result));
+	TestTrue(TEXT("Mentions classes"), MCPTestUtils::GetResultText(Result).Contains(TEXT("classes")));
+
+	auto BadTransform = MakeShared<FJsonObject>();
+	BadTransform->SetArrayField(TEXT("classes"), MakeClasses());
+	TArray<TSharedPtr<FJsonValue>> Transforms;
+	Transforms.Add(MakeTransform({ 1, 2 }));
+	BadTransform->SetArrayField(TEXT("transforms"), Transforms);
+	TestTrue(TEXT("Short transform rejected"), MCPTestUtils::IsError(Tool.Execute(BadTransform)));
+
+	auto MismatchedIndices = MakeShared<FJsonObject>();
+	MismatchedIndices->SetArrayField(TEXT("classes"), MakeClasses());
+	TArray<TSharedPtr<FJsonValue>> OneTransform;
+	OneTransform.Add(MakeTransform({ 0, 0, 0 }));
+	MismatchedIndices->SetArrayField(TEXT("transforms"), OneTransform);
+	MismatchedIndices->SetArrayField(TEXT("class_indices"), TArray<TSharedPtr<FJsonValue>>());
+	TestTrue(TEXT("Mismatched class_indices rejected"), MCPTestUtils::IsError(Tool.Execute(MismatchedIndices)));
+
+	TestEqual(TEXT("Module not called"), Mock.Recorder.GetCallCount(TEXT("SpawnActorsBatch")), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpawnActorsBatchPartialFailureTest,
+	"MCPServer.Unit.Batch.SpawnActorsBatch.PartialFailure",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSpawnActorsBatchPartialFailureTest::RunTest(const FString& Parameters)
+{
+	using namespace SpawnActorsBatchTestHelpers;
+
+	FMockActorModule Mock;
+	Mock.SpawnActorsBatchResult.bSuccess = true;
+	Mock.SpawnActorsBatchResult.SpawnedCount = 1;
+	Mock.SpawnActorsBatchResult.ActorNames = { TEXT("StaticMeshActor_0"), FString() };
+	Mock.SpawnActorsBatchResult.Errors.Add({ 1, TEXT("Class not found: /Script/Engine.Missing") });
+	FSpawnActorsBatchImplTool Tool(Mock);
+
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetArrayField(TEXT("classes"), MakeClasses());
+	TArray<TSharedPtr<FJsonValue>> Transforms;
+	Transforms.Add(MakeTransform({ 0, 0, 0 }));
+	Transforms.Add(MakeTransform({ 100, 0, 0 }));
+	Args->SetArrayField(TEXT("transforms"), Transforms);
+
+	auto Result = Tool.Execute(Args);
+	TestTrue(TEXT("Partial success is not an error"), MCPTestUtils::IsSuccess(Result));
+	TestTrue(TEXT("Contains item error"), MCPTestUtils::GetResultText(Result).Contains(TEXT("Class not found")));
+
+	Mock.SpawnActorsBatchResult.SpawnedCount = 0;
+	TestTrue(TEXT("isError when all fail"), MCPTestUtils::IsError(Tool.Execute(Args)));
+
+	Mock.SpawnActorsBatchResult.bSuccess = false;
+	Mock.SpawnActorsBatchResult.ErrorMessage = TEXT("No editor world available");
+	auto FailureResult = Tool.Execute(Args);
+	TestTrue(TEXT("Module failure is an error"), MCPTestUtils::IsError(FailureResult));
+	TestTrue(TEXT("Contains module error"), MCPTestUtils::GetResultText(FailureResult).Contains(TEXT("No editor world")));
+	return true;
+}
+
 // ===========================================================================
 // BatchSetActorFolders
 // ===========================================================================
@@ -229,18 +391,19 @@ bool FBatchSetActorFoldersPartialFailureTest::RunTest(const FString& Parameters)
 	return true;
 }
 
-IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBatchSetActorFoldersTooManyTest,
-	"MCPServer.Unit.Batch.BatchSetActorFolders.TooMany",
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBatchSetActorFoldersLargeBatchTest,
+	"MCPServer.Unit.Batch.BatchSetActorFolders.LargeBatch",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
 
-bool FBatchSetActorFoldersTooManyTest::RunTest(const FString& Parameters)
+bool FBatchSetActorFoldersLargeBatchTest::RunTest(const FString& Parameters)
 {
 	FMockActorModule Mock;
+	Mock.SetActorFolderResult.bSuccess = true;
 	FBatchSetActorFoldersImplTool Tool(Mock);
 
 	auto Args = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> Ops;
-	for (int32 i = 0; i < 101; ++i)
+	for (int32 i = 0; i < 5000; ++i)
 	{
 		auto Op = MakeShared<FJsonObject>();
 		Op->SetStringField(TEXT("actor_identifier"), FString::Printf(TEXT("Actor_%d"), i));
@@ -250,8 +413,9 @@ bool FBatchSetActorFoldersTooManyTest::RunTest(const FString& Parameters)
 	Args->SetArrayField(TEXT("operations"), Ops);
 	auto Result = Tool.Execute(Args);
 
-	TestTrue(TEXT("Error on >100"), MCPTestUtils::IsError(Result));
-	TestTrue(TEXT("Mentions maximum"), MCPTestUtils::GetResultText(Result).Contains(TEXT("Maximum 100")));
+	TestTrue(TEXT("No operation cap"), MCPTestUtils::IsSuccess(Result));
+	TestTrue(TEXT("All succeeded"), MCPTestUtils::GetResultText(Result).Contains(TEXT("5000 succeeded")));
+	TestEqual(TEXT("SetActorFolder called for every operation"), Mock.Recorder.GetCallCount(TEXT("SetActorFolder")), 5000);
 	return true;
 }
 
@@ -995,6 +1159,140 @@ bool FBatchDisconnectGraphPinsModuleFailureTest::RunTest(const FString& Paramete
 	return true;
 }
 
+// ===========================================================================
+// Transaction grouping
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBatchActorSingleTransactionTest,
+	"MCPServer.Unit.Batch.Transaction.ActorBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FBatchActorSingleTransactionTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.SetActorPropertyResult.bSuccess = true;
+	FBatchSetActorPropertiesImplTool Tool(Mock);
+
+	// Invalid input must not open a batch
+	Tool.Execute(MakeShared<FJsonObject>());
+	TestEqual(TEXT("No batch on missing args"), Mock.Recorder.GetCallCount(TEXT("BeginBatch")), 0);
+
+	auto Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Ops;
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		auto Op = MakeShared<FJsonObject>();
+		Op->SetStringField(TEXT("actor_identifier"), FString::Printf(TEXT("Actor_%d"), Index));
+		Op->SetStringField(TEXT("property_name"), TEXT("bHidden"));
+		Op->SetStringField(TEXT("property_value"), TEXT("true"));
+		Ops.Add(MakeShared<FJsonValueObject>(Op));
+	}
+	Args->SetArrayField(TEXT("operations"), Ops);
+	auto Result = Tool.Execute(Args);
+
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	TestEqual(TEXT("One BeginBatch"), Mock.Recorder.GetCallCount(TEXT("BeginBatch")), 1);
+	TestEqual(TEXT("One EndBatch"), Mock.Recorder.GetCallCount(TEXT("EndBatch")), 1);
+	TestEqual(TEXT("Batch opened first"), Mock.Recorder.Calls[0].MethodName, FString(TEXT("BeginBatch")));
+	TestEqual(TEXT("Batch closed last"), Mock.Recorder.Calls.Last().MethodName, FString(TEXT("EndBatch")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBatchMaterialSingleTransactionTest,
+	"MCPServer.Unit.Batch.Transaction.MaterialBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FBatchMaterialSingleTransactionTest::RunTest(const FString& Parameters)
+{
+	FMockMaterialModule Mock;
+	Mock.SetMaterialExpressionPropertyResult.bSuccess = false;
+	Mock.SetMaterialExpressionPropertyResult.ErrorMessage = TEXT("Property not found");
+	FBatchSetMaterialExpressionPropertiesImplTool Tool(Mock);
+
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetStringField(TEXT("material_path"), TEXT("/Game/M_Test"));
+	TArray<TSharedPtr<FJsonValue>> Ops;
+	auto Op = MakeShared<FJsonObject>();
+	Op->SetNumberField(TEXT("expression_index"), 0);
+	Op->SetStringField(TEXT("property_name"), TEXT("Missing"));
+	Op->SetStringField(TEXT("property_value"), TEXT("1"));
+	Ops.Add(MakeShared<FJsonValueObject>(Op));
+	Ops.Add(MakeShared<FJsonValueObject>(Op));
+	Args->SetArrayField(TEXT("operations"), Ops);
+	auto Result = Tool.Execute(Args);
+
+	// The batch is closed even when every operation fails
+	TestTrue(TEXT("Is error"), MCPTestUtils::IsError(Result));
+	TestEqual(TEXT("One BeginBatch"), Mock.Recorder.GetCallCount(TEXT("BeginBatch")), 1);
+	TestEqual(TEXT("One EndBatch"), Mock.Recorder.GetCallCount(TEXT("EndBatch")), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBatchBlueprintSingleTransactionTest,
+	"MCPServer.Unit.Batch.Transaction.BlueprintBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FBatchBlueprintSingleTransactionTest::RunTest(const FString& Parameters)
+{
+	FMockBlueprintModule Mock;
+	Mock.DeleteGraphNodeResult.bSuccess = true;
+	FBatchDeleteGraphNodesImplTool Tool(Mock);
+
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetStringField(TEXT("blueprint_path"), TEXT("/Game/BP_Test"));
+	Args->SetStringField(TEXT("graph_name"), TEXT("EventGraph"));
+	TArray<TSharedPtr<FJsonValue>> NodeIds;
+	NodeIds.Add(MakeShared<FJsonValueString>(TEXT("AAAA-BBBB-CCCC-DDDD")));
+	NodeIds.Add(MakeShared<FJsonValueString>(TEXT("EEEE-FFFF-0000-1111")));
+	Args->SetArrayField(TEXT("node_ids"), NodeIds);
+	auto Result = Tool.Execute(Args);
+
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	TestEqual(TEXT("One BeginBatch"), Mock.Recorder.GetCallCount(TEXT("BeginBatch")), 1);
+	TestEqual(TEXT("One EndBatch"), Mock.Recorder.GetCallCount(TEXT("EndBatch")), 1);
+	TestEqual(TEXT("Total calls"), Mock.Recorder.GetTotalCallCount(), 4);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBatchSlicedTaskTest,
+	"MCPServer.Unit.Batch.Transaction.SlicedTask",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FBatchSlicedTaskTest::RunTest(const FString& Parameters)
+{
+	FMockActorModule Mock;
+	Mock.SetActorTransformResult.bSuccess = true;
+	FBatchSetActorTransformsImplTool Tool(Mock);
+
+	auto Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Ops;
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		auto Op = MakeShared<FJsonObject>();
+		Op->SetStringField(TEXT("actor_identifier"), FString::Printf(TEXT("Actor_%d"), Index));
+		Ops.Add(MakeShared<FJsonValueObject>(Op));
+	}
+	Args->SetArrayField(TEXT("operations"), Ops);
+
+	TSharedPtr<IMCPToolTask> Task = Tool.StartTask(Args);
+	TestTrue(TEXT("Task created"), Task.IsValid());
+	TestEqual(TEXT("Total"), Task->GetTotal(), 3);
+
+	// An expired deadline still runs one operation per slice
+	TestFalse(TEXT("First slice not finished"), Task->Tick(0.0));
+	TestEqual(TEXT("Progress after first slice"), Task->GetProgress(), 1);
+	TestFalse(TEXT("Second slice not finished"), Task->Tick(0.0));
+	TestEqual(TEXT("Batch closed between slices"),
+		Mock.Recorder.GetCallCount(TEXT("EndBatch")), Mock.Recorder.GetCallCount(TEXT("BeginBatch")));
+	TestTrue(TEXT("Third slice finishes"), Task->Tick(0.0));
+
+	TestTrue(TEXT("Result valid"), MCPTestUtils::IsSuccess(Task->GetResult()));
+	TestTrue(TEXT("Contains 3 succeeded"), MCPTestUtils::GetResultText(Task->GetResult()).Contains(TEXT("3 succeeded")));
+	TestEqual(TEXT("One batch per slice"), Mock.Recorder.GetCallCount(TEXT("BeginBatch")), 3);
+	TestEqual(TEXT("Every batch closed"), Mock.Recorder.GetCallCount(TEXT("EndBatch")), 3);
+	return true;
+}
+
 // ===========================================================================
 // Integration: Batch workflow
 // ===========================================================================
@@ -10,6 +10,8 @@
 #include "Tools/Impl/SetCommentBoxPropertiesImplTool.h"
 #include "Tests/Mocks/MockBlueprintModule.h"
 #include "Tests/Integration/IntegrationTestUtils.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -223,6 +225,7 @@ bool FGetGraphNodesSummarySuccessTest::RunTest(const FString& Parameters)
 	Pin1.PinType = TEXT("exec");
 	Pin1.Direction = TEXT("Output");
 	Pin1.ConnectedPinIds.Add(TEXT("PIN-002"));
+	Pin1.ConnectedNodeIds.Add(TEXT("GUID-002"));
 	Node1.Pins.Add(Pin1);
 
 	FGraphNodeInfo Node2;
@@ -235,6 +238,7 @@ bool FGetGraphNodesSummarySuccessTest::RunTest(const FString& Parameters)
 	Pin2.PinType = TEXT("exec");
 	Pin2.Direction = TEXT("Input");
 	Pin2.ConnectedPinIds.Add(TEXT("PIN-001"));
+	Pin2.ConnectedNodeIds.Add(TEXT("GUID-001"));
 	Node2.Pins.Add(Pin2);
 
 	Mock.GetGraphNodesResult.Nodes.Add(Node1);
@@ -260,6 +264,49 @@ bool FGetGraphNodesSummarySuccessTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetGraphNodesSummaryConnectedNodesTest,
+	"MCPServer.Unit.GraphNodes.GetGraphNodesSummary.ConnectedNodes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGetGraphNodesSummaryConnectedNodesTest::RunTest(const FString& Parameters)
+{
+	FMockBlueprintModule Mock;
+	Mock.GetGraphNodesResult.bSuccess = true;
+
+	// Node1 links twice to Node3; Node2 is not part of the pin data at all
+	FGraphNodeInfo Node1;
+	Node1.NodeId = TEXT("GUID-001");
+	FGraphNodePinInfo Pin1;
+	Pin1.PinId = TEXT("PIN-001");
+	Pin1.ConnectedPinIds.Add(TEXT("PIN-003"));
+	Pin1.ConnectedNodeIds.Add(TEXT("GUID-003"));
+	Pin1.ConnectedPinIds.Add(TEXT("PIN-004"));
+	Pin1.ConnectedNodeIds.Add(TEXT("GUID-003"));
+	Node1.Pins.Add(Pin1);
+	Mock.GetGraphNodesResult.Nodes.Add(Node1);
+
+	FGetGraphNodesSummaryImplTool Tool(Mock);
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetStringField(TEXT("blueprint_path"), TEXT("/Game/BP_Test"));
+	Args->SetStringField(TEXT("graph_name"), TEXT("EventGraph"));
+	auto Result = Tool.Execute(Args);
+
+	TestTrue(TEXT("Success"), MCPTestUtils::IsSuccess(Result));
+	FString Text = MCPTestUtils::GetResultText(Result);
+	FString JsonPart;
+	Text.Split(TEXT("\n"), nullptr, &JsonPart);
+	TArray<TSharedPtr<FJsonValue>> Nodes;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonPart);
+	TestTrue(TEXT("JSON parses"), FJsonSerializer::Deserialize(Reader, Nodes) && Nodes.Num() == 1);
+	if (Nodes.Num() == 1)
+	{
+		const TArray<TSharedPtr<FJsonValue>>& Connected = Nodes[0]->AsObject()->GetArrayField(TEXT("connected_node_ids"));
+		TestEqual(TEXT("Duplicate links collapsed"), Connected.Num(), 1);
+		TestEqual(TEXT("Owner resolved from pin data"), Connected[0]->AsString(), TEXT("GUID-003"));
+	}
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetGraphNodesSummaryClassFilterTest,
 	"MCPServer.Unit.GraphNodes.GetGraphNodesSummary.ClassFilter",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
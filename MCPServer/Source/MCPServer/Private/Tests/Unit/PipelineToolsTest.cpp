@@ -0,0 +1,379 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tools/Impl/RunPipelineImplTool.h"
+#include "Tools/MCPToolRegistry.h"
+#include "Tools/Interfaces/IMCPTool.h"
+#include "Tools/Interfaces/IMCPToolTask.h"
+#include "Tools/MCPBatchToolTask.h"
+#include "Tests/Integration/IntegrationTestUtils.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PipelineTestTools
+{
+	/** Returns its arguments as JSON after a text prefix, like add_graph_node does */
+	class FEchoTool : public IMCPTool
+	{
+	public:
+		int32 CallCount = 0;
+
+		virtual FString GetName() const override { return TEXT("echo"); }
+		virtual FString GetDescription() const override { return TEXT("Echo arguments"); }
+		virtual TSharedPtr<FJsonObject> GetInputSchema() const override
+		{
+			TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+			Schema->SetStringField(TEXT("type"), TEXT("object"));
+			return Schema;
+		}
+		virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override
+		{
+			CallCount++;
+			FString JsonString;
+			TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+			FJsonSerializer::Serialize(Arguments.ToSharedRef(), Writer);
+
+			TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+			TArray<TSharedPtr<FJsonValue>> ContentArray;
+			TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
+			TextContent->SetStringField(TEXT("type"), TEXT("text"));
+			TextContent->SetStringField(TEXT("text"), FString::Printf(TEXT("Echo:\n%s"), *JsonString));
+			ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+			Result->SetArrayField(TEXT("content"), ContentArray);
+			Result->SetBoolField(TEXT("isError"), false);
+			return Result;
+		}
+	};
+
+	class FFailTool : public IMCPTool
+	{
+	public:
+		virtual FString GetName() const override { return TEXT("fail"); }
+		virtual FString GetDescription() const override { return TEXT("Always fails"); }
+		virtual TSharedPtr<FJsonObject> GetInputSchema() const override
+		{
+			TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+			Schema->SetStringField(TEXT("type"), TEXT("object"));
+			return Schema;
+		}
+		virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override
+		{
+			TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+			TArray<TSharedPtr<FJsonValue>> ContentArray;
+			TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
+			TextContent->SetStringField(TEXT("type"), TEXT("text"));
+			TextContent->SetStringField(TEXT("text"), TEXT("Intentional failure"));
+			ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+			Result->SetArrayField(TEXT("content"), ContentArray);
+			Result->SetBoolField(TEXT("isError"), true);
+			return Result;
+		}
+	};
+
+	/** Batch tool with three operations, run as a task like the batch tools */
+	class FBatchTool : public IMCPTool
+	{
+	public:
+		int32 OperationCount = 0;
+		int32 SliceCount = 0;
+
+		virtual FString GetName() const override { return TEXT("batch"); }
+		virtual FString GetDescription() const override { return TEXT("Three batch operations"); }
+		virtual TSharedPtr<FJsonObject> GetInputSchema() const override
+		{
+			TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+			Schema->SetStringField(TEXT("type"), TEXT("object"));
+			return Schema;
+		}
+		virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override
+		{
+			return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+		}
+		virtual TSharedPtr<IMCPToolTask> StartTask(const TSharedPtr<FJsonObject>& Arguments) override
+		{
+			TArray<TSharedPtr<FJsonValue>> Operations;
+			for (int32 Index = 0; Index < 3; ++Index)
+			{
+				Operations.Add(MakeShared<FJsonValueNumber>(Index));
+			}
+			return MakeShared<FMCPBatchToolTask>(TEXT("Batch completed"), Operations,
+				[this](const TSharedPtr<FJsonValue>& Operation, FString& OutError)
+				{
+					OperationCount++;
+					return true;
+				},
+				[this]() { SliceCount++; });
+		}
+		virtual EMCPToolPriority GetPriority() const override { return EMCPToolPriority::Bulk; }
+	};
+
+	class FBuildTool : public FEchoTool
+	{
+	public:
+		virtual FString GetName() const override { return TEXT("build"); }
+		virtual EMCPToolPriority GetPriority() const override { return EMCPToolPriority::Build; }
+	};
+
+	struct FTestContext
+	{
+		FMCPToolRegistry Registry;
+		TSharedPtr<FEchoTool> EchoTool = MakeShared<FEchoTool>();
+		TSharedPtr<FBatchTool> BatchTool = MakeShared<FBatchTool>();
+		TSharedPtr<FRunPipelineImplTool> PipelineTool;
+
+		FTestContext()
+		{
+			Registry.RegisterTool(EchoTool);
+			Registry.RegisterTool(BatchTool);
+			Registry.RegisterTool(MakeShared<FBuildTool>());
+			Registry.RegisterTool(MakeShared<FFailTool>());
+			PipelineTool = MakeShared<FRunPipelineImplTool>(Registry);
+			Registry.RegisterTool(PipelineTool);
+		}
+	};
+
+	TSharedPtr<FJsonValue> MakeStep(const FString& Id, const FString& Tool, const TSharedPtr<FJsonObject>& Arguments = nullptr)
+	{
+		TSharedPtr<FJsonObject> Step = MakeShared<FJsonObject>();
+		if (!Id.IsEmpty())
+		{
+			Step->SetStringField(TEXT("id"), Id);
+		}
+		Step->SetStringField(TEXT("tool"), Tool);
+		if (Arguments.IsValid())
+		{
+			Step->SetObjectField(TEXT("arguments"), Arguments);
+		}
+		return MakeShared<FJsonValueObject>(Step);
+	}
+
+	TSharedPtr<FJsonObject> GetStepResult(const TSharedPtr<FJsonObject>& Result, int32 StepIndex)
+	{
+		const TSharedPtr<FJsonObject>* Structured = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* Steps = nullptr;
+		if (!Result.IsValid() || !Result->TryGetObjectField(TEXT("structuredContent"), Structured)
+			|| !(*Structured)->TryGetArrayField(TEXT("steps"), Steps) || !Steps->IsValidIndex(StepIndex))
+		{
+			return nullptr;
+		}
+		return (*Steps)[StepIndex]->AsObject();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunPipelineMetadataTest,
+	"MCPServer.Unit.Pipeline.RunPipeline.Metadata",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRunPipelineMetadataTest::RunTest(const FString& Parameters)
+{
+	PipelineTestTools::FTestContext Context;
+	TestEqual(TEXT("Name"), Context.PipelineTool->GetName(), TEXT("run_pipeline"));
+	TestTrue(TEXT("Description not empty"), !Context.PipelineTool->GetDescription().IsEmpty());
+	TestTrue(TEXT("Schema valid"), Context.PipelineTool->GetInputSchema().IsValid());
+	TestTrue(TEXT("Schema has type"), Context.PipelineTool->GetInputSchema()->HasField(TEXT("type")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunPipelineReferencesTest,
+	"MCPServer.Unit.Pipeline.RunPipeline.References",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRunPipelineReferencesTest::RunTest(const FString& Parameters)
+{
+	PipelineTestTools::FTestContext Context;
+
+	// Step "node" produces a node object with pins, like add_graph_node
+	TSharedPtr<FJsonObject> NodeArgs = MakeShared<FJsonObject>();
+	NodeArgs->SetStringField(TEXT("node_id"), TEXT("NODE-1"));
+	NodeArgs->SetNumberField(TEXT("pos_x"), 300);
+	TArray<TSharedPtr<FJsonValue>> Pins;
+	TSharedPtr<FJsonObject> ExecPin = MakeShared<FJsonObject>();
+	ExecPin->SetStringField(TEXT("pin_name"), TEXT("execute"));
+	ExecPin->SetStringField(TEXT("pin_id"), TEXT("PIN-EXEC"));
+	Pins.Add(MakeShared<FJsonValueObject>(ExecPin));
+	TSharedPtr<FJsonObject> ThenPin = MakeShared<FJsonObject>();
+	ThenPin->SetStringField(TEXT("pin_name"), TEXT("then"));
+	ThenPin->SetStringField(TEXT("pin_id"), TEXT("PIN-THEN"));
+	Pins.Add(MakeShared<FJsonValueObject>(ThenPin));
+	NodeArgs->SetArrayField(TEXT("pins"), Pins);
+
+	TSharedPtr<FJsonObject> LinkArgs = MakeShared<FJsonObject>();
+	LinkArgs->SetStringField(TEXT("source_node_id"), TEXT("${node.node_id}"));
+	LinkArgs->SetStringField(TEXT("source_pin_id"), TEXT("${node.pins.pin_name=then.pin_id}"));
+	LinkArgs->SetStringField(TEXT("first_pin"), TEXT("${node.pins.0.pin_name}"));
+	LinkArgs->SetStringField(TEXT("label"), TEXT("Node ${node.node_id} at ${node.pos_x}"));
+	LinkArgs->SetStringField(TEXT("pos_x"), TEXT("${node.pos_x}"));
+
+	auto Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Steps;
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("node"), TEXT("echo"), NodeArgs));
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("link"), TEXT("echo"), LinkArgs));
+	Args->SetArrayField(TEXT("steps"), Steps);
+
+	auto Result = Context.PipelineTool->Execute(Args);
+	TestTrue(TEXT("Pipeline succeeds"), MCPTestUtils::IsSuccess(Result));
+	TestEqual(TEXT("Both steps ran"), Context.EchoTool->CallCount, 2);
+
+	TSharedPtr<FJsonObject> LinkStep = PipelineTestTools::GetStepResult(Result, 1);
+	if (!TestTrue(TEXT("Has link step"), LinkStep.IsValid()))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Link step status"), LinkStep->GetStringField(TEXT("status")), TEXT("succeeded"));
+
+	TSharedPtr<FJsonObject> Output = LinkStep->GetObjectField(TEXT("output"));
+	TestEqual(TEXT("Field reference"), Output->GetStringField(TEXT("source_node_id")), TEXT("NODE-1"));
+	TestEqual(TEXT("key=value selector"), Output->GetStringField(TEXT("source_pin_id")), TEXT("PIN-THEN"));
+	TestEqual(TEXT("Index selector"), Output->GetStringField(TEXT("first_pin")), TEXT("execute"));
+	TestEqual(TEXT("Interpolated string"), Output->GetStringField(TEXT("label")), TEXT("Node NODE-1 at 300"));
+
+	double PosX = 0.0;
+	TestTrue(TEXT("Whole-string reference keeps the number type"), Output->TryGetNumberField(TEXT("pos_x"), PosX));
+	TestEqual(TEXT("Referenced number"), PosX, 300.0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunPipelineStopOnErrorTest,
+	"MCPServer.Unit.Pipeline.RunPipeline.StopOnError",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRunPipelineStopOnErrorTest::RunTest(const FString& Parameters)
+{
+	PipelineTestTools::FTestContext Context;
+
+	TArray<TSharedPtr<FJsonValue>> Steps;
+	Steps.Add(PipelineTestTools::MakeStep(TEXT(""), TEXT("echo")));
+	Steps.Add(PipelineTestTools::MakeStep(TEXT(""), TEXT("fail")));
+	Steps.Add(PipelineTestTools::MakeStep(TEXT(""), TEXT("echo")));
+
+	// Default: stop at the first failure
+	auto Args = MakeShared<FJsonObject>();
+	Args->SetArrayField(TEXT("steps"), Steps);
+	auto Result = Context.PipelineTool->Execute(Args);
+	TestTrue(TEXT("Pipeline with a failed step is an error"), MCPTestUtils::IsError(Result));
+	TestEqual(TEXT("Only the first echo ran"), Context.EchoTool->CallCount, 1);
+	TestEqual(TEXT("Default step id is the index"), PipelineTestTools::GetStepResult(Result, 1)->GetStringField(TEXT("id")), TEXT("1"));
+	TestEqual(TEXT("Failed step error"), PipelineTestTools::GetStepResult(Result, 1)->GetStringField(TEXT("error")), TEXT("Intentional failure"));
+	TestEqual(TEXT("Last step skipped"), PipelineTestTools::GetStepResult(Result, 2)->GetStringField(TEXT("status")), TEXT("skipped"));
+
+	// stop_on_error=false: keep going
+	Args->SetBoolField(TEXT("stop_on_error"), false);
+	Result = Context.PipelineTool->Execute(Args);
+	TestEqual(TEXT("Both echo steps ran"), Context.EchoTool->CallCount, 3);
+	TestEqual(TEXT("Last step succeeded"), PipelineTestTools::GetStepResult(Result, 2)->GetStringField(TEXT("status")), TEXT("succeeded"));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunPipelineUnresolvedReferenceTest,
+	"MCPServer.Unit.Pipeline.RunPipeline.UnresolvedReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRunPipelineUnresolvedReferenceTest::RunTest(const FString& Parameters)
+{
+	PipelineTestTools::FTestContext Context;
+
+	TSharedPtr<FJsonObject> StepArgs = MakeShared<FJsonObject>();
+	StepArgs->SetStringField(TEXT("node_id"), TEXT("${later.node_id}"));
+
+	auto Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Steps;
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("first"), TEXT("echo"), StepArgs));
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("later"), TEXT("echo")));
+	Args->SetArrayField(TEXT("steps"), Steps);
+
+	auto Result = Context.PipelineTool->Execute(Args);
+	TestTrue(TEXT("Pipeline is an error"), MCPTestUtils::IsError(Result));
+	TestEqual(TEXT("Tool not called with an unresolved argument"), Context.EchoTool->CallCount, 0);
+	TestTrue(TEXT("Error names the reference"),
+		PipelineTestTools::GetStepResult(Result, 0)->GetStringField(TEXT("error")).Contains(TEXT("${later.node_id}")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunPipelineValidationTest,
+	"MCPServer.Unit.Pipeline.RunPipeline.Validation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRunPipelineValidationTest::RunTest(const FString& Parameters)
+{
+	PipelineTestTools::FTestContext Context;
+
+	auto Result = Context.PipelineTool->Execute(MakeShared<FJsonObject>());
+	TestTrue(TEXT("Missing steps is an error"), MCPTestUtils::IsError(Result));
+
+	auto Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Steps;
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("a"), TEXT("echo")));
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("b"), TEXT("no_such_tool")));
+	Args->SetArrayField(TEXT("steps"), Steps);
+	Result = Context.PipelineTool->Execute(Args);
+	TestTrue(TEXT("Unknown tool is an error"), MCPTestUtils::IsError(Result));
+	TestEqual(TEXT("Nothing ran before validation failed"), Context.EchoTool->CallCount, 0);
+
+	Steps.Reset();
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("a"), TEXT("run_pipeline")));
+	Args->SetArrayField(TEXT("steps"), Steps);
+	Result = Context.PipelineTool->Execute(Args);
+	TestTrue(TEXT("Nested pipeline is an error"), MCPTestUtils::IsError(Result));
+
+	Steps.Reset();
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("a"), TEXT("echo")));
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("b"), TEXT("build")));
+	Args->SetArrayField(TEXT("steps"), Steps);
+	Result = Context.PipelineTool->Execute(Args);
+	TestTrue(TEXT("Build tool step is an error"), MCPTestUtils::IsError(Result));
+	TestEqual(TEXT("Nothing ran before a build step was refused"), Context.EchoTool->CallCount, 0);
+
+	Steps.Reset();
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("a"), TEXT("echo")));
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("a"), TEXT("echo")));
+	Args->SetArrayField(TEXT("steps"), Steps);
+	Result = Context.PipelineTool->Execute(Args);
+	TestTrue(TEXT("Duplicate id is an error"), MCPTestUtils::IsError(Result));
+	TestTrue(TEXT("Error mentions duplicate"), MCPTestUtils::GetResultText(Result).Contains(TEXT("duplicate")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRunPipelineSlicedStepTest,
+	"MCPServer.Unit.Pipeline.RunPipeline.SlicedStep",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRunPipelineSlicedStepTest::RunTest(const FString& Parameters)
+{
+	PipelineTestTools::FTestContext Context;
+
+	auto Args = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Steps;
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("batch"), TEXT("batch")));
+	Steps.Add(PipelineTestTools::MakeStep(TEXT("after"), TEXT("echo")));
+	Args->SetArrayField(TEXT("steps"), Steps);
+
+	TSharedPtr<IMCPToolTask> Task = Context.PipelineTool->StartTask(Args);
+	if (!TestTrue(TEXT("Task started"), Task.IsValid()))
+	{
+		return false;
+	}
+
+	// An expired budget runs one operation of the batch step, not the whole batch
+	TestFalse(TEXT("First slice not finished"), Task->Tick(0.0));
+	TestEqual(TEXT("One batch operation in the first slice"), Context.BatchTool->OperationCount, 1);
+	TestEqual(TEXT("Next step waits for the batch"), Context.EchoTool->CallCount, 0);
+	TestEqual(TEXT("No step completed yet"), Task->GetProgress(), 0);
+
+	int32 Slices = 1;
+	while (!Task->Tick(0.0) && Slices < 10)
+	{
+		Slices++;
+	}
+	TestEqual(TEXT("All batch operations ran"), Context.BatchTool->OperationCount, 3);
+	TestEqual(TEXT("Batch step ticked once per slice"), Context.BatchTool->SliceCount, 3);
+	TestEqual(TEXT("Next step ran after the batch"), Context.EchoTool->CallCount, 1);
+	TestTrue(TEXT("Pipeline succeeds"), MCPTestUtils::IsSuccess(Task->GetResult()));
+	TestEqual(TEXT("Batch step succeeded"),
+		PipelineTestTools::GetStepResult(Task->GetResult(), 0)->GetStringField(TEXT("status")), TEXT("succeeded"));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -174,3 +174,8 @@ TSharedPtr<FJsonObject> FAddGraphNodesBatchImplTool::Execute(const TSharedPtr<FJ
 	Result->SetArrayField(TEXT("content"), ContentArray);
 	return Result;
 }
+
+EMCPToolPriority FAddGraphNodesBatchImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
+}
@@ -2,6 +2,7 @@
 
 #include "Tools/Impl/BatchConnectGraphPinsImplTool.h"
 #include "Modules/Interfaces/IBlueprintModule.h"
+#include "Tools/MCPBatchToolTask.h"
 #include "Dom/JsonValue.h"
 
 FBatchConnectGraphPinsImplTool::FBatchConnectGraphPinsImplTool(IBlueprintModule& InBlueprintModule)
@@ -16,7 +17,7 @@ FString FBatchConnectGraphPinsImplTool::GetName() const
 
 FString FBatchConnectGraphPinsImplTool::GetDescription() const
 {
-	return TEXT("Connect multiple pin pairs in a single call (up to 100 connections per call)");
+	return TEXT("Connect multiple pin pairs in a single call. Large batches run in time slices without blocking the editor.");
 }
 
 TSharedPtr<FJsonObject> FBatchConnectGraphPinsImplTool::GetInputSchema() const
@@ -38,7 +39,7 @@ TSharedPtr<FJsonObject> FBatchConnectGraphPinsImplTool::GetInputSchema() const
 
 	TSharedPtr<FJsonObject> ConnsProp = MakeShared<FJsonObject>();
 	ConnsProp->SetStringField(TEXT("type"), TEXT("array"));
-	ConnsProp->SetStringField(TEXT("description"), TEXT("Array of connections (max 100). Each: {source_node_id, source_pin, target_node_id, target_pin}"));
+	ConnsProp->SetStringField(TEXT("description"), TEXT("Array of connections. Each: {source_node_id, source_pin, target_node_id, target_pin}"));
 	Properties->SetObjectField(TEXT("connections"), ConnsProp);
 
 	Schema->SetObjectField(TEXT("properties"), Properties);
@@ -53,6 +54,11 @@ TSharedPtr<FJsonObject> FBatchConnectGraphPinsImplTool::GetInputSchema() const
 }
 
 TSharedPtr<FJsonObject> FBatchConnectGraphPinsImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+}
+
+TSharedPtr<IMCPToolTask> FBatchConnectGraphPinsImplTool::StartTask(const TSharedPtr<FJsonObject>& Arguments)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> ContentArray;
@@ -68,7 +74,7 @@ TSharedPtr<FJsonObject> FBatchConnectGraphPinsImplTool::Execute(const TSharedPtr
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* ConnsArray = nullptr;
@@ -80,76 +86,40 @@ TSharedPtr<FJsonObject> FBatchConnectGraphPinsImplTool::Execute(const TSharedPtr
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	if (ConnsArray->Num() > 100)
-	{
-		TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-		TextContent->SetStringField(TEXT("type"), TEXT("text"));
-		TextContent->SetStringField(TEXT("text"), TEXT("Maximum 100 connections per call"));
-		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-		Result->SetArrayField(TEXT("content"), ContentArray);
-		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	int32 Succeeded = 0;
-	int32 Failed = 0;
-	TArray<FString> Errors;
-
-	for (int32 i = 0; i < ConnsArray->Num(); ++i)
-	{
-		const TSharedPtr<FJsonObject>* ConnObj = nullptr;
-		if (!(*ConnsArray)[i].IsValid() || !(*ConnsArray)[i]->TryGetObject(ConnObj) || !ConnObj || !(*ConnObj).IsValid())
-		{
-			++Failed;
-			Errors.Add(FString::Printf(TEXT("[%d] Invalid connection object"), i));
-			continue;
-		}
-
-		FString SourceNodeId, SourcePin, TargetNodeId, TargetPin;
-		(*ConnObj)->TryGetStringField(TEXT("source_node_id"), SourceNodeId);
-		(*ConnObj)->TryGetStringField(TEXT("source_pin"), SourcePin);
-		(*ConnObj)->TryGetStringField(TEXT("target_node_id"), TargetNodeId);
-		(*ConnObj)->TryGetStringField(TEXT("target_pin"), TargetPin);
-
-		if (SourceNodeId.IsEmpty() || SourcePin.IsEmpty() || TargetNodeId.IsEmpty() || TargetPin.IsEmpty())
-		{
-			++Failed;
-			Errors.Add(FString::Printf(TEXT("[%d] Missing fields in connection"), i));
-			continue;
-		}
-
-		FConnectGraphPinsResult ConnResult = BlueprintModule.ConnectGraphPins(BlueprintPath, GraphName, SourceNodeId, SourcePin, TargetNodeId, TargetPin);
-		if (ConnResult.bSuccess)
-		{
-			++Succeeded;
-		}
-		else
-		{
-			++Failed;
-			Errors.Add(FString::Printf(TEXT("[%d] %s"), i, *ConnResult.ErrorMessage));
-		}
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
-	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-	TextContent->SetStringField(TEXT("type"), TEXT("text"));
-
-	FString ResponseText = FString::Printf(TEXT("Batch connect: %d succeeded, %d failed"), Succeeded, Failed);
-	if (Errors.Num() > 0)
-	{
-		ResponseText += TEXT("\nErrors:");
-		for (const FString& Err : Errors)
+	return MakeShared<FMCPBatchToolTask>(TEXT("Batch connect"), *ConnsArray,
+		[this, BlueprintPath, GraphName](const TSharedPtr<FJsonValue>& Operation, FString& OutError)
 		{
-			ResponseText += FString::Printf(TEXT("\n- %s"), *Err);
-		}
-	}
-	TextContent->SetStringField(TEXT("text"), ResponseText);
-
-	Result->SetBoolField(TEXT("isError"), Succeeded == 0 && Failed > 0);
+			const TSharedPtr<FJsonObject>* ConnObj = nullptr;
+			if (!Operation->TryGetObject(ConnObj) || !ConnObj || !(*ConnObj).IsValid())
+			{
+				OutError = TEXT("Invalid connection object");
+				return false;
+			}
+
+			FString SourceNodeId, SourcePin, TargetNodeId, TargetPin;
+			(*ConnObj)->TryGetStringField(TEXT("source_node_id"), SourceNodeId);
+			(*ConnObj)->TryGetStringField(TEXT("source_pin"), SourcePin);
+			(*ConnObj)->TryGetStringField(TEXT("target_node_id"), TargetNodeId);
+			(*ConnObj)->TryGetStringField(TEXT("target_pin"), TargetPin);
+
+			if (SourceNodeId.IsEmpty() || SourcePin.IsEmpty() || TargetNodeId.IsEmpty() || TargetPin.IsEmpty())
+			{
+				OutError = TEXT("Missing fields in connection");
+				return false;
+			}
+
+			FConnectGraphPinsResult ConnResult = BlueprintModule.ConnectGraphPins(BlueprintPath, GraphName, SourceNodeId, SourcePin, TargetNodeId, TargetPin);
+			OutError = ConnResult.ErrorMessage;
+			return ConnResult.bSuccess;
+		},
+		[this]() { BlueprintModule.BeginBatch(TEXT("Batch Connect Graph Pins")); },
+		[this]() { BlueprintModule.EndBatch(); });
+}
 
-	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-	Result->SetArrayField(TEXT("content"), ContentArray);
-	return Result;
+EMCPToolPriority FBatchConnectGraphPinsImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
 }
@@ -2,6 +2,7 @@
 
 #include "Tools/Impl/BatchConnectMaterialExpressionsImplTool.h"
 #include "Modules/Interfaces/IMaterialModule.h"
+#include "Tools/MCPBatchToolTask.h"
 #include "Dom/JsonValue.h"
 
 FBatchConnectMaterialExpressionsImplTool::FBatchConnectMaterialExpressionsImplTool(IMaterialModule& InMaterialModule)
@@ -16,7 +17,7 @@ FString FBatchConnectMaterialExpressionsImplTool::GetName() const
 
 FString FBatchConnectMaterialExpressionsImplTool::GetDescription() const
 {
-	return TEXT("Connect multiple material expression nodes in one call. Up to 100 connections per batch.");
+	return TEXT("Connect multiple material expression nodes in one call. Large batches run in time slices without blocking the editor.");
 }
 
 TSharedPtr<FJsonObject> FBatchConnectMaterialExpressionsImplTool::GetInputSchema() const
@@ -71,6 +72,11 @@ TSharedPtr<FJsonObject> FBatchConnectMaterialExpressionsImplTool::GetInputSchema
 }
 
 TSharedPtr<FJsonObject> FBatchConnectMaterialExpressionsImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+}
+
+TSharedPtr<IMCPToolTask> FBatchConnectMaterialExpressionsImplTool::StartTask(const TSharedPtr<FJsonObject>& Arguments)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> ContentArray;
@@ -84,7 +90,7 @@ TSharedPtr<FJsonObject> FBatchConnectMaterialExpressionsImplTool::Execute(const
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* Connections = nullptr;
@@ -96,77 +102,46 @@ TSharedPtr<FJsonObject> FBatchConnectMaterialExpressionsImplTool::Execute(const
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	if (Connections->Num() > 100)
-	{
-		TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-		TextContent->SetStringField(TEXT("type"), TEXT("text"));
-		TextContent->SetStringField(TEXT("text"), TEXT("Too many connections. Maximum 100 per batch."));
-		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-		Result->SetArrayField(TEXT("content"), ContentArray);
-		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
-	int32 Succeeded = 0;
-	int32 Failed = 0;
-	FString Errors;
-
-	for (int32 i = 0; i < Connections->Num(); ++i)
-	{
-		const TSharedPtr<FJsonObject>* ConnObj = nullptr;
-		if (!(*Connections)[i]->TryGetObject(ConnObj) || !ConnObj || !(*ConnObj).IsValid())
-		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] Invalid connection object\n"), i);
-			continue;
-		}
-
-		double FromIndexValue = 0.0, ToIndexValue = 0.0;
-		FString ToInput;
-		if (!(*ConnObj)->TryGetNumberField(TEXT("from_index"), FromIndexValue) ||
-			!(*ConnObj)->TryGetNumberField(TEXT("to_index"), ToIndexValue) ||
-			!(*ConnObj)->TryGetStringField(TEXT("to_input"), ToInput))
+	return MakeShared<FMCPBatchToolTask>(TEXT("Batch completed"), *Connections,
+		[this, MaterialPath](const TSharedPtr<FJsonValue>& Operation, FString& OutError)
 		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] Missing from_index, to_index, or to_input\n"), i);
-			continue;
-		}
-
-		FString FromOutput;
-		(*ConnObj)->TryGetStringField(TEXT("from_output"), FromOutput);
-
-		int32 FromIndex = static_cast<int32>(FromIndexValue);
-		int32 ToIndex = static_cast<int32>(ToIndexValue);
-
-		FConnectExpressionsResult OpResult = MaterialModule.ConnectMaterialExpressions(
-			MaterialPath, FromIndex, FromOutput, ToIndex, ToInput);
-
-		if (OpResult.bSuccess)
-		{
-			Succeeded++;
-		}
-		else
-		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] %s\n"), i, *OpResult.ErrorMessage);
-		}
-	}
-
-	FString ResponseText = FString::Printf(TEXT("Batch completed: %d succeeded, %d failed"), Succeeded, Failed);
-	if (!Errors.IsEmpty())
-	{
-		ResponseText += TEXT("\n\nErrors:\n") + Errors;
-	}
-
-	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-	TextContent->SetStringField(TEXT("type"), TEXT("text"));
-	TextContent->SetStringField(TEXT("text"), ResponseText);
-	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-	Result->SetArrayField(TEXT("content"), ContentArray);
-	Result->SetBoolField(TEXT("isError"), Succeeded == 0 && Failed > 0);
+			const TSharedPtr<FJsonObject>* ConnObj = nullptr;
+			if (!Operation->TryGetObject(ConnObj) || !ConnObj || !(*ConnObj).IsValid())
+			{
+				OutError = TEXT("Invalid connection object");
+				return false;
+			}
+
+			double FromIndexValue = 0.0, ToIndexValue = 0.0;
+			FString ToInput;
+			if (!(*ConnObj)->TryGetNumberField(TEXT("from_index"), FromIndexValue) ||
+				!(*ConnObj)->TryGetNumberField(TEXT("to_index"), ToIndexValue) ||
+				!(*ConnObj)->TryGetStringField(TEXT("to_input"), ToInput))
+			{
+				OutError = TEXT("Missing from_index, to_index, or to_input");
+				return false;
+			}
+
+			FString FromOutput;
+			(*ConnObj)->TryGetStringField(TEXT("from_output"), FromOutput);
+
+			int32 FromIndex = static_cast<int32>(FromIndexValue);
+			int32 ToIndex = static_cast<int32>(ToIndexValue);
+
+			FConnectExpressionsResult OpResult = MaterialModule.ConnectMaterialExpressions(
+				MaterialPath, FromIndex, FromOutput, ToIndex, ToInput);
+
+			OutError = OpResult.ErrorMessage;
+			return OpResult.bSuccess;
+		},
+		[this]() { MaterialModule.BeginBatch(TEXT("Batch Connect Material Expressions")); },
+		[this]() { MaterialModule.EndBatch(); });
+}
 
-	return Result;
+EMCPToolPriority FBatchConnectMaterialExpressionsImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
 }
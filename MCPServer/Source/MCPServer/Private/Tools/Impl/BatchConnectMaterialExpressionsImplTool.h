@@ -14,6 +14,8 @@ public:
 	virtual FString GetDescription() const override;
 	virtual TSharedPtr<FJsonObject> GetInputSchema() const override;
 	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override;
+	virtual TSharedPtr<IMCPToolTask> StartTask(const TSharedPtr<FJsonObject>& Arguments) override;
+	virtual EMCPToolPriority GetPriority() const override;
 
 private:
 	IMaterialModule& MaterialModule;
@@ -2,6 +2,7 @@
 
 #include "Tools/Impl/BatchDeleteGraphNodesImplTool.h"
 #include "Modules/Interfaces/IBlueprintModule.h"
+#include "Tools/MCPBatchToolTask.h"
 #include "Dom/JsonValue.h"
 
 FBatchDeleteGraphNodesImplTool::FBatchDeleteGraphNodesImplTool(IBlueprintModule& InBlueprintModule)
@@ -16,7 +17,7 @@ FString FBatchDeleteGraphNodesImplTool::GetName() const
 
 FString FBatchDeleteGraphNodesImplTool::GetDescription() const
 {
-	return TEXT("Delete multiple graph nodes in a single call (up to 100 nodes per call)");
+	return TEXT("Delete multiple graph nodes in a single call. Large batches run in time slices without blocking the editor.");
 }
 
 TSharedPtr<FJsonObject> FBatchDeleteGraphNodesImplTool::GetInputSchema() const
@@ -38,7 +39,7 @@ TSharedPtr<FJsonObject> FBatchDeleteGraphNodesImplTool::GetInputSchema() const
 
 	TSharedPtr<FJsonObject> NodeIdsProp = MakeShared<FJsonObject>();
 	NodeIdsProp->SetStringField(TEXT("type"), TEXT("array"));
-	NodeIdsProp->SetStringField(TEXT("description"), TEXT("Array of node GUID strings to delete (max 100)"));
+	NodeIdsProp->SetStringField(TEXT("description"), TEXT("Array of node GUID strings to delete"));
 	Properties->SetObjectField(TEXT("node_ids"), NodeIdsProp);
 
 	Schema->SetObjectField(TEXT("properties"), Properties);
@@ -53,6 +54,11 @@ TSharedPtr<FJsonObject> FBatchDeleteGraphNodesImplTool::GetInputSchema() const
 }
 
 TSharedPtr<FJsonObject> FBatchDeleteGraphNodesImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+}
+
+TSharedPtr<IMCPToolTask> FBatchDeleteGraphNodesImplTool::StartTask(const TSharedPtr<FJsonObject>& Arguments)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> ContentArray;
@@ -68,7 +74,7 @@ TSharedPtr<FJsonObject> FBatchDeleteGraphNodesImplTool::Execute(const TSharedPtr
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* NodeIdsArray = nullptr;
@@ -80,63 +86,28 @@ TSharedPtr<FJsonObject> FBatchDeleteGraphNodesImplTool::Execute(const TSharedPtr
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
-	if (NodeIdsArray->Num() > 100)
-	{
-		TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-		TextContent->SetStringField(TEXT("type"), TEXT("text"));
-		TextContent->SetStringField(TEXT("text"), TEXT("Maximum 100 node_ids per call"));
-		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-		Result->SetArrayField(TEXT("content"), ContentArray);
-		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	int32 Succeeded = 0;
-	int32 Failed = 0;
-	TArray<FString> Errors;
-
-	for (int32 i = 0; i < NodeIdsArray->Num(); ++i)
-	{
-		FString NodeId;
-		if (!(*NodeIdsArray)[i].IsValid() || !(*NodeIdsArray)[i]->TryGetString(NodeId) || NodeId.IsEmpty())
+	return MakeShared<FMCPBatchToolTask>(TEXT("Batch delete"), *NodeIdsArray,
+		[this, BlueprintPath, GraphName](const TSharedPtr<FJsonValue>& Operation, FString& OutError)
 		{
-			++Failed;
-			Errors.Add(FString::Printf(TEXT("[%d] Invalid or empty node_id"), i));
-			continue;
-		}
-
-		FDeleteGraphNodeResult DeleteResult = BlueprintModule.DeleteGraphNode(BlueprintPath, GraphName, NodeId);
-		if (DeleteResult.bSuccess)
-		{
-			++Succeeded;
-		}
-		else
-		{
-			++Failed;
-			Errors.Add(FString::Printf(TEXT("[%d] %s"), i, *DeleteResult.ErrorMessage));
-		}
-	}
-
-	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-	TextContent->SetStringField(TEXT("type"), TEXT("text"));
-
-	FString ResponseText = FString::Printf(TEXT("Batch delete: %d succeeded, %d failed"), Succeeded, Failed);
-	if (Errors.Num() > 0)
-	{
-		ResponseText += TEXT("\nErrors:");
-		for (const FString& Err : Errors)
-		{
-			ResponseText += FString::Printf(TEXT("\n- %s"), *Err);
-		}
-	}
-	TextContent->SetStringField(TEXT("text"), ResponseText);
-
-	Result->SetBoolField(TEXT("isError"), Succeeded == 0 && Failed > 0);
+			FString NodeId;
+			if (!Operation->TryGetString(NodeId) || NodeId.IsEmpty())
+			{
+				OutError = TEXT("Invalid or empty node_id");
+				return false;
+			}
+
+			FDeleteGraphNodeResult DeleteResult = BlueprintModule.DeleteGraphNode(BlueprintPath, GraphName, NodeId);
+			OutError = DeleteResult.ErrorMessage;
+			return DeleteResult.bSuccess;
+		},
+		[this]() { BlueprintModule.BeginBatch(TEXT("Batch Delete Graph Nodes")); },
+		[this]() { BlueprintModule.EndBatch(); });
+}
 
-	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-	Result->SetArrayField(TEXT("content"), ContentArray);
-	return Result;
+EMCPToolPriority FBatchDeleteGraphNodesImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
 }
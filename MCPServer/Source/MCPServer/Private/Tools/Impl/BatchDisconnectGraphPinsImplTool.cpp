@@ -2,6 +2,7 @@
 
 #include "Tools/Impl/BatchDisconnectGraphPinsImplTool.h"
 #include "Modules/Interfaces/IBlueprintModule.h"
+#include "Tools/MCPBatchToolTask.h"
 #include "Dom/JsonValue.h"
 
 FBatchDisconnectGraphPinsImplTool::FBatchDisconnectGraphPinsImplTool(IBlueprintModule& InBlueprintModule)
@@ -16,7 +17,7 @@ FString FBatchDisconnectGraphPinsImplTool::GetName() const
 
 FString FBatchDisconnectGraphPinsImplTool::GetDescription() const
 {
-	return TEXT("Disconnect multiple pin pairs in a single call (up to 100 disconnections per call)");
+	return TEXT("Disconnect multiple pin pairs in a single call. Large batches run in time slices without blocking the editor.");
 }
 
 TSharedPtr<FJsonObject> FBatchDisconnectGraphPinsImplTool::GetInputSchema() const
@@ -38,7 +39,7 @@ TSharedPtr<FJsonObject> FBatchDisconnectGraphPinsImplTool::GetInputSchema() cons
 
 	TSharedPtr<FJsonObject> DisconnsProp = MakeShared<FJsonObject>();
 	DisconnsProp->SetStringField(TEXT("type"), TEXT("array"));
-	DisconnsProp->SetStringField(TEXT("description"), TEXT("Array of disconnections (max 100). Each: {source_node_id, source_pin, target_node_id, target_pin}"));
+	DisconnsProp->SetStringField(TEXT("description"), TEXT("Array of disconnections. Each: {source_node_id, source_pin, target_node_id, target_pin}"));
 	Properties->SetObjectField(TEXT("disconnections"), DisconnsProp);
 
 	Schema->SetObjectField(TEXT("properties"), Properties);
@@ -53,6 +54,11 @@ TSharedPtr<FJsonObject> FBatchDisconnectGraphPinsImplTool::GetInputSchema() cons
 }
 
 TSharedPtr<FJsonObject> FBatchDisconnectGraphPinsImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+}
+
+TSharedPtr<IMCPToolTask> FBatchDisconnectGraphPinsImplTool::StartTask(const TSharedPtr<FJsonObject>& Arguments)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> ContentArray;
@@ -68,7 +74,7 @@ TSharedPtr<FJsonObject> FBatchDisconnectGraphPinsImplTool::Execute(const TShared
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* DisconnsArray = nullptr;
@@ -80,76 +86,40 @@ TSharedPtr<FJsonObject> FBatchDisconnectGraphPinsImplTool::Execute(const TShared
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	if (DisconnsArray->Num() > 100)
-	{
-		TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-		TextContent->SetStringField(TEXT("type"), TEXT("text"));
-		TextContent->SetStringField(TEXT("text"), TEXT("Maximum 100 disconnections per call"));
-		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-		Result->SetArrayField(TEXT("content"), ContentArray);
-		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	int32 Succeeded = 0;
-	int32 Failed = 0;
-	TArray<FString> Errors;
-
-	for (int32 i = 0; i < DisconnsArray->Num(); ++i)
-	{
-		const TSharedPtr<FJsonObject>* DisconnObj = nullptr;
-		if (!(*DisconnsArray)[i].IsValid() || !(*DisconnsArray)[i]->TryGetObject(DisconnObj) || !DisconnObj || !(*DisconnObj).IsValid())
-		{
-			++Failed;
-			Errors.Add(FString::Printf(TEXT("[%d] Invalid disconnection object"), i));
-			continue;
-		}
-
-		FString SourceNodeId, SourcePin, TargetNodeId, TargetPin;
-		(*DisconnObj)->TryGetStringField(TEXT("source_node_id"), SourceNodeId);
-		(*DisconnObj)->TryGetStringField(TEXT("source_pin"), SourcePin);
-		(*DisconnObj)->TryGetStringField(TEXT("target_node_id"), TargetNodeId);
-		(*DisconnObj)->TryGetStringField(TEXT("target_pin"), TargetPin);
-
-		if (SourceNodeId.IsEmpty() || SourcePin.IsEmpty() || TargetNodeId.IsEmpty() || TargetPin.IsEmpty())
-		{
-			++Failed;
-			Errors.Add(FString::Printf(TEXT("[%d] Missing fields in disconnection"), i));
-			continue;
-		}
-
-		FDisconnectGraphPinsResult DisconnResult = BlueprintModule.DisconnectGraphPins(BlueprintPath, GraphName, SourceNodeId, SourcePin, TargetNodeId, TargetPin);
-		if (DisconnResult.bSuccess)
-		{
-			++Succeeded;
-		}
-		else
-		{
-			++Failed;
-			Errors.Add(FString::Printf(TEXT("[%d] %s"), i, *DisconnResult.ErrorMessage));
-		}
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
-	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-	TextContent->SetStringField(TEXT("type"), TEXT("text"));
-
-	FString ResponseText = FString::Printf(TEXT("Batch disconnect: %d succeeded, %d failed"), Succeeded, Failed);
-	if (Errors.Num() > 0)
-	{
-		ResponseText += TEXT("\nErrors:");
-		for (const FString& Err : Errors)
+	return MakeShared<FMCPBatchToolTask>(TEXT("Batch disconnect"), *DisconnsArray,
+		[this, BlueprintPath, GraphName](const TSharedPtr<FJsonValue>& Operation, FString& OutError)
 		{
-			ResponseText += FString::Printf(TEXT("\n- %s"), *Err);
-		}
-	}
-	TextContent->SetStringField(TEXT("text"), ResponseText);
-
-	Result->SetBoolField(TEXT("isError"), Succeeded == 0 && Failed > 0);
+			const TSharedPtr<FJsonObject>* DisconnObj = nullptr;
+			if (!Operation->TryGetObject(DisconnObj) || !DisconnObj || !(*DisconnObj).IsValid())
+			{
+				OutError = TEXT("Invalid disconnection object");
+				return false;
+			}
+
+			FString SourceNodeId, SourcePin, TargetNodeId, TargetPin;
+			(*DisconnObj)->TryGetStringField(TEXT("source_node_id"), SourceNodeId);
+			(*DisconnObj)->TryGetStringField(TEXT("source_pin"), SourcePin);
+			(*DisconnObj)->TryGetStringField(TEXT("target_node_id"), TargetNodeId);
+			(*DisconnObj)->TryGetStringField(TEXT("target_pin"), TargetPin);
+
+			if (SourceNodeId.IsEmpty() || SourcePin.IsEmpty() || TargetNodeId.IsEmpty() || TargetPin.IsEmpty())
+			{
+				OutError = TEXT("Missing fields in disconnection");
+				return false;
+			}
+
+			FDisconnectGraphPinsResult DisconnResult = BlueprintModule.DisconnectGraphPins(BlueprintPath, GraphName, SourceNodeId, SourcePin, TargetNodeId, TargetPin);
+			OutError = DisconnResult.ErrorMessage;
+			return DisconnResult.bSuccess;
+		},
+		[this]() { BlueprintModule.BeginBatch(TEXT("Batch Disconnect Graph Pins")); },
+		[this]() { BlueprintModule.EndBatch(); });
+}
 
-	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-	Result->SetArrayField(TEXT("content"), ContentArray);
-	return Result;
+EMCPToolPriority FBatchDisconnectGraphPinsImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
 }
@@ -2,6 +2,7 @@
 
 #include "Tools/Impl/BatchSetActorPropertiesImplTool.h"
 #include "Modules/Interfaces/IActorModule.h"
+#include "Tools/MCPBatchToolTask.h"
 #include "Dom/JsonValue.h"
 
 FBatchSetActorPropertiesImplTool::FBatchSetActorPropertiesImplTool(IActorModule& InActorModule)
@@ -16,7 +17,7 @@ FString FBatchSetActorPropertiesImplTool::GetName() const
 
 FString FBatchSetActorPropertiesImplTool::GetDescription() const
 {
-	return TEXT("Set properties on multiple actors in one call. Up to 100 operations per batch.");
+	return TEXT("Set properties on multiple actors in one call. Large batches run in time slices without blocking the editor.");
 }
 
 TSharedPtr<FJsonObject> FBatchSetActorPropertiesImplTool::GetInputSchema() const
@@ -60,6 +61,11 @@ TSharedPtr<FJsonObject> FBatchSetActorPropertiesImplTool::GetInputSchema() const
 }
 
 TSharedPtr<FJsonObject> FBatchSetActorPropertiesImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+}
+
+TSharedPtr<IMCPToolTask> FBatchSetActorPropertiesImplTool::StartTask(const TSharedPtr<FJsonObject>& Arguments)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> ContentArray;
@@ -73,68 +79,37 @@ TSharedPtr<FJsonObject> FBatchSetActorPropertiesImplTool::Execute(const TSharedP
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	if (Operations->Num() > 100)
-	{
-		TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-		TextContent->SetStringField(TEXT("type"), TEXT("text"));
-		TextContent->SetStringField(TEXT("text"), TEXT("Too many operations. Maximum 100 per batch."));
-		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-		Result->SetArrayField(TEXT("content"), ContentArray);
-		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
-	int32 Succeeded = 0;
-	int32 Failed = 0;
-	FString Errors;
-
-	for (int32 i = 0; i < Operations->Num(); ++i)
-	{
-		const TSharedPtr<FJsonObject>* OpObj = nullptr;
-		if (!(*Operations)[i]->TryGetObject(OpObj) || !OpObj || !(*OpObj).IsValid())
-		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] Invalid operation object\n"), i);
-			continue;
-		}
-
-		FString ActorIdentifier, PropertyName, PropertyValue;
-		if (!(*OpObj)->TryGetStringField(TEXT("actor_identifier"), ActorIdentifier) ||
-			!(*OpObj)->TryGetStringField(TEXT("property_name"), PropertyName) ||
-			!(*OpObj)->TryGetStringField(TEXT("property_value"), PropertyValue))
-		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] Missing actor_identifier, property_name, or property_value\n"), i);
-			continue;
-		}
-
-		FActorSetPropertyResult OpResult = ActorModule.SetActorProperty(ActorIdentifier, PropertyName, PropertyValue);
-		if (OpResult.bSuccess)
-		{
-			Succeeded++;
-		}
-		else
+	return MakeShared<FMCPBatchToolTask>(TEXT("Batch completed"), *Operations,
+		[this](const TSharedPtr<FJsonValue>& Operation, FString& OutError)
 		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] %s\n"), i, *OpResult.ErrorMessage);
-		}
-	}
-
-	FString ResponseText = FString::Printf(TEXT("Batch completed: %d succeeded, %d failed"), Succeeded, Failed);
-	if (!Errors.IsEmpty())
-	{
-		ResponseText += TEXT("\n\nErrors:\n") + Errors;
-	}
-
-	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-	TextContent->SetStringField(TEXT("type"), TEXT("text"));
-	TextContent->SetStringField(TEXT("text"), ResponseText);
-	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-	Result->SetArrayField(TEXT("content"), ContentArray);
-	Result->SetBoolField(TEXT("isError"), Succeeded == 0 && Failed > 0);
+			const TSharedPtr<FJsonObject>* OpObj = nullptr;
+			if (!Operation->TryGetObject(OpObj) || !OpObj || !(*OpObj).IsValid())
+			{
+				OutError = TEXT("Invalid operation object");
+				return false;
+			}
+
+			FString ActorIdentifier, PropertyName, PropertyValue;
+			if (!(*OpObj)->TryGetStringField(TEXT("actor_identifier"), ActorIdentifier) ||
+				!(*OpObj)->TryGetStringField(TEXT("property_name"), PropertyName) ||
+				!(*OpObj)->TryGetStringField(TEXT("property_value"), PropertyValue))
+			{
+				OutError = TEXT("Missing actor_identifier, property_name, or property_value");
+				return false;
+			}
+
+			FActorSetPropertyResult OpResult = ActorModule.SetActorProperty(ActorIdentifier, PropertyName, PropertyValue);
+			OutError = OpResult.ErrorMessage;
+			return OpResult.bSuccess;
+		},
+		[this]() { ActorModule.BeginBatch(TEXT("Batch Set Actor Properties")); },
+		[this]() { ActorModule.EndBatch(); });
+}
 
-	return Result;
+EMCPToolPriority FBatchSetActorPropertiesImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
 }
@@ -2,6 +2,7 @@
 
 #include "Tools/Impl/BatchSetActorTransformsImplTool.h"
 #include "Modules/Interfaces/IActorModule.h"
+#include "Tools/MCPBatchToolTask.h"
 #include "Dom/JsonValue.h"
 
 FBatchSetActorTransformsImplTool::FBatchSetActorTransformsImplTool(IActorModule& InActorModule)
@@ -16,7 +17,7 @@ FString FBatchSetActorTransformsImplTool::GetName() const
 
 FString FBatchSetActorTransformsImplTool::GetDescription() const
 {
-	return TEXT("Set transforms (location, rotation, scale) on multiple actors in one call. Up to 100 operations per batch.");
+	return TEXT("Set transforms (location, rotation, scale) on multiple actors in one call. Large batches run in time slices without blocking the editor.");
 }
 
 TSharedPtr<FJsonObject> FBatchSetActorTransformsImplTool::GetInputSchema() const
@@ -67,6 +68,11 @@ TSharedPtr<FJsonObject> FBatchSetActorTransformsImplTool::GetInputSchema() const
 }
 
 TSharedPtr<FJsonObject> FBatchSetActorTransformsImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+}
+
+TSharedPtr<IMCPToolTask> FBatchSetActorTransformsImplTool::StartTask(const TSharedPtr<FJsonObject>& Arguments)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> ContentArray;
@@ -80,107 +86,76 @@ TSharedPtr<FJsonObject> FBatchSetActorTransformsImplTool::Execute(const TSharedP
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
-	if (Operations->Num() > 100)
-	{
-		TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-		TextContent->SetStringField(TEXT("type"), TEXT("text"));
-		TextContent->SetStringField(TEXT("text"), TEXT("Too many operations. Maximum 100 per batch."));
-		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-		Result->SetArrayField(TEXT("content"), ContentArray);
-		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	int32 Succeeded = 0;
-	int32 Failed = 0;
-	FString Errors;
-
-	for (int32 i = 0; i < Operations->Num(); ++i)
-	{
-		const TSharedPtr<FJsonObject>* OpObj = nullptr;
-		if (!(*Operations)[i]->TryGetObject(OpObj) || !OpObj || !(*OpObj).IsValid())
-		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] Invalid operation object\n"), i);
-			continue;
-		}
-
-		FString ActorIdentifier;
-		if (!(*OpObj)->TryGetStringField(TEXT("actor_identifier"), ActorIdentifier))
+	return MakeShared<FMCPBatchToolTask>(TEXT("Batch completed"), *Operations,
+		[this](const TSharedPtr<FJsonValue>& Operation, FString& OutError)
 		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] Missing actor_identifier\n"), i);
-			continue;
-		}
-
-		// Parse optional location
-		FVector Location;
-		FVector* LocationPtr = nullptr;
-		const TSharedPtr<FJsonObject>* LocationObj;
-		if ((*OpObj)->TryGetObjectField(TEXT("location"), LocationObj))
-		{
-			Location = FVector::ZeroVector;
-			(*LocationObj)->TryGetNumberField(TEXT("x"), Location.X);
-			(*LocationObj)->TryGetNumberField(TEXT("y"), Location.Y);
-			(*LocationObj)->TryGetNumberField(TEXT("z"), Location.Z);
-			LocationPtr = &Location;
-		}
-
-		// Parse optional rotation
-		FRotator Rotation;
-		FRotator* RotationPtr = nullptr;
-		const TSharedPtr<FJsonObject>* RotationObj;
-		if ((*OpObj)->TryGetObjectField(TEXT("rotation"), RotationObj))
-		{
-			Rotation = FRotator::ZeroRotator;
-			(*RotationObj)->TryGetNumberField(TEXT("pitch"), Rotation.Pitch);
-			(*RotationObj)->TryGetNumberField(TEXT("yaw"), Rotation.Yaw);
-			(*RotationObj)->TryGetNumberField(TEXT("roll"), Rotation.Roll);
-			RotationPtr = &Rotation;
-		}
-
-		// Parse optional scale
-		FVector Scale;
-		FVector* ScalePtr = nullptr;
-		const TSharedPtr<FJsonObject>* ScaleObj;
-		if ((*OpObj)->TryGetObjectField(TEXT("scale"), ScaleObj))
-		{
-			Scale = FVector::OneVector;
-			(*ScaleObj)->TryGetNumberField(TEXT("x"), Scale.X);
-			(*ScaleObj)->TryGetNumberField(TEXT("y"), Scale.Y);
-			(*ScaleObj)->TryGetNumberField(TEXT("z"), Scale.Z);
-			ScalePtr = &Scale;
-		}
-
-		FActorSetTransformResult OpResult = ActorModule.SetActorTransform(
-			ActorIdentifier, LocationPtr, RotationPtr, ScalePtr);
-
-		if (OpResult.bSuccess)
-		{
-			Succeeded++;
-		}
-		else
-		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] %s\n"), i, *OpResult.ErrorMessage);
-		}
-	}
-
-	FString ResponseText = FString::Printf(TEXT("Batch completed: %d succeeded, %d failed"), Succeeded, Failed);
-	if (!Errors.IsEmpty())
-	{
-		ResponseText += TEXT("\n\nErrors:\n") + Errors;
-	}
-
-	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-	TextContent->SetStringField(TEXT("type"), TEXT("text"));
-	TextContent->SetStringField(TEXT("text"), ResponseText);
-	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-	Result->SetArrayField(TEXT("content"), ContentArray);
-	Result->SetBoolField(TEXT("isError"), Succeeded == 0 && Failed > 0);
+			const TSharedPtr<FJsonObject>* OpObj = nullptr;
+			if (!Operation->TryGetObject(OpObj) || !OpObj || !(*OpObj).IsValid())
+			{
+				OutError = TEXT("Invalid operation object");
+				return false;
+			}
+
+			FString ActorIdentifier;
+			if (!(*OpObj)->TryGetStringField(TEXT("actor_identifier"), ActorIdentifier))
+			{
+				OutError = TEXT("Missing actor_identifier");
+				return false;
+			}
+
+			// Parse optional location
+			FVector Location;
+			FVector* LocationPtr = nullptr;
+			const TSharedPtr<FJsonObject>* LocationObj;
+			if ((*OpObj)->TryGetObjectField(TEXT("location"), LocationObj))
+			{
+				Location = FVector::ZeroVector;
+				(*LocationObj)->TryGetNumberField(TEXT("x"), Location.X);
+				(*LocationObj)->TryGetNumberField(TEXT("y"), Location.Y);
+				(*LocationObj)->TryGetNumberField(TEXT("z"), Location.Z);
+				LocationPtr = &Location;
+			}
+
+			// Parse optional rotation
+			FRotator Rotation;
+			FRotator* RotationPtr = nullptr;
+			const TSharedPtr<FJsonObject>* RotationObj;
+			if ((*OpObj)->TryGetObjectField(TEXT("rotation"), RotationObj))
+			{
+				Rotation = FRotator::ZeroRotator;
+				(*RotationObj)->TryGetNumberField(TEXT("pitch"), Rotation.Pitch);
+				(*RotationObj)->TryGetNumberField(TEXT("yaw"), Rotation.Yaw);
+				(*RotationObj)->TryGetNumberField(TEXT("roll"), Rotation.Roll);
+				RotationPtr = &Rotation;
+			}
+
+			// Parse optional scale
+			FVector Scale;
+			FVector* ScalePtr = nullptr;
+			const TSharedPtr<FJsonObject>* ScaleObj;
+			if ((*OpObj)->TryGetObjectField(TEXT("scale"), ScaleObj))
+			{
+				Scale = FVector::OneVector;
+				(*ScaleObj)->TryGetNumberField(TEXT("x"), Scale.X);
+				(*ScaleObj)->TryGetNumberField(TEXT("y"), Scale.Y);
+				(*ScaleObj)->TryGetNumberField(TEXT("z"), Scale.Z);
+				ScalePtr = &Scale;
+			}
+
+			FActorSetTransformResult OpResult = ActorModule.SetActorTransform(
+				ActorIdentifier, LocationPtr, RotationPtr, ScalePtr);
+
+			OutError = OpResult.ErrorMessage;
+			return OpResult.bSuccess;
+		},
+		[this]() { ActorModule.BeginBatch(TEXT("Batch Set Actor Transforms")); },
+		[this]() { ActorModule.EndBatch(); });
+}
 
-	return Result;
+EMCPToolPriority FBatchSetActorTransformsImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
 }
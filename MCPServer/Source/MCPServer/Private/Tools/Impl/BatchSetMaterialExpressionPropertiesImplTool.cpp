@@ -2,6 +2,7 @@
 
 #include "Tools/Impl/BatchSetMaterialExpressionPropertiesImplTool.h"
 #include "Modules/Interfaces/IMaterialModule.h"
+#include "Tools/MCPBatchToolTask.h"
 #include "Dom/JsonValue.h"
 
 FBatchSetMaterialExpressionPropertiesImplTool::FBatchSetMaterialExpressionPropertiesImplTool(IMaterialModule& InMaterialModule)
@@ -16,7 +17,7 @@ FString FBatchSetMaterialExpressionPropertiesImplTool::GetName() const
 
 FString FBatchSetMaterialExpressionPropertiesImplTool::GetDescription() const
 {
-	return TEXT("Set properties on multiple material expression nodes in one call. Up to 100 operations per batch.");
+	return TEXT("Set properties on multiple material expression nodes in one call. Large batches run in time slices without blocking the editor.");
 }
 
 TSharedPtr<FJsonObject> FBatchSetMaterialExpressionPropertiesImplTool::GetInputSchema() const
@@ -66,6 +67,11 @@ TSharedPtr<FJsonObject> FBatchSetMaterialExpressionPropertiesImplTool::GetInputS
 }
 
 TSharedPtr<FJsonObject> FBatchSetMaterialExpressionPropertiesImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+}
+
+TSharedPtr<IMCPToolTask> FBatchSetMaterialExpressionPropertiesImplTool::StartTask(const TSharedPtr<FJsonObject>& Arguments)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> ContentArray;
@@ -79,7 +85,7 @@ TSharedPtr<FJsonObject> FBatchSetMaterialExpressionPropertiesImplTool::Execute(c
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* Operations = nullptr;
@@ -91,72 +97,41 @@ TSharedPtr<FJsonObject> FBatchSetMaterialExpressionPropertiesImplTool::Execute(c
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
-	if (Operations->Num() > 100)
-	{
-		TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-		TextContent->SetStringField(TEXT("type"), TEXT("text"));
-		TextContent->SetStringField(TEXT("text"), TEXT("Too many operations. Maximum 100 per batch."));
-		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-		Result->SetArrayField(TEXT("content"), ContentArray);
-		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	int32 Succeeded = 0;
-	int32 Failed = 0;
-	FString Errors;
-
-	for (int32 i = 0; i < Operations->Num(); ++i)
-	{
-		const TSharedPtr<FJsonObject>* OpObj = nullptr;
-		if (!(*Operations)[i]->TryGetObject(OpObj) || !OpObj || !(*OpObj).IsValid())
+	return MakeShared<FMCPBatchToolTask>(TEXT("Batch completed"), *Operations,
+		[this, MaterialPath](const TSharedPtr<FJsonValue>& Operation, FString& OutError)
 		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] Invalid operation object\n"), i);
-			continue;
-		}
-
-		double ExpressionIndexValue = 0.0;
-		FString PropertyName, PropertyValue;
-		if (!(*OpObj)->TryGetNumberField(TEXT("expression_index"), ExpressionIndexValue) ||
-			!(*OpObj)->TryGetStringField(TEXT("property_name"), PropertyName) ||
-			!(*OpObj)->TryGetStringField(TEXT("property_value"), PropertyValue))
-		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] Missing expression_index, property_name, or property_value\n"), i);
-			continue;
-		}
-
-		int32 ExpressionIndex = static_cast<int32>(ExpressionIndexValue);
-		FSetMaterialExpressionPropertyResult OpResult = MaterialModule.SetMaterialExpressionProperty(
-			MaterialPath, ExpressionIndex, PropertyName, PropertyValue);
-
-		if (OpResult.bSuccess)
-		{
-			Succeeded++;
-		}
-		else
-		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] %s\n"), i, *OpResult.ErrorMessage);
-		}
-	}
-
-	FString ResponseText = FString::Printf(TEXT("Batch completed: %d succeeded, %d failed"), Succeeded, Failed);
-	if (!Errors.IsEmpty())
-	{
-		ResponseText += TEXT("\n\nErrors:\n") + Errors;
-	}
-
-	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-	TextContent->SetStringField(TEXT("type"), TEXT("text"));
-	TextContent->SetStringField(TEXT("text"), ResponseText);
-	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-	Result->SetArrayField(TEXT("content"), ContentArray);
-	Result->SetBoolField(TEXT("isError"), Succeeded == 0 && Failed > 0);
+			const TSharedPtr<FJsonObject>* OpObj = nullptr;
+			if (!Operation->TryGetObject(OpObj) || !OpObj || !(*OpObj).IsValid())
+			{
+				OutError = TEXT("Invalid operation object");
+				return false;
+			}
+
+			double ExpressionIndexValue = 0.0;
+			FString PropertyName, PropertyValue;
+			if (!(*OpObj)->TryGetNumberField(TEXT("expression_index"), ExpressionIndexValue) ||
+				!(*OpObj)->TryGetStringField(TEXT("property_name"), PropertyName) ||
+				!(*OpObj)->TryGetStringField(TEXT("property_value"), PropertyValue))
+			{
+				OutError = TEXT("Missing expression_index, property_name, or property_value");
+				return false;
+			}
+
+			int32 ExpressionIndex = static_cast<int32>(ExpressionIndexValue);
+			FSetMaterialExpressionPropertyResult OpResult = MaterialModule.SetMaterialExpressionProperty(
+				MaterialPath, ExpressionIndex, PropertyName, PropertyValue);
+
+			OutError = OpResult.ErrorMessage;
+			return OpResult.bSuccess;
+		},
+		[this]() { MaterialModule.BeginBatch(TEXT("Batch Set Material Expression Properties")); },
+		[this]() { MaterialModule.EndBatch(); });
+}
 
-	return Result;
+EMCPToolPriority FBatchSetMaterialExpressionPropertiesImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
 }
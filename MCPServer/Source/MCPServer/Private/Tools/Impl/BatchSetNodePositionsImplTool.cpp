@@ -2,6 +2,7 @@
 
 #include "Tools/Impl/BatchSetNodePositionsImplTool.h"
 #include "Modules/Interfaces/IBlueprintModule.h"
+#include "Tools/MCPBatchToolTask.h"
 #include "Dom/JsonValue.h"
 
 FBatchSetNodePositionsImplTool::FBatchSetNodePositionsImplTool(IBlueprintModule& InBlueprintModule)
@@ -16,7 +17,7 @@ FString FBatchSetNodePositionsImplTool::GetName() const
 
 FString FBatchSetNodePositionsImplTool::GetDescription() const
 {
-	return TEXT("Move multiple nodes on a Blueprint graph in one call. Up to 100 operations per batch.");
+	return TEXT("Move multiple nodes on a Blueprint graph in one call. Large batches run in time slices without blocking the editor.");
 }
 
 TSharedPtr<FJsonObject> FBatchSetNodePositionsImplTool::GetInputSchema() const
@@ -69,6 +70,11 @@ TSharedPtr<FJsonObject> FBatchSetNodePositionsImplTool::GetInputSchema() const
 }
 
 TSharedPtr<FJsonObject> FBatchSetNodePositionsImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+}
+
+TSharedPtr<IMCPToolTask> FBatchSetNodePositionsImplTool::StartTask(const TSharedPtr<FJsonObject>& Arguments)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> ContentArray;
@@ -82,7 +88,7 @@ TSharedPtr<FJsonObject> FBatchSetNodePositionsImplTool::Execute(const TSharedPtr
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
 	FString GraphName;
@@ -94,7 +100,7 @@ TSharedPtr<FJsonObject> FBatchSetNodePositionsImplTool::Execute(const TSharedPtr
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* Operations = nullptr;
@@ -106,82 +112,50 @@ TSharedPtr<FJsonObject> FBatchSetNodePositionsImplTool::Execute(const TSharedPtr
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
-	if (Operations->Num() > 100)
-	{
-		TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-		TextContent->SetStringField(TEXT("type"), TEXT("text"));
-		TextContent->SetStringField(TEXT("text"), TEXT("Too many operations. Maximum 100 per batch."));
-		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-		Result->SetArrayField(TEXT("content"), ContentArray);
-		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	int32 Succeeded = 0;
-	int32 Failed = 0;
-	FString Errors;
-
-	for (int32 i = 0; i < Operations->Num(); ++i)
-	{
-		const TSharedPtr<FJsonObject>* OpObj = nullptr;
-		if (!(*Operations)[i]->TryGetObject(OpObj) || !OpObj || !(*OpObj).IsValid())
-		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] Invalid operation object\n"), i);
-			continue;
-		}
-
-		FString NodeId;
-		if (!(*OpObj)->TryGetStringField(TEXT("node_id"), NodeId))
+	return MakeShared<FMCPBatchToolTask>(TEXT("Batch completed"), *Operations,
+		[this, BlueprintPath, GraphName](const TSharedPtr<FJsonValue>& Operation, FString& OutError)
 		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] Missing node_id\n"), i);
-			continue;
-		}
-
-		const TSharedPtr<FJsonObject>* PositionObj;
-		if (!(*OpObj)->TryGetObjectField(TEXT("position"), PositionObj))
-		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] Missing position\n"), i);
-			continue;
-		}
-
-		double PosXd = 0.0, PosYd = 0.0;
-		(*PositionObj)->TryGetNumberField(TEXT("x"), PosXd);
-		(*PositionObj)->TryGetNumberField(TEXT("y"), PosYd);
-		int32 PosX = static_cast<int32>(PosXd);
-		int32 PosY = static_cast<int32>(PosYd);
-
-		FSetNodePositionResult OpResult = BlueprintModule.SetNodePosition(
-			BlueprintPath, GraphName, NodeId, PosX, PosY);
-
-		if (OpResult.bSuccess)
-		{
-			Succeeded++;
-		}
-		else
-		{
-			Failed++;
-			Errors += FString::Printf(TEXT("- [%d] %s\n"), i, *OpResult.ErrorMessage);
-		}
-	}
-
-	FString ResponseText = FString::Printf(TEXT("Batch completed: %d succeeded, %d failed"), Succeeded, Failed);
-	if (!Errors.IsEmpty())
-	{
-		ResponseText += TEXT("\n\nErrors:\n") + Errors;
-	}
-
-	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-	TextContent->SetStringField(TEXT("type"), TEXT("text"));
-	TextContent->SetStringField(TEXT("text"), ResponseText);
-	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-	Result->SetArrayField(TEXT("content"), ContentArray);
-	Result->SetBoolField(TEXT("isError"), Succeeded == 0 && Failed > 0);
+			const TSharedPtr<FJsonObject>* OpObj = nullptr;
+			if (!Operation->TryGetObject(OpObj) || !OpObj || !(*OpObj).IsValid())
+			{
+				OutError = TEXT("Invalid operation object");
+				return false;
+			}
+
+			FString NodeId;
+			if (!(*OpObj)->TryGetStringField(TEXT("node_id"), NodeId))
+			{
+				OutError = TEXT("Missing node_id");
+				return false;
+			}
+
+			const TSharedPtr<FJsonObject>* PositionObj;
+			if (!(*OpObj)->TryGetObjectField(TEXT("position"), PositionObj))
+			{
+				OutError = TEXT("Missing position");
+				return false;
+			}
+
+			double PosXd = 0.0, PosYd = 0.0;
+			(*PositionObj)->TryGetNumberField(TEXT("x"), PosXd);
+			(*PositionObj)->TryGetNumberField(TEXT("y"), PosYd);
+			int32 PosX = static_cast<int32>(PosXd);
+			int32 PosY = static_cast<int32>(PosYd);
+
+			FSetNodePositionResult OpResult = BlueprintModule.SetNodePosition(
+				BlueprintPath, GraphName, NodeId, PosX, PosY);
+
+			OutError = OpResult.ErrorMessage;
+			return OpResult.bSuccess;
+		},
+		[this]() { BlueprintModule.BeginBatch(TEXT("Batch Set Node Positions")); },
+		[this]() { BlueprintModule.EndBatch(); });
+}
 
-	return Result;
+EMCPToolPriority FBatchSetNodePositionsImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
 }
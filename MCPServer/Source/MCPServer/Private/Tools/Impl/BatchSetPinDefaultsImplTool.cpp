@@ -2,6 +2,7 @@
 
 #include "Tools/Impl/BatchSetPinDefaultsImplTool.h"
 #include "Modules/Interfaces/IBlueprintModule.h"
+#include "Tools/MCPBatchToolTask.h"
 #include "Dom/JsonValue.h"
 
 FBatchSetPinDefaultsImplTool::FBatchSetPinDefaultsImplTool(IBlueprintModule& InBlueprintModule)
@@ -16,7 +17,7 @@ FString FBatchSetPinDefaultsImplTool::GetName() const
 
 FString FBatchSetPinDefaultsImplTool::GetDescription() const
 {
-	return TEXT("Set default values on multiple pins in a single call (up to 100 operations per call)");
+	return TEXT("Set default values on multiple pins in a single call. Large batches run in time slices without blocking the editor.");
 }
 
 TSharedPtr<FJsonObject> FBatchSetPinDefaultsImplTool::GetInputSchema() const
@@ -38,7 +39,7 @@ TSharedPtr<FJsonObject> FBatchSetPinDefaultsImplTool::GetInputSchema() const
 
 	TSharedPtr<FJsonObject> OpsProp = MakeShared<FJsonObject>();
 	OpsProp->SetStringField(TEXT("type"), TEXT("array"));
-	OpsProp->SetStringField(TEXT("description"), TEXT("Array of operations (max 100). Each: {node_id, pin_name, value}"));
+	OpsProp->SetStringField(TEXT("description"), TEXT("Array of operations. Each: {node_id, pin_name, value}"));
 	Properties->SetObjectField(TEXT("operations"), OpsProp);
 
 	Schema->SetObjectField(TEXT("properties"), Properties);
@@ -53,6 +54,11 @@ TSharedPtr<FJsonObject> FBatchSetPinDefaultsImplTool::GetInputSchema() const
 }
 
 TSharedPtr<FJsonObject> FBatchSetPinDefaultsImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+}
+
+TSharedPtr<IMCPToolTask> FBatchSetPinDefaultsImplTool::StartTask(const TSharedPtr<FJsonObject>& Arguments)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> ContentArray;
@@ -68,7 +74,7 @@ TSharedPtr<FJsonObject> FBatchSetPinDefaultsImplTool::Execute(const TSharedPtr<F
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* OpsArray = nullptr;
@@ -80,75 +86,39 @@ TSharedPtr<FJsonObject> FBatchSetPinDefaultsImplTool::Execute(const TSharedPtr<F
 		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
 		Result->SetArrayField(TEXT("content"), ContentArray);
 		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	if (OpsArray->Num() > 100)
-	{
-		TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-		TextContent->SetStringField(TEXT("type"), TEXT("text"));
-		TextContent->SetStringField(TEXT("text"), TEXT("Maximum 100 operations per call"));
-		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-		Result->SetArrayField(TEXT("content"), ContentArray);
-		Result->SetBoolField(TEXT("isError"), true);
-		return Result;
-	}
-
-	int32 Succeeded = 0;
-	int32 Failed = 0;
-	TArray<FString> Errors;
-
-	for (int32 i = 0; i < OpsArray->Num(); ++i)
-	{
-		const TSharedPtr<FJsonObject>* OpObj = nullptr;
-		if (!(*OpsArray)[i].IsValid() || !(*OpsArray)[i]->TryGetObject(OpObj) || !OpObj || !(*OpObj).IsValid())
-		{
-			++Failed;
-			Errors.Add(FString::Printf(TEXT("[%d] Invalid operation object"), i));
-			continue;
-		}
-
-		FString NodeId, PinName, Value;
-		(*OpObj)->TryGetStringField(TEXT("node_id"), NodeId);
-		(*OpObj)->TryGetStringField(TEXT("pin_name"), PinName);
-		(*OpObj)->TryGetStringField(TEXT("value"), Value);
-
-		if (NodeId.IsEmpty() || PinName.IsEmpty())
-		{
-			++Failed;
-			Errors.Add(FString::Printf(TEXT("[%d] Missing node_id or pin_name"), i));
-			continue;
-		}
-
-		FSetPinDefaultValueResult PinResult = BlueprintModule.SetPinDefaultValue(BlueprintPath, GraphName, NodeId, PinName, Value);
-		if (PinResult.bSuccess)
-		{
-			++Succeeded;
-		}
-		else
-		{
-			++Failed;
-			Errors.Add(FString::Printf(TEXT("[%d] %s"), i, *PinResult.ErrorMessage));
-		}
+		return FMCPBatchToolTask::MakeFinished(Result);
 	}
 
-	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-	TextContent->SetStringField(TEXT("type"), TEXT("text"));
-
-	FString ResponseText = FString::Printf(TEXT("Batch set pin defaults: %d succeeded, %d failed"), Succeeded, Failed);
-	if (Errors.Num() > 0)
-	{
-		ResponseText += TEXT("\nErrors:");
-		for (const FString& Err : Errors)
+	return MakeShared<FMCPBatchToolTask>(TEXT("Batch set pin defaults"), *OpsArray,
+		[this, BlueprintPath, GraphName](const TSharedPtr<FJsonValue>& Operation, FString& OutError)
 		{
-			ResponseText += FString::Printf(TEXT("\n- %s"), *Err);
-		}
-	}
-	TextContent->SetStringField(TEXT("text"), ResponseText);
-
-	Result->SetBoolField(TEXT("isError"), Succeeded == 0 && Failed > 0);
+			const TSharedPtr<FJsonObject>* OpObj = nullptr;
+			if (!Operation->TryGetObject(OpObj) || !OpObj || !(*OpObj).IsValid())
+			{
+				OutError = TEXT("Invalid operation object");
+				return false;
+			}
+
+			FString NodeId, PinName, Value;
+			(*OpObj)->TryGetStringField(TEXT("node_id"), NodeId);
+			(*OpObj)->TryGetStringField(TEXT("pin_name"), PinName);
+			(*OpObj)->TryGetStringField(TEXT("value"), Value);
+
+			if (NodeId.IsEmpty() || PinName.IsEmpty())
+			{
+				OutError = TEXT("Missing node_id or pin_name");
+				return false;
+			}
+
+			FSetPinDefaultValueResult PinResult = BlueprintModule.SetPinDefaultValue(BlueprintPath, GraphName, NodeId, PinName, Value);
+			OutError = PinResult.ErrorMessage;
+			return PinResult.bSuccess;
+		},
+		[this]() { BlueprintModule.BeginBatch(TEXT("Batch Set Pin Defaults")); },
+		[this]() { BlueprintModule.EndBatch(); });
+}
 
-	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-	Result->SetArrayField(TEXT("content"), ContentArray);
-	return Result;
+EMCPToolPriority FBatchSetPinDefaultsImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
 }
@@ -57,3 +57,8 @@ TSharedPtr<FJsonObject> FBuildAllImplTool::Execute(const TSharedPtr<FJsonObject>
 
 	return Result;
 }
+
+EMCPToolPriority FBuildAllImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Build;
+}
@@ -57,3 +57,8 @@ TSharedPtr<FJsonObject> FBuildGeometryImplTool::Execute(const TSharedPtr<FJsonOb
 
 	return Result;
 }
+
+EMCPToolPriority FBuildGeometryImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Build;
+}
@@ -57,3 +57,8 @@ TSharedPtr<FJsonObject> FBuildHlodImplTool::Execute(const TSharedPtr<FJsonObject
 
 	return Result;
 }
+
+EMCPToolPriority FBuildHlodImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Build;
+}
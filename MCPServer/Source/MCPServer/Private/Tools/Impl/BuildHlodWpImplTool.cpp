@@ -45,3 +45,8 @@ TSharedPtr<FJsonObject> FBuildHlodWpImplTool::Execute(const TSharedPtr<FJsonObje
 	Result->SetArrayField(TEXT("content"), ContentArray);
 	return Result;
 }
+
+EMCPToolPriority FBuildHlodWpImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Build;
+}
@@ -57,3 +57,8 @@ TSharedPtr<FJsonObject> FBuildLightingImplTool::Execute(const TSharedPtr<FJsonOb
 
 	return Result;
 }
+
+EMCPToolPriority FBuildLightingImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Build;
+}
@@ -57,3 +57,8 @@ TSharedPtr<FJsonObject> FBuildNavigationDataImplTool::Execute(const TSharedPtr<F
 
 	return Result;
 }
+
+EMCPToolPriority FBuildNavigationDataImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Build;
+}
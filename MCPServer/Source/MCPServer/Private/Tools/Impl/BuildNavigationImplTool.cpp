@@ -57,3 +57,8 @@ TSharedPtr<FJsonObject> FBuildNavigationImplTool::Execute(const TSharedPtr<FJson
 
 	return Result;
 }
+
+EMCPToolPriority FBuildNavigationImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Build;
+}
@@ -57,3 +57,8 @@ TSharedPtr<FJsonObject> FBuildTextureStreamingImplTool::Execute(const TSharedPtr
 
 	return Result;
 }
+
+EMCPToolPriority FBuildTextureStreamingImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Build;
+}
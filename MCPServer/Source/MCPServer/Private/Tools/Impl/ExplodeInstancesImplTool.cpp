@@ -0,0 +1,109 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/Impl/ExplodeInstancesImplTool.h"
+#include "Tools/MCPToolResultUtils.h"
+#include "Modules/Interfaces/IActorModule.h"
+#include "Tools/MCPBatchToolTask.h"
+#include "Dom/JsonValue.h"
+
+namespace ExplodeInstancesToolPrivate
+{
+	TSharedPtr<FJsonObject> MakeBeforeAfter(int64 Before, int64 After)
+	{
+		TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+		Obj->SetNumberField(TEXT("before"), Before);
+		Obj->SetNumberField(TEXT("after"), After);
+		return Obj;
+	}
+}
+
+FExplodeInstancesImplTool::FExplodeInstancesImplTool(IActorModule& InActorModule)
+	: ActorModule(InActorModule)
+{
+}
+
+FString FExplodeInstancesImplTool::GetName() const
+{
+	return TEXT("explode_instances");
+}
+
+FString FExplodeInstancesImplTool::GetDescription() const
+{
+	return TEXT("Replace instanced static mesh actors (as created by merge_to_instances) with one static mesh actor per instance, keeping transforms, materials and Outliner folders.");
+}
+
+TSharedPtr<FJsonObject> FExplodeInstancesImplTool::GetInputSchema() const
+{
+	TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+
+	TSharedPtr<FJsonObject> ActorsProp = MakeShared<FJsonObject>();
+	ActorsProp->SetStringField(TEXT("type"), TEXT("array"));
+	ActorsProp->SetStringField(TEXT("description"),
+		TEXT("Instanced actor names, labels or paths. If omitted, the selected actors are exploded."));
+	TSharedPtr<FJsonObject> ItemProp = MakeShared<FJsonObject>();
+	ItemProp->SetStringField(TEXT("type"), TEXT("string"));
+	ActorsProp->SetObjectField(TEXT("items"), ItemProp);
+	Properties->SetObjectField(TEXT("actors"), ActorsProp);
+
+	Schema->SetObjectField(TEXT("properties"), Properties);
+
+	return Schema;
+}
+
+TSharedPtr<FJsonObject> FExplodeInstancesImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	using namespace ExplodeInstancesToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	TArray<FString> ActorIdentifiers;
+	const TArray<TSharedPtr<FJsonValue>>* ActorsArray = nullptr;
+	if (Arguments.IsValid() && Arguments->TryGetArrayField(TEXT("actors"), ActorsArray))
+	{
+		for (const TSharedPtr<FJsonValue>& ActorValue : *ActorsArray)
+		{
+			ActorIdentifiers.Add(ActorValue->AsString());
+		}
+	}
+
+	FExplodeInstancesResult ExplodeResult = ActorModule.ExplodeInstances(ActorIdentifiers);
+	if (!ExplodeResult.bSuccess)
+	{
+		return MakeErrorResult(FString::Printf(TEXT("Failed to explode instances: %s"), *ExplodeResult.ErrorMessage));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> NamesArray;
+	NamesArray.Reserve(ExplodeResult.ActorNames.Num());
+	for (const FString& ActorName : ExplodeResult.ActorNames)
+	{
+		NamesArray.Add(MakeShared<FJsonValueString>(ActorName));
+	}
+
+	// Skipped actors beyond the cap are counted but not listed, as in the batch tools
+	TArray<TSharedPtr<FJsonValue>> SkippedArray;
+	for (int32 SkipIndex = 0; SkipIndex < ExplodeResult.Skipped.Num() && SkipIndex < FMCPBatchToolTask::MaxListedErrors; ++SkipIndex)
+	{
+		TSharedPtr<FJsonObject> SkipObj = MakeShared<FJsonObject>();
+		SkipObj->SetStringField(TEXT("actor"), ExplodeResult.Skipped[SkipIndex].ActorIdentifier);
+		SkipObj->SetStringField(TEXT("reason"), ExplodeResult.Skipped[SkipIndex].Reason);
+		SkippedArray.Add(MakeShared<FJsonValueObject>(SkipObj));
+	}
+
+	TSharedPtr<FJsonObject> Structured = MakeShared<FJsonObject>();
+	Structured->SetNumberField(TEXT("exploded"), ExplodeResult.ExplodedActorCount);
+	Structured->SetNumberField(TEXT("spawned"), ExplodeResult.ActorNames.Num());
+	Structured->SetArrayField(TEXT("actors"), NamesArray);
+	Structured->SetNumberField(TEXT("skipped_count"), ExplodeResult.Skipped.Num());
+	Structured->SetArrayField(TEXT("skipped"), SkippedArray);
+	Structured->SetObjectField(TEXT("draw_calls"), MakeBeforeAfter(ExplodeResult.Stats.DrawCallsBefore, ExplodeResult.Stats.DrawCallsAfter));
+	Structured->SetObjectField(TEXT("estimated_memory_bytes"), MakeBeforeAfter(ExplodeResult.Stats.EstimatedBytesBefore, ExplodeResult.Stats.EstimatedBytesAfter));
+
+	return MakeStructuredResult(Structured, ExplodeResult.ExplodedActorCount == 0 && ExplodeResult.Skipped.Num() > 0);
+}
+
+EMCPToolPriority FExplodeInstancesImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
+}
@@ -0,0 +1,21 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "Tools/Interfaces/IMCPTool.h"
+
+class IActorModule;
+
+class FExplodeInstancesImplTool : public IMCPTool
+{
+public:
+	explicit FExplodeInstancesImplTool(IActorModule& InActorModule);
+
+	virtual FString GetName() const override;
+	virtual FString GetDescription() const override;
+	virtual TSharedPtr<FJsonObject> GetInputSchema() const override;
+	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override;
+	virtual EMCPToolPriority GetPriority() const override;
+
+private:
+	IActorModule& ActorModule;
+};
@@ -0,0 +1,200 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/Impl/GetActorPropertiesBulkImplTool.h"
+#include "Tools/MCPToolResultUtils.h"
+#include "Modules/Interfaces/IActorModule.h"
+#include "Dom/JsonValue.h"
+
+namespace GetActorPropertiesBulkToolPrivate
+{
+	constexpr int32 DefaultLimit = 1000;
+	constexpr int32 MaxLimit = 50000;
+	constexpr int32 MaxProperties = 64;
+
+	TArray<TSharedPtr<FJsonValue>> MakeStringArray(const TArray<FString>& Strings)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		Values.Reserve(Strings.Num());
+		for (const FString& String : Strings)
+		{
+			Values.Add(MakeShared<FJsonValueString>(String));
+		}
+		return Values;
+	}
+}
+
+FGetActorPropertiesBulkImplTool::FGetActorPropertiesBulkImplTool(IActorModule& InActorModule)
+	: ActorModule(InActorModule)
+{
+}
+
+FString FGetActorPropertiesBulkImplTool::GetName() const
+{
+	return TEXT("get_actor_properties_bulk");
+}
+
+FString FGetActorPropertiesBulkImplTool::GetDescription() const
+{
+	return TEXT("Read several properties from many actors in one call, returned as a column-major table. Select actors by identifiers, class or bounds; property paths may follow structs and object references, e.g. 'RootComponent.RelativeScale3D.X'.");
+}
+
+TSharedPtr<FJsonObject> FGetActorPropertiesBulkImplTool::GetInputSchema() const
+{
+	using namespace GetActorPropertiesBulkToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+
+	Properties->SetObjectField(TEXT("properties"), MakeArrayProp(TEXT("string"),
+		FString::Printf(TEXT("Property paths to read (max %d), e.g. [\"bHidden\", \"RootComponent.Mobility\", \"RootComponent.RelativeScale3D.X\"]"), MaxProperties)));
+
+	Properties->SetObjectField(TEXT("actors"), MakeArrayProp(TEXT("string"),
+		TEXT("Optional actor names, labels or paths. If omitted, every actor matching the filters is read.")));
+
+	TSharedPtr<FJsonObject> ClassFilterProp = MakeShared<FJsonObject>();
+	ClassFilterProp->SetStringField(TEXT("type"), TEXT("string"));
+	ClassFilterProp->SetStringField(TEXT("description"),
+		TEXT("Optional class path to filter actors (e.g. '/Script/Engine.StaticMeshActor')"));
+	Properties->SetObjectField(TEXT("class_filter"), ClassFilterProp);
+
+	TSharedPtr<FJsonObject> BoundsProp = MakeShared<FJsonObject>();
+	BoundsProp->SetStringField(TEXT("type"), TEXT("object"));
+	BoundsProp->SetStringField(TEXT("description"),
+		TEXT("Optional axis-aligned box; only actors whose bounds overlap it are read"));
+	TSharedPtr<FJsonObject> BoundsProperties = MakeShared<FJsonObject>();
+	BoundsProperties->SetObjectField(TEXT("min"), MakeVectorProp());
+	BoundsProperties->SetObjectField(TEXT("max"), MakeVectorProp());
+	BoundsProp->SetObjectField(TEXT("properties"), BoundsProperties);
+	Properties->SetObjectField(TEXT("bounds"), BoundsProp);
+
+	TSharedPtr<FJsonObject> CursorProp = MakeShared<FJsonObject>();
+	CursorProp->SetStringField(TEXT("type"), TEXT("string"));
+	CursorProp->SetStringField(TEXT("description"),
+		TEXT("Opaque cursor from a previous response's next_cursor to fetch the next page"));
+	Properties->SetObjectField(TEXT("cursor"), CursorProp);
+
+	TSharedPtr<FJsonObject> LimitProp = MakeShared<FJsonObject>();
+	LimitProp->SetStringField(TEXT("type"), TEXT("integer"));
+	LimitProp->SetStringField(TEXT("description"),
+		FString::Printf(TEXT("Maximum number of actors (rows) per page (default %d, max %d)"), DefaultLimit, MaxLimit));
+	Properties->SetObjectField(TEXT("limit"), LimitProp);
+
+	Schema->SetObjectField(TEXT("properties"), Properties);
+
+	TArray<TSharedPtr<FJsonValue>> Required;
+	Required.Add(MakeShared<FJsonValueString>(TEXT("properties")));
+	Schema->SetArrayField(TEXT("required"), Required);
+
+	return Schema;
+}
+
+TSharedPtr<FJsonObject> FGetActorPropertiesBulkImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	using namespace GetActorPropertiesBulkToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	const TArray<TSharedPtr<FJsonValue>>* PropertiesArray = nullptr;
+	if (!Arguments.IsValid() || !Arguments->TryGetArrayField(TEXT("properties"), PropertiesArray) || PropertiesArray->Num() == 0)
+	{
+		return MakeErrorResult(TEXT("Missing required parameter: properties (non-empty array)"));
+	}
+	if (PropertiesArray->Num() > MaxProperties)
+	{
+		return MakeErrorResult(FString::Printf(TEXT("Too many properties: %d (max %d)"), PropertiesArray->Num(), MaxProperties));
+	}
+
+	FActorPropertiesBulkQuery Query;
+	Query.Limit = DefaultLimit;
+	for (const TSharedPtr<FJsonValue>& PropertyValue : *PropertiesArray)
+	{
+		Query.PropertyPaths.Add(PropertyValue->AsString());
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* ActorsArray = nullptr;
+	if (Arguments->TryGetArrayField(TEXT("actors"), ActorsArray))
+	{
+		for (const TSharedPtr<FJsonValue>& ActorValue : *ActorsArray)
+		{
+			Query.ActorIdentifiers.Add(ActorValue->AsString());
+		}
+	}
+
+	Arguments->TryGetStringField(TEXT("class_filter"), Query.ClassFilter);
+
+	const TSharedPtr<FJsonObject>* BoundsObj;
+	if (Arguments->TryGetObjectField(TEXT("bounds"), BoundsObj))
+	{
+		FVector Min, Max;
+		if (!ParseVectorField(*BoundsObj, TEXT("min"), Min) || !ParseVectorField(*BoundsObj, TEXT("max"), Max))
+		{
+			return MakeErrorResult(TEXT("Invalid parameter: bounds requires min and max with x, y, z"));
+		}
+		Query.Bounds = FBox(Min, Max);
+	}
+
+	FString Cursor;
+	if (Arguments->TryGetStringField(TEXT("cursor"), Cursor) && !Cursor.IsEmpty())
+	{
+		if (!Cursor.IsNumeric() || FCString::Atoi(*Cursor) < 0)
+		{
+			return MakeErrorResult(FString::Printf(TEXT("Invalid cursor: %s"), *Cursor));
+		}
+		Query.Offset = FCString::Atoi(*Cursor);
+	}
+
+	int32 Limit = 0;
+	if (Arguments->TryGetNumberField(TEXT("limit"), Limit))
+	{
+		Query.Limit = FMath::Clamp(Limit, 1, MaxLimit);
+	}
+
+	FActorPropertiesBulkResult BulkResult = ActorModule.GetActorPropertiesBulk(Query);
+	if (!BulkResult.bSuccess)
+	{
+		return MakeErrorResult(FString::Printf(TEXT("Failed to read properties: %s"), *BulkResult.ErrorMessage));
+	}
+
+	// Column-major: each column holds one value per entry of "actors", null where the path did not resolve
+	TArray<TSharedPtr<FJsonValue>> ColumnsArray;
+	ColumnsArray.Reserve(BulkResult.Columns.Num());
+	for (const FActorPropertyColumn& Column : BulkResult.Columns)
+	{
+		TArray<TSharedPtr<FJsonValue>> ValuesArray;
+		ValuesArray.Reserve(Column.Values.Num());
+		for (const TOptional<FString>& Value : Column.Values)
+		{
+			if (Value.IsSet())
+			{
+				ValuesArray.Add(MakeShared<FJsonValueString>(Value.GetValue()));
+			}
+			else
+			{
+				ValuesArray.Add(MakeShared<FJsonValueNull>());
+			}
+		}
+
+		TSharedPtr<FJsonObject> ColumnObj = MakeShared<FJsonObject>();
+		ColumnObj->SetStringField(TEXT("path"), Column.PropertyPath);
+		ColumnObj->SetStringField(TEXT("type"), Column.PropertyType);
+		ColumnObj->SetArrayField(TEXT("values"), ValuesArray);
+		ColumnsArray.Add(MakeShared<FJsonValueObject>(ColumnObj));
+	}
+
+	TSharedPtr<FJsonObject> Structured = MakeShared<FJsonObject>();
+	Structured->SetNumberField(TEXT("count"), BulkResult.ActorNames.Num());
+	Structured->SetArrayField(TEXT("actors"), MakeStringArray(BulkResult.ActorNames));
+	Structured->SetArrayField(TEXT("columns"), ColumnsArray);
+	if (BulkResult.MissingActors.Num() > 0)
+	{
+		Structured->SetArrayField(TEXT("missing"), MakeStringArray(BulkResult.MissingActors));
+	}
+	if (BulkResult.bHasMore)
+	{
+		Structured->SetStringField(TEXT("next_cursor"), FString::FromInt(BulkResult.NextOffset));
+	}
+
+	return MakeStructuredResult(Structured);
+}
@@ -1,9 +1,27 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Tools/Impl/GetActorsInLevelImplTool.h"
+#include "Tools/MCPToolResultUtils.h"
 #include "Modules/Interfaces/IActorModule.h"
 #include "Dom/JsonValue.h"
 
+namespace GetActorsInLevelToolPrivate
+{
+	constexpr int32 DefaultLimit = 1000;
+	constexpr int32 MaxLimit = 10000;
+
+	bool ParseField(const FString& FieldName, EActorInfoFields& OutField)
+	{
+		if (FieldName == TEXT("name")) { OutField = EActorInfoFields::Name; return true; }
+		if (FieldName == TEXT("label")) { OutField = EActorInfoFields::Label; return true; }
+		if (FieldName == TEXT("class")) { OutField = EActorInfoFields::Class; return true; }
+		if (FieldName == TEXT("location")) { OutField = EActorInfoFields::Location; return true; }
+		if (FieldName == TEXT("rotation")) { OutField = EActorInfoFields::Rotation; return true; }
+		if (FieldName == TEXT("folder")) { OutField = EActorInfoFields::Folder; return true; }
+		return false;
+	}
+}
+
 FGetActorsInLevelImplTool::FGetActorsInLevelImplTool(IActorModule& InActorModule)
 	: ActorModule(InActorModule)
 {
@@ -16,11 +34,14 @@ FString FGetActorsInLevelImplTool::GetName() const
 
 FString FGetActorsInLevelImplTool::GetDescription() const
 {
-	return TEXT("Get a list of all actors in the current level. Optionally filter by class.");
+	return TEXT("Get actors in the current level, one page at a time. Optionally filter by class, folder, or bounds and select which fields to return.");
 }
 
 TSharedPtr<FJsonObject> FGetActorsInLevelImplTool::GetInputSchema() const
 {
+	using namespace GetActorsInLevelToolPrivate;
+	using namespace MCPToolResultUtils;
+
 	TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
 	Schema->SetStringField(TEXT("type"), TEXT("object"));
 
@@ -32,6 +53,43 @@ TSharedPtr<FJsonObject> FGetActorsInLevelImplTool::GetInputSchema() const
 		TEXT("Optional class path to filter actors (e.g. '/Script/Engine.StaticMeshActor')"));
 	Properties->SetObjectField(TEXT("class_filter"), ClassFilterProp);
 
+	TSharedPtr<FJsonObject> FolderProp = MakeShared<FJsonObject>();
+	FolderProp->SetStringField(TEXT("type"), TEXT("string"));
+	FolderProp->SetStringField(TEXT("description"),
+		TEXT("Optional World Outliner folder; only actors in this folder or its subfolders are returned"));
+	Properties->SetObjectField(TEXT("folder"), FolderProp);
+
+	TSharedPtr<FJsonObject> BoundsProp = MakeShared<FJsonObject>();
+	BoundsProp->SetStringField(TEXT("type"), TEXT("object"));
+	BoundsProp->SetStringField(TEXT("description"),
+		TEXT("Optional axis-aligned box; only actors whose bounds overlap it are returned"));
+	TSharedPtr<FJsonObject> BoundsProperties = MakeShared<FJsonObject>();
+	BoundsProperties->SetObjectField(TEXT("min"), MakeVectorProp());
+	BoundsProperties->SetObjectField(TEXT("max"), MakeVectorProp());
+	BoundsProp->SetObjectField(TEXT("properties"), BoundsProperties);
+	Properties->SetObjectField(TEXT("bounds"), BoundsProp);
+
+	TSharedPtr<FJsonObject> FieldsProp = MakeShared<FJsonObject>();
+	FieldsProp->SetStringField(TEXT("type"), TEXT("array"));
+	FieldsProp->SetStringField(TEXT("description"),
+		TEXT("Fields to return for each actor: name, label, class, location, rotation, folder (default: all)"));
+	TSharedPtr<FJsonObject> FieldItem = MakeShared<FJsonObject>();
+	FieldItem->SetStringField(TEXT("type"), TEXT("string"));
+	FieldsProp->SetObjectField(TEXT("items"), FieldItem);
+	Properties->SetObjectField(TEXT("fields"), FieldsProp);
+
+	TSharedPtr<FJsonObject> CursorProp = MakeShared<FJsonObject>();
+	CursorProp->SetStringField(TEXT("type"), TEXT("string"));
+	CursorProp->SetStringField(TEXT("description"),
+		TEXT("Opaque cursor from a previous response's next_cursor to fetch the next page"));
+	Properties->SetObjectField(TEXT("cursor"), CursorProp);
+
+	TSharedPtr<FJsonObject> LimitProp = MakeShared<FJsonObject>();
+	LimitProp->SetStringField(TEXT("type"), TEXT("integer"));
+	LimitProp->SetStringField(TEXT("description"),
+		FString::Printf(TEXT("Maximum number of actors per page (default %d, max %d)"), DefaultLimit, MaxLimit));
+	Properties->SetObjectField(TEXT("limit"), LimitProp);
+
 	Schema->SetObjectField(TEXT("properties"), Properties);
 
 	return Schema;
@@ -39,43 +97,114 @@ TSharedPtr<FJsonObject> FGetActorsInLevelImplTool::GetInputSchema() const
 
 TSharedPtr<FJsonObject> FGetActorsInLevelImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
 {
-	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-	TArray<TSharedPtr<FJsonValue>> ContentArray;
+	using namespace GetActorsInLevelToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	FActorQuery Query;
+	Query.Limit = DefaultLimit;
 
-	FString ClassFilter;
 	if (Arguments.IsValid())
 	{
-		Arguments->TryGetStringField(TEXT("class_filter"), ClassFilter);
-	}
+		Arguments->TryGetStringField(TEXT("class_filter"), Query.ClassFilter);
+		Arguments->TryGetStringField(TEXT("folder"), Query.FolderFilter);
 
-	FGetActorsResult ActorsResult = ActorModule.GetActorsInLevel(ClassFilter);
+		const TSharedPtr<FJsonObject>* BoundsObj;
+		if (Arguments->TryGetObjectField(TEXT("bounds"), BoundsObj))
+		{
+			FVector Min, Max;
+			if (!ParseVectorField(*BoundsObj, TEXT("min"), Min) || !ParseVectorField(*BoundsObj, TEXT("max"), Max))
+			{
+				return MakeErrorResult(TEXT("Invalid parameter: bounds requires min and max with x, y, z"));
+			}
+			Query.Bounds = FBox(Min, Max);
+		}
 
-	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
-	TextContent->SetStringField(TEXT("type"), TEXT("text"));
+		const TArray<TSharedPtr<FJsonValue>>* FieldsArray;
+		if (Arguments->TryGetArrayField(TEXT("fields"), FieldsArray) && FieldsArray->Num() > 0)
+		{
+			Query.Fields = EActorInfoFields::None;
+			for (const TSharedPtr<FJsonValue>& FieldValue : *FieldsArray)
+			{
+				EActorInfoFields Field;
+				if (!ParseField(FieldValue->AsString(), Field))
+				{
+					return MakeErrorResult(FString::Printf(TEXT("Unknown field: %s"), *FieldValue->AsString()));
+				}
+				Query.Fields |= Field;
+			}
+		}
 
-	if (ActorsResult.bSuccess)
-	{
-		FString ResponseText = FString::Printf(TEXT("Found %d actors in level:\n"), ActorsResult.Actors.Num());
-		for (const FActorInfo& Info : ActorsResult.Actors)
+		FString Cursor;
+		if (Arguments->TryGetStringField(TEXT("cursor"), Cursor) && !Cursor.IsEmpty())
+		{
+			if (!Cursor.IsNumeric() || FCString::Atoi(*Cursor) < 0)
+			{
+				return MakeErrorResult(FString::Printf(TEXT("Invalid cursor: %s"), *Cursor));
+			}
+			Query.Offset = FCString::Atoi(*Cursor);
+		}
+
+		int32 Limit = 0;
+		if (Arguments->TryGetNumberField(TEXT("limit"), Limit))
 		{
-			ResponseText += FString::Printf(
-				TEXT("- %s [%s] Class=%s Loc=(%.1f, %.1f, %.1f) Folder=%s\n"),
-				*Info.ActorLabel, *Info.ActorName, *Info.ActorClass,
-				Info.Location.X, Info.Location.Y, Info.Location.Z,
-				*Info.FolderPath);
+			Query.Limit = FMath::Clamp(Limit, 1, MaxLimit);
 		}
-		TextContent->SetStringField(TEXT("text"), ResponseText);
-		Result->SetBoolField(TEXT("isError"), false);
 	}
-	else
+
+	FGetActorsResult ActorsResult = ActorModule.GetActorsInLevel(Query);
+	if (!ActorsResult.bSuccess)
 	{
-		TextContent->SetStringField(TEXT("text"),
-			FString::Printf(TEXT("Failed to get actors: %s"), *ActorsResult.ErrorMessage));
-		Result->SetBoolField(TEXT("isError"), true);
+		return MakeErrorResult(FString::Printf(TEXT("Failed to get actors: %s"), *ActorsResult.ErrorMessage));
+	}
+
+	// Build the structured result with only the requested fields
+	TArray<TSharedPtr<FJsonValue>> ActorsArray;
+	ActorsArray.Reserve(ActorsResult.Actors.Num());
+	for (const FActorInfo& Info : ActorsResult.Actors)
+	{
+		TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Name))
+		{
+			ActorObj->SetStringField(TEXT("name"), Info.ActorName);
+		}
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Label))
+		{
+			ActorObj->SetStringField(TEXT("label"), Info.ActorLabel);
+		}
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Class))
+		{
+			ActorObj->SetStringField(TEXT("class"), Info.ActorClass);
+		}
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Location))
+		{
+			TSharedPtr<FJsonObject> LocationObj = MakeShared<FJsonObject>();
+			LocationObj->SetNumberField(TEXT("x"), Info.Location.X);
+			LocationObj->SetNumberField(TEXT("y"), Info.Location.Y);
+			LocationObj->SetNumberField(TEXT("z"), Info.Location.Z);
+			ActorObj->SetObjectField(TEXT("location"), LocationObj);
+		}
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Rotation))
+		{
+			TSharedPtr<FJsonObject> RotationObj = MakeShared<FJsonObject>();
+			RotationObj->SetNumberField(TEXT("pitch"), Info.Rotation.Pitch);
+			RotationObj->SetNumberField(TEXT("yaw"), Info.Rotation.Yaw);
+			RotationObj->SetNumberField(TEXT("roll"), Info.Rotation.Roll);
+			ActorObj->SetObjectField(TEXT("rotation"), RotationObj);
+		}
+		if (EnumHasAnyFlags(Query.Fields, EActorInfoFields::Folder))
+		{
+			ActorObj->SetStringField(TEXT("folder"), Info.FolderPath);
+		}
+		ActorsArray.Add(MakeShared<FJsonValueObject>(ActorObj));
 	}
 
-	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
-	Result->SetArrayField(TEXT("content"), ContentArray);
+	TSharedPtr<FJsonObject> Structured = MakeShared<FJsonObject>();
+	Structured->SetNumberField(TEXT("count"), ActorsArray.Num());
+	Structured->SetArrayField(TEXT("actors"), ActorsArray);
+	if (ActorsResult.bHasMore)
+	{
+		Structured->SetStringField(TEXT("next_cursor"), FString::FromInt(ActorsResult.NextOffset));
+	}
 
-	return Result;
+	return MakeStructuredResult(Structured);
 }
@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/Impl/GetAssetCacheStatsImplTool.h"
+#include "Modules/Interfaces/IAssetCacheModule.h"
+#include "Dom/JsonValue.h"
+
+FGetAssetCacheStatsImplTool::FGetAssetCacheStatsImplTool(IAssetCacheModule& InAssetCacheModule)
+	: AssetCacheModule(InAssetCacheModule)
+{
+}
+
+FString FGetAssetCacheStatsImplTool::GetName() const
+{
+	return TEXT("get_asset_cache_stats");
+}
+
+FString FGetAssetCacheStatsImplTool::GetDescription() const
+{
+	return TEXT("Get hit/miss counters of the resolved-asset cache shared by all tools. Optionally clear the cache.");
+}
+
+TSharedPtr<FJsonObject> FGetAssetCacheStatsImplTool::GetInputSchema() const
+{
+	TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+
+	TSharedPtr<FJsonObject> ClearProp = MakeShared<FJsonObject>();
+	ClearProp->SetStringField(TEXT("type"), TEXT("boolean"));
+	ClearProp->SetStringField(TEXT("description"),
+		TEXT("Drop all cached assets after reading the counters (default: false)"));
+	Properties->SetObjectField(TEXT("clear"), ClearProp);
+
+	Schema->SetObjectField(TEXT("properties"), Properties);
+
+	return Schema;
+}
+
+TSharedPtr<FJsonObject> FGetAssetCacheStatsImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> ContentArray;
+
+	bool bClear = false;
+	if (Arguments.IsValid())
+	{
+		Arguments->TryGetBoolField(TEXT("clear"), bClear);
+	}
+
+	const FAssetCacheStats Stats = AssetCacheModule.GetStats();
+	if (bClear)
+	{
+		AssetCacheModule.ClearCache();
+	}
+
+	const int64 Lookups = Stats.Hits + Stats.Misses;
+	const double HitRate = Lookups > 0 ? 100.0 * static_cast<double>(Stats.Hits) / static_cast<double>(Lookups) : 0.0;
+
+	FString ResponseText = FString::Printf(
+		TEXT("Asset cache: %d cached, %lld hits, %lld misses (%.1f%% hit rate), %lld invalidations"),
+		Stats.CachedCount, Stats.Hits, Stats.Misses, HitRate, Stats.Invalidations);
+	if (bClear)
+	{
+		ResponseText += TEXT("\nCache cleared");
+	}
+
+	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
+	TextContent->SetStringField(TEXT("type"), TEXT("text"));
+	TextContent->SetStringField(TEXT("text"), ResponseText);
+	Result->SetBoolField(TEXT("isError"), false);
+
+	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+	Result->SetArrayField(TEXT("content"), ContentArray);
+
+	return Result;
+}
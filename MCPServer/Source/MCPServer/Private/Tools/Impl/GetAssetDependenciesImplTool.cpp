@@ -83,3 +83,9 @@ TSharedPtr<FJsonObject> FGetAssetDependenciesImplTool::Execute(const TSharedPtr<
 	Result->SetArrayField(TEXT("content"), ContentArray);
 	return Result;
 }
+
+bool FGetAssetDependenciesImplTool::IsReadOnly() const
+{
+	// Only queries the asset registry, which is safe to use from worker threads
+	return true;
+}
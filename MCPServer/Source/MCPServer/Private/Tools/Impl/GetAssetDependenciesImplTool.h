@@ -14,6 +14,7 @@ public:
 	virtual FString GetDescription() const override;
 	virtual TSharedPtr<FJsonObject> GetInputSchema() const override;
 	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override;
+	virtual bool IsReadOnly() const override;
 
 private:
 	IAssetModule& AssetModule;
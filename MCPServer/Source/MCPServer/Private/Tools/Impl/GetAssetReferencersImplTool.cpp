@@ -83,3 +83,9 @@ TSharedPtr<FJsonObject> FGetAssetReferencersImplTool::Execute(const TSharedPtr<F
 	Result->SetArrayField(TEXT("content"), ContentArray);
 	return Result;
 }
+
+bool FGetAssetReferencersImplTool::IsReadOnly() const
+{
+	// Only queries the asset registry, which is safe to use from worker threads
+	return true;
+}
@@ -108,23 +108,15 @@ TSharedPtr<FJsonObject> FGetGraphNodesSummaryImplTool::Execute(const TSharedPtr<
 			NodeObj->SetStringField(TEXT("node_class"), Info.NodeClass);
 			NodeObj->SetStringField(TEXT("node_title"), Info.NodeTitle);
 
-			// Collect unique connected node IDs from all pins
+			// Collect unique connected node IDs from all pins; the module reports each link's owning node
 			TSet<FString> ConnectedNodeIdSet;
 			for (const FGraphNodePinInfo& PinInfo : Info.Pins)
 			{
-				for (const FString& ConnectedPinId : PinInfo.ConnectedPinIds)
+				for (const FString& ConnectedNodeId : PinInfo.ConnectedNodeIds)
 				{
-					// Find which node owns this pin
-					for (const FGraphNodeInfo& OtherNode : NodesResult.Nodes)
+					if (!ConnectedNodeId.IsEmpty() && ConnectedNodeId != Info.NodeId)
 					{
-						if (OtherNode.NodeId == Info.NodeId) continue;
-						for (const FGraphNodePinInfo& OtherPin : OtherNode.Pins)
-						{
-							if (OtherPin.PinId == ConnectedPinId)
-							{
-								ConnectedNodeIdSet.Add(OtherNode.NodeId);
-							}
-						}
+						ConnectedNodeIdSet.Add(ConnectedNodeId);
 					}
 				}
 			}
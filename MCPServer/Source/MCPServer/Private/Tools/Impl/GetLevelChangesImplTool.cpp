@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/Impl/GetLevelChangesImplTool.h"
+#include "Tools/MCPToolResultUtils.h"
+#include "Modules/Interfaces/IActorModule.h"
+#include "Dom/JsonValue.h"
+
+namespace GetLevelChangesToolPrivate
+{
+	TSharedPtr<FJsonValue> MakeChangeValue(const FActorChange& Change)
+	{
+		TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
+		ActorObj->SetStringField(TEXT("name"), Change.ActorName);
+		ActorObj->SetStringField(TEXT("label"), Change.ActorLabel);
+		ActorObj->SetStringField(TEXT("class"), Change.ActorClass);
+		if (Change.Kind != EActorChangeKind::Removed)
+		{
+			TSharedPtr<FJsonObject> LocationObj = MakeShared<FJsonObject>();
+			LocationObj->SetNumberField(TEXT("x"), Change.Location.X);
+			LocationObj->SetNumberField(TEXT("y"), Change.Location.Y);
+			LocationObj->SetNumberField(TEXT("z"), Change.Location.Z);
+			ActorObj->SetObjectField(TEXT("location"), LocationObj);
+		}
+		return MakeShared<FJsonValueObject>(ActorObj);
+	}
+}
+
+FGetLevelChangesImplTool::FGetLevelChangesImplTool(IActorModule& InActorModule)
+	: ActorModule(InActorModule)
+{
+}
+
+FString FGetLevelChangesImplTool::GetName() const
+{
+	return TEXT("get_level_changes");
+}
+
+FString FGetLevelChangesImplTool::GetDescription() const
+{
+	return TEXT("Get the actors added, removed or modified in the editor level since a change token, plus a new token. Call without a token to get the current one; if reset is true, re-read the level and continue from the returned token.");
+}
+
+TSharedPtr<FJsonObject> FGetLevelChangesImplTool::GetInputSchema() const
+{
+	TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+
+	TSharedPtr<FJsonObject> TokenProp = MakeShared<FJsonObject>();
+	TokenProp->SetStringField(TEXT("type"), TEXT("string"));
+	TokenProp->SetStringField(TEXT("description"), TEXT("Token returned by a previous call. Omit to only get the current token."));
+	Properties->SetObjectField(TEXT("since_token"), TokenProp);
+
+	Schema->SetObjectField(TEXT("properties"), Properties);
+
+	return Schema;
+}
+
+TSharedPtr<FJsonObject> FGetLevelChangesImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	using namespace GetLevelChangesToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	FString SinceToken;
+	if (Arguments.IsValid())
+	{
+		Arguments->TryGetStringField(TEXT("since_token"), SinceToken);
+	}
+
+	FLevelChangesResult ChangesResult = ActorModule.GetLevelChanges(SinceToken);
+	if (!ChangesResult.bSuccess)
+	{
+		return MakeErrorResult(FString::Printf(TEXT("Failed to get level changes: %s"), *ChangesResult.ErrorMessage));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> AddedArray;
+	TArray<TSharedPtr<FJsonValue>> ModifiedArray;
+	TArray<TSharedPtr<FJsonValue>> RemovedArray;
+	for (const FActorChange& Change : ChangesResult.Changes)
+	{
+		switch (Change.Kind)
+		{
+		case EActorChangeKind::Added:
+			AddedArray.Add(MakeChangeValue(Change));
+			break;
+		case EActorChangeKind::Modified:
+			ModifiedArray.Add(MakeChangeValue(Change));
+			break;
+		case EActorChangeKind::Removed:
+			RemovedArray.Add(MakeChangeValue(Change));
+			break;
+		}
+	}
+
+	TSharedPtr<FJsonObject> Structured = MakeShared<FJsonObject>();
+	Structured->SetStringField(TEXT("token"), ChangesResult.Token);
+	Structured->SetBoolField(TEXT("reset"), ChangesResult.bReset);
+	Structured->SetArrayField(TEXT("added"), AddedArray);
+	Structured->SetArrayField(TEXT("modified"), ModifiedArray);
+	Structured->SetArrayField(TEXT("removed"), RemovedArray);
+
+	return MakeStructuredResult(Structured);
+}
@@ -0,0 +1,91 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/Impl/GetQueueStatsImplTool.h"
+#include "Tools/MCPToolCallQueue.h"
+#include "Protocol/MCPRateLimiter.h"
+#include "Dom/JsonValue.h"
+
+FGetQueueStatsImplTool::FGetQueueStatsImplTool(FMCPToolCallQueue& InToolCallQueue, FMCPRateLimiter& InRateLimiter)
+	: ToolCallQueue(InToolCallQueue)
+	, RateLimiter(InRateLimiter)
+{
+}
+
+FString FGetQueueStatsImplTool::GetName() const
+{
+	return TEXT("get_queue_stats");
+}
+
+FString FGetQueueStatsImplTool::GetDescription() const
+{
+	return TEXT("Get tool call queue depth per priority lane (interactive, bulk, build), rate limits and admission counters, "
+		"and per-tool wait/execute times.");
+}
+
+TSharedPtr<FJsonObject> FGetQueueStatsImplTool::GetInputSchema() const
+{
+	TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+	Schema->SetObjectField(TEXT("properties"), MakeShared<FJsonObject>());
+	return Schema;
+}
+
+TSharedPtr<FJsonObject> FGetQueueStatsImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> ContentArray;
+
+	FString ResponseText = FString::Printf(TEXT("Tool call queue: %d queued or running, %d running tasks"),
+		ToolCallQueue.GetQueueDepth(), ToolCallQueue.GetActiveTaskCount());
+
+	for (int32 LaneIndex = 0; LaneIndex < static_cast<int32>(EMCPToolPriority::Num); ++LaneIndex)
+	{
+		const EMCPToolPriority Priority = static_cast<EMCPToolPriority>(LaneIndex);
+		const FMCPLaneLimits& Limits = RateLimiter.GetLaneLimits(Priority);
+		const FMCPLaneAdmissionStats Stats = RateLimiter.GetLaneStats(Priority);
+
+		const FString RateText = Limits.CallsPerSecond > 0.0
+			? FString::Printf(TEXT("%.2f calls/s per session (burst %.0f)"), Limits.CallsPerSecond, FMath::Max(1.0, Limits.Burst))
+			: FString(TEXT("no rate limit"));
+		const FString QueueLimitText = Limits.MaxQueuedCalls > 0
+			? FString::Printf(TEXT("max %d"), Limits.MaxQueuedCalls)
+			: FString(TEXT("no limit"));
+
+		ResponseText += FString::Printf(
+			TEXT("\nLane %s: %d pending (%s), %s; %lld admitted, %lld rate limited, %lld refused (queue full)"),
+			LexToString(Priority), ToolCallQueue.GetPendingCount(Priority), *QueueLimitText, *RateText,
+			Stats.Admitted, Stats.RateLimited, Stats.QueueFull);
+	}
+
+	// Most expensive tools first
+	TMap<FString, FMCPToolQueueStats> ToolStats = ToolCallQueue.GetToolStats();
+	ToolStats.ValueSort([](const FMCPToolQueueStats& A, const FMCPToolQueueStats& B)
+	{
+		return A.TotalExecuteSeconds > B.TotalExecuteSeconds;
+	});
+
+	if (ToolStats.Num() > 0)
+	{
+		ResponseText += TEXT("\n\nTools:");
+	}
+	for (const auto& Pair : ToolStats)
+	{
+		const FMCPToolQueueStats& Stats = Pair.Value;
+		const double Completed = static_cast<double>(FMath::Max<int64>(1, Stats.CompletedCount));
+		ResponseText += FString::Printf(
+			TEXT("\n- %s: %lld completed, %d queued, wait avg %.1f ms (max %.1f), execute avg %.1f ms (max %.1f)"),
+			*Pair.Key, Stats.CompletedCount, Stats.QueueDepth,
+			1000.0 * Stats.TotalWaitSeconds / Completed, 1000.0 * Stats.MaxWaitSeconds,
+			1000.0 * Stats.TotalExecuteSeconds / Completed, 1000.0 * Stats.MaxExecuteSeconds);
+	}
+
+	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
+	TextContent->SetStringField(TEXT("type"), TEXT("text"));
+	TextContent->SetStringField(TEXT("text"), ResponseText);
+	Result->SetBoolField(TEXT("isError"), false);
+
+	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+	Result->SetArrayField(TEXT("content"), ContentArray);
+
+	return Result;
+}
@@ -0,0 +1,22 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "Tools/Interfaces/IMCPTool.h"
+
+class FMCPToolCallQueue;
+class FMCPRateLimiter;
+
+class FGetQueueStatsImplTool : public IMCPTool
+{
+public:
+	FGetQueueStatsImplTool(FMCPToolCallQueue& InToolCallQueue, FMCPRateLimiter& InRateLimiter);
+
+	virtual FString GetName() const override;
+	virtual FString GetDescription() const override;
+	virtual TSharedPtr<FJsonObject> GetInputSchema() const override;
+	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override;
+
+private:
+	FMCPToolCallQueue& ToolCallQueue;
+	FMCPRateLimiter& RateLimiter;
+};
@@ -0,0 +1,139 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/Impl/GetServerStatsImplTool.h"
+#include "Core/MCPMetrics.h"
+#include "Dom/JsonValue.h"
+
+namespace GetServerStatsPrivate
+{
+	FString FormatMillis(uint64 Micros)
+	{
+		return FString::Printf(TEXT("%.1f ms"), Micros / 1000.0);
+	}
+
+	FString FormatBytes(double Bytes)
+	{
+		return Bytes >= 1024.0 ? FString::Printf(TEXT("%.1f KB"), Bytes / 1024.0) : FString::Printf(TEXT("%.0f B"), Bytes);
+	}
+
+	/** One line per series, most total time first */
+	void AppendSeries(FString& Out, TMap<FString, FMCPMetricSeries>& Series)
+	{
+		Series.ValueSort([](const FMCPMetricSeries& A, const FMCPMetricSeries& B)
+		{
+			return A.LatencyMicros.GetSum() > B.LatencyMicros.GetSum();
+		});
+
+		for (const auto& Pair : Series)
+		{
+			const FMCPMetricSeries& Stats = Pair.Value;
+			Out += FString::Printf(TEXT("\n- %s: %lld calls, %lld errors, latency p50 %s, p95 %s, p99 %s (max %s)"),
+				*Pair.Key, Stats.Calls, Stats.Errors,
+				*FormatMillis(Stats.LatencyMicros.GetPercentile(0.5)),
+				*FormatMillis(Stats.LatencyMicros.GetPercentile(0.95)),
+				*FormatMillis(Stats.LatencyMicros.GetPercentile(0.99)),
+				*FormatMillis(Stats.LatencyMicros.GetMax()));
+
+			if (Stats.QueueWaitMicros.GetCount() > 0)
+			{
+				Out += FString::Printf(TEXT(", queue wait p50 %s, p95 %s"),
+					*FormatMillis(Stats.QueueWaitMicros.GetPercentile(0.5)),
+					*FormatMillis(Stats.QueueWaitMicros.GetPercentile(0.95)));
+			}
+			if (Stats.RequestBytes.GetCount() > 0)
+			{
+				Out += FString::Printf(TEXT(", request avg %s, response avg %s (max %s)"),
+					*FormatBytes(Stats.RequestBytes.GetMean()),
+					*FormatBytes(Stats.ResponseBytes.GetMean()),
+					*FormatBytes(static_cast<double>(Stats.ResponseBytes.GetMax())));
+			}
+		}
+	}
+}
+
+FGetServerStatsImplTool::FGetServerStatsImplTool(FMCPMetrics& InMetrics)
+	: Metrics(InMetrics)
+{
+}
+
+FString FGetServerStatsImplTool::GetName() const
+{
+	return TEXT("get_server_stats");
+}
+
+FString FGetServerStatsImplTool::GetDescription() const
+{
+	return TEXT("Get call counts, error counts, p50/p95/p99 latency, queue wait and request/response sizes "
+		"per JSON-RPC method and per tool. Optionally reset the counters.");
+}
+
+TSharedPtr<FJsonObject> FGetServerStatsImplTool::GetInputSchema() const
+{
+	TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+
+	TSharedPtr<FJsonObject> ResetProp = MakeShared<FJsonObject>();
+	ResetProp->SetStringField(TEXT("type"), TEXT("boolean"));
+	ResetProp->SetStringField(TEXT("description"),
+		TEXT("Reset all counters after reading them (default: false)"));
+	Properties->SetObjectField(TEXT("reset"), ResetProp);
+
+	Schema->SetObjectField(TEXT("properties"), Properties);
+
+	return Schema;
+}
+
+TSharedPtr<FJsonObject> FGetServerStatsImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> ContentArray;
+
+	bool bReset = false;
+	if (Arguments.IsValid())
+	{
+		Arguments->TryGetBoolField(TEXT("reset"), bReset);
+	}
+
+	const double CollectionSeconds = Metrics.GetCollectionSeconds();
+	TMap<FString, FMCPMetricSeries> MethodSeries = Metrics.GetMethodSeries();
+	TMap<FString, FMCPMetricSeries> ToolSeries = Metrics.GetToolSeries();
+	if (bReset)
+	{
+		Metrics.Reset();
+	}
+
+	FString ResponseText = FString::Printf(TEXT("Server stats over %.0f s: %d methods, %d tools called"),
+		CollectionSeconds, MethodSeries.Num(), ToolSeries.Num());
+
+	if (MethodSeries.Num() > 0)
+	{
+		ResponseText += TEXT("\n\nMethods:");
+		GetServerStatsPrivate::AppendSeries(ResponseText, MethodSeries);
+	}
+	if (ToolSeries.Num() > 0)
+	{
+		ResponseText += TEXT("\n\nTools:");
+		GetServerStatsPrivate::AppendSeries(ResponseText, ToolSeries);
+	}
+	if (bReset)
+	{
+		ResponseText += TEXT("\n\nCounters reset");
+	}
+
+	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
+	TextContent->SetStringField(TEXT("type"), TEXT("text"));
+	TextContent->SetStringField(TEXT("text"), ResponseText);
+	Result->SetBoolField(TEXT("isError"), false);
+
+	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+	Result->SetArrayField(TEXT("content"), ContentArray);
+
+	return Result;
+}
+
+bool FGetServerStatsImplTool::IsReadOnly() const
+{
+	return true;
+}
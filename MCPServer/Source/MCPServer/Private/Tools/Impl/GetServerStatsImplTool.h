@@ -0,0 +1,21 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "Tools/Interfaces/IMCPTool.h"
+
+class FMCPMetrics;
+
+class FGetServerStatsImplTool : public IMCPTool
+{
+public:
+	explicit FGetServerStatsImplTool(FMCPMetrics& InMetrics);
+
+	virtual FString GetName() const override;
+	virtual FString GetDescription() const override;
+	virtual TSharedPtr<FJsonObject> GetInputSchema() const override;
+	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override;
+	virtual bool IsReadOnly() const override;
+
+private:
+	FMCPMetrics& Metrics;
+};
@@ -60,3 +60,8 @@ TSharedPtr<FJsonObject> FHelloWorldImplTool::Execute(const TSharedPtr<FJsonObjec
 
 	return Result;
 }
+
+bool FHelloWorldImplTool::IsReadOnly() const
+{
+	return true;
+}
@@ -0,0 +1,166 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/Impl/MergeToInstancesImplTool.h"
+#include "Tools/MCPToolResultUtils.h"
+#include "Modules/Interfaces/IActorModule.h"
+#include "Tools/MCPBatchToolTask.h"
+#include "Dom/JsonValue.h"
+
+namespace MergeToInstancesToolPrivate
+{
+	TSharedPtr<FJsonObject> MakeBeforeAfter(int64 Before, int64 After)
+	{
+		TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+		Obj->SetNumberField(TEXT("before"), Before);
+		Obj->SetNumberField(TEXT("after"), After);
+		return Obj;
+	}
+}
+
+FMergeToInstancesImplTool::FMergeToInstancesImplTool(IActorModule& InActorModule)
+	: ActorModule(InActorModule)
+{
+}
+
+FString FMergeToInstancesImplTool::GetName() const
+{
+	return TEXT("merge_to_instances");
+}
+
+FString FMergeToInstancesImplTool::GetDescription() const
+{
+	return TEXT("Replace static mesh actors that share a mesh, material overrides and settings with one instanced static mesh actor per group, keeping transforms and Outliner folders. Reports estimated draw call and memory savings; explode_instances reverses it.");
+}
+
+TSharedPtr<FJsonObject> FMergeToInstancesImplTool::GetInputSchema() const
+{
+	using namespace MergeToInstancesToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+
+	TSharedPtr<FJsonObject> ActorsProp = MakeDescribedProp(TEXT("array"),
+		TEXT("Actor names, labels or paths to merge. If omitted, the selection (use_selection) or every actor matching folder and bounds is used."));
+	TSharedPtr<FJsonObject> ItemProp = MakeShared<FJsonObject>();
+	ItemProp->SetStringField(TEXT("type"), TEXT("string"));
+	ActorsProp->SetObjectField(TEXT("items"), ItemProp);
+	Properties->SetObjectField(TEXT("actors"), ActorsProp);
+
+	Properties->SetObjectField(TEXT("use_selection"), MakeDescribedProp(TEXT("boolean"),
+		TEXT("Merge the selected actors when no actors are given (default false)")));
+	Properties->SetObjectField(TEXT("folder"), MakeDescribedProp(TEXT("string"),
+		TEXT("Only actors in this Outliner folder or its subfolders")));
+
+	TSharedPtr<FJsonObject> BoundsProp = MakeDescribedProp(TEXT("object"),
+		TEXT("Only actors whose bounds overlap this axis-aligned box"));
+	TSharedPtr<FJsonObject> BoundsProperties = MakeShared<FJsonObject>();
+	BoundsProperties->SetObjectField(TEXT("min"), MakeVectorProp());
+	BoundsProperties->SetObjectField(TEXT("max"), MakeVectorProp());
+	BoundsProp->SetObjectField(TEXT("properties"), BoundsProperties);
+	Properties->SetObjectField(TEXT("bounds"), BoundsProp);
+
+	Properties->SetObjectField(TEXT("hierarchical"), MakeDescribedProp(TEXT("boolean"),
+		TEXT("Create hierarchical instanced components (HISM) with per-cluster culling and LOD (default true); false for plain ISM")));
+	Properties->SetObjectField(TEXT("min_instances"), MakeDescribedProp(TEXT("integer"),
+		TEXT("Leave groups with fewer actors unchanged (default 2)")));
+
+	Schema->SetObjectField(TEXT("properties"), Properties);
+
+	return Schema;
+}
+
+TSharedPtr<FJsonObject> FMergeToInstancesImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	using namespace MergeToInstancesToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	if (!Arguments.IsValid())
+	{
+		return MakeErrorResult(TEXT("Missing parameters: give actors, use_selection, folder or bounds"));
+	}
+
+	FMergeToInstancesRequest Request;
+
+	const TArray<TSharedPtr<FJsonValue>>* ActorsArray = nullptr;
+	if (Arguments->TryGetArrayField(TEXT("actors"), ActorsArray))
+	{
+		for (const TSharedPtr<FJsonValue>& ActorValue : *ActorsArray)
+		{
+			Request.ActorIdentifiers.Add(ActorValue->AsString());
+		}
+	}
+
+	Arguments->TryGetBoolField(TEXT("use_selection"), Request.bUseSelection);
+	Arguments->TryGetStringField(TEXT("folder"), Request.FolderFilter);
+
+	const TSharedPtr<FJsonObject>* BoundsObj;
+	if (Arguments->TryGetObjectField(TEXT("bounds"), BoundsObj))
+	{
+		FVector Min, Max;
+		if (!ParseVectorField(*BoundsObj, TEXT("min"), Min) || !ParseVectorField(*BoundsObj, TEXT("max"), Max))
+		{
+			return MakeErrorResult(TEXT("Invalid parameter: bounds requires min and max with x, y, z"));
+		}
+		Request.Bounds = FBox(Min, Max);
+	}
+
+	// Merging is destructive, so the whole level is never merged by omission
+	if (Request.ActorIdentifiers.IsEmpty() && !Request.bUseSelection && Request.FolderFilter.IsEmpty() && !Request.Bounds.IsValid)
+	{
+		return MakeErrorResult(TEXT("Missing parameters: give actors, use_selection, folder or bounds"));
+	}
+
+	Arguments->TryGetBoolField(TEXT("hierarchical"), Request.bHierarchical);
+	int32 MinInstances = 0;
+	if (Arguments->TryGetNumberField(TEXT("min_instances"), MinInstances))
+	{
+		Request.MinInstances = FMath::Max(1, MinInstances);
+	}
+
+	FMergeToInstancesResult MergeResult = ActorModule.MergeToInstances(Request);
+	if (!MergeResult.bSuccess)
+	{
+		return MakeErrorResult(FString::Printf(TEXT("Failed to merge actors: %s"), *MergeResult.ErrorMessage));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> GroupsArray;
+	GroupsArray.Reserve(MergeResult.Groups.Num());
+	for (const FInstanceMergeGroup& Group : MergeResult.Groups)
+	{
+		TSharedPtr<FJsonObject> GroupObj = MakeShared<FJsonObject>();
+		GroupObj->SetStringField(TEXT("actor"), Group.ActorName);
+		GroupObj->SetStringField(TEXT("label"), Group.ActorLabel);
+		GroupObj->SetStringField(TEXT("mesh"), Group.StaticMeshPath);
+		GroupObj->SetStringField(TEXT("folder"), Group.FolderPath);
+		GroupObj->SetNumberField(TEXT("instances"), Group.InstanceCount);
+		GroupsArray.Add(MakeShared<FJsonValueObject>(GroupObj));
+	}
+
+	// Skipped actors beyond the cap are counted but not listed, as in the batch tools
+	TArray<TSharedPtr<FJsonValue>> SkippedArray;
+	for (int32 SkipIndex = 0; SkipIndex < MergeResult.Skipped.Num() && SkipIndex < FMCPBatchToolTask::MaxListedErrors; ++SkipIndex)
+	{
+		TSharedPtr<FJsonObject> SkipObj = MakeShared<FJsonObject>();
+		SkipObj->SetStringField(TEXT("actor"), MergeResult.Skipped[SkipIndex].ActorIdentifier);
+		SkipObj->SetStringField(TEXT("reason"), MergeResult.Skipped[SkipIndex].Reason);
+		SkippedArray.Add(MakeShared<FJsonValueObject>(SkipObj));
+	}
+
+	TSharedPtr<FJsonObject> Structured = MakeShared<FJsonObject>();
+	Structured->SetNumberField(TEXT("merged"), MergeResult.MergedActorCount);
+	Structured->SetArrayField(TEXT("groups"), GroupsArray);
+	Structured->SetNumberField(TEXT("skipped_count"), MergeResult.Skipped.Num());
+	Structured->SetArrayField(TEXT("skipped"), SkippedArray);
+	Structured->SetObjectField(TEXT("draw_calls"), MakeBeforeAfter(MergeResult.Stats.DrawCallsBefore, MergeResult.Stats.DrawCallsAfter));
+	Structured->SetObjectField(TEXT("estimated_memory_bytes"), MakeBeforeAfter(MergeResult.Stats.EstimatedBytesBefore, MergeResult.Stats.EstimatedBytesAfter));
+
+	return MakeStructuredResult(Structured);
+}
+
+EMCPToolPriority FMergeToInstancesImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
+}
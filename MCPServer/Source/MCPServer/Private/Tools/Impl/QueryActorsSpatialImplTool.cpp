@@ -0,0 +1,207 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/Impl/QueryActorsSpatialImplTool.h"
+#include "Tools/MCPToolResultUtils.h"
+#include "Modules/Interfaces/IActorModule.h"
+#include "Dom/JsonValue.h"
+
+namespace QueryActorsSpatialToolPrivate
+{
+	constexpr int32 DefaultLimit = 1000;
+	constexpr int32 MaxLimit = 10000;
+
+	bool ParseShape(const FString& ShapeName, EActorSpatialShape& OutShape)
+	{
+		if (ShapeName == TEXT("box")) { OutShape = EActorSpatialShape::Box; return true; }
+		if (ShapeName == TEXT("sphere")) { OutShape = EActorSpatialShape::Sphere; return true; }
+		if (ShapeName == TEXT("frustum")) { OutShape = EActorSpatialShape::Frustum; return true; }
+		if (ShapeName == TEXT("nearest")) { OutShape = EActorSpatialShape::Nearest; return true; }
+		return false;
+	}
+}
+
+FQueryActorsSpatialImplTool::FQueryActorsSpatialImplTool(IActorModule& InActorModule)
+	: ActorModule(InActorModule)
+{
+}
+
+FString FQueryActorsSpatialImplTool::GetName() const
+{
+	return TEXT("query_actors_spatial");
+}
+
+FString FQueryActorsSpatialImplTool::GetDescription() const
+{
+	return TEXT("Find actors whose bounds overlap a box, sphere or camera frustum, or the k actors nearest to a point. Served from a spatial index, results are sorted by distance.");
+}
+
+TSharedPtr<FJsonObject> FQueryActorsSpatialImplTool::GetInputSchema() const
+{
+	using namespace QueryActorsSpatialToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+
+	TSharedPtr<FJsonObject> ShapeProp = MakeShared<FJsonObject>();
+	ShapeProp->SetStringField(TEXT("type"), TEXT("string"));
+	ShapeProp->SetStringField(TEXT("description"),
+		TEXT("Query shape: box (min, max), sphere (center, radius), frustum (origin, rotation, fov, aspect_ratio, near, far) or nearest (center, k, max_distance)"));
+	TArray<TSharedPtr<FJsonValue>> ShapeValues;
+	ShapeValues.Add(MakeShared<FJsonValueString>(TEXT("box")));
+	ShapeValues.Add(MakeShared<FJsonValueString>(TEXT("sphere")));
+	ShapeValues.Add(MakeShared<FJsonValueString>(TEXT("frustum")));
+	ShapeValues.Add(MakeShared<FJsonValueString>(TEXT("nearest")));
+	ShapeProp->SetArrayField(TEXT("enum"), ShapeValues);
+	Properties->SetObjectField(TEXT("shape"), ShapeProp);
+
+	Properties->SetObjectField(TEXT("min"), MakeVectorProp(TEXT("Box: minimum corner")));
+	Properties->SetObjectField(TEXT("max"), MakeVectorProp(TEXT("Box: maximum corner")));
+	Properties->SetObjectField(TEXT("center"), MakeVectorProp(TEXT("Sphere and nearest: query point")));
+	Properties->SetObjectField(TEXT("radius"), MakeDescribedProp(TEXT("number"), TEXT("Sphere: radius")));
+	Properties->SetObjectField(TEXT("origin"), MakeVectorProp(TEXT("Frustum: eye position")));
+
+	TSharedPtr<FJsonObject> RotationProp = MakeShared<FJsonObject>();
+	RotationProp->SetStringField(TEXT("type"), TEXT("object"));
+	RotationProp->SetStringField(TEXT("description"), TEXT("Frustum: view rotation in degrees"));
+	TSharedPtr<FJsonObject> RotationProperties = MakeShared<FJsonObject>();
+	RotationProperties->SetObjectField(TEXT("pitch"), MakeNumberProp());
+	RotationProperties->SetObjectField(TEXT("yaw"), MakeNumberProp());
+	RotationProperties->SetObjectField(TEXT("roll"), MakeNumberProp());
+	RotationProp->SetObjectField(TEXT("properties"), RotationProperties);
+	Properties->SetObjectField(TEXT("rotation"), RotationProp);
+
+	Properties->SetObjectField(TEXT("fov"), MakeDescribedProp(TEXT("number"), TEXT("Frustum: horizontal field of view in degrees (default 90)")));
+	Properties->SetObjectField(TEXT("aspect_ratio"), MakeDescribedProp(TEXT("number"), TEXT("Frustum: width / height (default 1.777)")));
+	Properties->SetObjectField(TEXT("near"), MakeDescribedProp(TEXT("number"), TEXT("Frustum: near plane distance (default 10)")));
+	Properties->SetObjectField(TEXT("far"), MakeDescribedProp(TEXT("number"), TEXT("Frustum: far plane distance (default 100000)")));
+	Properties->SetObjectField(TEXT("k"), MakeDescribedProp(TEXT("integer"), TEXT("Nearest: number of actors to return (default 1)")));
+	Properties->SetObjectField(TEXT("max_distance"), MakeDescribedProp(TEXT("number"), TEXT("Nearest: ignore actors farther than this (default: no limit)")));
+
+	TSharedPtr<FJsonObject> ClassFilterProp = MakeShared<FJsonObject>();
+	ClassFilterProp->SetStringField(TEXT("type"), TEXT("string"));
+	ClassFilterProp->SetStringField(TEXT("description"),
+		TEXT("Optional class path to filter actors (e.g. '/Script/Engine.StaticMeshActor')"));
+	Properties->SetObjectField(TEXT("class_filter"), ClassFilterProp);
+
+	Properties->SetObjectField(TEXT("limit"), MakeDescribedProp(TEXT("integer"),
+		FString::Printf(TEXT("Maximum number of actors to return (default %d, max %d)"), DefaultLimit, MaxLimit)));
+
+	Schema->SetObjectField(TEXT("properties"), Properties);
+
+	TArray<TSharedPtr<FJsonValue>> Required;
+	Required.Add(MakeShared<FJsonValueString>(TEXT("shape")));
+	Schema->SetArrayField(TEXT("required"), Required);
+
+	return Schema;
+}
+
+TSharedPtr<FJsonObject> FQueryActorsSpatialImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	using namespace QueryActorsSpatialToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	FString ShapeName;
+	if (!Arguments.IsValid() || !Arguments->TryGetStringField(TEXT("shape"), ShapeName))
+	{
+		return MakeErrorResult(TEXT("Missing required parameter: shape"));
+	}
+
+	FActorSpatialQuery Query;
+	Query.Limit = DefaultLimit;
+	if (!ParseShape(ShapeName, Query.Shape))
+	{
+		return MakeErrorResult(FString::Printf(TEXT("Unknown shape: %s (expected box, sphere, frustum or nearest)"), *ShapeName));
+	}
+
+	switch (Query.Shape)
+	{
+	case EActorSpatialShape::Box:
+	{
+		FVector Min, Max;
+		if (!ParseVectorField(Arguments, TEXT("min"), Min) || !ParseVectorField(Arguments, TEXT("max"), Max))
+		{
+			return MakeErrorResult(TEXT("Missing required parameter: box queries need min and max with x, y, z"));
+		}
+		Query.Box = FBox(Min, Max);
+		break;
+	}
+
+	case EActorSpatialShape::Sphere:
+		if (!ParseVectorField(Arguments, TEXT("center"), Query.Center) || !Arguments->TryGetNumberField(TEXT("radius"), Query.Radius))
+		{
+			return MakeErrorResult(TEXT("Missing required parameter: sphere queries need center and radius"));
+		}
+		break;
+
+	case EActorSpatialShape::Frustum:
+	{
+		if (!ParseVectorField(Arguments, TEXT("origin"), Query.Origin))
+		{
+			return MakeErrorResult(TEXT("Missing required parameter: frustum queries need origin"));
+		}
+		const TSharedPtr<FJsonObject>* RotationObj;
+		if (Arguments->TryGetObjectField(TEXT("rotation"), RotationObj))
+		{
+			(*RotationObj)->TryGetNumberField(TEXT("pitch"), Query.Rotation.Pitch);
+			(*RotationObj)->TryGetNumberField(TEXT("yaw"), Query.Rotation.Yaw);
+			(*RotationObj)->TryGetNumberField(TEXT("roll"), Query.Rotation.Roll);
+		}
+		Arguments->TryGetNumberField(TEXT("fov"), Query.FieldOfView);
+		Arguments->TryGetNumberField(TEXT("aspect_ratio"), Query.AspectRatio);
+		Arguments->TryGetNumberField(TEXT("near"), Query.NearDistance);
+		Arguments->TryGetNumberField(TEXT("far"), Query.FarDistance);
+		break;
+	}
+
+	case EActorSpatialShape::Nearest:
+		if (!ParseVectorField(Arguments, TEXT("center"), Query.Center))
+		{
+			return MakeErrorResult(TEXT("Missing required parameter: nearest queries need center"));
+		}
+		Arguments->TryGetNumberField(TEXT("k"), Query.Count);
+		Arguments->TryGetNumberField(TEXT("max_distance"), Query.MaxDistance);
+		break;
+	}
+
+	Arguments->TryGetStringField(TEXT("class_filter"), Query.ClassFilter);
+
+	int32 Limit = 0;
+	if (Arguments->TryGetNumberField(TEXT("limit"), Limit))
+	{
+		Query.Limit = FMath::Clamp(Limit, 1, MaxLimit);
+	}
+
+	FActorSpatialQueryResult QueryResult = ActorModule.QueryActorsSpatial(Query);
+	if (!QueryResult.bSuccess)
+	{
+		return MakeErrorResult(FString::Printf(TEXT("Failed to query actors: %s"), *QueryResult.ErrorMessage));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> ActorsArray;
+	ActorsArray.Reserve(QueryResult.Actors.Num());
+	for (const FActorSpatialMatch& Match : QueryResult.Actors)
+	{
+		TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
+		ActorObj->SetStringField(TEXT("name"), Match.ActorName);
+		ActorObj->SetStringField(TEXT("label"), Match.ActorLabel);
+		ActorObj->SetStringField(TEXT("class"), Match.ActorClass);
+		TSharedPtr<FJsonObject> LocationObj = MakeShared<FJsonObject>();
+		LocationObj->SetNumberField(TEXT("x"), Match.Location.X);
+		LocationObj->SetNumberField(TEXT("y"), Match.Location.Y);
+		LocationObj->SetNumberField(TEXT("z"), Match.Location.Z);
+		ActorObj->SetObjectField(TEXT("location"), LocationObj);
+		ActorObj->SetNumberField(TEXT("distance"), Match.Distance);
+		ActorsArray.Add(MakeShared<FJsonValueObject>(ActorObj));
+	}
+
+	TSharedPtr<FJsonObject> Structured = MakeShared<FJsonObject>();
+	Structured->SetNumberField(TEXT("count"), ActorsArray.Num());
+	Structured->SetNumberField(TEXT("total"), QueryResult.TotalMatches);
+	Structured->SetBoolField(TEXT("truncated"), QueryResult.bTruncated);
+	Structured->SetArrayField(TEXT("actors"), ActorsArray);
+
+	return MakeStructuredResult(Structured);
+}
@@ -64,3 +64,8 @@ TSharedPtr<FJsonObject> FRebuildLandscapeImplTool::Execute(const TSharedPtr<FJso
 	Result->SetArrayField(TEXT("content"), ContentArray);
 	return Result;
 }
+
+EMCPToolPriority FRebuildLandscapeImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Build;
+}
@@ -57,3 +57,8 @@ TSharedPtr<FJsonObject> FRebuildNavigationImplTool::Execute(const TSharedPtr<FJs
 
 	return Result;
 }
+
+EMCPToolPriority FRebuildNavigationImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Build;
+}
@@ -0,0 +1,555 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/Impl/RunPipelineImplTool.h"
+#include "Tools/MCPToolRegistry.h"
+#include "Tools/MCPBatchToolTask.h"
+#include "Tools/MCPToolResultUtils.h"
+#include "Tools/Interfaces/IMCPToolTask.h"
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace RunPipelineToolPrivate
+{
+	struct FPipelineStep
+	{
+		FString Id;
+		FString ToolName;
+		TSharedPtr<FJsonObject> Arguments;
+	};
+
+	/**
+	 * Runs pipeline steps in order, one or more per queue time slice.
+	 * Each step runs as a tool task ticked within the slice budget, so a batch step is split across slices too.
+	 * Outputs of successful steps are kept by step id for ${step_id.path} references.
+	 */
+	class FRunPipelineTask : public IMCPToolTask
+	{
+	public:
+		FRunPipelineTask(const FMCPToolRegistry& InToolRegistry, TArray<FPipelineStep>&& InSteps, bool bInStopOnError)
+			: ToolRegistry(InToolRegistry)
+			, Steps(MoveTemp(InSteps))
+			, bStopOnError(bInStopOnError)
+		{
+		}
+
+		virtual bool Tick(double EndTimeSeconds) override
+		{
+			if (Result.IsValid())
+			{
+				return true;
+			}
+
+			while (NextIndex < Steps.Num() && !bStopped)
+			{
+				const FPipelineStep& Step = Steps[NextIndex];
+				if (!StepTask.IsValid())
+				{
+					StepTask = StartStep(Step);
+				}
+				if (!StepTask->Tick(EndTimeSeconds))
+				{
+					return false;
+				}
+
+				FinishStep(Step, StepTask->GetResult());
+				StepTask.Reset();
+				NextIndex++;
+				if (FPlatformTime::Seconds() >= EndTimeSeconds)
+				{
+					break;
+				}
+			}
+
+			if (NextIndex < Steps.Num() && !bStopped)
+			{
+				return false;
+			}
+
+			for (; NextIndex < Steps.Num(); NextIndex++)
+			{
+				TSharedPtr<FJsonObject> StepObj = MakeShared<FJsonObject>();
+				StepObj->SetStringField(TEXT("id"), Steps[NextIndex].Id);
+				StepObj->SetStringField(TEXT("tool"), Steps[NextIndex].ToolName);
+				StepObj->SetStringField(TEXT("status"), TEXT("skipped"));
+				StepResults.Add(MakeShared<FJsonValueObject>(StepObj));
+				Skipped++;
+			}
+
+			BuildResult();
+			return true;
+		}
+
+		virtual int32 GetProgress() const override
+		{
+			return NextIndex;
+		}
+
+		virtual int32 GetTotal() const override
+		{
+			return Steps.Num();
+		}
+
+		virtual TSharedPtr<FJsonObject> GetResult() const override
+		{
+			return Result;
+		}
+
+	private:
+		/** Task of the step: the tool's own task, or a finished one for tools without tasks and unresolved references */
+		TSharedPtr<IMCPToolTask> StartStep(const FPipelineStep& Step) const
+		{
+			FString Error;
+			TSharedPtr<FJsonValue> ResolvedArguments = ResolveReferences(MakeShared<FJsonValueObject>(Step.Arguments), Error);
+			if (!ResolvedArguments.IsValid())
+			{
+				return FMCPBatchToolTask::MakeFinished(MCPToolResultUtils::MakeErrorResult(Error));
+			}
+
+			if (TSharedPtr<IMCPToolTask> Task = ToolRegistry.StartToolTask(Step.ToolName, ResolvedArguments->AsObject()))
+			{
+				return Task;
+			}
+
+			TSharedPtr<FJsonObject> CallResult = ToolRegistry.CallTool(Step.ToolName, ResolvedArguments->AsObject());
+			return FMCPBatchToolTask::MakeFinished(CallResult.IsValid()
+				? CallResult
+				: MCPToolResultUtils::MakeErrorResult(FString::Printf(TEXT("Tool not found: %s"), *Step.ToolName)));
+		}
+
+		void FinishStep(const FPipelineStep& Step, const TSharedPtr<FJsonObject>& CallResult)
+		{
+			TSharedPtr<FJsonObject> StepObj = MakeShared<FJsonObject>();
+			StepObj->SetStringField(TEXT("id"), Step.Id);
+			StepObj->SetStringField(TEXT("tool"), Step.ToolName);
+
+			FString Error;
+			bool bIsError = true;
+			FString Text;
+			if (CallResult.IsValid())
+			{
+				CallResult->TryGetBoolField(TEXT("isError"), bIsError);
+				Text = GetResultText(CallResult);
+				if (bIsError)
+				{
+					Error = Text;
+				}
+			}
+
+			if (!bIsError)
+			{
+				TSharedPtr<FJsonValue> Output = ExtractOutput(CallResult, Text);
+				Outputs.Add(Step.Id, Output);
+				StepObj->SetStringField(TEXT("status"), TEXT("succeeded"));
+				StepObj->SetField(TEXT("output"), Output);
+				Succeeded++;
+			}
+			else
+			{
+				StepObj->SetStringField(TEXT("status"), TEXT("failed"));
+				StepObj->SetStringField(TEXT("error"), Error);
+				Failed++;
+				bStopped = bStopOnError;
+			}
+
+			StepResults.Add(MakeShared<FJsonValueObject>(StepObj));
+		}
+
+		/** Concatenated text of all text content items */
+		static FString GetResultText(const TSharedPtr<FJsonObject>& CallResult)
+		{
+			FString Text;
+			const TArray<TSharedPtr<FJsonValue>>* ContentArray = nullptr;
+			if (CallResult->TryGetArrayField(TEXT("content"), ContentArray) && ContentArray)
+			{
+				for (const TSharedPtr<FJsonValue>& ContentValue : *ContentArray)
+				{
+					const TSharedPtr<FJsonObject>* ContentObj = nullptr;
+					FString ContentText;
+					if (ContentValue->TryGetObject(ContentObj) && ContentObj && (*ContentObj)->TryGetStringField(TEXT("text"), ContentText))
+					{
+						if (!Text.IsEmpty())
+						{
+							Text += TEXT("\n");
+						}
+						Text += ContentText;
+					}
+				}
+			}
+			return Text;
+		}
+
+		/**
+		 * Output of a step for references: structuredContent when the tool provides it,
+		 * otherwise the JSON embedded in the text (e.g. the node object after "Node added..."),
+		 * otherwise the text itself.
+		 */
+		static TSharedPtr<FJsonValue> ExtractOutput(const TSharedPtr<FJsonObject>& CallResult, const FString& Text)
+		{
+			const TSharedPtr<FJsonObject>* Structured = nullptr;
+			if (CallResult->TryGetObjectField(TEXT("structuredContent"), Structured) && Structured && (*Structured).IsValid())
+			{
+				return MakeShared<FJsonValueObject>(*Structured);
+			}
+
+			int32 JsonStart = INDEX_NONE;
+			for (int32 CharIndex = 0; CharIndex < Text.Len(); CharIndex++)
+			{
+				if (Text[CharIndex] == TEXT('{') || Text[CharIndex] == TEXT('['))
+				{
+					JsonStart = CharIndex;
+					break;
+				}
+			}
+
+			if (JsonStart != INDEX_NONE)
+			{
+				TSharedPtr<FJsonValue> Parsed;
+				TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text.Mid(JsonStart));
+				if (FJsonSerializer::Deserialize(Reader, Parsed) && Parsed.IsValid())
+				{
+					return Parsed;
+				}
+			}
+
+			return MakeShared<FJsonValueString>(Text);
+		}
+
+		/** Replace ${step_id.path} references in strings, recursing into arrays and objects */
+		TSharedPtr<FJsonValue> ResolveReferences(const TSharedPtr<FJsonValue>& Value, FString& OutError) const
+		{
+			if (Value->Type == EJson::String)
+			{
+				const FString Source = Value->AsString();
+
+				// A string that is exactly one reference takes the referenced value with its JSON type
+				if (Source.StartsWith(TEXT("${")) && Source.EndsWith(TEXT("}")) && Source.Find(TEXT("}")) == Source.Len() - 1)
+				{
+					return ResolveReference(Source.Mid(2, Source.Len() - 3), OutError);
+				}
+
+				FString Resolved;
+				int32 SearchFrom = 0;
+				while (true)
+				{
+					const int32 RefStart = Source.Find(TEXT("${"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchFrom);
+					const int32 RefEnd = RefStart == INDEX_NONE ? INDEX_NONE : Source.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, RefStart);
+					if (RefEnd == INDEX_NONE)
+					{
+						Resolved += Source.Mid(SearchFrom);
+						break;
+					}
+
+					TSharedPtr<FJsonValue> Referenced = ResolveReference(Source.Mid(RefStart + 2, RefEnd - RefStart - 2), OutError);
+					if (!Referenced.IsValid())
+					{
+						return nullptr;
+					}
+					Resolved += Source.Mid(SearchFrom, RefStart - SearchFrom);
+					Resolved += ValueToString(Referenced);
+					SearchFrom = RefEnd + 1;
+				}
+				return MakeShared<FJsonValueString>(Resolved);
+			}
+
+			if (Value->Type == EJson::Array)
+			{
+				TArray<TSharedPtr<FJsonValue>> ResolvedItems;
+				for (const TSharedPtr<FJsonValue>& Item : Value->AsArray())
+				{
+					TSharedPtr<FJsonValue> ResolvedItem = ResolveReferences(Item, OutError);
+					if (!ResolvedItem.IsValid())
+					{
+						return nullptr;
+					}
+					ResolvedItems.Add(ResolvedItem);
+				}
+				return MakeShared<FJsonValueArray>(ResolvedItems);
+			}
+
+			if (Value->Type == EJson::Object)
+			{
+				TSharedPtr<FJsonObject> ResolvedObj = MakeShared<FJsonObject>();
+				for (const auto& Pair : Value->AsObject()->Values)
+				{
+					TSharedPtr<FJsonValue> ResolvedField = ResolveReferences(Pair.Value, OutError);
+					if (!ResolvedField.IsValid())
+					{
+						return nullptr;
+					}
+					ResolvedObj->SetField(Pair.Key, ResolvedField);
+				}
+				return MakeShared<FJsonValueObject>(ResolvedObj);
+			}
+
+			return Value;
+		}
+
+		/**
+		 * Resolve "step_id.seg.seg" against the outputs of earlier steps.
+		 * Object segments are field names; array segments are an index or key=value,
+		 * which selects the first element whose field equals the value.
+		 */
+		TSharedPtr<FJsonValue> ResolveReference(const FString& Reference, FString& OutError) const
+		{
+			TArray<FString> Segments;
+			Reference.ParseIntoArray(Segments, TEXT("."));
+			if (Segments.Num() == 0)
+			{
+				OutError = TEXT("Empty reference ${}");
+				return nullptr;
+			}
+
+			const TSharedPtr<FJsonValue>* StepOutput = Outputs.Find(Segments[0]);
+			if (!StepOutput)
+			{
+				OutError = FString::Printf(TEXT("Unresolved reference ${%s}: no earlier successful step '%s'"), *Reference, *Segments[0]);
+				return nullptr;
+			}
+
+			TSharedPtr<FJsonValue> Current = *StepOutput;
+			for (int32 SegmentIndex = 1; SegmentIndex < Segments.Num(); SegmentIndex++)
+			{
+				const FString& Segment = Segments[SegmentIndex];
+				TSharedPtr<FJsonValue> Next;
+
+				if (Current->Type == EJson::Object)
+				{
+					Next = Current->AsObject()->TryGetField(Segment);
+				}
+				else if (Current->Type == EJson::Array)
+				{
+					const TArray<TSharedPtr<FJsonValue>>& Items = Current->AsArray();
+					FString Key, Expected;
+					if (Segment.Split(TEXT("="), &Key, &Expected))
+					{
+						for (const TSharedPtr<FJsonValue>& Item : Items)
+						{
+							FString FieldValue;
+							if (Item->Type == EJson::Object && Item->AsObject()->TryGetStringField(Key, FieldValue) && FieldValue == Expected)
+							{
+								Next = Item;
+								break;
+							}
+						}
+					}
+					else if (Segment.IsNumeric())
+					{
+						const int32 ItemIndex = FCString::Atoi(*Segment);
+						if (Items.IsValidIndex(ItemIndex))
+						{
+							Next = Items[ItemIndex];
+						}
+					}
+				}
+
+				if (!Next.IsValid())
+				{
+					OutError = FString::Printf(TEXT("Unresolved reference ${%s}: nothing at '%s'"), *Reference, *Segment);
+					return nullptr;
+				}
+				Current = Next;
+			}
+
+			return Current;
+		}
+
+		static FString ValueToString(const TSharedPtr<FJsonValue>& Value)
+		{
+			switch (Value->Type)
+			{
+			case EJson::String:
+				return Value->AsString();
+			case EJson::Number:
+			{
+				const double Number = Value->AsNumber();
+				return Number == FMath::RoundToDouble(Number)
+					? FString::Printf(TEXT("%lld"), static_cast<int64>(Number))
+					: FString::SanitizeFloat(Number);
+			}
+			case EJson::Boolean:
+				return Value->AsBool() ? TEXT("true") : TEXT("false");
+			case EJson::Null:
+				return TEXT("null");
+			default:
+			{
+				FString JsonString;
+				TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+					TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+				FJsonSerializer::Serialize(Value, FString(), Writer);
+				return JsonString;
+			}
+			}
+		}
+
+		void BuildResult()
+		{
+			TSharedPtr<FJsonObject> Structured = MakeShared<FJsonObject>();
+			Structured->SetNumberField(TEXT("succeeded"), Succeeded);
+			Structured->SetNumberField(TEXT("failed"), Failed);
+			Structured->SetNumberField(TEXT("skipped"), Skipped);
+			Structured->SetArrayField(TEXT("steps"), StepResults);
+
+			Result = MCPToolResultUtils::MakeStructuredResult(Structured, Failed > 0);
+		}
+
+		const FMCPToolRegistry& ToolRegistry;
+		TArray<FPipelineStep> Steps;
+		bool bStopOnError = true;
+		bool bStopped = false;
+
+		/** Task of the step at NextIndex while it spans slices */
+		TSharedPtr<IMCPToolTask> StepTask;
+		int32 NextIndex = 0;
+		int32 Succeeded = 0;
+		int32 Failed = 0;
+		int32 Skipped = 0;
+		TMap<FString, TSharedPtr<FJsonValue>> Outputs;
+		TArray<TSharedPtr<FJsonValue>> StepResults;
+		TSharedPtr<FJsonObject> Result;
+	};
+}
+
+FRunPipelineImplTool::FRunPipelineImplTool(FMCPToolRegistry& InToolRegistry)
+	: ToolRegistry(InToolRegistry)
+{
+}
+
+FString FRunPipelineImplTool::GetName() const
+{
+	return TEXT("run_pipeline");
+}
+
+FString FRunPipelineImplTool::GetDescription() const
+{
+	return TEXT("Run an ordered list of tool calls in one request. Step arguments can reference outputs of earlier steps with ${step_id.path}, e.g. ${node.node_id}.");
+}
+
+TSharedPtr<FJsonObject> FRunPipelineImplTool::GetInputSchema() const
+{
+	TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+
+	TSharedPtr<FJsonObject> StepsProp = MakeShared<FJsonObject>();
+	StepsProp->SetStringField(TEXT("type"), TEXT("array"));
+	StepsProp->SetStringField(TEXT("description"), TEXT("Steps to run in order. Each has tool, optional id and optional arguments. String arguments may contain ${step_id.path} references to earlier step outputs; path segments are field names, array indices or key=value selectors (e.g. ${node.pins.pin_name=then.pin_id})."));
+
+	TSharedPtr<FJsonObject> ItemSchema = MakeShared<FJsonObject>();
+	ItemSchema->SetStringField(TEXT("type"), TEXT("object"));
+	TSharedPtr<FJsonObject> ItemProps = MakeShared<FJsonObject>();
+
+	TSharedPtr<FJsonObject> IdProp = MakeShared<FJsonObject>();
+	IdProp->SetStringField(TEXT("type"), TEXT("string"));
+	IdProp->SetStringField(TEXT("description"), TEXT("Step id used in references. Defaults to the step index."));
+	ItemProps->SetObjectField(TEXT("id"), IdProp);
+
+	TSharedPtr<FJsonObject> ToolProp = MakeShared<FJsonObject>();
+	ToolProp->SetStringField(TEXT("type"), TEXT("string"));
+	ToolProp->SetStringField(TEXT("description"), TEXT("Name of the tool to call"));
+	ItemProps->SetObjectField(TEXT("tool"), ToolProp);
+
+	TSharedPtr<FJsonObject> ArgumentsProp = MakeShared<FJsonObject>();
+	ArgumentsProp->SetStringField(TEXT("type"), TEXT("object"));
+	ArgumentsProp->SetStringField(TEXT("description"), TEXT("Arguments passed to the tool"));
+	ItemProps->SetObjectField(TEXT("arguments"), ArgumentsProp);
+
+	ItemSchema->SetObjectField(TEXT("properties"), ItemProps);
+	StepsProp->SetObjectField(TEXT("items"), ItemSchema);
+	Properties->SetObjectField(TEXT("steps"), StepsProp);
+
+	TSharedPtr<FJsonObject> StopOnErrorProp = MakeShared<FJsonObject>();
+	StopOnErrorProp->SetStringField(TEXT("type"), TEXT("boolean"));
+	StopOnErrorProp->SetStringField(TEXT("description"), TEXT("Skip the remaining steps after the first failure (default true)"));
+	Properties->SetObjectField(TEXT("stop_on_error"), StopOnErrorProp);
+
+	Schema->SetObjectField(TEXT("properties"), Properties);
+
+	TArray<TSharedPtr<FJsonValue>> Required;
+	Required.Add(MakeShared<FJsonValueString>(TEXT("steps")));
+	Schema->SetArrayField(TEXT("required"), Required);
+
+	return Schema;
+}
+
+TSharedPtr<FJsonObject> FRunPipelineImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	return FMCPBatchToolTask::RunToCompletion(StartTask(Arguments));
+}
+
+TSharedPtr<IMCPToolTask> FRunPipelineImplTool::StartTask(const TSharedPtr<FJsonObject>& Arguments)
+{
+	using namespace RunPipelineToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	const TArray<TSharedPtr<FJsonValue>>* StepsArray = nullptr;
+	if (!Arguments.IsValid() || !Arguments->TryGetArrayField(TEXT("steps"), StepsArray) || !StepsArray)
+	{
+		return FMCPBatchToolTask::MakeFinished(MakeErrorResult(TEXT("Missing required parameter: steps (array)")));
+	}
+
+	bool bStopOnError = true;
+	Arguments->TryGetBoolField(TEXT("stop_on_error"), bStopOnError);
+
+	// Validate every step up front so a malformed pipeline does not run half-way
+	TArray<FPipelineStep> Steps;
+	TSet<FString> StepIds;
+	for (int32 StepIndex = 0; StepIndex < StepsArray->Num(); StepIndex++)
+	{
+		const TSharedPtr<FJsonObject>* StepObj = nullptr;
+		if (!(*StepsArray)[StepIndex]->TryGetObject(StepObj) || !StepObj || !(*StepObj).IsValid())
+		{
+			return FMCPBatchToolTask::MakeFinished(MakeErrorResult(FString::Printf(TEXT("Invalid step [%d]: expected an object"), StepIndex)));
+		}
+
+		FPipelineStep Step;
+		if (!(*StepObj)->TryGetStringField(TEXT("tool"), Step.ToolName))
+		{
+			return FMCPBatchToolTask::MakeFinished(MakeErrorResult(FString::Printf(TEXT("Invalid step [%d]: missing tool"), StepIndex)));
+		}
+		if (Step.ToolName == GetName())
+		{
+			return FMCPBatchToolTask::MakeFinished(MakeErrorResult(FString::Printf(TEXT("Invalid step [%d]: run_pipeline cannot be nested"), StepIndex)));
+		}
+		if (!ToolRegistry.HasTool(Step.ToolName))
+		{
+			return FMCPBatchToolTask::MakeFinished(MakeErrorResult(FString::Printf(TEXT("Invalid step [%d]: tool not found: %s"), StepIndex, *Step.ToolName)));
+		}
+		// Build tools have their own lane and queue limits, which a pipeline in the bulk lane would bypass
+		if (ToolRegistry.GetToolPriority(Step.ToolName) == EMCPToolPriority::Build)
+		{
+			return FMCPBatchToolTask::MakeFinished(MakeErrorResult(FString::Printf(TEXT("Invalid step [%d]: build tool %s cannot run in a pipeline, call it on its own"), StepIndex, *Step.ToolName)));
+		}
+
+		if (!(*StepObj)->TryGetStringField(TEXT("id"), Step.Id))
+		{
+			Step.Id = FString::FromInt(StepIndex);
+		}
+		if (Step.Id.IsEmpty() || Step.Id.Contains(TEXT(".")) || Step.Id.Contains(TEXT("}")))
+		{
+			return FMCPBatchToolTask::MakeFinished(MakeErrorResult(FString::Printf(TEXT("Invalid step [%d]: id must be non-empty and must not contain '.' or '}'"), StepIndex)));
+		}
+		if (StepIds.Contains(Step.Id))
+		{
+			return FMCPBatchToolTask::MakeFinished(MakeErrorResult(FString::Printf(TEXT("Invalid step [%d]: duplicate id '%s'"), StepIndex, *Step.Id)));
+		}
+		StepIds.Add(Step.Id);
+
+		const TSharedPtr<FJsonObject>* StepArguments = nullptr;
+		Step.Arguments = (*StepObj)->TryGetObjectField(TEXT("arguments"), StepArguments) && StepArguments
+			? *StepArguments
+			: MakeShared<FJsonObject>();
+
+		Steps.Add(MoveTemp(Step));
+	}
+
+	return MakeShared<FRunPipelineTask>(ToolRegistry, MoveTemp(Steps), bStopOnError);
+}
+
+EMCPToolPriority FRunPipelineImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
+}
@@ -0,0 +1,26 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "Tools/Interfaces/IMCPTool.h"
+
+class FMCPToolRegistry;
+
+/**
+ * Runs an ordered list of tool calls in one request.
+ * Step arguments may reference the output of earlier steps with ${step_id.path}.
+ */
+class FRunPipelineImplTool : public IMCPTool
+{
+public:
+	explicit FRunPipelineImplTool(FMCPToolRegistry& InToolRegistry);
+
+	virtual FString GetName() const override;
+	virtual FString GetDescription() const override;
+	virtual TSharedPtr<FJsonObject> GetInputSchema() const override;
+	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) override;
+	virtual TSharedPtr<IMCPToolTask> StartTask(const TSharedPtr<FJsonObject>& Arguments) override;
+	virtual EMCPToolPriority GetPriority() const override;
+
+private:
+	FMCPToolRegistry& ToolRegistry;
+};
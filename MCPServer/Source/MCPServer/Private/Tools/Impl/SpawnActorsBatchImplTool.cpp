@@ -0,0 +1,183 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/Impl/SpawnActorsBatchImplTool.h"
+#include "Tools/MCPToolResultUtils.h"
+#include "Modules/Interfaces/IActorModule.h"
+#include "Tools/MCPBatchToolTask.h"
+#include "Dom/JsonValue.h"
+
+namespace SpawnActorsBatchToolPrivate
+{
+	constexpr int32 MaxItems = 100000;
+
+	/** Parse [x, y, z], [x, y, z, pitch, yaw, roll] or [x, y, z, pitch, yaw, roll, sx, sy, sz] */
+	bool ParseTransform(const TSharedPtr<FJsonValue>& Value, FTransform& OutTransform)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Numbers;
+		if (!Value.IsValid() || !Value->TryGetArray(Numbers) || (Numbers->Num() != 3 && Numbers->Num() != 6 && Numbers->Num() != 9))
+		{
+			return false;
+		}
+
+		double Components[9] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0 };
+		for (int32 Index = 0; Index < Numbers->Num(); ++Index)
+		{
+			if (!(*Numbers)[Index]->TryGetNumber(Components[Index]))
+			{
+				return false;
+			}
+		}
+
+		OutTransform = FTransform(
+			FRotator(Components[3], Components[4], Components[5]),
+			FVector(Components[0], Components[1], Components[2]),
+			FVector(Components[6], Components[7], Components[8]));
+		return true;
+	}
+}
+
+FSpawnActorsBatchImplTool::FSpawnActorsBatchImplTool(IActorModule& InActorModule)
+	: ActorModule(InActorModule)
+{
+}
+
+FString FSpawnActorsBatchImplTool::GetName() const
+{
+	return TEXT("spawn_actors_batch");
+}
+
+FString FSpawnActorsBatchImplTool::GetDescription() const
+{
+	return TEXT("Spawn many actors in one call and one undo transaction. Classes are listed once and referenced by index; transforms are compact number arrays. Failed items are reported without stopping the batch.");
+}
+
+TSharedPtr<FJsonObject> FSpawnActorsBatchImplTool::GetInputSchema() const
+{
+	using namespace SpawnActorsBatchToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+	Schema->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+
+	Properties->SetObjectField(TEXT("classes"), MakeArrayProp(TEXT("string"),
+		TEXT("Class paths used by this batch, e.g. [\"/Script/Engine.StaticMeshActor\", \"/Script/Engine.PointLight\"]")));
+
+	TSharedPtr<FJsonObject> TransformsProp = MakeShared<FJsonObject>();
+	TransformsProp->SetStringField(TEXT("type"), TEXT("array"));
+	TransformsProp->SetStringField(TEXT("description"),
+		FString::Printf(TEXT("One entry per actor (max %d): [x, y, z], [x, y, z, pitch, yaw, roll] or [x, y, z, pitch, yaw, roll, sx, sy, sz]"), MaxItems));
+	TransformsProp->SetObjectField(TEXT("items"), MakeArrayProp(TEXT("number"), TEXT("Location, optional rotation in degrees, optional scale")));
+	Properties->SetObjectField(TEXT("transforms"), TransformsProp);
+
+	Properties->SetObjectField(TEXT("class_indices"), MakeArrayProp(TEXT("integer"),
+		TEXT("Optional index into classes for each transform. Defaults to 0 for every actor.")));
+
+	TSharedPtr<FJsonObject> LabelPrefixProp = MakeShared<FJsonObject>();
+	LabelPrefixProp->SetStringField(TEXT("type"), TEXT("string"));
+	LabelPrefixProp->SetStringField(TEXT("description"), TEXT("Optional label prefix; actors are labelled <prefix>_<index>"));
+	Properties->SetObjectField(TEXT("label_prefix"), LabelPrefixProp);
+
+	TSharedPtr<FJsonObject> FolderProp = MakeShared<FJsonObject>();
+	FolderProp->SetStringField(TEXT("type"), TEXT("string"));
+	FolderProp->SetStringField(TEXT("description"), TEXT("Optional World Outliner folder for every spawned actor"));
+	Properties->SetObjectField(TEXT("folder"), FolderProp);
+
+	Schema->SetObjectField(TEXT("properties"), Properties);
+
+	TArray<TSharedPtr<FJsonValue>> Required;
+	Required.Add(MakeShared<FJsonValueString>(TEXT("classes")));
+	Required.Add(MakeShared<FJsonValueString>(TEXT("transforms")));
+	Schema->SetArrayField(TEXT("required"), Required);
+
+	return Schema;
+}
+
+TSharedPtr<FJsonObject> FSpawnActorsBatchImplTool::Execute(const TSharedPtr<FJsonObject>& Arguments)
+{
+	using namespace SpawnActorsBatchToolPrivate;
+	using namespace MCPToolResultUtils;
+
+	const TArray<TSharedPtr<FJsonValue>>* ClassesArray = nullptr;
+	if (!Arguments.IsValid() || !Arguments->TryGetArrayField(TEXT("classes"), ClassesArray) || ClassesArray->Num() == 0)
+	{
+		return MakeErrorResult(TEXT("Missing required parameter: classes (non-empty array)"));
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* TransformsArray = nullptr;
+	if (!Arguments->TryGetArrayField(TEXT("transforms"), TransformsArray))
+	{
+		return MakeErrorResult(TEXT("Missing required parameter: transforms (array)"));
+	}
+	if (TransformsArray->Num() > MaxItems)
+	{
+		return MakeErrorResult(FString::Printf(TEXT("Too many transforms: %d (max %d)"), TransformsArray->Num(), MaxItems));
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* ClassIndicesArray = nullptr;
+	if (Arguments->TryGetArrayField(TEXT("class_indices"), ClassIndicesArray) && ClassIndicesArray->Num() != TransformsArray->Num())
+	{
+		return MakeErrorResult(FString::Printf(TEXT("class_indices has %d entries but transforms has %d"), ClassIndicesArray->Num(), TransformsArray->Num()));
+	}
+
+	FActorSpawnBatchRequest Request;
+	Request.ClassPaths.Reserve(ClassesArray->Num());
+	for (const TSharedPtr<FJsonValue>& ClassValue : *ClassesArray)
+	{
+		Request.ClassPaths.Add(ClassValue->AsString());
+	}
+
+	Request.Items.SetNum(TransformsArray->Num());
+	for (int32 Index = 0; Index < TransformsArray->Num(); ++Index)
+	{
+		FActorSpawnBatchItem& Item = Request.Items[Index];
+		if (!ParseTransform((*TransformsArray)[Index], Item.Transform))
+		{
+			return MakeErrorResult(FString::Printf(TEXT("Invalid transform at index %d: expected 3, 6 or 9 numbers"), Index));
+		}
+		if (ClassIndicesArray && !(*ClassIndicesArray)[Index]->TryGetNumber(Item.ClassIndex))
+		{
+			return MakeErrorResult(FString::Printf(TEXT("Invalid class index at index %d"), Index));
+		}
+	}
+
+	Arguments->TryGetStringField(TEXT("label_prefix"), Request.LabelPrefix);
+	Arguments->TryGetStringField(TEXT("folder"), Request.FolderPath);
+
+	FActorSpawnBatchResult BatchResult = ActorModule.SpawnActorsBatch(Request);
+	if (!BatchResult.bSuccess)
+	{
+		return MakeErrorResult(FString::Printf(TEXT("Failed to spawn actors: %s"), *BatchResult.ErrorMessage));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> NamesArray;
+	NamesArray.Reserve(BatchResult.ActorNames.Num());
+	for (const FString& ActorName : BatchResult.ActorNames)
+	{
+		NamesArray.Add(MakeShared<FJsonValueString>(ActorName));
+	}
+
+	// Errors beyond the cap are counted in "failed" but not listed, as in the other batch tools
+	TArray<TSharedPtr<FJsonValue>> ErrorsArray;
+	for (int32 ErrorIndex = 0; ErrorIndex < BatchResult.Errors.Num() && ErrorIndex < FMCPBatchToolTask::MaxListedErrors; ++ErrorIndex)
+	{
+		TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+		ErrorObj->SetNumberField(TEXT("index"), BatchResult.Errors[ErrorIndex].Index);
+		ErrorObj->SetStringField(TEXT("error"), BatchResult.Errors[ErrorIndex].ErrorMessage);
+		ErrorsArray.Add(MakeShared<FJsonValueObject>(ErrorObj));
+	}
+
+	TSharedPtr<FJsonObject> Structured = MakeShared<FJsonObject>();
+	Structured->SetNumberField(TEXT("spawned"), BatchResult.SpawnedCount);
+	Structured->SetNumberField(TEXT("failed"), BatchResult.Errors.Num());
+	Structured->SetArrayField(TEXT("actors"), NamesArray);
+	Structured->SetArrayField(TEXT("errors"), ErrorsArray);
+
+	return MakeStructuredResult(Structured, BatchResult.SpawnedCount == 0 && BatchResult.Errors.Num() > 0);
+}
+
+EMCPToolPriority FSpawnActorsBatchImplTool::GetPriority() const
+{
+	return EMCPToolPriority::Bulk;
+}
@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/MCPBatchToolTask.h"
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+
+FMCPBatchToolTask::FMCPBatchToolTask(
+	const FString& InSummaryLabel,
+	const TArray<TSharedPtr<FJsonValue>>& InOperations,
+	FRunOperation InRunOperation,
+	TFunction<void()> InOnSliceBegin,
+	TFunction<void()> InOnSliceEnd)
+	: SummaryLabel(InSummaryLabel)
+	, Operations(InOperations)
+	, RunOperation(MoveTemp(InRunOperation))
+	, OnSliceBegin(MoveTemp(InOnSliceBegin))
+	, OnSliceEnd(MoveTemp(InOnSliceEnd))
+{
+}
+
+TSharedPtr<IMCPToolTask> FMCPBatchToolTask::MakeFinished(const TSharedPtr<FJsonObject>& Result)
+{
+	TSharedPtr<FMCPBatchToolTask> Task = MakeShared<FMCPBatchToolTask>(FString(), TArray<TSharedPtr<FJsonValue>>(), nullptr);
+	Task->Result = Result;
+	return Task;
+}
+
+TSharedPtr<FJsonObject> FMCPBatchToolTask::RunToCompletion(const TSharedPtr<IMCPToolTask>& Task)
+{
+	if (!Task.IsValid())
+	{
+		return nullptr;
+	}
+
+	while (!Task->Tick(TNumericLimits<double>::Max()))
+	{
+	}
+	return Task->GetResult();
+}
+
+bool FMCPBatchToolTask::Tick(double EndTimeSeconds)
+{
+	if (Result.IsValid())
+	{
+		return true;
+	}
+
+	if (Operations.Num() == 0)
+	{
+		BuildResult();
+		return true;
+	}
+
+	// Closed again before returning, so tool calls and editor edits between ticks stay out of the batch
+	if (OnSliceBegin)
+	{
+		OnSliceBegin();
+	}
+
+	do
+	{
+		const int32 Index = NextIndex++;
+		FString Error;
+		const TSharedPtr<FJsonValue>& Operation = Operations[Index];
+		if (Operation.IsValid() && RunOperation(Operation, Error))
+		{
+			Succeeded++;
+		}
+		else
+		{
+			Failed++;
+			if (Errors.Num() < MaxListedErrors)
+			{
+				Errors.Add(FString::Printf(TEXT("[%d] %s"), Index, Error.IsEmpty() ? TEXT("Invalid operation object") : *Error));
+			}
+		}
+	}
+	while (NextIndex < Operations.Num() && FPlatformTime::Seconds() < EndTimeSeconds);
+
+	if (OnSliceEnd)
+	{
+		OnSliceEnd();
+	}
+
+	if (NextIndex < Operations.Num())
+	{
+		return false;
+	}
+
+	BuildResult();
+	return true;
+}
+
+int32 FMCPBatchToolTask::GetProgress() const
+{
+	return NextIndex;
+}
+
+int32 FMCPBatchToolTask::GetTotal() const
+{
+	return Operations.Num();
+}
+
+TSharedPtr<FJsonObject> FMCPBatchToolTask::GetResult() const
+{
+	return Result;
+}
+
+void FMCPBatchToolTask::BuildResult()
+{
+	FString ResponseText = FString::Printf(TEXT("%s: %d succeeded, %d failed"), *SummaryLabel, Succeeded, Failed);
+	if (Errors.Num() > 0)
+	{
+		ResponseText += TEXT("\n\nErrors:");
+		for (const FString& Error : Errors)
+		{
+			ResponseText += FString::Printf(TEXT("\n- %s"), *Error);
+		}
+		if (Failed > Errors.Num())
+		{
+			ResponseText += FString::Printf(TEXT("\n- ... and %d more"), Failed - Errors.Num());
+		}
+	}
+
+	TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
+	TextContent->SetStringField(TEXT("type"), TEXT("text"));
+	TextContent->SetStringField(TEXT("text"), ResponseText);
+
+	TArray<TSharedPtr<FJsonValue>> ContentArray;
+	ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+
+	Result = MakeShared<FJsonObject>();
+	Result->SetArrayField(TEXT("content"), ContentArray);
+	Result->SetBoolField(TEXT("isError"), Succeeded == 0 && Failed > 0);
+}
@@ -0,0 +1,224 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/MCPToolCallQueue.h"
+#include "Tools/MCPToolRegistry.h"
+#include "Tools/Interfaces/IMCPToolTask.h"
+#include "Core/MCPMetrics.h"
+#include "Core/MCPTrace.h"
+#include "HAL/PlatformTime.h"
+
+FMCPToolCallQueue::FMCPToolCallQueue(FMCPToolRegistry& InToolRegistry, FMCPMetrics* InMetrics, double InTimeSliceSeconds)
+	: ToolRegistry(InToolRegistry)
+	, Metrics(InMetrics)
+	, TimeSliceSeconds(InTimeSliceSeconds)
+{
+}
+
+FMCPToolCallQueue::~FMCPToolCallQueue()
+{
+	Stop();
+}
+
+void FMCPToolCallQueue::Start()
+{
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FMCPToolCallQueue::Tick), 0.0f);
+	}
+}
+
+void FMCPToolCallQueue::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	for (TDeque<FQueuedToolCall>& Lane : PendingCalls)
+	{
+		Lane.Empty();
+	}
+	ActiveTasks.Empty();
+	BulkLaneHolders = 0;
+	for (auto& Pair : ToolStats)
+	{
+		Pair.Value.QueueDepth = 0;
+	}
+}
+
+void FMCPToolCallQueue::Enqueue(
+	const FString& ToolName,
+	const TSharedPtr<FJsonObject>& Arguments,
+	FMCPToolCallCompletion OnComplete,
+	FMCPToolCallProgress OnProgress)
+{
+	FQueuedToolCall Call;
+	Call.ToolName = ToolName;
+	Call.Arguments = Arguments;
+	Call.OnComplete = MoveTemp(OnComplete);
+	Call.OnProgress = MoveTemp(OnProgress);
+	Call.EnqueueTime = FPlatformTime::Seconds();
+	Call.TraceSessionId = MCPTrace::GetSessionId();
+	const EMCPToolPriority Priority = ToolRegistry.GetToolPriority(ToolName);
+	Call.bHoldsBulkLane = Priority == EMCPToolPriority::Bulk && !ToolRegistry.IsReadOnlyTool(ToolName);
+	PendingCalls[static_cast<int32>(Priority)].PushLast(MoveTemp(Call));
+
+	ToolStats.FindOrAdd(ToolName).QueueDepth++;
+}
+
+int32 FMCPToolCallQueue::ProcessQueue(double TimeBudgetSeconds)
+{
+	MCP_TRACE_SCOPE("MCP::ProcessQueue");
+
+	const double SliceStart = FPlatformTime::Seconds();
+	const double SliceEnd = SliceStart + TimeBudgetSeconds;
+	int32 StartedCount = 0;
+	int32 CompletedCount = 0;
+
+	// Queued calls first, so cheap requests are not held behind long-running tasks
+	while (TDeque<FQueuedToolCall>* Lane = FindNextLane())
+	{
+		if (StartedCount > 0 && FPlatformTime::Seconds() >= SliceEnd)
+		{
+			break;
+		}
+
+		FQueuedToolCall Call = MoveTemp(Lane->First());
+		Lane->PopFirst();
+		StartedCount++;
+
+		FMCPTraceSessionScope TraceSession(Call.TraceSessionId);
+
+		const double ExecuteStart = FPlatformTime::Seconds();
+		Call.WaitSeconds = ExecuteStart - Call.EnqueueTime;
+
+		Call.Task = ToolRegistry.StartToolTask(Call.ToolName, Call.Arguments);
+		if (Call.Task.IsValid())
+		{
+			Call.ExecuteSeconds += FPlatformTime::Seconds() - ExecuteStart;
+			BulkLaneHolders += Call.bHoldsBulkLane ? 1 : 0;
+			ActiveTasks.PushLast(MoveTemp(Call));
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> ToolResult = ToolRegistry.CallTool(Call.ToolName, Call.Arguments);
+		Call.ExecuteSeconds += FPlatformTime::Seconds() - ExecuteStart;
+		CompleteCall(Call, ToolResult);
+		CompletedCount++;
+	}
+
+	// The rest of the slice is split between running tasks; each advances at least once per tick
+	const int32 TaskCount = ActiveTasks.Num();
+	for (int32 TaskIndex = 0; TaskIndex < TaskCount; ++TaskIndex)
+	{
+		FQueuedToolCall Call = MoveTemp(ActiveTasks.First());
+		ActiveTasks.PopFirst();
+
+		FMCPTraceSessionScope TraceSession(Call.TraceSessionId);
+		MCP_TRACE_SCOPE("MCP::TickTask");
+		MCP_TRACE_SCOPE_TEXT(*Call.ToolName);
+
+		const double TaskStart = FPlatformTime::Seconds();
+		const double TaskEnd = TaskStart + FMath::Max(0.0, SliceEnd - TaskStart) / (TaskCount - TaskIndex);
+		const bool bFinished = Call.Task->Tick(TaskEnd);
+		Call.ExecuteSeconds += FPlatformTime::Seconds() - TaskStart;
+
+		ReportProgress(Call);
+		if (bFinished)
+		{
+			BulkLaneHolders -= Call.bHoldsBulkLane ? 1 : 0;
+			CompleteCall(Call, Call.Task->GetResult());
+			CompletedCount++;
+		}
+		else
+		{
+			ActiveTasks.PushLast(MoveTemp(Call));
+		}
+	}
+
+	return CompletedCount;
+}
+
+int32 FMCPToolCallQueue::GetQueueDepth() const
+{
+	int32 Depth = ActiveTasks.Num();
+	for (const TDeque<FQueuedToolCall>& Lane : PendingCalls)
+	{
+		Depth += Lane.Num();
+	}
+	return Depth;
+}
+
+int32 FMCPToolCallQueue::GetPendingCount(EMCPToolPriority Priority) const
+{
+	return PendingCalls[static_cast<int32>(Priority)].Num();
+}
+
+TDeque<FMCPToolCallQueue::FQueuedToolCall>* FMCPToolCallQueue::FindNextLane()
+{
+	for (int32 LaneIndex = 0; LaneIndex < static_cast<int32>(EMCPToolPriority::Num); ++LaneIndex)
+	{
+		TDeque<FQueuedToolCall>& Lane = PendingCalls[LaneIndex];
+		if (Lane.IsEmpty())
+		{
+			continue;
+		}
+
+		// Only the head is considered, so a held mutating call also keeps later bulk calls in order behind it
+		if (BulkLaneHolders > 0 && LaneIndex == static_cast<int32>(EMCPToolPriority::Bulk) && Lane.First().bHoldsBulkLane)
+		{
+			continue;
+		}
+		return &Lane;
+	}
+	return nullptr;
+}
+
+int32 FMCPToolCallQueue::GetActiveTaskCount() const
+{
+	return ActiveTasks.Num();
+}
+
+TMap<FString, FMCPToolQueueStats> FMCPToolCallQueue::GetToolStats() const
+{
+	return ToolStats;
+}
+
+void FMCPToolCallQueue::ReportProgress(FQueuedToolCall& Call)
+{
+	const int32 Progress = Call.Task->GetProgress();
+	if (Call.OnProgress && Progress != Call.ReportedProgress)
+	{
+		Call.ReportedProgress = Progress;
+		Call.OnProgress(Progress, Call.Task->GetTotal());
+	}
+}
+
+void FMCPToolCallQueue::CompleteCall(FQueuedToolCall& Call, const TSharedPtr<FJsonObject>& ToolResult)
+{
+	FMCPToolQueueStats& Stats = ToolStats.FindOrAdd(Call.ToolName);
+	Stats.QueueDepth = FMath::Max(0, Stats.QueueDepth - 1);
+	Stats.CompletedCount++;
+	Stats.TotalWaitSeconds += Call.WaitSeconds;
+	Stats.MaxWaitSeconds = FMath::Max(Stats.MaxWaitSeconds, Call.WaitSeconds);
+	Stats.TotalExecuteSeconds += Call.ExecuteSeconds;
+	Stats.MaxExecuteSeconds = FMath::Max(Stats.MaxExecuteSeconds, Call.ExecuteSeconds);
+
+	if (Metrics)
+	{
+		Metrics->RecordToolCall(Call.ToolName, Call.ExecuteSeconds, Call.WaitSeconds, FMCPMetrics::IsToolError(ToolResult));
+	}
+
+	if (Call.OnComplete)
+	{
+		Call.OnComplete(ToolResult);
+	}
+}
+
+bool FMCPToolCallQueue::Tick(float DeltaTime)
+{
+	ProcessQueue(TimeSliceSeconds);
+	return true;
+}
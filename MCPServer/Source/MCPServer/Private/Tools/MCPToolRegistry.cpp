@@ -2,20 +2,50 @@
 
 #include "Tools/MCPToolRegistry.h"
 #include "Tools/Interfaces/IMCPTool.h"
+#include "Tools/Interfaces/IMCPToolTask.h"
+#include "Core/MCPTrace.h"
 #include "Dom/JsonValue.h"
+#include "Hash/CityHash.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
 
 void FMCPToolRegistry::RegisterTool(TSharedPtr<IMCPTool> Tool)
 {
 	if (Tool.IsValid())
 	{
 		Tools.Add(Tool->GetName(), Tool);
+		bToolsListCacheValid = false;
+		ToolsListChangedDelegate.Broadcast();
 	}
 }
 
-TArray<TSharedPtr<FJsonValue>> FMCPToolRegistry::GetToolsList() const
+const TArray<TSharedPtr<FJsonValue>>& FMCPToolRegistry::GetToolsList() const
 {
-	TArray<TSharedPtr<FJsonValue>> ToolsArray;
+	BuildToolsListCache();
+	return CachedToolsList;
+}
 
+const TArray<uint8>& FMCPToolRegistry::GetToolsListJson() const
+{
+	BuildToolsListCache();
+	return CachedToolsListJson;
+}
+
+const FString& FMCPToolRegistry::GetToolsListETag() const
+{
+	BuildToolsListCache();
+	return CachedToolsListETag;
+}
+
+void FMCPToolRegistry::BuildToolsListCache() const
+{
+	if (bToolsListCacheValid)
+	{
+		return;
+	}
+
+	CachedToolsList.Reset(Tools.Num());
 	for (const auto& Pair : Tools)
 	{
 		const TSharedPtr<IMCPTool>& Tool = Pair.Value;
@@ -30,10 +60,26 @@ TArray<TSharedPtr<FJsonValue>> FMCPToolRegistry::GetToolsList() const
 			ToolObj->SetObjectField(TEXT("inputSchema"), InputSchema);
 		}
 
-		ToolsArray.Add(MakeShared<FJsonValueObject>(ToolObj));
+		if (Tool->IsReadOnly())
+		{
+			TSharedPtr<FJsonObject> Annotations = MakeShared<FJsonObject>();
+			Annotations->SetBoolField(TEXT("readOnlyHint"), true);
+			ToolObj->SetObjectField(TEXT("annotations"), Annotations);
+		}
+
+		CachedToolsList.Add(MakeShared<FJsonValueObject>(ToolObj));
 	}
 
-	return ToolsArray;
+	CachedToolsListJson.Reset();
+	FMemoryWriter JsonArchive(CachedToolsListJson);
+	TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> Writer =
+		TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&JsonArchive);
+	FJsonSerializer::Serialize(CachedToolsList, Writer);
+
+	CachedToolsListETag = FString::Printf(TEXT("\"%016llx\""),
+		CityHash64(reinterpret_cast<const char*>(CachedToolsListJson.GetData()), CachedToolsListJson.Num()));
+
+	bToolsListCacheValid = true;
 }
 
 TSharedPtr<FJsonObject> FMCPToolRegistry::CallTool(const FString& ToolName, const TSharedPtr<FJsonObject>& Arguments) const
@@ -44,10 +90,39 @@ TSharedPtr<FJsonObject> FMCPToolRegistry::CallTool(const FString& ToolName, cons
 		return nullptr;
 	}
 
+	MCP_TRACE_SCOPE("MCP::Execute");
+	MCP_TRACE_SCOPE_TEXT(*ToolName);
+	MCPTrace::TraceScopeMetadata(TEXT("MCP::Execute"), ToolName, Arguments);
 	return (*FoundTool)->Execute(Arguments);
 }
 
+TSharedPtr<IMCPToolTask> FMCPToolRegistry::StartToolTask(const FString& ToolName, const TSharedPtr<FJsonObject>& Arguments) const
+{
+	const TSharedPtr<IMCPTool>* FoundTool = Tools.Find(ToolName);
+	if (!FoundTool || !FoundTool->IsValid())
+	{
+		return nullptr;
+	}
+
+	MCP_TRACE_SCOPE("MCP::StartTask");
+	MCP_TRACE_SCOPE_TEXT(*ToolName);
+	MCPTrace::TraceScopeMetadata(TEXT("MCP::StartTask"), ToolName, Arguments);
+	return (*FoundTool)->StartTask(Arguments);
+}
+
 bool FMCPToolRegistry::HasTool(const FString& ToolName) const
 {
 	return Tools.Contains(ToolName);
 }
+
+bool FMCPToolRegistry::IsReadOnlyTool(const FString& ToolName) const
+{
+	const TSharedPtr<IMCPTool>* FoundTool = Tools.Find(ToolName);
+	return FoundTool && FoundTool->IsValid() && (*FoundTool)->IsReadOnly();
+}
+
+EMCPToolPriority FMCPToolRegistry::GetToolPriority(const FString& ToolName) const
+{
+	const TSharedPtr<IMCPTool>* FoundTool = Tools.Find(ToolName);
+	return FoundTool && FoundTool->IsValid() ? (*FoundTool)->GetPriority() : EMCPToolPriority::Interactive;
+}
@@ -0,0 +1,98 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tools/MCPToolResultUtils.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+namespace MCPToolResultUtils
+{
+	TSharedPtr<FJsonObject> MakeErrorResult(const FString& Message)
+	{
+		TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> ContentArray;
+		TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
+		TextContent->SetStringField(TEXT("type"), TEXT("text"));
+		TextContent->SetStringField(TEXT("text"), Message);
+		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+		Result->SetArrayField(TEXT("content"), ContentArray);
+		Result->SetBoolField(TEXT("isError"), true);
+		return Result;
+	}
+
+	TSharedPtr<FJsonObject> MakeStructuredResult(const TSharedPtr<FJsonObject>& Structured, bool bIsError)
+	{
+		FString JsonString;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+		FJsonSerializer::Serialize(Structured.ToSharedRef(), Writer);
+
+		TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> ContentArray;
+		TSharedPtr<FJsonObject> TextContent = MakeShared<FJsonObject>();
+		TextContent->SetStringField(TEXT("type"), TEXT("text"));
+		TextContent->SetStringField(TEXT("text"), JsonString);
+		ContentArray.Add(MakeShared<FJsonValueObject>(TextContent));
+		Result->SetArrayField(TEXT("content"), ContentArray);
+		Result->SetObjectField(TEXT("structuredContent"), Structured);
+		Result->SetBoolField(TEXT("isError"), bIsError);
+		return Result;
+	}
+
+	bool ParseVector(const TSharedPtr<FJsonObject>& VectorObj, FVector& OutVector)
+	{
+		return VectorObj->TryGetNumberField(TEXT("x"), OutVector.X)
+			&& VectorObj->TryGetNumberField(TEXT("y"), OutVector.Y)
+			&& VectorObj->TryGetNumberField(TEXT("z"), OutVector.Z);
+	}
+
+	bool ParseVectorField(const TSharedPtr<FJsonObject>& Arguments, const FString& FieldName, FVector& OutVector)
+	{
+		const TSharedPtr<FJsonObject>* VectorObj;
+		return Arguments->TryGetObjectField(FieldName, VectorObj) && ParseVector(*VectorObj, OutVector);
+	}
+
+	TSharedPtr<FJsonObject> MakeNumberProp()
+	{
+		TSharedPtr<FJsonObject> NumProp = MakeShared<FJsonObject>();
+		NumProp->SetStringField(TEXT("type"), TEXT("number"));
+		return NumProp;
+	}
+
+	TSharedPtr<FJsonObject> MakeVectorProp(const FString& Description)
+	{
+		TSharedPtr<FJsonObject> VectorProp = MakeShared<FJsonObject>();
+		VectorProp->SetStringField(TEXT("type"), TEXT("object"));
+		if (!Description.IsEmpty())
+		{
+			VectorProp->SetStringField(TEXT("description"), Description);
+		}
+		TSharedPtr<FJsonObject> VectorProperties = MakeShared<FJsonObject>();
+		VectorProperties->SetObjectField(TEXT("x"), MakeNumberProp());
+		VectorProperties->SetObjectField(TEXT("y"), MakeNumberProp());
+		VectorProperties->SetObjectField(TEXT("z"), MakeNumberProp());
+		VectorProp->SetObjectField(TEXT("properties"), VectorProperties);
+		return VectorProp;
+	}
+
+	TSharedPtr<FJsonObject> MakeDescribedProp(const FString& Type, const FString& Description)
+	{
+		TSharedPtr<FJsonObject> Prop = MakeShared<FJsonObject>();
+		Prop->SetStringField(TEXT("type"), Type);
+		Prop->SetStringField(TEXT("description"), Description);
+		return Prop;
+	}
+
+	TSharedPtr<FJsonObject> MakeArrayProp(const FString& ItemType, const FString& Description)
+	{
+		TSharedPtr<FJsonObject> ArrayProp = MakeShared<FJsonObject>();
+		ArrayProp->SetStringField(TEXT("type"), TEXT("array"));
+		ArrayProp->SetStringField(TEXT("description"), Description);
+		TSharedPtr<FJsonObject> ItemProp = MakeShared<FJsonObject>();
+		ItemProp->SetStringField(TEXT("type"), ItemType);
+		ArrayProp->SetObjectField(TEXT("items"), ItemProp);
+		return ArrayProp;
+	}
+}
@@ -0,0 +1,107 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Log-linear histogram in the style of HdrHistogram.
+ * Values below 64 are counted exactly; above that every power of two is split into 32 buckets,
+ * so percentiles are within about 2% of the recorded values. Buckets grow with the largest value seen.
+ * Not thread-safe on its own.
+ */
+class FMCPHistogram
+{
+public:
+	void Record(uint64 Value);
+
+	/** Approximate value at the given quantile (0..1), or 0 if nothing was recorded */
+	uint64 GetPercentile(double Quantile) const;
+
+	int64 GetCount() const { return Count; }
+	uint64 GetSum() const { return Sum; }
+	uint64 GetMax() const { return Max; }
+
+	/** Mean of the recorded values, or 0 if nothing was recorded */
+	double GetMean() const;
+
+private:
+	static constexpr int32 LinearBits = 6;
+	static constexpr int32 LinearCount = 1 << LinearBits;
+	static constexpr int32 SubBucketCount = LinearCount / 2;
+
+	static int32 GetBucketIndex(uint64 Value);
+
+	/** Midpoint of the values counted in a bucket */
+	static uint64 GetBucketValue(int32 Index);
+
+	TArray<int64> Buckets;
+	int64 Count = 0;
+	uint64 Sum = 0;
+	uint64 Max = 0;
+};
+
+/** Counters and distributions of one tool or JSON-RPC method */
+struct FMCPMetricSeries
+{
+	int64 Calls = 0;
+	int64 Errors = 0;
+
+	/** Tools: execution time. Methods: time from receiving the request body to having the response. */
+	FMCPHistogram LatencyMicros;
+
+	/** Time queued calls waited before they started executing */
+	FMCPHistogram QueueWaitMicros;
+
+	/** UTF-8 body sizes; only recorded where a message had an HTTP body of its own */
+	FMCPHistogram RequestBytes;
+	FMCPHistogram ResponseBytes;
+};
+
+/**
+ * Per-tool and per-method call metrics of the server.
+ * Tools are recorded where they execute: inline, on worker threads, or in the tool call queue.
+ * Methods are recorded once the response of their message is complete; messages of a batch all get the
+ * latency of the whole batch and no sizes. Thread-safe.
+ */
+class FMCPMetrics
+{
+public:
+	FMCPMetrics();
+
+	/**
+	 * Record one tool execution.
+	 * @param QueueWaitSeconds  Time spent in the tool call queue, negative for calls that were not queued.
+	 *                          Queued waits are also counted for the tools/call method.
+	 */
+	void RecordToolCall(const FString& ToolName, double ExecuteSeconds, double QueueWaitSeconds, bool bError);
+
+	/** Record the request and response sizes of a tools/call that was sent on its own */
+	void RecordToolBytes(const FString& ToolName, int64 RequestBytes, int64 ResponseBytes);
+
+	/** Record one answered JSON-RPC message. Negative sizes are not recorded. */
+	void RecordMethodCall(const FString& Method, double LatencySeconds, bool bError, int64 RequestBytes, int64 ResponseBytes);
+
+	/** Snapshots of the recorded series, keyed by tool name and method */
+	TMap<FString, FMCPMetricSeries> GetToolSeries() const;
+	TMap<FString, FMCPMetricSeries> GetMethodSeries() const;
+
+	/** Seconds since the metrics were created or last reset */
+	double GetCollectionSeconds() const;
+
+	/** Drop every recorded series */
+	void Reset();
+
+	/** All series in the Prometheus text exposition format (0.0.4) */
+	FString ExportPrometheus() const;
+
+	/** Whether a tool result (or a missing one) counts as an error */
+	static bool IsToolError(const TSharedPtr<FJsonObject>& ToolResult);
+
+private:
+	mutable FCriticalSection MetricsLock;
+	TMap<FString, FMCPMetricSeries> ToolSeries;
+	TMap<FString, FMCPMetricSeries> MethodSeries;
+	double CollectingSince = 0.0;
+};
@@ -5,9 +5,14 @@
 #include "Modules/ModuleManager.h"
 
 class FMCPToolRegistry;
+class FMCPToolCallQueue;
 class FMCPSessionManager;
+class FMCPRateLimiter;
+class FMCPMetrics;
 class FMCPJsonRpc;
 class FMCPHttpServer;
+class IAssetCacheModule;
+class IEditorBatchModule;
 class IActorModule;
 class ILevelModule;
 class IAssetModule;
@@ -54,6 +59,8 @@ private:
 	uint32 ServerPort = 8080;
 
 	// Modules layer
+	TUniquePtr<IAssetCacheModule> AssetCacheModule;
+	TUniquePtr<IEditorBatchModule> EditorBatchModule;
 	TUniquePtr<IActorModule> ActorModule;
 	TUniquePtr<ILevelModule> LevelModule;
 	TUniquePtr<IAssetModule> AssetModule;
@@ -78,9 +85,12 @@ private:
 
 	// Tools layer
 	TUniquePtr<FMCPToolRegistry> ToolRegistry;
+	TUniquePtr<FMCPToolCallQueue> ToolCallQueue;
 
 	// Protocol layer
 	TUniquePtr<FMCPSessionManager> SessionManager;
+	TUniquePtr<FMCPRateLimiter> RateLimiter;
+	TUniquePtr<FMCPMetrics> Metrics;
 	TUniquePtr<FMCPJsonRpc> JsonRpc;
 	TUniquePtr<FMCPHttpServer> HttpServer;
 };
@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "MCPServerSettings.generated.h"
+
+/** Admission limits of one tool lane */
+USTRUCT()
+struct FMCPToolLaneSettings
+{
+	GENERATED_BODY()
+
+	/** Sustained tools/call rate per session. 0 disables rate limiting for the lane. */
+	UPROPERTY(EditAnywhere, config, Category = "Lane", meta = (ClampMin = "0"))
+	float CallsPerSecond = 0.0f;
+
+	/** Calls a session may make at once before the rate applies */
+	UPROPERTY(EditAnywhere, config, Category = "Lane", meta = (ClampMin = "1"))
+	float Burst = 1.0f;
+
+	/** Calls of the lane waiting in the tool call queue, across all sessions. 0 means no limit. */
+	UPROPERTY(EditAnywhere, config, Category = "Lane", meta = (ClampMin = "0"))
+	int32 MaxQueuedCalls = 0;
+};
+
+/**
+ * MCP Server settings, shown under Project Settings > Plugins > MCP Server.
+ * Read once when the module starts; changes apply after an editor restart.
+ */
+UCLASS(config = Editor, defaultconfig, meta = (DisplayName = "MCP Server"))
+class MCPSERVER_API UMCPServerSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UMCPServerSettings();
+
+	virtual FName GetCategoryName() const override;
+
+	/** Sessions without a request for this many seconds expire. 0 disables expiry. */
+	UPROPERTY(EditAnywhere, config, Category = "Sessions", meta = (ClampMin = "0"))
+	float SessionIdleTimeoutSeconds = 1800.0f;
+
+	/** Live sessions kept at most; the least recently active one is dropped for a new one. 0 means no cap. */
+	UPROPERTY(EditAnywhere, config, Category = "Sessions", meta = (ClampMin = "0"))
+	int32 MaxSessions = 64;
+
+	/** Lookups and single edits; scheduled first */
+	UPROPERTY(EditAnywhere, config, Category = "Rate Limits")
+	FMCPToolLaneSettings InteractiveLane;
+
+	/** Batch tools and pipelines */
+	UPROPERTY(EditAnywhere, config, Category = "Rate Limits")
+	FMCPToolLaneSettings BulkLane;
+
+	/** Lighting, navigation, HLOD and other builds; scheduled last */
+	UPROPERTY(EditAnywhere, config, Category = "Rate Limits")
+	FMCPToolLaneSettings BuildLane;
+};
@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/**
+ * Unreal Insights channel for MCP traffic: request parsing, dispatch, tool execution, module calls and
+ * response serialization. Off by default; enable it with -trace=cpu,mcp or from the Insights channel list.
+ */
+UE_TRACE_CHANNEL_EXTERN(MCPChannel, MCPSERVER_API)
+
+/** CPU timing scope on the MCP channel. Name must be a string literal. */
+#define MCP_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, MCPChannel)
+
+/** CPU timing scope on the MCP channel named at runtime, e.g. by the called tool */
+#define MCP_TRACE_SCOPE_TEXT(Text) TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(Text, MCPChannel)
+
+namespace MCPTrace
+{
+	/** Whether the MCP channel is currently traced */
+	MCPSERVER_API bool IsEnabled();
+
+	/** Session the current thread is working for, empty outside of a request */
+	MCPSERVER_API const FString& GetSessionId();
+
+	/**
+	 * Emit an MCP.ScopeMetadata event for the scope open on this thread: scope name, session ID,
+	 * tool name and argument size, stamped with the cycle counter and thread so Insights can line it
+	 * up with the timing event. Does nothing unless the channel is traced.
+	 */
+	MCPSERVER_API void TraceScopeMetadata(const TCHAR* ScopeName, const FString& ToolName, int64 ArgumentBytes);
+
+	/** Same as above, measuring the arguments as condensed JSON only when the channel is traced */
+	MCPSERVER_API void TraceScopeMetadata(const TCHAR* ScopeName, const FString& ToolName, const TSharedPtr<FJsonObject>& Arguments);
+}
+
+/**
+ * Sets the session the current thread works for until the scope ends, so scopes further down
+ * (tool execution, module calls) are attributed to it. Tool calls carry it through the queue.
+ */
+class MCPSERVER_API FMCPTraceSessionScope
+{
+public:
+	explicit FMCPTraceSessionScope(const FString& SessionId);
+	~FMCPTraceSessionScope();
+
+	FMCPTraceSessionScope(const FMCPTraceSessionScope&) = delete;
+	FMCPTraceSessionScope& operator=(const FMCPTraceSessionScope&) = delete;
+
+private:
+	FString PreviousSessionId;
+	bool bActive = false;
+};
@@ -3,6 +3,8 @@
 
 #include "CoreMinimal.h"
 
+class AActor;
+
 /**
  * Result of an actor spawn operation.
  */
@@ -17,6 +19,51 @@ struct FActorSpawnResult
 	FString ErrorMessage;
 };
 
+/**
+ * One actor to spawn in a batch.
+ */
+struct FActorSpawnBatchItem
+{
+	/** Index into FActorSpawnBatchRequest::ClassPaths */
+	int32 ClassIndex = 0;
+	FTransform Transform = FTransform::Identity;
+};
+
+/**
+ * Actors to spawn in one pass. Each class path is resolved once for the whole batch.
+ */
+struct FActorSpawnBatchRequest
+{
+	TArray<FString> ClassPaths;
+	TArray<FActorSpawnBatchItem> Items;
+	/** If set, actors are labelled "<LabelPrefix>_<item index>" */
+	FString LabelPrefix;
+	/** If set, World Outliner folder for every spawned actor */
+	FString FolderPath;
+};
+
+/**
+ * Failure of a single batch item.
+ */
+struct FActorSpawnBatchError
+{
+	int32 Index = INDEX_NONE;
+	FString ErrorMessage;
+};
+
+/**
+ * Result of a batch spawn. Failed items do not stop the batch.
+ */
+struct FActorSpawnBatchResult
+{
+	bool bSuccess = false;
+	/** Spawned actor name per item, empty for failed items */
+	TArray<FString> ActorNames;
+	int32 SpawnedCount = 0;
+	TArray<FActorSpawnBatchError> Errors;
+	FString ErrorMessage;
+};
+
 /**
  * Result of an actor delete operation.
  */
@@ -53,6 +100,42 @@ struct FActorInfo
 	FString FolderPath;
 };
 
+/**
+ * Fields of FActorInfo filled in by listing operations.
+ */
+enum class EActorInfoFields : uint8
+{
+	None     = 0,
+	Name     = 1 << 0,
+	Label    = 1 << 1,
+	Class    = 1 << 2,
+	Location = 1 << 3,
+	Rotation = 1 << 4,
+	Folder   = 1 << 5,
+	All      = Name | Label | Class | Location | Rotation | Folder
+};
+ENUM_CLASS_FLAGS(EActorInfoFields);
+
+/**
+ * Filters and paging for listing actors.
+ * Filters are evaluated before any per-actor data is gathered.
+ */
+struct FActorQuery
+{
+	/** Class path; only actors of this class or subclasses */
+	FString ClassFilter;
+	/** World Outliner folder; only actors in this folder or its subfolders */
+	FString FolderFilter;
+	/** Only actors whose bounds overlap this box (ignored if not valid) */
+	FBox Bounds = FBox(ForceInit);
+	/** Number of matching actors to skip */
+	int32 Offset = 0;
+	/** Maximum number of actors to return, INDEX_NONE for no limit */
+	int32 Limit = INDEX_NONE;
+	/** Fields to fill in each FActorInfo */
+	EActorInfoFields Fields = EActorInfoFields::All;
+};
+
 /**
  * Result of getting all actors in a level.
  */
@@ -60,6 +143,125 @@ struct FGetActorsResult
 {
 	bool bSuccess = false;
 	TArray<FActorInfo> Actors;
+	/** True if more matching actors exist past this page */
+	bool bHasMore = false;
+	/** Offset of the next page when bHasMore is set */
+	int32 NextOffset = 0;
+	FString ErrorMessage;
+};
+
+/**
+ * Shape of a spatial actor query.
+ */
+enum class EActorSpatialShape : uint8
+{
+	/** Actors whose bounds overlap an axis-aligned box */
+	Box,
+	/** Actors whose bounds overlap a sphere */
+	Sphere,
+	/** Actors whose bounds overlap a camera-style view frustum */
+	Frustum,
+	/** The k actors nearest to a point */
+	Nearest
+};
+
+/**
+ * Spatial query over actor bounds in the editor world.
+ * Only the fields used by the chosen shape are read.
+ */
+struct FActorSpatialQuery
+{
+	EActorSpatialShape Shape = EActorSpatialShape::Box;
+	/** Box: query volume */
+	FBox Box = FBox(ForceInit);
+	/** Sphere and Nearest: query point */
+	FVector Center = FVector::ZeroVector;
+	/** Sphere: query radius */
+	double Radius = 0.0;
+	/** Nearest: number of actors to return */
+	int32 Count = 1;
+	/** Nearest: ignore actors farther than this, 0 for no limit */
+	double MaxDistance = 0.0;
+	/** Frustum: eye position and view direction */
+	FVector Origin = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	/** Frustum: horizontal field of view in degrees */
+	double FieldOfView = 90.0;
+	/** Frustum: width / height */
+	double AspectRatio = 16.0 / 9.0;
+	double NearDistance = 10.0;
+	double FarDistance = 100000.0;
+	/** Class path; only actors of this class or subclasses */
+	FString ClassFilter;
+	/** Maximum number of actors to return, INDEX_NONE for no limit */
+	int32 Limit = INDEX_NONE;
+};
+
+/**
+ * Actor matched by a spatial query.
+ */
+struct FActorSpatialMatch
+{
+	FString ActorName;
+	FString ActorLabel;
+	FString ActorClass;
+	FVector Location = FVector::ZeroVector;
+	/** Distance from the query center (frustum: origin) to the actor bounds */
+	double Distance = 0.0;
+};
+
+/**
+ * Result of a spatial actor query, sorted by distance.
+ */
+struct FActorSpatialQueryResult
+{
+	bool bSuccess = false;
+	TArray<FActorSpatialMatch> Actors;
+	/** Number of matching actors before the limit was applied */
+	int32 TotalMatches = 0;
+	/** True if matches were dropped by the limit */
+	bool bTruncated = false;
+	FString ErrorMessage;
+};
+
+/**
+ * How an actor changed since a level change token.
+ */
+enum class EActorChangeKind : uint8
+{
+	Added,
+	Modified,
+	Removed
+};
+
+/**
+ * Actor added, modified or removed since a level change token.
+ */
+struct FActorChange
+{
+	EActorChangeKind Kind = EActorChangeKind::Modified;
+	FString ActorName;
+	FString ActorLabel;
+	FString ActorClass;
+	/** Current location; zero for removed actors */
+	FVector Location = FVector::ZeroVector;
+};
+
+/**
+ * Result of reading the level change journal.
+ */
+struct FLevelChangesResult
+{
+	bool bSuccess = false;
+	/** Token to pass to the next call */
+	FString Token;
+	/**
+	 * True if the changes since the given token are not known (empty, expired or foreign token, or the level
+	 * was reloaded). Changes is empty and the caller should re-read the level, then continue from Token.
+	 */
+	bool bReset = false;
+	/** One entry per changed actor, in order of its latest change */
+	TArray<FActorChange> Changes;
 	FString ErrorMessage;
 };
 
@@ -109,6 +311,55 @@ struct FActorPropertyResult
 	FString ErrorMessage;
 };
 
+/**
+ * Actors and property paths for a bulk property read.
+ * Explicit identifiers and the filters combine; with no identifiers every actor in the level is a candidate.
+ */
+struct FActorPropertiesBulkQuery
+{
+	/** Actor names, labels or paths; empty to select by the filters alone */
+	TArray<FString> ActorIdentifiers;
+	/** Class path; only actors of this class or subclasses */
+	FString ClassFilter;
+	/** Only actors whose bounds overlap this box (ignored if not valid) */
+	FBox Bounds = FBox(ForceInit);
+	/** Dot-separated paths through struct and object properties, e.g. "RootComponent.RelativeScale3D.X" */
+	TArray<FString> PropertyPaths;
+	/** Number of matching actors to skip */
+	int32 Offset = 0;
+	/** Maximum number of actors to return, INDEX_NONE for no limit */
+	int32 Limit = INDEX_NONE;
+};
+
+/**
+ * One property path read across every returned actor.
+ */
+struct FActorPropertyColumn
+{
+	FString PropertyPath;
+	/** C++ type of the leaf property, from the first actor the path resolved on */
+	FString PropertyType;
+	/** Exported value per actor, unset where the path does not resolve (missing property or null reference) */
+	TArray<TOptional<FString>> Values;
+};
+
+/**
+ * Result of a bulk property read, column-major: Columns[c].Values[r] belongs to ActorNames[r].
+ */
+struct FActorPropertiesBulkResult
+{
+	bool bSuccess = false;
+	TArray<FString> ActorNames;
+	TArray<FActorPropertyColumn> Columns;
+	/** Requested identifiers that matched no actor */
+	TArray<FString> MissingActors;
+	/** True if more matching actors exist past this page */
+	bool bHasMore = false;
+	/** Offset of the next page when bHasMore is set */
+	int32 NextOffset = 0;
+	FString ErrorMessage;
+};
+
 /**
  * Result of setting an actor property.
  */
@@ -160,6 +411,87 @@ struct FSetActorFolderResult
 	FString ErrorMessage;
 };
 
+/**
+ * Static mesh actors to replace with instanced static mesh actors.
+ * Candidates are the named actors, else the selection if bUseSelection is set, else every actor matching the filters.
+ */
+struct FMergeToInstancesRequest
+{
+	TArray<FString> ActorIdentifiers;
+	bool bUseSelection = false;
+	/** World Outliner folder; only actors in this folder or its subfolders */
+	FString FolderFilter;
+	/** Only actors whose bounds overlap this box (ignored if not valid) */
+	FBox Bounds = FBox(ForceInit);
+	/** Create hierarchical instanced components (per-cluster culling and LOD) rather than plain instanced ones */
+	bool bHierarchical = true;
+	/** Groups with fewer actors are left as they are */
+	int32 MinInstances = 2;
+};
+
+/**
+ * One instanced actor created by MergeToInstances.
+ */
+struct FInstanceMergeGroup
+{
+	FString ActorName;
+	FString ActorLabel;
+	FString StaticMeshPath;
+	FString FolderPath;
+	int32 InstanceCount = 0;
+};
+
+/**
+ * Candidate actor left unchanged by MergeToInstances or ExplodeInstances.
+ */
+struct FInstanceMergeSkip
+{
+	FString ActorIdentifier;
+	FString Reason;
+};
+
+/**
+ * Estimated cost of the replaced and the created actors.
+ * Draw calls count LOD0 mesh sections before culling; bytes count actor and component objects plus per-instance data.
+ */
+struct FInstanceMergeStats
+{
+	int32 DrawCallsBefore = 0;
+	int32 DrawCallsAfter = 0;
+	int64 EstimatedBytesBefore = 0;
+	int64 EstimatedBytesAfter = 0;
+};
+
+/**
+ * Result of merging static mesh actors into instanced static mesh actors.
+ */
+struct FMergeToInstancesResult
+{
+	bool bSuccess = false;
+	TArray<FInstanceMergeGroup> Groups;
+	/** Number of static mesh actors replaced by instances */
+	int32 MergedActorCount = 0;
+	/** Named or selected actors that were not merged */
+	TArray<FInstanceMergeSkip> Skipped;
+	FInstanceMergeStats Stats;
+	FString ErrorMessage;
+};
+
+/**
+ * Result of exploding instanced static mesh actors back into static mesh actors.
+ */
+struct FExplodeInstancesResult
+{
+	bool bSuccess = false;
+	/** Static mesh actors spawned, one per instance */
+	TArray<FString> ActorNames;
+	/** Number of instanced actors replaced */
+	int32 ExplodedActorCount = 0;
+	TArray<FInstanceMergeSkip> Skipped;
+	FInstanceMergeStats Stats;
+	FString ErrorMessage;
+};
+
 /**
  * Module interface for actor operations in the editor world.
  * Wraps UE5 editor actor subsystem behind a testable interface.
@@ -181,6 +513,15 @@ public:
 		const FVector& Location,
 		const FRotator& Rotation) = 0;
 
+	/**
+	 * Spawn many actors in the current level in one undo transaction.
+	 * Construction is deferred until every actor is created, and level-wide editor notifications
+	 * (package dirtying, actor list changes, viewport redraws) run once for the whole batch.
+	 * @param Request  Class paths and per-item transforms
+	 * @return         Per-item actor names and failures; bSuccess is false only if the batch could not run
+	 */
+	virtual FActorSpawnBatchResult SpawnActorsBatch(const FActorSpawnBatchRequest& Request) = 0;
+
 	/**
 	 * Delete an actor from the editor world by name/label/path.
 	 * @param ActorIdentifier  Actor name, label, or path (e.g. "StaticMeshActor_0" or "PersistentLevel.StaticMeshActor_0")
@@ -198,8 +539,14 @@ public:
 		const FString& ActorIdentifier,
 		const FVector& Offset) = 0;
 
-	/** Get all actors in the current level. Optional class filter. */
-	virtual FGetActorsResult GetActorsInLevel(const FString& ClassFilter = TEXT("")) = 0;
+	/** Get actors in the current level matching the query, one page at a time. */
+	virtual FGetActorsResult GetActorsInLevel(const FActorQuery& Query = FActorQuery()) = 0;
+
+	/**
+	 * Find actors whose bounds match a box, sphere, frustum or nearest-neighbour query.
+	 * Served from a spatial index of actor bounds, so the cost follows the number of matches rather than the level size.
+	 */
+	virtual FActorSpatialQueryResult QueryActorsSpatial(const FActorSpatialQuery& Query) = 0;
 
 	/** Select actors by identifiers (additive or replace). */
 	virtual FActorSelectionResult SelectActors(const TArray<FString>& ActorIdentifiers, bool bAddToSelection = false) = 0;
@@ -220,6 +567,9 @@ public:
 	/** Get a property value from an actor. */
 	virtual FActorPropertyResult GetActorProperty(const FString& ActorIdentifier, const FString& PropertyName) = 0;
 
+	/** Read several property paths from many actors, resolving each path once per class. */
+	virtual FActorPropertiesBulkResult GetActorPropertiesBulk(const FActorPropertiesBulkQuery& Query) = 0;
+
 	/** Set a property value on an actor. */
 	virtual FActorSetPropertyResult SetActorProperty(const FString& ActorIdentifier, const FString& PropertyName, const FString& PropertyValue) = 0;
 
@@ -234,4 +584,41 @@ public:
 
 	/** Set the folder path for an actor in the World Outliner. */
 	virtual FSetActorFolderResult SetActorFolder(const FString& ActorIdentifier, const FString& FolderPath) = 0;
+
+	/**
+	 * Replace static mesh actors sharing a mesh, material overrides, collision and shadow settings with one
+	 * instanced static mesh actor per level and Outliner folder, in one undo transaction.
+	 * @param Request  Candidate actors and grouping options
+	 * @return         Created instanced actors, skipped candidates and estimated savings
+	 */
+	virtual FMergeToInstancesResult MergeToInstances(const FMergeToInstancesRequest& Request) = 0;
+
+	/**
+	 * Replace instanced static mesh actors with one static mesh actor per instance, in one undo transaction.
+	 * @param ActorIdentifiers  Instanced actors to explode, or empty for the selected actors
+	 * @return                  Spawned actors, skipped candidates and estimated cost change
+	 */
+	virtual FExplodeInstancesResult ExplodeInstances(const TArray<FString>& ActorIdentifiers) = 0;
+
+	/**
+	 * Get the actors added, modified or removed in the editor level since a change token.
+	 * Changes are journaled from editor delegates, so the cost follows the number of changes, not the level size.
+	 * @param SinceToken  Token from a previous call, or empty to only get the current token
+	 * @return            Changes since the token and a new token
+	 */
+	virtual FLevelChangesResult GetLevelChanges(const FString& SinceToken) = 0;
+
+	/**
+	 * Resolve an actor in the editor world by name, label, or path.
+	 * Shared by modules that take actor identifiers so they all use the same lookup.
+	 * @param ActorIdentifier  Actor name, label, or path
+	 * @return                 The actor, or nullptr if not found
+	 */
+	virtual AActor* FindActor(const FString& ActorIdentifier) = 0;
+
+	/** Group the following calls into one undo transaction and defer PostEditChange until EndBatch. */
+	virtual void BeginBatch(const FString& Description) = 0;
+
+	/** Close a batch opened with BeginBatch. */
+	virtual void EndBatch() = 0;
 };
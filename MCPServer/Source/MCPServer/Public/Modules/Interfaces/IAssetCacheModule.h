@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+#include "Templates/Casts.h"
+
+/**
+ * Counters of the resolved-asset cache.
+ */
+struct FAssetCacheStats
+{
+	int64 Hits = 0;
+	int64 Misses = 0;
+	int64 Invalidations = 0;
+	int32 CachedCount = 0;
+};
+
+/**
+ * Interface for resolving asset paths to loaded objects.
+ * Resolved assets are cached so repeated calls against the same asset skip path resolution.
+ */
+class IAssetCacheModule
+{
+public:
+	virtual ~IAssetCacheModule() = default;
+
+	/**
+	 * Resolve an asset path, loading the asset if needed.
+	 * @param AssetPath   Object path of the asset (e.g. /Game/BP_Test.BP_Test)
+	 * @param AssetClass  Required class of the asset
+	 * @return            The asset, or nullptr if it does not exist or is not of AssetClass
+	 */
+	virtual UObject* LoadAsset(const FString& AssetPath, UClass* AssetClass) = 0;
+
+	/** Typed convenience wrapper around LoadAsset. */
+	template<typename T>
+	T* LoadAsset(const FString& AssetPath)
+	{
+		return Cast<T>(LoadAsset(AssetPath, T::StaticClass()));
+	}
+
+	/** Get cache hit/miss counters. */
+	virtual FAssetCacheStats GetStats() const = 0;
+
+	/** Drop all cached entries. */
+	virtual void ClearCache() = 0;
+};
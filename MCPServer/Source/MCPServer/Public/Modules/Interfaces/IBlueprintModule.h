@@ -85,6 +85,7 @@ struct FGraphNodePinInfo
 	FString PinType;
 	FString Direction; // "Input" or "Output"
 	TArray<FString> ConnectedPinIds;
+	TArray<FString> ConnectedNodeIds; // Owning node of each entry in ConnectedPinIds
 };
 
 struct FGraphNodeInfo
@@ -356,4 +357,8 @@ public:
 
 	// Function search
 	virtual FFindFunctionResult FindFunction(const FString& Search, const FString* ClassName, int32 Limit, bool bBlueprintCallableOnly) = 0;
+
+	// Batching: one undo transaction, Blueprint modified notifications deferred until EndBatch
+	virtual void BeginBatch(const FString& Description) = 0;
+	virtual void EndBatch() = 0;
 };
@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Interface for grouping module calls made by batch tools.
+ * An open batch holds one undo transaction and defers per-object finalization
+ * (PostEditChange, material recompiles, Blueprint modified notifications) to its end.
+ */
+class IEditorBatchModule
+{
+public:
+	virtual ~IEditorBatchModule() = default;
+
+	/**
+	 * Open a batch. Batches nest; only the outermost one opens a transaction.
+	 * @param Description  Undo history description
+	 */
+	virtual void BeginBatch(const FString& Description) = 0;
+
+	/** Close the batch. The outermost close runs deferred finalization and ends the transaction. */
+	virtual void EndBatch() = 0;
+
+	/** Whether a batch is currently open. */
+	virtual bool IsBatchActive() const = 0;
+
+	/**
+	 * Run Finalize on Object now, or once at the end of the open batch.
+	 * Deferred calls are deduplicated by Object and Kind and run in first-request order.
+	 */
+	virtual void RunOrDefer(UObject* Object, FName Kind, TFunction<void(UObject*)> Finalize) = 0;
+};
@@ -125,4 +125,8 @@ public:
 	virtual FGetMaterialExpressionsResult GetMaterialExpressions(const FString& MaterialPath) = 0;
 	virtual FGetMaterialExpressionPropertyResult GetMaterialExpressionProperty(const FString& MaterialPath, int32 ExpressionIndex, const FString& PropertyName) = 0;
 	virtual FSetMaterialExpressionPropertyResult SetMaterialExpressionProperty(const FString& MaterialPath, int32 ExpressionIndex, const FString& PropertyName, const FString& PropertyValue) = 0;
+
+	// Batching: one undo transaction, material updates deferred until EndBatch
+	virtual void BeginBatch(const FString& Description) = 0;
+	virtual void EndBatch() = 0;
 };
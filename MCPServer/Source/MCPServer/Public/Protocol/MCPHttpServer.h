@@ -4,19 +4,43 @@
 #include "CoreMinimal.h"
 #include "HttpResultCallback.h"
 #include "HttpRouteHandle.h"
+#include "Containers/Ticker.h"
 
 class IHttpRouter;
 class FMCPJsonRpc;
 class FMCPSessionManager;
+class FMCPMetrics;
+struct FMCPSessionEvent;
+struct FHttpServerResponse;
 
 /**
  * HTTP server wrapper for MCP protocol.
- * Binds POST /mcp and DELETE /mcp routes, delegates message processing to FMCPJsonRpc.
+ * Binds POST, GET and DELETE on /mcp and delegates message processing to FMCPJsonRpc.
+ * POST responses are completed asynchronously once queued tool calls have executed.
+ * tools/list responses carry an ETag and are answered with 304 when If-None-Match matches.
+ *
+ * GET /mcp is the session's server-to-client SSE stream. The UE HTTP server cannot keep a response
+ * open while writing to it, so the stream is served as a long poll: the request is held until the
+ * session has events (or StreamHoldSeconds pass) and then answered with those events, each with an
+ * SSE id. The client reconnects immediately and sends Last-Event-ID to resume.
+ * While a session has a stream open, progress notifications of its tool calls are pushed there as
+ * they happen. Otherwise clients that accept text/event-stream get them, together with pending
+ * session notifications, as SSE events ahead of the POST response.
+ *
+ * POST responses of at least CompressionThresholdBytes are compressed with gzip or deflate when the
+ * client's Accept-Encoding allows it. Compression runs on a worker thread; the response is
+ * completed back on the game thread.
+ *
+ * Requests naming an unknown or expired Mcp-Session-Id are answered with 404, which tells the client
+ * to initialize a new session. Expired sessions are dropped on the same one-second tick as the streams.
+ *
+ * With metrics, GET /metrics serves them in the Prometheus text format together with session gauges.
  */
 class FMCPHttpServer
 {
 public:
-	FMCPHttpServer(FMCPJsonRpc& InJsonRpc, FMCPSessionManager& InSessionManager);
+	FMCPHttpServer(FMCPJsonRpc& InJsonRpc, FMCPSessionManager& InSessionManager, FMCPMetrics* InMetrics = nullptr);
+	~FMCPHttpServer();
 
 	/** Start listening on the given port */
 	void Start(uint32 Port);
@@ -24,17 +48,95 @@ public:
 	/** Stop listening and unbind routes */
 	void Stop();
 
+	/** Compression format (NAME_Gzip or NAME_Zlib) the client accepts, or NAME_None */
+	static FName NegotiateContentEncoding(const struct FHttpServerRequest& Request);
+
+	/** Complete a response, compressing its body off the game thread if it is large enough and an encoding was negotiated */
+	static void CompleteResponse(const FHttpResultCallback& OnComplete, TUniquePtr<FHttpServerResponse> Response, FName ContentEncoding);
+
+	/** Smaller bodies are sent uncompressed; compressing them costs more than it saves */
+	static constexpr int32 CompressionThresholdBytes = 16 * 1024;
+
 private:
 	/** Handle POST /mcp — incoming JSON-RPC messages */
 	bool HandlePostRequest(const struct FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
+	/** Build and send the HTTP response for a processed JSON-RPC message. The UTF-8 body is moved into the response. */
+	static void SendJsonRpcResponse(
+		const FHttpResultCallback& OnComplete,
+		TArray<uint8>&& ResponseBody,
+		const FString& NewSessionId,
+		int32 HttpCode,
+		const FString& ETag = FString(),
+		FName ContentEncoding = NAME_None,
+		int32 RetryAfterSeconds = 0);
+
+	/** Whether the request's If-None-Match header matches the given entity tag */
+	static bool MatchesETag(const struct FHttpServerRequest& Request, const FString& ETag);
+
+	/** Send progress notifications followed by the JSON-RPC response as one SSE body */
+	static void SendEventStreamResponse(
+		const FHttpResultCallback& OnComplete,
+		const TArray<FString>& Notifications,
+		const TArray<uint8>& ResponseBody,
+		const FString& NewSessionId,
+		FName ContentEncoding = NAME_None);
+
 	/** Handle DELETE /mcp — session termination */
 	bool HandleDeleteRequest(const struct FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
+	/** Handle GET /metrics — Prometheus scrape endpoint */
+	bool HandleMetricsRequest(const struct FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** Handle GET /mcp — long-polled SSE stream of session events */
+	bool HandleGetRequest(const struct FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** Answer the session's held stream as soon as an event is queued */
+	void HandleSessionEventQueued(const FString& SessionId);
+
+	/** Answer streams held longer than StreamHoldSeconds with a keepalive and drop expired sessions */
+	bool TickSessions(float DeltaTime);
+
+	/** Close the held stream of a session that expired or was dropped for the session cap */
+	void HandleSessionRemoved(const FString& SessionId);
+
+	/** Answer and forget the session's held stream, if any */
+	void CompleteStream(const FString& SessionId, const TArray<FMCPSessionEvent>& Events);
+
+	/** Answer every held stream and stop listening for session events */
+	void CloseAllStreams();
+
+	/** Send events as an SSE body with ids and a retry hint, or a keepalive comment if there are none */
+	static void SendStreamEvents(const FHttpResultCallback& OnComplete, const TArray<FMCPSessionEvent>& Events);
+
+	/** Whether the request's Accept header includes text/event-stream */
+	static bool AcceptsEventStream(const struct FHttpServerRequest& Request);
+
+	/** How long a GET stream is held without events before it is answered with a keepalive */
+	static constexpr double StreamHoldSeconds = 20.0;
+
+	/** SSE retry hint sent with every stream response */
+	static constexpr int32 StreamRetryMilliseconds = 100;
+
+	struct FOpenStream
+	{
+		FHttpResultCallback OnComplete;
+		double OpenedAt = 0.0;
+	};
+
 	FMCPJsonRpc& JsonRpc;
 	FMCPSessionManager& SessionManager;
+	FMCPMetrics* Metrics;
 
 	TSharedPtr<IHttpRouter> HttpRouter;
 	FHttpRouteHandle PostRouteHandle;
 	FHttpRouteHandle DeleteRouteHandle;
+	FHttpRouteHandle GetRouteHandle;
+	FHttpRouteHandle MetricsRouteHandle;
+
+	/** Held GET streams by session ID */
+	TMap<FString, FOpenStream> OpenStreams;
+	FDelegateHandle EventQueuedHandle;
+	FDelegateHandle SessionRemovedHandle;
+	FTSTicker::FDelegateHandle StreamTickerHandle;
 };
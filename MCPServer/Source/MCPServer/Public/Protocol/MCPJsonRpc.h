@@ -3,18 +3,54 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
 
 class FMCPToolRegistry;
+class FMCPToolCallQueue;
 class FMCPSessionManager;
+class FMCPRateLimiter;
+class FMCPMetrics;
+
+/** Receives the serialized response of an asynchronously processed message */
+using FMCPMessageCompletion = TFunction<void(const FString& Response, const FString& NewSessionId, int32 HttpCode)>;
+
+/**
+ * Receives the condensed UTF-8 response of an asynchronously processed message; the buffer may be moved into the HTTP response.
+ * RetryAfterSeconds is set when tools/call requests were refused by admission control.
+ */
+using FMCPMessageCompletionUtf8 = TFunction<void(TArray<uint8>&& Response, const FString& NewSessionId, int32 HttpCode, int32 RetryAfterSeconds)>;
+
+/** Receives serialized server-to-client notifications (e.g. notifications/progress) produced while a message is processed */
+using FMCPMessageNotification = TFunction<void(const FString& Notification)>;
 
 /**
  * Handles JSON-RPC 2.0 message parsing, serialization, and MCP method dispatch.
  * Delegates tool operations to FMCPToolRegistry and session operations to FMCPSessionManager.
+ * When a tool call queue is provided, tools/call requests processed via ProcessMessageAsync
+ * are executed by the queue and answered once the tool has finished.
+ * Within a batch array, calls to read-only tools (IMCPTool::IsReadOnly) run concurrently on
+ * worker threads while all other messages stay serialized on the game thread. Responses keep
+ * their batch position, but reads are not ordered against writes of the same batch.
+ * A single tools/list request is answered from the registry's cached JSON without re-serializing,
+ * and changes to the tools list are queued to every session as notifications/tools/list_changed.
+ * Messages are parsed and responses written as UTF-8; the FString entry points convert at the edges.
+ * With a rate limiter, tools/call requests are admitted per session and tool lane before dispatch.
+ * Refused calls get a -32000 error with data.retryAfterSeconds; a refused single request is answered with HTTP 429.
+ * With metrics, every answered message is recorded per method, and tools executed here per tool.
  */
 class FMCPJsonRpc
 {
 public:
-	FMCPJsonRpc(FMCPToolRegistry& InToolRegistry, FMCPSessionManager& InSessionManager);
+	FMCPJsonRpc(
+		FMCPToolRegistry& InToolRegistry,
+		FMCPSessionManager& InSessionManager,
+		FMCPToolCallQueue* InToolCallQueue = nullptr,
+		FMCPRateLimiter* InRateLimiter = nullptr,
+		FMCPMetrics* InMetrics = nullptr);
+
+	/** Waits for read-only calls still running on worker threads; their responses are dropped */
+	~FMCPJsonRpc();
 
 	/**
 	 * Process an incoming JSON-RPC message body.
@@ -31,14 +67,125 @@ public:
 		FString& OutNewSessionId,
 		int32& OutHttpCode);
 
+	/**
+	 * Process an incoming JSON-RPC message body without blocking on tool execution.
+	 * Requests other than tools/call are answered immediately; tools/call requests are
+	 * queued and OnProcessed fires once every request in the message has a response.
+	 * Falls back to synchronous processing when no tool call queue is set.
+	 * Requests carrying params._meta.progressToken report notifications/progress through OnNotification.
+	 */
+	void ProcessMessageAsync(
+		const FString& RequestBody,
+		const FString& SessionId,
+		FMCPMessageCompletion OnProcessed,
+		FMCPMessageNotification OnNotification = nullptr);
+
+	/**
+	 * Same as ProcessMessageAsync, for a raw UTF-8 HTTP body.
+	 * The body is parsed in place and only needs to stay valid for the duration of this call.
+	 */
+	void ProcessUtf8MessageAsync(
+		FUtf8StringView RequestBody,
+		const FString& SessionId,
+		FMCPMessageCompletionUtf8 OnProcessed,
+		FMCPMessageNotification OnNotification = nullptr);
+
+	/** Whether the raw UTF-8 body is a single tools/list request (cheap pre-check before parsing) */
+	bool IsToolsListRequest(FUtf8StringView RequestBody) const;
+
+	/** Quoted entity tag of the current tools/list result */
+	const FString& GetToolsListETag() const;
+
 	/** JSON-RPC helpers */
 	static TSharedPtr<FJsonObject> MakeResponse(const TSharedPtr<FJsonValue>& Id, const TSharedPtr<FJsonObject>& Result);
 	static TSharedPtr<FJsonObject> MakeError(const TSharedPtr<FJsonValue>& Id, int32 Code, const FString& Message);
 	static FString SerializeJson(const TSharedPtr<FJsonObject>& JsonObject);
+	static TArray<uint8> SerializeJsonUtf8(const TSharedPtr<FJsonObject>& JsonObject);
+	static TSharedPtr<FJsonObject> MakeProgressNotification(const TSharedPtr<FJsonValue>& ProgressToken, int32 Progress, int32 Total);
 
 private:
 	FMCPToolRegistry& ToolRegistry;
 	FMCPSessionManager& SessionManager;
+	FMCPToolCallQueue* ToolCallQueue;
+	FMCPRateLimiter* RateLimiter;
+	FMCPMetrics* Metrics;
+
+	/** Read-only tool calls currently running on worker threads */
+	FThreadSafeCounter InFlightWorkerCalls;
+
+	/** Cleared on destruction so worker responses that arrive later are not delivered */
+	TSharedRef<FThreadSafeBool> bDeliverWorkerResponses = MakeShared<FThreadSafeBool>(true);
+
+	FDelegateHandle ToolsListChangedHandle;
+
+	/** Queue notifications/tools/list_changed for every session */
+	void HandleToolsListChanged();
+
+	/** Whether a parsed message is a valid tools/list request */
+	static bool IsToolsListMessage(const TSharedPtr<FJsonObject>& Message);
+
+	/** tools/list response built around the registry's cached UTF-8 tools JSON */
+	TArray<uint8> MakeToolsListResponseJson(const TSharedPtr<FJsonValue>& Id) const;
+
+	/** Parse a message body. Returns nullptr if it is not valid JSON. */
+	static TSharedPtr<FJsonValue> ParseMessage(const FString& RequestBody);
+	static TSharedPtr<FJsonValue> ParseMessage(FUtf8StringView RequestBody);
+
+	/** Convert a serialized UTF-8 response for the FString entry points */
+	static FString Utf8ToString(const TArray<uint8>& Utf8);
+
+	/**
+	 * Shared dispatch for the sync and async entry points. A null ParsedValue is answered with a parse error.
+	 * ReceivedAt and RequestBytes describe the body for metrics.
+	 */
+	void ProcessMessageInternal(
+		const TSharedPtr<FJsonValue>& ParsedValue,
+		const FString& SessionId,
+		bool bDeferToolCalls,
+		FMCPMessageCompletionUtf8 OnProcessed,
+		FMCPMessageNotification OnNotification,
+		double ReceivedAt,
+		int64 RequestBytes);
+
+	/** Method a message is recorded under in metrics; unknown methods share one series so clients cannot grow the table */
+	static FString GetMetricsMethodName(const TSharedPtr<FJsonObject>& Message);
+
+	/** Name of the registered tool a tools/call message targets, or empty */
+	FString GetCalledToolName(const TSharedPtr<FJsonObject>& Message) const;
+
+	/** Queue a valid tools/call request. Returns false if the message must be handled inline. */
+	bool TryEnqueueToolsCall(
+		const TSharedPtr<FJsonObject>& Message,
+		const FString& SessionId,
+		TFunction<void(const TSharedPtr<FJsonObject>&)> OnResponse,
+		const FMCPMessageNotification& OnNotification);
+
+	/**
+	 * Check a tools/call request against the rate limiter and lane queue limits. Returns the error response if refused.
+	 * @param AdmittedPerLane  Calls of the same request body admitted so far, indexed by EMCPToolPriority. They are not
+	 *                         queued yet but count toward the lane's queue limit; an admitted call is added to its lane.
+	 */
+	TSharedPtr<FJsonObject> AdmitToolsCall(
+		const TSharedPtr<FJsonObject>& Message,
+		const FString& SessionId,
+		TArrayView<int32> AdmittedPerLane,
+		double& OutRetryAfterSeconds) const;
+
+	/** Whether a message is a valid tools/call to a read-only tool that may run on a worker thread */
+	bool IsReadOnlyToolsCall(const TSharedPtr<FJsonObject>& Message) const;
+
+	/** Validate tools/call params. Returns an error response on failure, nullptr on success. */
+	TSharedPtr<FJsonObject> ValidateToolsCall(
+		const TSharedPtr<FJsonValue>& Id,
+		const TSharedPtr<FJsonObject>& Params,
+		FString& OutToolName,
+		TSharedPtr<FJsonObject>& OutArguments) const;
+
+	/** Wrap a tool result (or a missing one) into a tools/call response */
+	static TSharedPtr<FJsonObject> MakeToolsCallResponse(
+		const TSharedPtr<FJsonValue>& Id,
+		const FString& ToolName,
+		const TSharedPtr<FJsonObject>& ToolResult);
 
 	/** Handle a single JSON-RPC message (request or notification) */
 	void HandleSingleMessage(
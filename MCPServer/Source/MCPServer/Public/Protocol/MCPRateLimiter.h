@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Tools/Interfaces/IMCPTool.h"
+
+/** Admission limits of one tool lane */
+struct FMCPLaneLimits
+{
+	/** Sustained tools/call rate per session. 0 disables rate limiting for the lane. */
+	double CallsPerSecond = 0.0;
+
+	/** Calls a session may make at once before the rate applies */
+	double Burst = 1.0;
+
+	/** Calls of the lane waiting in the tool call queue, across all sessions. 0 means no limit. */
+	int32 MaxQueuedCalls = 0;
+};
+
+/** Limits for every lane, indexed by EMCPToolPriority */
+struct FMCPRateLimits
+{
+	FMCPLaneLimits Lanes[static_cast<int32>(EMCPToolPriority::Num)];
+};
+
+/** Admission counters of one lane */
+struct FMCPLaneAdmissionStats
+{
+	int64 Admitted = 0;
+	int64 RateLimited = 0;
+	int64 QueueFull = 0;
+};
+
+/**
+ * Token buckets for tools/call admission, one per session and tool lane.
+ * Each bucket holds up to Burst tokens and refills at CallsPerSecond; a call takes one token.
+ * Requests without a session share one bucket per lane. Thread-safe.
+ */
+class FMCPRateLimiter
+{
+public:
+	explicit FMCPRateLimiter(const FMCPRateLimits& InLimits = FMCPRateLimits());
+
+	/**
+	 * Take a token for a call in the given lane.
+	 * @param SessionId          Session of the request, empty for sessionless clients
+	 * @param Priority           Lane of the called tool
+	 * @param OutRetryAfterSeconds  When refused, time until the bucket has a token again
+	 * @return                   True if the call may proceed
+	 */
+	bool TryAcquire(const FString& SessionId, EMCPToolPriority Priority, double& OutRetryAfterSeconds);
+
+	/** Count a call refused because its lane's queue was full */
+	void RecordQueueFull(EMCPToolPriority Priority);
+
+	const FMCPLaneLimits& GetLaneLimits(EMCPToolPriority Priority) const;
+
+	/** Snapshot of the admission counters of a lane */
+	FMCPLaneAdmissionStats GetLaneStats(EMCPToolPriority Priority) const;
+
+	/** Buckets are dropped once they have refilled, so the table stays about this large */
+	static constexpr int32 MaxTrackedBuckets = 256;
+
+private:
+	struct FTokenBucket
+	{
+		double Tokens = 0.0;
+		double LastRefillAt = 0.0;
+	};
+
+	/** Bring a bucket up to date. Returns true if it is full again. */
+	static bool Refill(FTokenBucket& Bucket, const FMCPLaneLimits& LaneLimits, double Now);
+
+	/** Drop full buckets; a new bucket starts full, so nothing is lost */
+	void PruneBuckets(double Now);
+
+	FMCPRateLimits Limits;
+
+	mutable FCriticalSection BucketsLock;
+	TMap<TPair<FString, EMCPToolPriority>, FTokenBucket> Buckets;
+	FMCPLaneAdmissionStats LaneStats[static_cast<int32>(EMCPToolPriority::Num)];
+};
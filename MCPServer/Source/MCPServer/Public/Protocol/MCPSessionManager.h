@@ -2,15 +2,65 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "HAL/CriticalSection.h"
+
+/** A server-to-client message queued on a session, numbered for SSE Last-Event-ID resumption */
+struct FMCPSessionEvent
+{
+	uint64 EventId = 0;
+	FString Data;
+};
+
+/** Limits applied to the session table */
+struct FMCPSessionLimits
+{
+	/** Sessions without a request for this long expire. 0 disables expiry. */
+	double IdleTimeoutSeconds = 30.0 * 60.0;
+
+	/** Live sessions kept at most; the least recently active one is dropped for a new one. 0 means no cap. */
+	int32 MaxSessions = 64;
+};
+
+/** Snapshot of one session's state and counters */
+struct FMCPSessionInfo
+{
+	FString SessionId;
+	FString ProtocolVersion;
+	FString ClientName;
+	FString ClientVersion;
+	TSharedPtr<FJsonObject> ClientCapabilities;
+	double CreatedAt = 0.0;
+	double LastActivityAt = 0.0;
+	int64 RequestCount = 0;
+	int64 ToolCallCount = 0;
+	TArray<FString> InFlightRequestIds;
+};
+
+/** Fired with the session ID whenever an event is queued on that session */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMCPSessionEventQueued, const FString& /*SessionId*/);
+
+/** Fired with the session ID when a session expired or was dropped for the session cap */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMCPSessionRemoved, const FString& /*SessionId*/);
 
 /**
  * Manages MCP session lifecycle.
  * Sessions are identified by unique string IDs passed via Mcp-Session-Id header.
+ * Each session keeps an ordered log of server-initiated messages (progress, tools/list_changed)
+ * for the GET /mcp event stream. The newest MaxRetainedEvents stay in the log after delivery,
+ * so a client that reconnects with Last-Event-ID can resume.
+ *
+ * The session table is guarded by a lock, so every method may be called from any thread.
+ * Delegates are broadcast outside the lock. Sessions idle for longer than the configured timeout
+ * are invalid immediately and are dropped by RemoveExpiredSessions, which the HTTP server calls
+ * periodically.
  */
 class FMCPSessionManager
 {
 public:
-	/** Create a new session and return its ID */
+	explicit FMCPSessionManager(const FMCPSessionLimits& InLimits = FMCPSessionLimits());
+
+	/** Create a new session and return its ID. Drops the least recently active session when the cap is reached. */
 	FString CreateSession();
 
 	/** Check if a session ID is valid and active */
@@ -19,6 +69,98 @@ public:
 	/** Remove a session by ID */
 	void RemoveSession(const FString& SessionId);
 
+	/** Record a request on the session. Returns false if the session is unknown or expired. */
+	bool TouchSession(const FString& SessionId);
+
+	/** Store what the client sent with initialize */
+	void SetClientInfo(
+		const FString& SessionId,
+		const FString& ProtocolVersion,
+		const FString& ClientName,
+		const FString& ClientVersion,
+		const TSharedPtr<FJsonObject>& ClientCapabilities);
+
+	/** Count tools/call requests received on the session */
+	void RecordToolCalls(const FString& SessionId, int32 Count);
+
+	/** Track a tools/call request that was queued and not answered yet. Sessions with one do not expire. */
+	void AddInFlightRequest(const FString& SessionId, const FString& RequestId);
+	void RemoveInFlightRequest(const FString& SessionId, const FString& RequestId);
+
+	/** Snapshot of a session, unset if it is unknown or expired */
+	TOptional<FMCPSessionInfo> GetSessionInfo(const FString& SessionId) const;
+
+	/** Number of live sessions, including expired ones not removed yet */
+	int32 GetSessionCount() const;
+
+	/** Remove sessions idle for longer than the timeout and broadcast OnSessionRemoved for each */
+	void RemoveExpiredSessions();
+
+	/** Fired after a session expired or was dropped for the cap; not fired by RemoveSession */
+	FOnMCPSessionRemoved& OnSessionRemoved() { return SessionRemovedDelegate; }
+
+	const FMCPSessionLimits& GetLimits() const { return Limits; }
+
+	/** Queue a serialized notification on one session. Ignored for unknown sessions. */
+	void PushNotification(const FString& SessionId, const FString& Notification);
+
+	/** Queue a serialized notification on every active session */
+	void BroadcastNotification(const FString& Notification);
+
+	/**
+	 * Notifications not yet delivered to a session, oldest first, which are then marked delivered.
+	 * They stay in the event log, so a stream that reconnects with Last-Event-ID can still replay them.
+	 */
+	TArray<FString> TakeNotifications(const FString& SessionId);
+
+	/**
+	 * Events of a session for the event stream, which are then marked delivered.
+	 * @param SessionId    Session to read
+	 * @param LastEventId  Last-Event-ID sent by the client, or unset to get the undelivered events
+	 */
+	TArray<FMCPSessionEvent> GetEventsForStream(const FString& SessionId, TOptional<uint64> LastEventId);
+
+	/** Whether the session has events that were not delivered yet */
+	bool HasUndeliveredEvents(const FString& SessionId) const;
+
+	/** Fired after PushNotification/BroadcastNotification queued an event */
+	FOnMCPSessionEventQueued& OnEventQueued() { return EventQueuedDelegate; }
+
+	/** Events kept per session for Last-Event-ID resumption */
+	static constexpr int32 MaxRetainedEvents = 256;
+
 private:
-	TSet<FString> ActiveSessions;
+	struct FSession
+	{
+		TArray<FMCPSessionEvent> Events;
+		uint64 NextEventId = 1;
+		uint64 DeliveredEventId = 0;
+
+		FString ProtocolVersion;
+		FString ClientName;
+		FString ClientVersion;
+		TSharedPtr<FJsonObject> ClientCapabilities;
+		double CreatedAt = 0.0;
+		double LastActivityAt = 0.0;
+		int64 RequestCount = 0;
+		int64 ToolCallCount = 0;
+		TSet<FString> InFlightRequestIds;
+	};
+
+	/** Append to the session log and trim it to the retention limit */
+	static void AppendEvent(FSession& Session, const FString& Notification);
+
+	/** Session by ID if it exists and has not expired. Caller holds SessionsLock. */
+	FSession* FindLiveSession(const FString& SessionId, double Now);
+	const FSession* FindLiveSession(const FString& SessionId, double Now) const;
+
+	bool IsExpired(const FSession& Session, double Now) const;
+
+	FMCPSessionLimits Limits;
+
+	mutable FCriticalSection SessionsLock;
+	TMap<FString, FSession> ActiveSessions;
+
+	FOnMCPSessionEventQueued EventQueuedDelegate;
+	FOnMCPSessionRemoved SessionRemovedDelegate;
 };
@@ -4,6 +4,33 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 
+class IMCPToolTask;
+
+/** Scheduling lane of a tool call. The tool call queue drains lower lanes first. */
+enum class EMCPToolPriority : uint8
+{
+	/** Lookups and single edits a user is waiting on */
+	Interactive,
+	/** Batch mutations over many objects */
+	Bulk,
+	/** Lighting, navigation, HLOD and other editor-wide builds */
+	Build,
+
+	Num
+};
+
+/** Lowercase lane name used in settings, stats and error messages */
+inline const TCHAR* LexToString(EMCPToolPriority Priority)
+{
+	switch (Priority)
+	{
+	case EMCPToolPriority::Interactive: return TEXT("interactive");
+	case EMCPToolPriority::Bulk: return TEXT("bulk");
+	case EMCPToolPriority::Build: return TEXT("build");
+	default: return TEXT("unknown");
+	}
+}
+
 /**
  * Base interface for all MCP tools.
  * Each tool represents a single callable function exposed to MCP clients.
@@ -28,4 +55,25 @@ public:
 	 * @return           Result object containing "content" array and "isError" flag
 	 */
 	virtual TSharedPtr<FJsonObject> Execute(const TSharedPtr<FJsonObject>& Arguments) = 0;
+
+	/**
+	 * Start an incremental execution that the tool call queue advances in time slices.
+	 * Tools that finish quickly keep the default and are run through Execute.
+	 * @param Arguments  Parsed JSON arguments matching the input schema
+	 * @return           Task for this call, or nullptr to use Execute
+	 */
+	virtual TSharedPtr<IMCPToolTask> StartTask(const TSharedPtr<FJsonObject>& Arguments) { return nullptr; }
+
+	/**
+	 * Whether the tool only reads state through thread-safe engine APIs such as the asset registry.
+	 * Read-only calls in a JSON-RPC batch run concurrently on worker threads.
+	 * Tools that modify the editor or touch UObjects must keep the default.
+	 */
+	virtual bool IsReadOnly() const { return false; }
+
+	/**
+	 * Lane the tool call queue schedules this tool in, also used for per-lane rate limits.
+	 * Batch tools return Bulk and build tools return Build so they never hold up interactive calls.
+	 */
+	virtual EMCPToolPriority GetPriority() const { return EMCPToolPriority::Interactive; }
 };
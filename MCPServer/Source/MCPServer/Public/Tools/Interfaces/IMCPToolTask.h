@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Incremental execution of a single tool call.
+ * Created by IMCPTool::StartTask and advanced by the tool call queue in game thread
+ * time slices, so long-running tools do not stall the editor.
+ */
+class IMCPToolTask
+{
+public:
+	virtual ~IMCPToolTask() = default;
+
+	/**
+	 * Run work until EndTimeSeconds (FPlatformTime::Seconds) is reached.
+	 * Always makes progress on at least one unit of work.
+	 * @return true once the task has finished and GetResult is valid
+	 */
+	virtual bool Tick(double EndTimeSeconds) = 0;
+
+	/** Units of work completed so far */
+	virtual int32 GetProgress() const = 0;
+
+	/** Total units of work, 0 if unknown */
+	virtual int32 GetTotal() const = 0;
+
+	/** Result object in the same format as IMCPTool::Execute. Valid once Tick has returned true. */
+	virtual TSharedPtr<FJsonObject> GetResult() const = 0;
+};
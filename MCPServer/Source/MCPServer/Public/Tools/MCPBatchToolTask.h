@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tools/Interfaces/IMCPToolTask.h"
+
+class FJsonValue;
+
+/**
+ * Tool task that runs a list of independent batch operations.
+ * Any number of operations is accepted; the queue runs as many per tick as fit in its time slice.
+ * Each Tick is wrapped in OnSliceBegin/OnSliceEnd so module batching (one undo transaction,
+ * deferred finalization) covers the operations of that slice and is closed before the tick returns.
+ */
+class FMCPBatchToolTask : public IMCPToolTask
+{
+public:
+	/** Run one operation. Returns false and sets OutError on failure. */
+	using FRunOperation = TFunction<bool(const TSharedPtr<FJsonValue>& Operation, FString& OutError)>;
+
+	/**
+	 * @param InSummaryLabel   Prefix of the result text, e.g. "Batch completed"
+	 * @param InOperations     Operations to run, in order
+	 * @param InRunOperation   Runs a single operation
+	 * @param InOnSliceBegin   Called before the operations of each Tick
+	 * @param InOnSliceEnd     Called after the operations of each Tick
+	 */
+	FMCPBatchToolTask(
+		const FString& InSummaryLabel,
+		const TArray<TSharedPtr<FJsonValue>>& InOperations,
+		FRunOperation InRunOperation,
+		TFunction<void()> InOnSliceBegin = nullptr,
+		TFunction<void()> InOnSliceEnd = nullptr);
+
+	/** Task that has already finished with the given result, used for argument errors */
+	static TSharedPtr<IMCPToolTask> MakeFinished(const TSharedPtr<FJsonObject>& Result);
+
+	/** Run a task to completion in a single slice and return its result */
+	static TSharedPtr<FJsonObject> RunToCompletion(const TSharedPtr<IMCPToolTask>& Task);
+
+	virtual bool Tick(double EndTimeSeconds) override;
+	virtual int32 GetProgress() const override;
+	virtual int32 GetTotal() const override;
+	virtual TSharedPtr<FJsonObject> GetResult() const override;
+
+	/** Errors beyond this count are tallied but not listed in the result text */
+	static constexpr int32 MaxListedErrors = 100;
+
+private:
+	void BuildResult();
+
+	FString SummaryLabel;
+	TArray<TSharedPtr<FJsonValue>> Operations;
+	FRunOperation RunOperation;
+	TFunction<void()> OnSliceBegin;
+	TFunction<void()> OnSliceEnd;
+
+	int32 NextIndex = 0;
+	int32 Succeeded = 0;
+	int32 Failed = 0;
+	TArray<FString> Errors;
+	TSharedPtr<FJsonObject> Result;
+};
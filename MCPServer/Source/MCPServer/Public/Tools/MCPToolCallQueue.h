@@ -0,0 +1,130 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Containers/Deque.h"
+#include "Containers/Ticker.h"
+#include "Tools/Interfaces/IMCPTool.h"
+
+class FMCPToolRegistry;
+class FMCPMetrics;
+class IMCPToolTask;
+
+/**
+ * Per-tool counters collected by the tool call queue.
+ */
+struct FMCPToolQueueStats
+{
+	int32 QueueDepth = 0;
+	int64 CompletedCount = 0;
+	double TotalWaitSeconds = 0.0;
+	double MaxWaitSeconds = 0.0;
+	double TotalExecuteSeconds = 0.0;
+	double MaxExecuteSeconds = 0.0;
+};
+
+/** Called on the game thread with the tool result (nullptr if the tool was not found) */
+using FMCPToolCallCompletion = TFunction<void(const TSharedPtr<FJsonObject>& ToolResult)>;
+
+/** Called on the game thread after each time slice of an incremental tool call */
+using FMCPToolCallProgress = TFunction<void(int32 Progress, int32 Total)>;
+
+/**
+ * Queue of pending tools/call invocations.
+ * Calls are executed on the game thread from a core ticker, a time slice per tick,
+ * so the HTTP handler can return immediately and cheap requests are never blocked
+ * behind heavy tools waiting in the queue.
+ * Tools that provide an IMCPToolTask keep running across ticks: newly queued calls are
+ * started first, and the rest of each slice is shared between the running tasks.
+ * Queued calls wait in one lane per IMCPTool::GetPriority. Interactive calls are started before
+ * bulk calls, and bulk calls before builds; calls within a lane keep their order.
+ * A mutating bulk call that runs as a task holds the bulk lane until it finishes, so the next mutating
+ * bulk call waits instead of interleaving with it slice by slice and bulk edits apply in request order.
+ * With metrics, every completed call is recorded with its queue wait and execution time.
+ */
+class FMCPToolCallQueue
+{
+public:
+	explicit FMCPToolCallQueue(FMCPToolRegistry& InToolRegistry, FMCPMetrics* InMetrics = nullptr, double InTimeSliceSeconds = 0.008);
+	~FMCPToolCallQueue();
+
+	/** Start draining the queue from the core ticker */
+	void Start();
+
+	/** Stop ticking and drop all pending calls and running tasks without completing them */
+	void Stop();
+
+	/**
+	 * Add a tool call to the queue. OnComplete fires once the tool has executed.
+	 * OnProgress fires after each slice of an incremental call and is never called for Execute-only tools.
+	 */
+	void Enqueue(
+		const FString& ToolName,
+		const TSharedPtr<FJsonObject>& Arguments,
+		FMCPToolCallCompletion OnComplete,
+		FMCPToolCallProgress OnProgress = nullptr);
+
+	/**
+	 * Execute queued calls and advance running tasks until the time budget is spent.
+	 * At least one queued call is started, unless all are held behind a running bulk task, and every
+	 * running task advances at least once.
+	 * @return Number of calls completed
+	 */
+	int32 ProcessQueue(double TimeBudgetSeconds);
+
+	/** Number of calls waiting to execute or still running as tasks */
+	int32 GetQueueDepth() const;
+
+	/** Number of calls of a lane waiting to be started */
+	int32 GetPendingCount(EMCPToolPriority Priority) const;
+
+	/** Number of incremental calls started but not yet finished */
+	int32 GetActiveTaskCount() const;
+
+	/** Snapshot of per-tool queue statistics */
+	TMap<FString, FMCPToolQueueStats> GetToolStats() const;
+
+private:
+	struct FQueuedToolCall
+	{
+		FString ToolName;
+		TSharedPtr<FJsonObject> Arguments;
+		FMCPToolCallCompletion OnComplete;
+		FMCPToolCallProgress OnProgress;
+		TSharedPtr<IMCPToolTask> Task;
+		double EnqueueTime = 0.0;
+		double WaitSeconds = 0.0;
+		double ExecuteSeconds = 0.0;
+		int32 ReportedProgress = -1;
+		/** Mutating bulk call: waits while another one runs as a task, and holds the bulk lane while it runs as one */
+		bool bHoldsBulkLane = false;
+
+		/** Session the call was queued for, restored while it runs so trace scopes are attributed to it */
+		FString TraceSessionId;
+	};
+
+	bool Tick(float DeltaTime);
+
+	/** Highest priority lane with a call that can start now, or nullptr if there is none */
+	TDeque<FQueuedToolCall>* FindNextLane();
+
+	/** Report task progress if it changed since the last slice */
+	static void ReportProgress(FQueuedToolCall& Call);
+
+	/** Record statistics and fire the completion callback */
+	void CompleteCall(FQueuedToolCall& Call, const TSharedPtr<FJsonObject>& ToolResult);
+
+	FMCPToolRegistry& ToolRegistry;
+	FMCPMetrics* Metrics;
+	double TimeSliceSeconds;
+
+	/** Calls not started yet, one lane per EMCPToolPriority */
+	TDeque<FQueuedToolCall> PendingCalls[static_cast<int32>(EMCPToolPriority::Num)];
+	TDeque<FQueuedToolCall> ActiveTasks;
+	/** Running tasks that hold the bulk lane */
+	int32 BulkLaneHolders = 0;
+	TMap<FString, FMCPToolQueueStats> ToolStats;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
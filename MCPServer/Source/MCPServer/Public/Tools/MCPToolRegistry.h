@@ -5,11 +5,14 @@
 #include "Dom/JsonObject.h"
 
 class IMCPTool;
+class IMCPToolTask;
+enum class EMCPToolPriority : uint8;
 
 /**
  * Registry for MCP tools.
  * Manages tool registration, listing, and dispatch.
- * Does not hold any state — tools are stateless functions.
+ * Tools are stateless functions; the only state held here is the tools/list cache,
+ * which is built on first use and invalidated by RegisterTool.
  */
 class FMCPToolRegistry
 {
@@ -18,14 +21,42 @@ public:
 	void RegisterTool(TSharedPtr<IMCPTool> Tool);
 
 	/** Get JSON array of all registered tools for tools/list response */
-	TArray<TSharedPtr<FJsonValue>> GetToolsList() const;
+	const TArray<TSharedPtr<FJsonValue>>& GetToolsList() const;
+
+	/** The tools/list array serialized as condensed UTF-8 JSON, ready to be spliced into a response body */
+	const TArray<uint8>& GetToolsListJson() const;
+
+	/** Quoted entity tag of the current tools list, used for HTTP ETag/If-None-Match */
+	const FString& GetToolsListETag() const;
+
+	/** Broadcast after RegisterTool has changed the tools list */
+	FSimpleMulticastDelegate& OnToolsListChanged() { return ToolsListChangedDelegate; }
 
 	/** Call a tool by name. Returns the result content object, or nullptr if tool not found */
 	TSharedPtr<FJsonObject> CallTool(const FString& ToolName, const TSharedPtr<FJsonObject>& Arguments) const;
 
+	/** Start an incremental call. Returns nullptr if the tool is not found or runs only through Execute */
+	TSharedPtr<IMCPToolTask> StartToolTask(const FString& ToolName, const TSharedPtr<FJsonObject>& Arguments) const;
+
 	/** Check if a tool exists */
 	bool HasTool(const FString& ToolName) const;
 
+	/** Check if a tool exists and is safe to call from worker threads (IMCPTool::IsReadOnly) */
+	bool IsReadOnlyTool(const FString& ToolName) const;
+
+	/** Scheduling lane of a tool (IMCPTool::GetPriority). Interactive for unknown tools. */
+	EMCPToolPriority GetToolPriority(const FString& ToolName) const;
+
 private:
+	/** Rebuild the cached tools list, its JSON and ETag if RegisterTool invalidated them */
+	void BuildToolsListCache() const;
+
 	TMap<FString, TSharedPtr<IMCPTool>> Tools;
+
+	mutable bool bToolsListCacheValid = false;
+	mutable TArray<TSharedPtr<FJsonValue>> CachedToolsList;
+	mutable TArray<uint8> CachedToolsListJson;
+	mutable FString CachedToolsListETag;
+
+	FSimpleMulticastDelegate ToolsListChangedDelegate;
 };
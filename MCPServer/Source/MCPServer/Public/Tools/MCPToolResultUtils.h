@@ -0,0 +1,39 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/**
+ * Result and schema helpers shared by tools that return structured output.
+ */
+namespace MCPToolResultUtils
+{
+	/** Error result with Message as its only text content */
+	TSharedPtr<FJsonObject> MakeErrorResult(const FString& Message);
+
+	/**
+	 * Result carrying Structured as structuredContent. The text content carries the same data as
+	 * condensed JSON for clients without structuredContent.
+	 */
+	TSharedPtr<FJsonObject> MakeStructuredResult(const TSharedPtr<FJsonObject>& Structured, bool bIsError = false);
+
+	/** Read an {x, y, z} object. Returns false if a component is missing. */
+	bool ParseVector(const TSharedPtr<FJsonObject>& VectorObj, FVector& OutVector);
+
+	/** Read the {x, y, z} object field FieldName of Arguments. Returns false if it is missing or incomplete. */
+	bool ParseVectorField(const TSharedPtr<FJsonObject>& Arguments, const FString& FieldName, FVector& OutVector);
+
+	/** Schema of an untitled number */
+	TSharedPtr<FJsonObject> MakeNumberProp();
+
+	/** Schema of an {x, y, z} object; the description is omitted when empty */
+	TSharedPtr<FJsonObject> MakeVectorProp(const FString& Description = FString());
+
+	/** Schema of a Type value with a description */
+	TSharedPtr<FJsonObject> MakeDescribedProp(const FString& Type, const FString& Description);
+
+	/** Schema of an array of ItemType values with a description */
+	TSharedPtr<FJsonObject> MakeArrayProp(const FString& ItemType, const FString& Description);
+}